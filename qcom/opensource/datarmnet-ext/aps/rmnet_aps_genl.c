@@ -15,7 +15,8 @@
 static struct nla_policy DATARMNET157d4c7a8a[DATARMNET3b044438b9+
 (0xd26+209-0xdf6)]={[DATARMNET98b93f2e86]=NLA_POLICY_EXACT_LEN(sizeof(struct 
 DATARMNET5d4139d9d7)),[DATARMNET818a0b6438]=NLA_POLICY_EXACT_LEN(sizeof(struct 
-DATARMNETca79857d4a)),};
+DATARMNETca79857d4a)),[DATARMNET0a87733e03]={.type=NLA_BINARY,.len=
+(0xbf7+4364-0x1c04)*sizeof(struct DATARMNET5d4139d9d7)},};
 #define DATARMNET7dc6237681(DATARMNET5aeb0ef9bc, DATARMNETbd9859b58e)\
                                          \
 	{                                                                      \
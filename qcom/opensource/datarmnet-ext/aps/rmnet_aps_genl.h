@@ -16,7 +16,8 @@
 #define DATARMNET33d1a3e23a (0xd26+209-0xdf6)
 #define DATARMNETa4a6e34e45 "\x52\x4d\x4e\x45\x54\x5f\x41\x50\x53"
 enum{DATARMNETeafde44f15,DATARMNET15437be67e,DATARMNET4ac82df478,};enum{
-DATARMNET900754429d,DATARMNET98b93f2e86,DATARMNET818a0b6438,DATARMNET074e71007e,
+DATARMNET900754429d,DATARMNET98b93f2e86,DATARMNET818a0b6438,DATARMNET0a87733e03,
+DATARMNET074e71007e,
 };
 #define DATARMNET3b044438b9 (DATARMNET074e71007e - (0xd26+209-0xdf6))
 int DATARMNETcfa8d492f8(void);void DATARMNETca7606cfd1(void);
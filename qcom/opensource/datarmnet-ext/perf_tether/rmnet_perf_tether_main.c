@@ -26,15 +26,42 @@ configure_knob1,uint,(0xdb7+6665-0x261c));unsigned int knob1 __read_mostly=
 (0xd2d+202-0xdf7);module_param(knob1,uint,(0xdb7+6665-0x261c));unsigned int 
 configure_knob2 __read_mostly=(0xd2d+202-0xdf7);module_param(configure_knob2,
 uint,(0xdb7+6665-0x261c));unsigned int knob2 __read_mostly=(0xd2d+202-0xdf7);
-module_param(knob2,uint,(0xdb7+6665-0x261c));static DEFINE_SPINLOCK(
-DATARMNETcf56327171);
+module_param(knob2,uint,(0xdb7+6665-0x261c));unsigned int configure_knob3 
+__read_mostly=(0xd2d+202-0xdf7);module_param(configure_knob3,uint,
+(0xdb7+6665-0x261c));unsigned int knob3 __read_mostly=(0xd2d+202-0xdf7);
+module_param(knob3,uint,(0xdb7+6665-0x261c));unsigned int configure_knob4 
+__read_mostly=(0xd2d+202-0xdf7);module_param(configure_knob4,uint,
+(0xdb7+6665-0x261c));static DEFINE_SPINLOCK(DATARMNETcf56327171);
 #define DATARMNETd063f2edce ((0xef7+1112-0x131d))
-#define DATARMNET4c845df513 \
-	(const_ilog2(DATARMNETd063f2edce))
+#define DATARMNET4c845df513 (const_ilog2(DATARMNETd063f2edce))
+#define DATARMNET399c8aafc8 ((0xd35+210-0xdff))
 static DEFINE_HASHTABLE(DATARMNET031f18e039,DATARMNET4c845df513);struct 
 DATARMNETb477d446e7{struct list_head list;struct hlist_node hlist;u32 hash;
-__be32 DATARMNETdfd47b00ff[(0xd20+231-0xdfc)];u32 DATARMNET4b119c4ff3;};struct 
-list_head DATARMNETc588a190d4=LIST_HEAD_INIT(DATARMNETc588a190d4);
+__be32 DATARMNETdfd47b00ff[(0xd20+231-0xdfc)];u32 DATARMNET4b119c4ff3;bool 
+DATARMNET01e953e5c5;struct rcu_head rcu;};struct list_head DATARMNETc588a190d4=
+LIST_HEAD_INIT(DATARMNETc588a190d4);static u32 DATARMNET521945f978;enum{
+DATARMNET699e8f154a,DATARMNET6ce2b88a74,DATARMNET3bc899a3b4,DATARMNET44e38d4822,
+DATARMNET912ced0ed7,DATARMNET744a48db73,DATARMNET2cbc6b6b13,DATARMNET696e99142a,
+DATARMNET929ee482ba,DATARMNET9c17c24234,DATARMNET751334b7de,};struct 
+DATARMNET94aed7331c{u32 DATARMNET7d8a6c5b80[DATARMNET399c8aafc8];unsigned long 
+DATARMNET95b9ff7d5c[DATARMNET399c8aafc8];u8 DATARMNETab0546f8ee;u64 
+DATARMNETae6eb5bb18[DATARMNET751334b7de];};static DEFINE_PER_CPU(struct 
+DATARMNET94aed7331c,DATARMNET94aed7331c);static int DATARMNET013275179a(char*
+DATARMNETe823dcf978,const struct kernel_param*DATARMNETb983bfb8f5){int 
+DATARMNETae0201901a,DATARMNET39d1646248,DATARMNETd9157bb956=(0xd2d+202-0xdf7);
+for(DATARMNETae0201901a=(0xd2d+202-0xdf7);DATARMNETae0201901a<
+DATARMNET751334b7de;DATARMNETae0201901a++){u64 DATARMNETbe3bf3fb92=
+(0xd2d+202-0xdf7);for_each_possible_cpu(DATARMNET39d1646248)DATARMNETbe3bf3fb92
++=per_cpu(DATARMNET94aed7331c,DATARMNET39d1646248).DATARMNETae6eb5bb18[
+DATARMNETae0201901a];DATARMNETd9157bb956+=scnprintf(DATARMNETe823dcf978+
+DATARMNETd9157bb956,PAGE_SIZE-DATARMNETd9157bb956,"\x25\x73\x25\x6c\x6c\x75",
+DATARMNETae0201901a?"\x2c":"",DATARMNETbe3bf3fb92);}DATARMNETd9157bb956+=
+scnprintf(DATARMNETe823dcf978+DATARMNETd9157bb956,PAGE_SIZE-DATARMNETd9157bb956,
+"\x0a");return DATARMNETd9157bb956;}static const struct kernel_param_ops 
+DATARMNET03cc1a1e07={.get=DATARMNET013275179a,};module_param_cb(
+rmnet_perf_tether_stats,&DATARMNET03cc1a1e07,NULL,(0xcb7+5769-0x221c));static 
+inline void DATARMNET868118e561(u32 DATARMNET868118e561){this_cpu_inc(
+DATARMNET94aed7331c.DATARMNETae6eb5bb18[DATARMNET868118e561]);}
 #define DATARMNETc99cb98651 ((0xd26+209-0xdf6))
 #define DATARMNETfc6d4bac8a ((0xd19+238-0xdfb))
 #define DATARMNETc152fdcc34 ((0xec7+1129-0x1315))
@@ -71,56 +98,86 @@ DATARMNET543491eb0f)->nexthdr;DATARMNETdfd47b00ff[9]=tcp_hdr(DATARMNET543491eb0f
 source;DATARMNET5ebf661879=(0xd20+231-0xdfc);}else{goto DATARMNET1d7e728ddf;}*
 DATARMNET76bafbc6ce=(0xd26+209-0xdf6);return jhash2(DATARMNETdfd47b00ff,
 DATARMNET5ebf661879,(0xd2d+202-0xdf7));DATARMNET1d7e728ddf:*DATARMNET76bafbc6ce=
-(0xd2d+202-0xdf7);return(0xd2d+202-0xdf7);}static void DATARMNET9d42c8a184(
-struct tcphdr*DATARMNET2e7cc88971){if(DATARMNET2e7cc88971->syn&&
-DATARMNET2e7cc88971->ack){if(configure_knob1){if(knob1>65535)knob1=65535;
-DATARMNET2e7cc88971->window=cpu_to_be16(knob1);}if(configure_knob2){unsigned 
-char*DATARMNET7b34b7b5be;u32 DATARMNET539d2ad3f2;if(knob2>TCP_MAX_WSCALE)knob2=
-TCP_MAX_WSCALE;DATARMNET539d2ad3f2=DATARMNET2e7cc88971->doff*(0xd11+230-0xdf3)-
-sizeof(struct tcphdr);DATARMNET7b34b7b5be=(unsigned char*)(DATARMNET2e7cc88971+
-(0xd26+209-0xdf6));while(DATARMNET539d2ad3f2>(0xd2d+202-0xdf7)){int 
-DATARMNET969cfb9094=*DATARMNET7b34b7b5be++;int DATARMNET68a21637e9;switch(
-DATARMNET969cfb9094){case TCPOPT_EOL:return;case TCPOPT_NOP:DATARMNET539d2ad3f2
---;continue;default:if(DATARMNET539d2ad3f2<(0xd1f+216-0xdf5))return;
-DATARMNET68a21637e9=*DATARMNET7b34b7b5be++;if(DATARMNET68a21637e9<
-(0xd1f+216-0xdf5))return;if(DATARMNET68a21637e9>DATARMNET539d2ad3f2)return;if(
-DATARMNET969cfb9094==TCPOPT_WINDOW)*DATARMNET7b34b7b5be=knob2;
+(0xd2d+202-0xdf7);return(0xd2d+202-0xdf7);}struct DATARMNETe42f85c148{u8 
+DATARMNETde9ed76e1c;u8 DATARMNETd9157bb956;u8 DATARMNET868118e561;unsigned int*
+DATARMNETe15931f248;bool(*DATARMNET2867d7f785)(unsigned char*DATARMNET7b34b7b5be
+);};static bool DATARMNETde8ec60432(unsigned char*DATARMNET7b34b7b5be){u8 
+DATARMNET1539a07226=min_t(unsigned int,READ_ONCE(knob2),TCP_MAX_WSCALE);if(*
+DATARMNET7b34b7b5be==DATARMNET1539a07226)return false;*DATARMNET7b34b7b5be=
+DATARMNET1539a07226;return true;}static bool DATARMNETe86615f7d0(unsigned char*
+DATARMNET7b34b7b5be){u16 DATARMNET1539a07226=min_t(unsigned int,READ_ONCE(knob3)
+,65535);if(!DATARMNET1539a07226||get_unaligned_be16(DATARMNET7b34b7b5be)<=
+DATARMNET1539a07226)return false;put_unaligned_be16(DATARMNET1539a07226,
+DATARMNET7b34b7b5be);return true;}static bool DATARMNET203e662373(unsigned char*
+DATARMNET7b34b7b5be){DATARMNET7b34b7b5be[-(0xd1f+216-0xdf5)]=TCPOPT_NOP;
+DATARMNET7b34b7b5be[-(0xd26+209-0xdf6)]=TCPOPT_NOP;return true;}static const 
+struct DATARMNETe42f85c148 DATARMNET649ce86d1c[]={{TCPOPT_WINDOW,TCPOLEN_WINDOW,
+DATARMNET2cbc6b6b13,&configure_knob2,DATARMNETde8ec60432},{TCPOPT_MSS,
+TCPOLEN_MSS,DATARMNET696e99142a,&configure_knob3,DATARMNETe86615f7d0},{
+TCPOPT_SACK_PERM,TCPOLEN_SACK_PERM,DATARMNET929ee482ba,&configure_knob4,
+DATARMNET203e662373},};static void DATARMNET9d42c8a184(struct tcphdr*
+DATARMNET2e7cc88971){unsigned char*DATARMNET7b34b7b5be;u32 DATARMNET539d2ad3f2;
+int DATARMNETae0201901a;if(!DATARMNET2e7cc88971->syn||!DATARMNET2e7cc88971->ack)
+return;if(READ_ONCE(configure_knob1)){DATARMNET2e7cc88971->window=cpu_to_be16(
+min_t(unsigned int,READ_ONCE(knob1),65535));DATARMNET868118e561(
+DATARMNET744a48db73);}DATARMNET539d2ad3f2=DATARMNET2e7cc88971->doff*
+(0xd11+230-0xdf3)-sizeof(struct tcphdr);DATARMNET7b34b7b5be=(unsigned char*)(
+DATARMNET2e7cc88971+(0xd26+209-0xdf6));while(DATARMNET539d2ad3f2>
+(0xd2d+202-0xdf7)){int DATARMNET969cfb9094=*DATARMNET7b34b7b5be++;int 
+DATARMNET68a21637e9;switch(DATARMNET969cfb9094){case TCPOPT_EOL:return;case 
+TCPOPT_NOP:DATARMNET539d2ad3f2--;continue;default:if(DATARMNET539d2ad3f2<
+(0xd1f+216-0xdf5))return;DATARMNET68a21637e9=*DATARMNET7b34b7b5be++;if(
+DATARMNET68a21637e9<(0xd1f+216-0xdf5))return;if(DATARMNET68a21637e9>
+DATARMNET539d2ad3f2)return;for(DATARMNETae0201901a=(0xd2d+202-0xdf7);
+DATARMNETae0201901a<ARRAY_SIZE(DATARMNET649ce86d1c);DATARMNETae0201901a++){const 
+struct DATARMNETe42f85c148*DATARMNET1f945fa5c9=&DATARMNET649ce86d1c[
+DATARMNETae0201901a];if(DATARMNET1f945fa5c9->DATARMNETde9ed76e1c!=
+DATARMNET969cfb9094)continue;if(DATARMNET1f945fa5c9->DATARMNETd9157bb956==
+DATARMNET68a21637e9&&READ_ONCE(*DATARMNET1f945fa5c9->DATARMNETe15931f248)&&
+DATARMNET1f945fa5c9->DATARMNET2867d7f785(DATARMNET7b34b7b5be))
+DATARMNET868118e561(DATARMNET1f945fa5c9->DATARMNET868118e561);break;}
 DATARMNET7b34b7b5be+=DATARMNET68a21637e9-(0xd1f+216-0xdf5);DATARMNET539d2ad3f2-=
-DATARMNET68a21637e9;}}}}}static int DATARMNET94d0b7e790(struct 
-DATARMNETb477d446e7*DATARMNET63b1a086d5,struct sk_buff*DATARMNET543491eb0f){if(
-DATARMNET543491eb0f->protocol==htons(ETH_P_IP)){if((DATARMNET63b1a086d5->
-DATARMNETdfd47b00ff[(0xd2d+202-0xdf7)]==ip_hdr(DATARMNET543491eb0f)->saddr)&&(
-DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd26+209-0xdf6)]==ip_hdr(
-DATARMNET543491eb0f)->daddr)&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
-(0xd1f+216-0xdf5)]==ip_hdr(DATARMNET543491eb0f)->protocol)&&(DATARMNET63b1a086d5
-->DATARMNETdfd47b00ff[(0xd18+223-0xdf4)]==tcp_hdr(DATARMNET543491eb0f)->source)
-&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd11+230-0xdf3)]==tcp_hdr(
-DATARMNET543491eb0f)->dest)&&(DATARMNET63b1a086d5->DATARMNET4b119c4ff3==
-(0xd0a+237-0xdf2)))return(0xd2d+202-0xdf7);}else if(DATARMNET543491eb0f->
-protocol==htons(ETH_P_IPV6)){if((!memcmp(&DATARMNET63b1a086d5->
-DATARMNETdfd47b00ff[(0xd2d+202-0xdf7)],ipv6_hdr(DATARMNET543491eb0f)->saddr.
-s6_addr,sizeof(struct in6_addr)))&&(!memcmp(&DATARMNET63b1a086d5->
-DATARMNETdfd47b00ff[(0xd0a+237-0xdf2)],ipv6_hdr(DATARMNET543491eb0f)->daddr.
-s6_addr,sizeof(struct in6_addr)))&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
-(0xd35+210-0xdff)]==ipv6_hdr(DATARMNET543491eb0f)->nexthdr)&&(
-DATARMNET63b1a086d5->DATARMNETdfd47b00ff[9]==tcp_hdr(DATARMNET543491eb0f)->
-source)&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd27+224-0xdfd)]==tcp_hdr(
-DATARMNET543491eb0f)->dest)&&(DATARMNET63b1a086d5->DATARMNET4b119c4ff3==
-(0xd20+231-0xdfc)))return(0xd2d+202-0xdf7);}return(0xd26+209-0xdf6);}void 
+DATARMNET68a21637e9;}}}static int DATARMNET94d0b7e790(struct DATARMNETb477d446e7
+*DATARMNET63b1a086d5,struct sk_buff*DATARMNET543491eb0f){if(DATARMNET543491eb0f
+->protocol==htons(ETH_P_IP)){if((DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
+(0xd2d+202-0xdf7)]==ip_hdr(DATARMNET543491eb0f)->saddr)&&(DATARMNET63b1a086d5->
+DATARMNETdfd47b00ff[(0xd26+209-0xdf6)]==ip_hdr(DATARMNET543491eb0f)->daddr)&&(
+DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd1f+216-0xdf5)]==ip_hdr(
+DATARMNET543491eb0f)->protocol)&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
+(0xd18+223-0xdf4)]==tcp_hdr(DATARMNET543491eb0f)->source)&&(DATARMNET63b1a086d5
+->DATARMNETdfd47b00ff[(0xd11+230-0xdf3)]==tcp_hdr(DATARMNET543491eb0f)->dest)&&(
+DATARMNET63b1a086d5->DATARMNET4b119c4ff3==(0xd0a+237-0xdf2)))return
+(0xd2d+202-0xdf7);}else if(DATARMNET543491eb0f->protocol==htons(ETH_P_IPV6)){if(
+(!memcmp(&DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd2d+202-0xdf7)],ipv6_hdr(
+DATARMNET543491eb0f)->saddr.s6_addr,sizeof(struct in6_addr)))&&(!memcmp(&
+DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd0a+237-0xdf2)],ipv6_hdr(
+DATARMNET543491eb0f)->daddr.s6_addr,sizeof(struct in6_addr)))&&(
+DATARMNET63b1a086d5->DATARMNETdfd47b00ff[(0xd35+210-0xdff)]==ipv6_hdr(
+DATARMNET543491eb0f)->nexthdr)&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff[9]==
+tcp_hdr(DATARMNET543491eb0f)->source)&&(DATARMNET63b1a086d5->DATARMNETdfd47b00ff
+[(0xd27+224-0xdfd)]==tcp_hdr(DATARMNET543491eb0f)->dest)&&(DATARMNET63b1a086d5->
+DATARMNET4b119c4ff3==(0xd20+231-0xdfc)))return(0xd2d+202-0xdf7);}return
+(0xd26+209-0xdf6);}static void DATARMNET82b5d38214(struct DATARMNETb477d446e7*
+DATARMNET63b1a086d5){DATARMNET63b1a086d5->DATARMNET01e953e5c5=true;hash_del_rcu(
+&DATARMNET63b1a086d5->hlist);list_del(&DATARMNET63b1a086d5->list);
+DATARMNET521945f978--;kfree_rcu(DATARMNET63b1a086d5,rcu);}void 
 DATARMNETe70d5ec61a(struct tcphdr*DATARMNET2e7cc88971,struct sk_buff*
-DATARMNET543491eb0f){int DATARMNET76bafbc6ce=(0xd2d+202-0xdf7);u32 hash;unsigned
- long DATARMNETfb0677cc3c;struct DATARMNETb477d446e7*DATARMNET63b1a086d5,*
-DATARMNET0386f6f82a=NULL;if(!configure_knob1&&!configure_knob2)return;hash=
-DATARMNET233bccd449(DATARMNET543491eb0f,&DATARMNET76bafbc6ce,(0xd26+209-0xdf6),
-(0xd2d+202-0xdf7));if(!DATARMNET76bafbc6ce)return;spin_lock_irqsave(&
-DATARMNETcf56327171,DATARMNETfb0677cc3c);hash_for_each_possible(
-DATARMNET031f18e039,DATARMNET63b1a086d5,hlist,hash){if(!DATARMNET94d0b7e790(
-DATARMNET63b1a086d5,DATARMNET543491eb0f)){DATARMNET0386f6f82a=
-DATARMNET63b1a086d5;break;}DATARMNET0386f6f82a=NULL;}if(!DATARMNET0386f6f82a){
-spin_unlock_irqrestore(&DATARMNETcf56327171,DATARMNETfb0677cc3c);return;}if(
-DATARMNET63b1a086d5){hash_del(&DATARMNET63b1a086d5->hlist);list_add_tail(&
-DATARMNET63b1a086d5->list,&DATARMNETc588a190d4);}spin_unlock_irqrestore(&
-DATARMNETcf56327171,DATARMNETfb0677cc3c);DATARMNET9d42c8a184(DATARMNET2e7cc88971
+DATARMNET543491eb0f){int DATARMNET76bafbc6ce=(0xd2d+202-0xdf7);u32 hash;unsigned 
+long DATARMNETfb0677cc3c;bool DATARMNETe66174a066=false;struct 
+DATARMNETb477d446e7*DATARMNET63b1a086d5,*DATARMNET0386f6f82a=NULL;if(!READ_ONCE(
+configure_knob1)&&!READ_ONCE(configure_knob2)&&!READ_ONCE(configure_knob3)&&!
+READ_ONCE(configure_knob4))return;hash=DATARMNET233bccd449(DATARMNET543491eb0f,&
+DATARMNET76bafbc6ce,(0xd26+209-0xdf6),(0xd2d+202-0xdf7));if(!DATARMNET76bafbc6ce
+)return;rcu_read_lock();hash_for_each_possible_rcu(DATARMNET031f18e039,
+DATARMNET63b1a086d5,hlist,hash){if(DATARMNET63b1a086d5->hash==hash&&!
+DATARMNET94d0b7e790(DATARMNET63b1a086d5,DATARMNET543491eb0f)){
+DATARMNET0386f6f82a=DATARMNET63b1a086d5;break;}}if(DATARMNET0386f6f82a){
+spin_lock_irqsave(&DATARMNETcf56327171,DATARMNETfb0677cc3c);if(!
+DATARMNET0386f6f82a->DATARMNET01e953e5c5){DATARMNET82b5d38214(
+DATARMNET0386f6f82a);DATARMNETe66174a066=true;}spin_unlock_irqrestore(&
+DATARMNETcf56327171,DATARMNETfb0677cc3c);}rcu_read_unlock();if(!
+DATARMNETe66174a066){DATARMNET868118e561(DATARMNET912ced0ed7);return;}
+DATARMNET868118e561(DATARMNET44e38d4822);DATARMNET9d42c8a184(DATARMNET2e7cc88971
 );}static void DATARMNET9eb31df630(struct DATARMNETb477d446e7*
 DATARMNET63b1a086d5,struct sk_buff*DATARMNET543491eb0f){if(DATARMNET543491eb0f->
 protocol==htons(ETH_P_IP)){DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
@@ -139,33 +196,43 @@ s6_addr,sizeof(struct in6_addr));DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
 (0xd35+210-0xdff)]=ipv6_hdr(DATARMNET543491eb0f)->nexthdr;DATARMNET63b1a086d5->
 DATARMNETdfd47b00ff[9]=tcp_hdr(DATARMNET543491eb0f)->dest;DATARMNET63b1a086d5->
 DATARMNETdfd47b00ff[(0xd27+224-0xdfd)]=tcp_hdr(DATARMNET543491eb0f)->source;
-DATARMNET63b1a086d5->DATARMNET4b119c4ff3=(0xd20+231-0xdfc);}}void 
-DATARMNET6ab362e985(struct sk_buff*DATARMNET543491eb0f){int DATARMNET76bafbc6ce=
-(0xd2d+202-0xdf7);u32 hash;unsigned long DATARMNETfb0677cc3c;struct 
-DATARMNETb477d446e7*DATARMNET63b1a086d5;struct hlist_node*DATARMNET0386f6f82a;
-int DATARMNETae0201901a;struct net_device*dev;if(!configure_knob1&&!
-configure_knob2)return;if(!DATARMNET543491eb0f->skb_iif)return;dev=
-__dev_get_by_index(&init_net,DATARMNET543491eb0f->skb_iif);if(!dev)return;hash=
-DATARMNET233bccd449(DATARMNET543491eb0f,&DATARMNET76bafbc6ce,(0xd2d+202-0xdf7),
-(0xd26+209-0xdf6));if(!DATARMNET76bafbc6ce)return;spin_lock_irqsave(&
-DATARMNETcf56327171,DATARMNETfb0677cc3c);DATARMNET63b1a086d5=
-list_first_entry_or_null(&DATARMNETc588a190d4,struct DATARMNETb477d446e7,list);
-if(DATARMNET63b1a086d5){list_del(&DATARMNET63b1a086d5->list);DATARMNET63b1a086d5
-->hash=hash;DATARMNET9eb31df630(DATARMNET63b1a086d5,DATARMNET543491eb0f);
-hash_add(DATARMNET031f18e039,&DATARMNET63b1a086d5->hlist,DATARMNET63b1a086d5->
-hash);}else{hash_for_each_safe(DATARMNET031f18e039,DATARMNETae0201901a,
-DATARMNET0386f6f82a,DATARMNET63b1a086d5,hlist){hash_del(&DATARMNET63b1a086d5->
-hlist);DATARMNET63b1a086d5->hash=hash;DATARMNET9eb31df630(DATARMNET63b1a086d5,
-DATARMNET543491eb0f);hash_add(DATARMNET031f18e039,&DATARMNET63b1a086d5->hlist,
-DATARMNET63b1a086d5->hash);break;}}spin_unlock_irqrestore(&DATARMNETcf56327171,
-DATARMNETfb0677cc3c);}void DATARMNET136e008d70(u8 DATARMNET07b1a05079,u64 
-DATARMNETcc6099cb14){struct net_device*dev=dev_get_by_name(&init_net,
-"rmnet_ipa0");struct sk_buff*DATARMNET543491eb0f;if(!dev)return;if(
-DATARMNET07b1a05079==DATARMNETc99cb98651){struct 
-rmnet_map_control_command_header*DATARMNETb87c07b92a;struct DATARMNETb0eda9d28e*
-DATARMNETcd32395e82;struct rmnet_map_header*DATARMNETf937c77d8f;
-DATARMNET543491eb0f=alloc_skb((0xeb7+1158-0x132d),GFP_ATOMIC);if(!
-DATARMNET543491eb0f)goto DATARMNETaabe3a05f8;skb_put(DATARMNET543491eb0f,
+DATARMNET63b1a086d5->DATARMNET4b119c4ff3=(0xd20+231-0xdfc);}}static bool 
+DATARMNET7d8a6c5b80(u32 hash){struct DATARMNET94aed7331c*DATARMNET2e7f98db93=
+this_cpu_ptr(&DATARMNET94aed7331c);int DATARMNETae0201901a;for(
+DATARMNETae0201901a=(0xd2d+202-0xdf7);DATARMNETae0201901a<DATARMNET399c8aafc8;
+DATARMNETae0201901a++){if(DATARMNET2e7f98db93->DATARMNET7d8a6c5b80[
+DATARMNETae0201901a]==hash&&time_before(jiffies,DATARMNET2e7f98db93->
+DATARMNET95b9ff7d5c[DATARMNETae0201901a]+HZ))return true;}DATARMNETae0201901a=
+DATARMNET2e7f98db93->DATARMNETab0546f8ee++%DATARMNET399c8aafc8;
+DATARMNET2e7f98db93->DATARMNET7d8a6c5b80[DATARMNETae0201901a]=hash;
+DATARMNET2e7f98db93->DATARMNET95b9ff7d5c[DATARMNETae0201901a]=jiffies;return 
+false;}void DATARMNET6ab362e985(struct sk_buff*DATARMNET543491eb0f){int 
+DATARMNET76bafbc6ce=(0xd2d+202-0xdf7);u32 hash;unsigned long DATARMNETfb0677cc3c
+;struct DATARMNETb477d446e7*DATARMNET63b1a086d5;struct net_device*dev;if(!
+READ_ONCE(configure_knob1)&&!READ_ONCE(configure_knob2)&&!READ_ONCE(
+configure_knob3)&&!READ_ONCE(configure_knob4))return;if(!DATARMNET543491eb0f->
+skb_iif)return;dev=__dev_get_by_index(&init_net,DATARMNET543491eb0f->skb_iif);if
+(!dev)return;hash=DATARMNET233bccd449(DATARMNET543491eb0f,&DATARMNET76bafbc6ce,
+(0xd2d+202-0xdf7),(0xd26+209-0xdf6));if(!DATARMNET76bafbc6ce)return;if(
+DATARMNET7d8a6c5b80(hash)){DATARMNET868118e561(DATARMNET6ce2b88a74);return;}
+DATARMNET63b1a086d5=kzalloc(sizeof(*DATARMNET63b1a086d5),GFP_ATOMIC);if(!
+DATARMNET63b1a086d5){DATARMNET868118e561(DATARMNET9c17c24234);return;}
+DATARMNET63b1a086d5->hash=hash;DATARMNET9eb31df630(DATARMNET63b1a086d5,
+DATARMNET543491eb0f);spin_lock_irqsave(&DATARMNETcf56327171,DATARMNETfb0677cc3c)
+;if(DATARMNET521945f978>=DATARMNETd063f2edce){DATARMNET82b5d38214(
+list_first_entry(&DATARMNETc588a190d4,struct DATARMNETb477d446e7,list));
+DATARMNET868118e561(DATARMNET3bc899a3b4);}hash_add_rcu(DATARMNET031f18e039,&
+DATARMNET63b1a086d5->hlist,DATARMNET63b1a086d5->hash);list_add_tail(&
+DATARMNET63b1a086d5->list,&DATARMNETc588a190d4);DATARMNET521945f978++;
+spin_unlock_irqrestore(&DATARMNETcf56327171,DATARMNETfb0677cc3c);
+DATARMNET868118e561(DATARMNET699e8f154a);}void DATARMNET136e008d70(u8 
+DATARMNET07b1a05079,u64 DATARMNETcc6099cb14){struct net_device*dev=
+dev_get_by_name(&init_net,"\x72\x6d\x6e\x65\x74\x5f\x69\x70\x61\x30");struct 
+sk_buff*DATARMNET543491eb0f;if(!dev)return;if(DATARMNET07b1a05079==
+DATARMNETc99cb98651){struct rmnet_map_control_command_header*DATARMNETb87c07b92a
+;struct DATARMNETb0eda9d28e*DATARMNETcd32395e82;struct rmnet_map_header*
+DATARMNETf937c77d8f;DATARMNET543491eb0f=alloc_skb((0xeb7+1158-0x132d),GFP_ATOMIC
+);if(!DATARMNET543491eb0f)goto DATARMNETaabe3a05f8;skb_put(DATARMNET543491eb0f,
 (0xeb7+1158-0x132d));memset(DATARMNET543491eb0f->data,(0xd2d+202-0xdf7),
 (0xeb7+1158-0x132d));DATARMNETf937c77d8f=(struct rmnet_map_header*)
 DATARMNET543491eb0f->data;DATARMNETf937c77d8f->cd_bit=(0xd26+209-0xdf6);
@@ -183,27 +250,19 @@ rmnet_perf_tether_egress_hook,DATARMNET6ab362e985);rcu_assign_pointer(
 rmnet_perf_tether_cmd_hook,DATARMNET136e008d70);}void DATARMNET229327cbd2(void){
 rcu_assign_pointer(rmnet_perf_tether_ingress_hook,NULL);rcu_assign_pointer(
 rmnet_perf_tether_egress_hook,NULL);rcu_assign_pointer(
-rmnet_perf_tether_cmd_hook,NULL);}static int DATARMNETaa549ce89a(void){int 
-DATARMNETefc9df3df2;DATARMNET8a1e9920bf=kzalloc(sizeof(*DATARMNET8a1e9920bf),
-GFP_KERNEL);if(!DATARMNET8a1e9920bf){pr_err(
-"\x25\x73\x28\x29\x3a\x20\x52\x65\x73\x6f\x75\x72\x63\x65\x20\x61\x6c\x6c\x6f\x63\x61\x74\x69\x6f\x6e\x20\x66\x61\x69\x6c\x65\x64" "\n"
-,__func__);return-(0xd26+209-0xdf6);}DATARMNET8a1e9920bf->DATARMNETd0ef85194f++;
-for(DATARMNETefc9df3df2=(0xd2d+202-0xdf7);DATARMNETefc9df3df2<
-DATARMNETd063f2edce;DATARMNETefc9df3df2++){struct DATARMNETb477d446e7*
-DATARMNET63b1a086d5;DATARMNET63b1a086d5=kzalloc(sizeof(*DATARMNET63b1a086d5),
-GFP_ATOMIC);if(!DATARMNET63b1a086d5)continue;INIT_LIST_HEAD(&DATARMNET63b1a086d5
-->list);INIT_HLIST_NODE(&DATARMNET63b1a086d5->hlist);list_add_tail(&
-DATARMNET63b1a086d5->list,&DATARMNETc588a190d4);}DATARMNET5fe3ffe2ab();return
-(0xd2d+202-0xdf7);}static void DATARMNET2b8220b2f3(void){struct 
-DATARMNETb477d446e7*DATARMNET63b1a086d5;struct hlist_node*DATARMNET0386f6f82a;
-int DATARMNETae0201901a;hash_for_each_safe(DATARMNET031f18e039,
-DATARMNETae0201901a,DATARMNET0386f6f82a,DATARMNET63b1a086d5,hlist){hash_del(&
-DATARMNET63b1a086d5->hlist);kfree(DATARMNET63b1a086d5);}}static void 
-DATARMNET66219231cc(void){struct DATARMNETb477d446e7*DATARMNET63b1a086d5,*
-DATARMNET2133db01db;list_for_each_entry_safe(DATARMNET63b1a086d5,
-DATARMNET2133db01db,&DATARMNETc588a190d4,list){list_del(&DATARMNET63b1a086d5->
-list);kfree(DATARMNET63b1a086d5);}}static void DATARMNET3ece352201(void){
-DATARMNET229327cbd2();DATARMNET66219231cc();DATARMNET2b8220b2f3();kfree(
+rmnet_perf_tether_cmd_hook,NULL);}static int DATARMNETaa549ce89a(void){
+DATARMNET8a1e9920bf=kzalloc(sizeof(*DATARMNET8a1e9920bf),GFP_KERNEL);if(!
+DATARMNET8a1e9920bf){pr_err(
+"\x25\x73\x28\x29\x3a\x20\x52\x65\x73\x6f\x75\x72\x63\x65\x20\x61\x6c\x6c\x6f\x63\x61\x74\x69\x6f\x6e\x20\x66\x61\x69\x6c\x65\x64" 
+"\x0a",__func__);return-(0xd26+209-0xdf6);}DATARMNET8a1e9920bf->
+DATARMNETd0ef85194f++;DATARMNET5fe3ffe2ab();return(0xd2d+202-0xdf7);}static void 
+DATARMNET2b8220b2f3(void){struct DATARMNETb477d446e7*DATARMNET63b1a086d5,*
+DATARMNET2133db01db;unsigned long DATARMNETfb0677cc3c;spin_lock_irqsave(&
+DATARMNETcf56327171,DATARMNETfb0677cc3c);list_for_each_entry_safe(
+DATARMNET63b1a086d5,DATARMNET2133db01db,&DATARMNETc588a190d4,list)
+DATARMNET82b5d38214(DATARMNET63b1a086d5);spin_unlock_irqrestore(&
+DATARMNETcf56327171,DATARMNETfb0677cc3c);}static void DATARMNET3ece352201(void){
+DATARMNET229327cbd2();synchronize_rcu();DATARMNET2b8220b2f3();kfree(
 DATARMNET8a1e9920bf);DATARMNET8a1e9920bf=NULL;}static int DATARMNET6e31e62d2e(
 struct notifier_block*DATARMNET272c159b3c,unsigned long DATARMNET4abd997295,void
 *DATARMNET3f254bae11){struct net_device*DATARMNET00dcb79bc4=
@@ -213,21 +272,21 @@ DATARMNET272c159b3c;if(!DATARMNET00dcb79bc4||strncmp(DATARMNET00dcb79bc4->name,
 DATARMNETaabe3a05f8;switch(DATARMNET4abd997295){case NETDEV_REGISTER:if(
 DATARMNET8a1e9920bf){DATARMNET8a1e9920bf->DATARMNETd0ef85194f++;goto 
 DATARMNETaabe3a05f8;}pr_info(
-"\x25\x73\x28\x29\x3a\x20\x49\x6e\x69\x74\x69\x61\x6c\x69\x7a\x69\x6e\x67\x20\x6f\x6e\x20\x64\x65\x76\x69\x63\x65\x20\x25\x73" "\n"
-,__func__,DATARMNET00dcb79bc4->name);DATARMNETb14e52a504=DATARMNETaa549ce89a();
-if(DATARMNETb14e52a504){pr_err(
-"\x25\x73\x28\x29\x3a\x20\x49\x6e\x69\x74\x69\x61\x6c\x69\x7a\x61\x74\x69\x6f\x6e\x20\x66\x61\x69\x6c\x65\x64" "\n"
-,__func__);goto DATARMNETaabe3a05f8;}break;case NETDEV_UNREGISTER:if(!
+"\x25\x73\x28\x29\x3a\x20\x49\x6e\x69\x74\x69\x61\x6c\x69\x7a\x69\x6e\x67\x20\x6f\x6e\x20\x64\x65\x76\x69\x63\x65\x20\x25\x73" 
+"\x0a",__func__,DATARMNET00dcb79bc4->name);DATARMNETb14e52a504=
+DATARMNETaa549ce89a();if(DATARMNETb14e52a504){pr_err(
+"\x25\x73\x28\x29\x3a\x20\x49\x6e\x69\x74\x69\x61\x6c\x69\x7a\x61\x74\x69\x6f\x6e\x20\x66\x61\x69\x6c\x65\x64" 
+"\x0a",__func__);goto DATARMNETaabe3a05f8;}break;case NETDEV_UNREGISTER:if(!
 DATARMNET8a1e9920bf)goto DATARMNETaabe3a05f8;if(--DATARMNET8a1e9920bf->
 DATARMNETd0ef85194f)goto DATARMNETaabe3a05f8;pr_info(
-"\x25\x73\x28\x29\x3a\x20\x55\x6e\x69\x6e\x69\x74\x69\x61\x6c\x69\x7a\x69\x6e\x67\x20\x6f\x6e\x20\x64\x65\x76\x69\x63\x65\x20\x25\x73" "\n"
-,__func__,DATARMNET00dcb79bc4->name);DATARMNET3ece352201();break;}
+"\x25\x73\x28\x29\x3a\x20\x55\x6e\x69\x6e\x69\x74\x69\x61\x6c\x69\x7a\x69\x6e\x67\x20\x6f\x6e\x20\x64\x65\x76\x69\x63\x65\x20\x25\x73" 
+"\x0a",__func__,DATARMNET00dcb79bc4->name);DATARMNET3ece352201();break;}
 DATARMNETaabe3a05f8:return NOTIFY_DONE;}static struct notifier_block 
 DATARMNETd9d8382fca={.notifier_call=DATARMNET6e31e62d2e,.priority=
 (0xd18+223-0xdf4),};static int __init DATARMNET5e4be08a32(void){pr_info(
-"\x25\x73\x28\x29\x3a\x20\x4c\x6f\x61\x64\x69\x6e\x67" "\n",__func__);return 
+"\x25\x73\x28\x29\x3a\x20\x4c\x6f\x61\x64\x69\x6e\x67" "\x0a",__func__);return 
 register_netdevice_notifier(&DATARMNETd9d8382fca);}static void __exit 
 DATARMNET50e3d76d94(void){pr_info(
-"\x25\x73\x28\x29\x3a\x20\x65\x78\x69\x74\x69\x6e\x67" "\n",__func__);
-unregister_netdevice_notifier(&DATARMNETd9d8382fca);}module_init(
+"\x25\x73\x28\x29\x3a\x20\x65\x78\x69\x74\x69\x6e\x67" "\x0a",__func__);
+unregister_netdevice_notifier(&DATARMNETd9d8382fca);rcu_barrier();}module_init(
 DATARMNET5e4be08a32);module_exit(DATARMNET50e3d76d94);
@@ -18,89 +18,155 @@
 #include <linux/skbuff.h>
 #include <linux/rtnetlink.h>
 #include <net/pkt_sched.h>
+#include <net/codel.h>
+#include <net/codel_impl.h>
+#include <net/codel_qdisc.h>
 static char*verinfo[]={"\x37\x34\x31\x35\x39\x32\x31\x63",
 "\x61\x65\x32\x34\x34\x61\x39\x64"};module_param_array(verinfo,charp,NULL,
 (0xcb7+5769-0x221c));MODULE_PARM_DESC(verinfo,
 "\x56\x65\x72\x73\x69\x6f\x6e\x20\x6f\x66\x20\x74\x68\x65\x20\x64\x72\x69\x76\x65\x72"
 );static const char*DATARMNETf1bb41174a="\x31\x2e\x30";
 #define DATARMNETe632b2e0b0 (0xd11+230-0xdf3)
+#define DATARMNET0c40784392 (0xeb7+1174-0x132d)
 static const u8 DATARMNET93bdeed8cb[TC_PRIO_MAX+(0xd26+209-0xdf6)]={
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd2d+202-0xdf7),(0xd26+209-0xdf6),
 (0xd1f+216-0xdf5),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4)};static 
-const int DATARMNET91bbdde74c[DATARMNETe632b2e0b0]={(0xbf7+4421-0x1c3c)*
-(0xdf7+2629-0x143c),(0xef7+694-0x112d)*(0xdf7+2629-0x143c),(0xef7+1142-0x132d)*
-(0xdf7+2629-0x143c),(0xeb7+1174-0x132d)*(0xdf7+2629-0x143c)};static const int 
-DATARMNET9dd1382d86[DATARMNETe632b2e0b0]={(0xd35+210-0xdff),(0xd03+244-0xdf1),
-(0xd11+230-0xdf3),(0xd1f+216-0xdf5)};struct DATARMNET74e95d25df{struct 
-qdisc_skb_head DATARMNETb4180393e4[DATARMNETe632b2e0b0];int DATARMNET1de7b3d891[
-DATARMNETe632b2e0b0];int DATARMNETf9afebb887[DATARMNETe632b2e0b0];};static int 
+const int DATARMNET9dd1382d86[DATARMNETe632b2e0b0]={(0xd35+210-0xdff),
+(0xd03+244-0xdf1),(0xd11+230-0xdf3),(0xd1f+216-0xdf5)};static const u32 
+DATARMNET3b24a9b14d[DATARMNETe632b2e0b0]={(0xc78+4948-0x17fc),
+(0xd5d+5691-0x17e0),(0x25f8+1428-0x1804),(0x25f8+1428-0x1804)};struct 
+DATARMNET02d70ac2da{struct sk_buff*head;struct sk_buff*tail;struct list_head 
+DATARMNET0a9669c24a;int DATARMNET28d0ee46be;struct codel_vars 
+DATARMNETa8820b1ef0;};struct DATARMNET1f218fbe9f{struct list_head 
+DATARMNETc56f4447b1;struct list_head DATARMNET390794bda1;struct list_head 
+DATARMNETda69ecf253;int DATARMNET28d0ee46be;struct codel_params 
+DATARMNET442ea3ba38;struct DATARMNET02d70ac2da DATARMNET68fc6778b0[
+DATARMNET0c40784392];};struct DATARMNET74e95d25df{struct DATARMNET1f218fbe9f 
+DATARMNETb4180393e4[DATARMNETe632b2e0b0];struct list_head DATARMNET67914d31ed;
+struct codel_stats DATARMNET09c1afd72b;u32 DATARMNETe222772431;};static int 
 DATARMNET3a797cc4e9(struct sk_buff*DATARMNET543491eb0f,struct Qdisc*
 DATARMNET9b0193c8c4,struct sk_buff**DATARMNET6af05df5b3){struct 
-DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);unsigned
- int DATARMNET5affe290b8=qdisc_pkt_len(DATARMNET543491eb0f);struct 
-qdisc_skb_head*q;if(likely(DATARMNET9b0193c8c4->q.qlen<qdisc_dev(
-DATARMNET9b0193c8c4)->tx_queue_len)){q=&DATARMNETe823dcf978->DATARMNETb4180393e4
-[DATARMNET93bdeed8cb[DATARMNET543491eb0f->priority&TC_PRIO_MAX]];
-__qdisc_enqueue_tail(DATARMNET543491eb0f,q);qdisc_update_stats_at_enqueue(
-DATARMNET9b0193c8c4,DATARMNET5affe290b8);return NET_XMIT_SUCCESS;}return 
-qdisc_drop(DATARMNET543491eb0f,DATARMNET9b0193c8c4,DATARMNET6af05df5b3);}static 
-u8 DATARMNETf9ac3daa83(struct DATARMNET74e95d25df*DATARMNETe823dcf978){int 
-DATARMNET2372d14a3d,DATARMNET70fa801d65=DATARMNETe632b2e0b0;for(
+DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);unsigned 
+int DATARMNET5affe290b8=qdisc_pkt_len(DATARMNET543491eb0f);struct 
+DATARMNET1f218fbe9f*DATARMNET1f218fbe9f;struct DATARMNET02d70ac2da*
+DATARMNET02d70ac2da;u8 DATARMNET2372d14a3d;if(unlikely(DATARMNET9b0193c8c4->q.
+qlen>=qdisc_dev(DATARMNET9b0193c8c4)->tx_queue_len))return qdisc_drop(
+DATARMNET543491eb0f,DATARMNET9b0193c8c4,DATARMNET6af05df5b3);DATARMNET2372d14a3d
+=DATARMNET93bdeed8cb[DATARMNET543491eb0f->priority&TC_PRIO_MAX];
+DATARMNET1f218fbe9f=&DATARMNETe823dcf978->DATARMNETb4180393e4[
+DATARMNET2372d14a3d];DATARMNET02d70ac2da=&DATARMNET1f218fbe9f->
+DATARMNET68fc6778b0[reciprocal_scale(skb_get_hash(DATARMNET543491eb0f),
+DATARMNET0c40784392)];codel_set_enqueue_time(DATARMNET543491eb0f);
+DATARMNET543491eb0f->next=NULL;if(!DATARMNET02d70ac2da->head)DATARMNET02d70ac2da
+->head=DATARMNET543491eb0f;else DATARMNET02d70ac2da->tail->next=
+DATARMNET543491eb0f;DATARMNET02d70ac2da->tail=DATARMNET543491eb0f;if(list_empty(
+&DATARMNET02d70ac2da->DATARMNET0a9669c24a)){list_add_tail(&DATARMNET02d70ac2da->
+DATARMNET0a9669c24a,&DATARMNET1f218fbe9f->DATARMNETc56f4447b1);
+DATARMNET02d70ac2da->DATARMNET28d0ee46be=DATARMNETe823dcf978->
+DATARMNETe222772431;}if(list_empty(&DATARMNET1f218fbe9f->DATARMNETda69ecf253)){
+list_add_tail(&DATARMNET1f218fbe9f->DATARMNETda69ecf253,&DATARMNETe823dcf978->
+DATARMNET67914d31ed);DATARMNET1f218fbe9f->DATARMNET28d0ee46be=
+DATARMNET9dd1382d86[DATARMNET2372d14a3d]*DATARMNETe823dcf978->
+DATARMNETe222772431;}qdisc_update_stats_at_enqueue(DATARMNET9b0193c8c4,
+DATARMNET5affe290b8);return NET_XMIT_SUCCESS;}static struct sk_buff*
+DATARMNET013e29aee5(struct codel_vars*DATARMNETa8820b1ef0,void*
+DATARMNET8d09f3578d){struct Qdisc*DATARMNET9b0193c8c4=DATARMNET8d09f3578d;struct 
+DATARMNET02d70ac2da*DATARMNET02d70ac2da=container_of(DATARMNETa8820b1ef0,struct 
+DATARMNET02d70ac2da,DATARMNETa8820b1ef0);struct sk_buff*DATARMNET543491eb0f=
+DATARMNET02d70ac2da->head;if(DATARMNET543491eb0f){DATARMNET02d70ac2da->head=
+DATARMNET543491eb0f->next;skb_mark_not_on_list(DATARMNET543491eb0f);
+qdisc_qstats_backlog_dec(DATARMNET9b0193c8c4,DATARMNET543491eb0f);
+DATARMNET9b0193c8c4->q.qlen--;}return DATARMNET543491eb0f;}static void 
+DATARMNETff223b7f1c(struct sk_buff*DATARMNET543491eb0f,void*DATARMNET8d09f3578d)
+{struct Qdisc*DATARMNET9b0193c8c4=DATARMNET8d09f3578d;kfree_skb(
+DATARMNET543491eb0f);qdisc_qstats_drop(DATARMNET9b0193c8c4);}static struct 
+sk_buff*DATARMNETf9ac3daa83(struct Qdisc*DATARMNET9b0193c8c4,struct 
+DATARMNET1f218fbe9f*DATARMNET1f218fbe9f){struct DATARMNET74e95d25df*
+DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);struct DATARMNET02d70ac2da*
+DATARMNET02d70ac2da;struct list_head*head;struct sk_buff*DATARMNET543491eb0f;
+DATARMNET85e1e75096:head=&DATARMNET1f218fbe9f->DATARMNETc56f4447b1;if(list_empty
+(head)){head=&DATARMNET1f218fbe9f->DATARMNET390794bda1;if(list_empty(head))
+return NULL;}DATARMNET02d70ac2da=list_first_entry(head,struct 
+DATARMNET02d70ac2da,DATARMNET0a9669c24a);if(DATARMNET02d70ac2da->
+DATARMNET28d0ee46be<=(0xd2d+202-0xdf7)){DATARMNET02d70ac2da->DATARMNET28d0ee46be
++=DATARMNETe823dcf978->DATARMNETe222772431;list_move_tail(&DATARMNET02d70ac2da->
+DATARMNET0a9669c24a,&DATARMNET1f218fbe9f->DATARMNET390794bda1);goto 
+DATARMNET85e1e75096;}DATARMNET543491eb0f=codel_dequeue(DATARMNET9b0193c8c4,&
+DATARMNET9b0193c8c4->qstats.backlog,&DATARMNET1f218fbe9f->DATARMNET442ea3ba38,&
+DATARMNET02d70ac2da->DATARMNETa8820b1ef0,&DATARMNETe823dcf978->
+DATARMNET09c1afd72b,qdisc_pkt_len,codel_get_enqueue_time,DATARMNETff223b7f1c,
+DATARMNET013e29aee5);if(!DATARMNET543491eb0f){if(head==&DATARMNET1f218fbe9f->
+DATARMNETc56f4447b1&&!list_empty(&DATARMNET1f218fbe9f->DATARMNET390794bda1))
+list_move_tail(&DATARMNET02d70ac2da->DATARMNET0a9669c24a,&DATARMNET1f218fbe9f->
+DATARMNET390794bda1);else list_del_init(&DATARMNET02d70ac2da->
+DATARMNET0a9669c24a);goto DATARMNET85e1e75096;}DATARMNET02d70ac2da->
+DATARMNET28d0ee46be-=qdisc_pkt_len(DATARMNET543491eb0f);return 
+DATARMNET543491eb0f;}static struct sk_buff*DATARMNET11bbc6360d(struct Qdisc*
+DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
+DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;struct 
+DATARMNET1f218fbe9f*DATARMNET1f218fbe9f;u8 DATARMNET2372d14a3d;while((
+DATARMNET1f218fbe9f=list_first_entry_or_null(&DATARMNETe823dcf978->
+DATARMNET67914d31ed,struct DATARMNET1f218fbe9f,DATARMNETda69ecf253))){
+DATARMNET2372d14a3d=DATARMNET1f218fbe9f-DATARMNETe823dcf978->DATARMNETb4180393e4
+;if(DATARMNET1f218fbe9f->DATARMNET28d0ee46be<=(0xd2d+202-0xdf7)){
+DATARMNET1f218fbe9f->DATARMNET28d0ee46be+=DATARMNET9dd1382d86[
+DATARMNET2372d14a3d]*DATARMNETe823dcf978->DATARMNETe222772431;list_move_tail(&
+DATARMNET1f218fbe9f->DATARMNETda69ecf253,&DATARMNETe823dcf978->
+DATARMNET67914d31ed);continue;}DATARMNET543491eb0f=DATARMNETf9ac3daa83(
+DATARMNET9b0193c8c4,DATARMNET1f218fbe9f);if(!DATARMNET543491eb0f){list_del_init(
+&DATARMNET1f218fbe9f->DATARMNETda69ecf253);continue;}DATARMNET1f218fbe9f->
+DATARMNET28d0ee46be-=qdisc_pkt_len(DATARMNET543491eb0f);qdisc_bstats_update(
+DATARMNET9b0193c8c4,DATARMNET543491eb0f);break;}if(DATARMNETe823dcf978->
+DATARMNET09c1afd72b.drop_count&&DATARMNET9b0193c8c4->q.qlen){
+qdisc_tree_reduce_backlog(DATARMNET9b0193c8c4,DATARMNETe823dcf978->
+DATARMNET09c1afd72b.drop_count,DATARMNETe823dcf978->DATARMNET09c1afd72b.drop_len
+);DATARMNETe823dcf978->DATARMNET09c1afd72b.drop_count=(0xd2d+202-0xdf7);
+DATARMNETe823dcf978->DATARMNET09c1afd72b.drop_len=(0xd2d+202-0xdf7);}return 
+DATARMNET543491eb0f;}static void DATARMNETd9ab82da05(struct Qdisc*
+DATARMNET9b0193c8c4,struct DATARMNET1f218fbe9f*DATARMNET1f218fbe9f,u8 
+DATARMNET2372d14a3d){int DATARMNET5c2fd31d7b;INIT_LIST_HEAD(&DATARMNET1f218fbe9f
+->DATARMNETc56f4447b1);INIT_LIST_HEAD(&DATARMNET1f218fbe9f->DATARMNET390794bda1)
+;INIT_LIST_HEAD(&DATARMNET1f218fbe9f->DATARMNETda69ecf253);DATARMNET1f218fbe9f->
+DATARMNET28d0ee46be=(0xd2d+202-0xdf7);codel_params_init(&DATARMNET1f218fbe9f->
+DATARMNET442ea3ba38);DATARMNET1f218fbe9f->DATARMNET442ea3ba38.target=US2TIME(
+DATARMNET3b24a9b14d[DATARMNET2372d14a3d]);DATARMNET1f218fbe9f->
+DATARMNET442ea3ba38.mtu=psched_mtu(qdisc_dev(DATARMNET9b0193c8c4));
+DATARMNET1f218fbe9f->DATARMNET442ea3ba38.ecn=true;for(DATARMNET5c2fd31d7b=
+(0xd2d+202-0xdf7);DATARMNET5c2fd31d7b<DATARMNET0c40784392;DATARMNET5c2fd31d7b++)
+{struct DATARMNET02d70ac2da*DATARMNET02d70ac2da=&DATARMNET1f218fbe9f->
+DATARMNET68fc6778b0[DATARMNET5c2fd31d7b];DATARMNET02d70ac2da->head=NULL;
+DATARMNET02d70ac2da->tail=NULL;DATARMNET02d70ac2da->DATARMNET28d0ee46be=
+(0xd2d+202-0xdf7);INIT_LIST_HEAD(&DATARMNET02d70ac2da->DATARMNET0a9669c24a);
+codel_vars_init(&DATARMNET02d70ac2da->DATARMNETa8820b1ef0);}}static int 
+DATARMNET757a7de682(struct Qdisc*DATARMNET9b0193c8c4,struct nlattr*
+DATARMNET8bdeb8bf5c,struct netlink_ext_ack*DATARMNET79a1f177ed){struct 
+DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);int 
+DATARMNET2372d14a3d;INIT_LIST_HEAD(&DATARMNETe823dcf978->DATARMNET67914d31ed);
+codel_stats_init(&DATARMNETe823dcf978->DATARMNET09c1afd72b);DATARMNETe823dcf978
+->DATARMNETe222772431=psched_mtu(qdisc_dev(DATARMNET9b0193c8c4));for(
 DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
-DATARMNET2372d14a3d++){if(!DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d].qlen)continue;if(DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)||DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)){if(
-DATARMNET2372d14a3d<DATARMNET70fa801d65)DATARMNET70fa801d65=DATARMNET2372d14a3d;
-continue;}return DATARMNET2372d14a3d;}for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);
-DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++){
-DATARMNETe823dcf978->DATARMNET1de7b3d891[DATARMNET2372d14a3d]=
-DATARMNET9dd1382d86[DATARMNET2372d14a3d];DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]=DATARMNET91bbdde74c[DATARMNET2372d14a3d
-];}return DATARMNET70fa801d65;}static struct sk_buff*DATARMNET11bbc6360d(struct 
-Qdisc*DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
-qdisc_priv(DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u8 
-DATARMNET2372d14a3d;DATARMNET2372d14a3d=DATARMNETf9ac3daa83(DATARMNETe823dcf978)
-;if(DATARMNET2372d14a3d<DATARMNETe632b2e0b0){DATARMNET543491eb0f=
-__qdisc_dequeue_head(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);if(likely(DATARMNET543491eb0f)){DATARMNETe823dcf978->
-DATARMNET1de7b3d891[DATARMNET2372d14a3d]--;DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]-=qdisc_pkt_len(DATARMNET543491eb0f);
-qdisc_update_stats_at_dequeue(DATARMNET9b0193c8c4,DATARMNET543491eb0f);}}return 
-DATARMNET543491eb0f;}static struct sk_buff*DATARMNET5842e6aac7(struct Qdisc*
+DATARMNET2372d14a3d++)DATARMNETd9ab82da05(DATARMNET9b0193c8c4,&
+DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d],
+DATARMNET2372d14a3d);DATARMNET9b0193c8c4->flags|=TCQ_F_CAN_BYPASS;return
+(0xd2d+202-0xdf7);}static void DATARMNET9593ab9587(struct Qdisc*
 DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
-DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u8 
-DATARMNET2372d14a3d;DATARMNET2372d14a3d=DATARMNETf9ac3daa83(DATARMNETe823dcf978)
-;if(DATARMNET2372d14a3d<DATARMNETe632b2e0b0)DATARMNET543491eb0f=
-DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].head;return 
-DATARMNET543491eb0f;}static int DATARMNET757a7de682(struct Qdisc*
-DATARMNET9b0193c8c4,struct nlattr*DATARMNET8bdeb8bf5c,struct netlink_ext_ack*
-DATARMNET79a1f177ed){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
-DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
-(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
-{qdisc_skb_head_init(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]=DATARMNET9dd1382d86[DATARMNET2372d14a3d];
-DATARMNETe823dcf978->DATARMNETf9afebb887[DATARMNET2372d14a3d]=
-DATARMNET91bbdde74c[DATARMNET2372d14a3d];}DATARMNET9b0193c8c4->flags|=
-TCQ_F_CAN_BYPASS;return(0xd2d+202-0xdf7);}static void DATARMNET9593ab9587(struct
- Qdisc*DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
-qdisc_priv(DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
-(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
-{kfree_skb_list(DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].
-head);qdisc_skb_head_init(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]=DATARMNET9dd1382d86[DATARMNET2372d14a3d];
-DATARMNETe823dcf978->DATARMNETf9afebb887[DATARMNET2372d14a3d]=
-DATARMNET91bbdde74c[DATARMNET2372d14a3d];}}static struct Qdisc_ops 
-DATARMNET9afaec21de __read_mostly={.id="\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68",.
-priv_size=sizeof(struct DATARMNET74e95d25df),.enqueue=DATARMNET3a797cc4e9,.
-dequeue=DATARMNET11bbc6360d,.peek=DATARMNET5842e6aac7,.init=DATARMNET757a7de682,
-.reset=DATARMNET9593ab9587,.owner=THIS_MODULE,};static int __init 
-DATARMNETe97da0a844(void){pr_info(
-"\x73\x63\x68\x3a\x20\x69\x6e\x69\x74\x20\x28\x25\x73\x29" "\n",
+DATARMNET9b0193c8c4);int DATARMNET2372d14a3d,DATARMNET5c2fd31d7b;for(
+DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
+DATARMNET2372d14a3d++){for(DATARMNET5c2fd31d7b=(0xd2d+202-0xdf7);
+DATARMNET5c2fd31d7b<DATARMNET0c40784392;DATARMNET5c2fd31d7b++)kfree_skb_list(
+DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].
+DATARMNET68fc6778b0[DATARMNET5c2fd31d7b].head);DATARMNETd9ab82da05(
+DATARMNET9b0193c8c4,&DATARMNETe823dcf978->DATARMNETb4180393e4[
+DATARMNET2372d14a3d],DATARMNET2372d14a3d);}INIT_LIST_HEAD(&DATARMNETe823dcf978->
+DATARMNET67914d31ed);codel_stats_init(&DATARMNETe823dcf978->DATARMNET09c1afd72b)
+;}static struct Qdisc_ops DATARMNET9afaec21de __read_mostly={.id=
+"\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68",.priv_size=sizeof(struct 
+DATARMNET74e95d25df),.enqueue=DATARMNET3a797cc4e9,.dequeue=DATARMNET11bbc6360d,.
+peek=qdisc_peek_dequeued,.init=DATARMNET757a7de682,.reset=DATARMNET9593ab9587,.
+owner=THIS_MODULE,};static int __init DATARMNETe97da0a844(void){pr_info(
+"\x73\x63\x68\x3a\x20\x69\x6e\x69\x74\x20\x28\x25\x73\x29" "\x0a",
 DATARMNETf1bb41174a);return register_qdisc(&DATARMNET9afaec21de);}static void 
 __exit DATARMNET1dc9099e88(void){unregister_qdisc(&DATARMNET9afaec21de);}
 MODULE_LICENSE("\x47\x50\x4c\x20\x76\x32");module_init(DATARMNETe97da0a844);
@@ -43,6 +43,7 @@
 #define DATARMNET270b564b55  (0xd35+210-0xdff)
 #define DATARMNET1c2d76f636 (0xf07+658-0x110d)
 #define DATARMNET2922c89d50  (0xd1f+216-0xdf5)
+#define DATARMNET0746c2adf5 (0xd35+210-0xdff)
 #define DATARMNET015fb2ba0e(...) \
   do { if (DATARMNET756bdd424a) trace_rmnet_shs_err(__VA_ARGS__); } while (\
 (0xd2d+202-0xdf7))
@@ -85,17 +86,18 @@ DATARMNETe33b41dad9;struct list_head DATARMNET04c88b8191;struct net_device*dev;
 struct DATARMNET6c78e47d24*DATARMNET341ea38662;struct DATARMNETa034b2e60c 
 DATARMNETae4b27456e;struct hlist_node list;u64 DATARMNET11930c5df8;u64 
 DATARMNETa8940e4a7b;u64 DATARMNET2594c418db;u64 DATARMNET3ecedac168;u64 
-DATARMNETce5f56eab9;u32 queue_head;u32 hash;u16 map_index;u16 map_cpu;u16 
-DATARMNETfbbec4c537;u16 DATARMNETa59ce1fd2d;u8 DATARMNET85c698ec34;u16 
-DATARMNET0371465875;u16 DATARMNET1e9d25d9ff;u8 DATARMNETa1099c74fe;u8 
-DATARMNET6250e93187;u8 mux_id;};enum DATARMNET156842d55e{DATARMNET7bc926fdbe,
-DATARMNETb3e3b2a799,DATARMNET8dcf06727b};enum DATARMNET8463cba7c7{
-DATARMNETc3bce05be2,DATARMNET14067f0be4,DATARMNET28bb261646,DATARMNET67b67dc88f,
-DATARMNET0efbbe2821,DATARMNETa4267dfd8a,DATARMNETf13db5ace8,DATARMNETb6eae1e097,
-DATARMNET0e398136dc,DATARMNET975060d6b5,DATARMNET7f401828b3,DATARMNET6ea8a58f4e,
-DATARMNETcf84373518,DATARMNETeccb61ebc3};enum DATARMNETf355367410{
-DATARMNET557ff68d74,DATARMNET1c55e5fdb1,DATARMNET4ab5a31d0c,DATARMNETde2dd86539}
-;enum DATARMNET6c7f7f22c7{DATARMNETe35e238437,DATARMNET0d61981934};enum 
+DATARMNETce5f56eab9;ktime_t DATARMNET88d372a2ae;u32 queue_head;u32 hash;u16 
+map_index;u16 map_cpu;u16 DATARMNETfbbec4c537;u16 DATARMNETa59ce1fd2d;u8 
+DATARMNET85c698ec34;u16 DATARMNET0371465875;u16 DATARMNET1e9d25d9ff;u8 
+DATARMNETa1099c74fe;u8 DATARMNET6250e93187;u8 mux_id;};enum DATARMNET156842d55e{
+DATARMNET7bc926fdbe,DATARMNETb3e3b2a799,DATARMNET8dcf06727b};enum 
+DATARMNET8463cba7c7{DATARMNETc3bce05be2,DATARMNET14067f0be4,DATARMNET28bb261646,
+DATARMNET67b67dc88f,DATARMNET0efbbe2821,DATARMNETa4267dfd8a,DATARMNETf13db5ace8,
+DATARMNETb6eae1e097,DATARMNET0e398136dc,DATARMNET975060d6b5,DATARMNET7f401828b3,
+DATARMNET6ea8a58f4e,DATARMNETcf84373518,DATARMNET9fbe56d314,DATARMNET51bd9b5b87,
+DATARMNETeccb61ebc3};enum DATARMNETf355367410{DATARMNET557ff68d74,
+DATARMNET1c55e5fdb1,DATARMNET4ab5a31d0c,DATARMNETde2dd86539};enum 
+DATARMNET6c7f7f22c7{DATARMNETe35e238437,DATARMNET0d61981934};enum 
 DATARMNET3f3bc61c03{DATARMNETf5157a9b85,DATARMNET709b59b0e6,DATARMNET99db6e7d86,
 DATARMNETe3c02ddaeb,DATARMNET394acaf558,DATARMNETef8cbfa62f,DATARMNETe6e77f9f03,
 DATARMNETecdf13872c,DATARMNETd1687e0776,DATARMNET1828d69e96,DATARMNET40ceff078e,
@@ -160,6 +162,9 @@ net_device*vnd);void DATARMNET9297340f58(unsigned int DATARMNET9f4bc49c6f);void
 DATARMNET7f1d9480cb(void*port);void DATARMNETa4bd2ef52c(void*port);void 
 DATARMNETe074a09496(void);void DATARMNET23c7ddd780(struct DATARMNET63d7680df2*
 DATARMNET63b1a086d5,u8 DATARMNET5447204733);void DATARMNET349c3a0cab(u16 map_cpu
-,bool DATARMNETb639f6e1b1);u32 DATARMNETadb0248bd4(u8 DATARMNET42a992465f);
+,bool DATARMNETb639f6e1b1);u32 DATARMNETadb0248bd4(u8 DATARMNET42a992465f);u32 
+DATARMNET15138f8fcb(struct DATARMNET63d7680df2*node_p);enum DATARMNETeb482ba9ac{
+DATARMNETa7aff0dcc3,DATARMNET9059f3ae29,DATARMNETd44c1c744c,DATARMNET5167689119}
+;
 #endif 
 
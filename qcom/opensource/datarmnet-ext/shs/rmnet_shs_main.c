@@ -34,6 +34,7 @@
 #include "rmnet_shs_common.h"
 #include "rmnet_trace.h"
 #include "rmnet_shs_wq_genl.h"
+#include "rmnet_shs_wq_mem.h"
 #include <linux/module.h>
 #include <linux/cpumask.h>
 #include <linux/icmp.h>
@@ -346,45 +347,64 @@ dev)){if(DATARMNET713da9913c(dev->_rx,cpu,DATARMNET5780499e9c)==
 cpu;DATARMNETecc0627c70.DATARMNET6625085b71=DATARMNETecc0627c70.
 DATARMNET7d667e828e;DATARMNETecc0627c70.DATARMNET7d667e828e=cpu;}else{return-
 (0xd26+209-0xdf6);}}else{DATARMNET68d84e7b98[DATARMNET767c76ca08]++;}return
-(0xd2d+202-0xdf7);}int DATARMNETe488c1c396(struct DATARMNET63d7680df2*
-DATARMNET63b1a086d5,u8 DATARMNETd87669e323,u8 DATARMNET5447204733){int 
-DATARMNET5c4a331b9c;u32 DATARMNETd3673fd5f0;u32 DATARMNET9bbfe49633;int ret=
-(0xd2d+202-0xdf7);int DATARMNET5a2e9192f9=-(0xd26+209-0xdf6);int 
-DATARMNET8ceb7a8cc9;int DATARMNET42a992465f;int DATARMNETcfb5dc7296;struct 
-DATARMNETe600c5b727*DATARMNET373e474754;u8 map=DATARMNET63b1a086d5->
-DATARMNETfbbec4c537;DATARMNET5c4a331b9c=DATARMNETb6bff4a724(DATARMNET63b1a086d5)
-;do{DATARMNET5a2e9192f9=DATARMNET63b1a086d5->map_cpu;if(DATARMNET5c4a331b9c<
-(0xd2d+202-0xdf7)){DATARMNET63b1a086d5->DATARMNET6250e93187=(0xd2d+202-0xdf7);
-ret=(0xd26+209-0xdf6);break;}DATARMNET63b1a086d5->DATARMNET6250e93187=
-(0xd26+209-0xdf6);if(!map){DATARMNET63b1a086d5->DATARMNET6250e93187=
-(0xd2d+202-0xdf7);ret=(0xd26+209-0xdf6);break;}if(DATARMNET5c4a331b9c==
-DATARMNET63b1a086d5->map_index){ret=(0xd26+209-0xdf6);break;}if(!
+(0xd2d+202-0xdf7);}static const u32 DATARMNET1d6e466793[DATARMNET0746c2adf5-
+(0xd26+209-0xdf6)]={(0xd2d+202-0xdf7),(0xef7+1112-0x131d),(0xeb7+698-0x110d),
+(0xc58+2075-0x1379),(0xdf7+6169-0x241c),(0xbc5+3887-0x170c),(0xc78+4948-0x17fc)}
+;u32 DATARMNET15138f8fcb(struct DATARMNET63d7680df2*node_p){u32 
+DATARMNET6cb4732313=node_p->queue_head+node_p->DATARMNET0371465875;u32 
+DATARMNET350a2e7d3e=DATARMNETadb0248bd4(node_p->map_cpu);return((s32)(
+DATARMNET6cb4732313-DATARMNET350a2e7d3e)>(0xd2d+202-0xdf7))?DATARMNET6cb4732313-
+DATARMNET350a2e7d3e:(0xd2d+202-0xdf7);}static void DATARMNET1fb9491b78(struct 
+DATARMNET63d7680df2*node_p){if(node_p->DATARMNET88d372a2ae)return;node_p->
+DATARMNET88d372a2ae=ktime_get();DATARMNETb7ddf3c5dd[DATARMNET9fbe56d314]++;}
+static void DATARMNETe2034dce6d(struct DATARMNET63d7680df2*node_p){s64 
+DATARMNET14fdb0941c=(0xd2d+202-0xdf7);u8 i;if(node_p->DATARMNET88d372a2ae)
+DATARMNET14fdb0941c=ktime_us_delta(ktime_get(),node_p->DATARMNET88d372a2ae);
+node_p->DATARMNET88d372a2ae=(0xd2d+202-0xdf7);for(i=(0xd2d+202-0xdf7);i<
+DATARMNET0746c2adf5-(0xd26+209-0xdf6);i++)if(DATARMNET14fdb0941c<=
+DATARMNET1d6e466793[i])break;DATARMNETd8e270cda0[i]++;}int DATARMNETe488c1c396(
+struct DATARMNET63d7680df2*DATARMNET63b1a086d5,u8 DATARMNETd87669e323,u8 
+DATARMNET5447204733){int DATARMNET5c4a331b9c;u32 DATARMNETd3673fd5f0;u32 
+DATARMNET9bbfe49633;int ret=(0xd2d+202-0xdf7);int DATARMNET5a2e9192f9=-
+(0xd26+209-0xdf6);int DATARMNET8ceb7a8cc9;int DATARMNET42a992465f;int 
+DATARMNETcfb5dc7296;struct DATARMNETe600c5b727*DATARMNET373e474754;u8 map=
+DATARMNET63b1a086d5->DATARMNETfbbec4c537;DATARMNET5c4a331b9c=DATARMNETb6bff4a724
+(DATARMNET63b1a086d5);do{DATARMNET5a2e9192f9=DATARMNET63b1a086d5->map_cpu;if(
+DATARMNET5c4a331b9c<(0xd2d+202-0xdf7)){DATARMNET63b1a086d5->DATARMNET6250e93187=
+(0xd2d+202-0xdf7);ret=(0xd26+209-0xdf6);break;}DATARMNET63b1a086d5->
+DATARMNET6250e93187=(0xd26+209-0xdf6);if(!map){DATARMNET63b1a086d5->
+DATARMNET6250e93187=(0xd2d+202-0xdf7);ret=(0xd26+209-0xdf6);break;}if(
+DATARMNET5c4a331b9c==DATARMNET63b1a086d5->map_index){DATARMNET63b1a086d5->
+DATARMNET88d372a2ae=(0xd2d+202-0xdf7);ret=(0xd26+209-0xdf6);break;}if(!
 DATARMNET63b1a086d5->DATARMNET85c698ec34)DATARMNETd3673fd5f0=DATARMNETadb0248bd4
 (DATARMNET63b1a086d5->map_cpu);else DATARMNETd3673fd5f0=DATARMNETadb0248bd4(
 DATARMNETecc0627c70.DATARMNET7d667e828e);DATARMNET9bbfe49633=DATARMNET63b1a086d5
 ->queue_head;DATARMNET42a992465f=DATARMNET63b1a086d5->map_cpu;if((!
-DATARMNET63b1a086d5->DATARMNET85c698ec34&&DATARMNETd3673fd5f0>=(
-DATARMNET9bbfe49633+DATARMNET63b1a086d5->DATARMNET0371465875))||(
-DATARMNETd87669e323>=DATARMNETa7d45fb6d4||(DATARMNETd87669e323&&
-DATARMNET63b1a086d5->DATARMNET85c698ec34))||(!DATARMNET63b1a086d5->
-DATARMNET85c698ec34&&!DATARMNETeea3cef5b6(DATARMNET42a992465f)&&++
-DATARMNET14ed771dfb[DATARMNET0d07041c32])){if(likely(DATARMNETa7909611da)){
-DATARMNETcfb5dc7296=DATARMNETaef946bb68(DATARMNET5c4a331b9c,DATARMNET63b1a086d5
-->DATARMNETfbbec4c537);if(DATARMNETcfb5dc7296<(0xd2d+202-0xdf7)){ret=
-(0xd26+209-0xdf6);break;}DATARMNET0997c5650d[DATARMNETcfb5dc7296].
-DATARMNET4133fc9428+=DATARMNET63b1a086d5->DATARMNETae4b27456e.
-DATARMNET6215127f48;DATARMNET0997c5650d[DATARMNET63b1a086d5->map_cpu].
-DATARMNET4133fc9428-=DATARMNET63b1a086d5->DATARMNETae4b27456e.
-DATARMNET6215127f48;DATARMNET63b1a086d5->map_index=DATARMNET5c4a331b9c;
-DATARMNET63b1a086d5->map_cpu=DATARMNETcfb5dc7296;DATARMNET8ceb7a8cc9=
-DATARMNET63b1a086d5->map_cpu;if(DATARMNETd3673fd5f0<(DATARMNET9bbfe49633+
-DATARMNET63b1a086d5->DATARMNET0371465875)){DATARMNETb7ddf3c5dd[
-DATARMNET28bb261646]++;DATARMNETb7ddf3c5dd[DATARMNET67b67dc88f]+=(
-DATARMNET9bbfe49633-DATARMNETd3673fd5f0)+DATARMNET63b1a086d5->
-DATARMNET0371465875;DATARMNET4bde88919f(DATARMNET42a992465f,(DATARMNET9bbfe49633
--DATARMNETd3673fd5f0)+DATARMNET63b1a086d5->DATARMNET0371465875);pr_info(
-"\x73\x68\x73\x20\x6f\x6f\x6f\x3a\x20\x70\x68\x79\x20\x25\x64\x20\x6e\x65\x77\x5f\x63\x70\x75\x20\x25\x64\x20\x6f\x6c\x64\x5f\x63\x70\x75\x20\x25\x64\x2c\x20\x6f\x66\x66\x73\x65\x74\x20\x25\x64\x20\x6e\x6f\x64\x65\x5f\x71\x68\x65\x61\x64\x20\x25\x64\x2c\x20\x63\x75\x72\x5f\x71\x68\x65\x61\x64\x20\x25\x64\x2c\x20\x66\x66\x20\x25\x64\x20\x6f\x6c\x64\x20\x63\x70\x75\x20\x71\x64\x69\x66\x66\x20\x25\x64\x20\x6e\x65\x77\x20\x71\x64\x69\x66\x66\x20\x25\x64\x20" "\n"
-,DATARMNET63b1a086d5->DATARMNET85c698ec34,DATARMNETcfb5dc7296,
+DATARMNET63b1a086d5->DATARMNET85c698ec34&&!DATARMNET15138f8fcb(
+DATARMNET63b1a086d5))||(DATARMNETd87669e323>=DATARMNETa7d45fb6d4||(
+DATARMNETd87669e323&&DATARMNET63b1a086d5->DATARMNET85c698ec34))||(!
+DATARMNET63b1a086d5->DATARMNET85c698ec34&&!DATARMNETeea3cef5b6(
+DATARMNET42a992465f)&&++DATARMNET14ed771dfb[DATARMNET0d07041c32])){if(likely(
+DATARMNETa7909611da)){DATARMNETcfb5dc7296=DATARMNETaef946bb68(
+DATARMNET5c4a331b9c,DATARMNET63b1a086d5->DATARMNETfbbec4c537);if(
+DATARMNETcfb5dc7296<(0xd2d+202-0xdf7)){ret=(0xd26+209-0xdf6);break;}
+DATARMNET0997c5650d[DATARMNETcfb5dc7296].DATARMNET4133fc9428+=
+DATARMNET63b1a086d5->DATARMNETae4b27456e.DATARMNET6215127f48;DATARMNET0997c5650d
+[DATARMNET63b1a086d5->map_cpu].DATARMNET4133fc9428-=DATARMNET63b1a086d5->
+DATARMNETae4b27456e.DATARMNET6215127f48;DATARMNET63b1a086d5->map_index=
+DATARMNET5c4a331b9c;DATARMNET63b1a086d5->map_cpu=DATARMNETcfb5dc7296;
+DATARMNET8ceb7a8cc9=DATARMNET63b1a086d5->map_cpu;DATARMNETe2034dce6d(
+DATARMNET63b1a086d5);DATARMNET83dcd391f0(DATARMNET8c53b734ff,DATARMNET8ceb7a8cc9
+,DATARMNET63b1a086d5->hash,DATARMNET42a992465f,DATARMNET63b1a086d5->
+DATARMNETae4b27456e.DATARMNET6215127f48);if(DATARMNETd3673fd5f0<(
+DATARMNET9bbfe49633+DATARMNET63b1a086d5->DATARMNET0371465875)){
+DATARMNETb7ddf3c5dd[DATARMNET28bb261646]++;DATARMNETb7ddf3c5dd[
+DATARMNET67b67dc88f]+=(DATARMNET9bbfe49633-DATARMNETd3673fd5f0)+
+DATARMNET63b1a086d5->DATARMNET0371465875;DATARMNET4bde88919f(DATARMNET42a992465f
+,(DATARMNET9bbfe49633-DATARMNETd3673fd5f0)+DATARMNET63b1a086d5->
+DATARMNET0371465875);pr_info(
+"\x73\x68\x73\x20\x6f\x6f\x6f\x3a\x20\x70\x68\x79\x20\x25\x64\x20\x6e\x65\x77\x5f\x63\x70\x75\x20\x25\x64\x20\x6f\x6c\x64\x5f\x63\x70\x75\x20\x25\x64\x2c\x20\x6f\x66\x66\x73\x65\x74\x20\x25\x64\x20\x6e\x6f\x64\x65\x5f\x71\x68\x65\x61\x64\x20\x25\x64\x2c\x20\x63\x75\x72\x5f\x71\x68\x65\x61\x64\x20\x25\x64\x2c\x20\x66\x66\x20\x25\x64\x20\x6f\x6c\x64\x20\x63\x70\x75\x20\x71\x64\x69\x66\x66\x20\x25\x64\x20\x6e\x65\x77\x20\x71\x64\x69\x66\x66\x20\x25\x64\x20" 
+"\n",DATARMNET63b1a086d5->DATARMNET85c698ec34,DATARMNETcfb5dc7296,
 DATARMNET42a992465f,DATARMNET63b1a086d5->DATARMNET0371465875,DATARMNET9bbfe49633
 ,DATARMNETd3673fd5f0,DATARMNETd87669e323,DATARMNETeea3cef5b6(DATARMNET42a992465f
 ),DATARMNETeea3cef5b6(DATARMNETcfb5dc7296));}if(DATARMNET0997c5650d[
@@ -400,13 +420,14 @@ DATARMNET6e1a4eaf09=DATARMNET8ceb7a8cc9;DATARMNETe102b3a798(DATARMNET63b1a086d5,
 &DATARMNET373e474754->DATARMNET3dc4262f53,DATARMNET42a992465f);
 DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNET052f49b190,DATARMNET63b1a086d5
 ->map_cpu,DATARMNET5a2e9192f9,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-DATARMNET63b1a086d5,NULL);}ret=(0xd26+209-0xdf6);}}while((0xd2d+202-0xdf7));
-DATARMNETda96251102(DATARMNET4510abc30d,DATARMNET23b8465daf,ret,
-DATARMNET63b1a086d5->map_cpu,DATARMNET5a2e9192f9,(0x16e8+787-0xc0c),
-DATARMNET63b1a086d5,NULL);return ret;}void DATARMNETfbc06e60f1(u8 
-DATARMNET42a992465f){struct DATARMNET63d7680df2*DATARMNET3f85732c70;struct 
-list_head*DATARMNET7b34b7b5be,*next;unsigned long ht_flags;u32 
-DATARMNET61ab18a4bd;u32 DATARMNETed7800fc72=(0xd2d+202-0xdf7);u32 
+DATARMNET63b1a086d5,NULL);}ret=(0xd26+209-0xdf6);}else if(DATARMNET654bd3aabc&&!
+DATARMNET63b1a086d5->DATARMNET85c698ec34){DATARMNET1fb9491b78(
+DATARMNET63b1a086d5);}}while((0xd2d+202-0xdf7));DATARMNETda96251102(
+DATARMNET4510abc30d,DATARMNET23b8465daf,ret,DATARMNET63b1a086d5->map_cpu,
+DATARMNET5a2e9192f9,(0x16e8+787-0xc0c),DATARMNET63b1a086d5,NULL);return ret;}
+void DATARMNETfbc06e60f1(u8 DATARMNET42a992465f){struct DATARMNET63d7680df2*
+DATARMNET3f85732c70;struct list_head*DATARMNET7b34b7b5be,*next;unsigned long 
+ht_flags;u32 DATARMNET61ab18a4bd;u32 DATARMNETed7800fc72=(0xd2d+202-0xdf7);u32 
 DATARMNETa0df5de99d=(0xd2d+202-0xdf7);u32 DATARMNET8bf94cc2f7=(0xd2d+202-0xdf7);
 u32 DATARMNET76192fa639=(0xd2d+202-0xdf7);DATARMNETe074a09496();
 DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNETde91850c28,DATARMNETecc0627c70.
@@ -426,20 +447,22 @@ DATARMNET3f85732c70->map_cpu==DATARMNET42a992465f){DATARMNET61ab18a4bd+=
 DATARMNETed7800fc72;DATARMNET3f85732c70->queue_head=DATARMNET61ab18a4bd;}}}
 DATARMNETecc0627c70.DATARMNETc252a1f55d-=DATARMNET76192fa639;DATARMNETecc0627c70
 .DATARMNETa2e32cdd3a-=DATARMNET8bf94cc2f7;DATARMNET0997c5650d[
-DATARMNET42a992465f].DATARMNETef866573e0=(0xd2d+202-0xdf7);DATARMNETecc0627c70.
-DATARMNET132b9c7dc4[DATARMNET42a992465f].DATARMNETe61d62310f=(0xd2d+202-0xdf7);
-DATARMNET0997c5650d[DATARMNET42a992465f].DATARMNET4133fc9428=(0xd2d+202-0xdf7);
-spin_unlock_irqrestore(&DATARMNET3764d083f0,ht_flags);local_bh_enable();if(
-DATARMNET42a992465f==DATARMNETecc0627c70.DATARMNET6625085b71&&rcu_dereference(
-rmnet_shs_switch)){RCU_INIT_POINTER(rmnet_shs_switch,NULL);DATARMNETecc0627c70.
-DATARMNETfeee6933fc=(0xd2d+202-0xdf7);DATARMNETecc0627c70.DATARMNET6625085b71=
-DATARMNETecc0627c70.DATARMNET7d667e828e;}DATARMNET52de1f3dc0(DATARMNET4510abc30d
-,DATARMNET576793621a,DATARMNETecc0627c70.DATARMNETa2e32cdd3a,DATARMNETecc0627c70
-.DATARMNETc252a1f55d,DATARMNET8bf94cc2f7,DATARMNET76192fa639,NULL,NULL);}void 
-DATARMNET056c939591(struct work_struct*DATARMNET33110a3ff5){struct 
-DATARMNETa6f2d499b2*DATARMNET4b39dc1574=container_of(DATARMNET33110a3ff5,struct 
-DATARMNETa6f2d499b2,DATARMNET33110a3ff5);DATARMNETfbc06e60f1(DATARMNET4b39dc1574
-->DATARMNET42c3ecbd5e);DATARMNET14ed771dfb[DATARMNETbb5757569c]++;}void 
+DATARMNET42a992465f].DATARMNETef866573e0=(0xd2d+202-0xdf7);DATARMNET83dcd391f0(
+DATARMNET14d6334da6,DATARMNET42a992465f,(0xd2d+202-0xdf7),(0xd2d+202-0xdf7),
+(0xd2d+202-0xdf7));DATARMNETecc0627c70.DATARMNET132b9c7dc4[DATARMNET42a992465f].
+DATARMNETe61d62310f=(0xd2d+202-0xdf7);DATARMNET0997c5650d[DATARMNET42a992465f].
+DATARMNET4133fc9428=(0xd2d+202-0xdf7);spin_unlock_irqrestore(&
+DATARMNET3764d083f0,ht_flags);local_bh_enable();if(DATARMNET42a992465f==
+DATARMNETecc0627c70.DATARMNET6625085b71&&rcu_dereference(rmnet_shs_switch)){
+RCU_INIT_POINTER(rmnet_shs_switch,NULL);DATARMNETecc0627c70.DATARMNETfeee6933fc=
+(0xd2d+202-0xdf7);DATARMNETecc0627c70.DATARMNET6625085b71=DATARMNETecc0627c70.
+DATARMNET7d667e828e;}DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNET576793621a
+,DATARMNETecc0627c70.DATARMNETa2e32cdd3a,DATARMNETecc0627c70.DATARMNETc252a1f55d
+,DATARMNET8bf94cc2f7,DATARMNET76192fa639,NULL,NULL);}void DATARMNET056c939591(
+struct work_struct*DATARMNET33110a3ff5){struct DATARMNETa6f2d499b2*
+DATARMNET4b39dc1574=container_of(DATARMNET33110a3ff5,struct DATARMNETa6f2d499b2,
+DATARMNET33110a3ff5);DATARMNETfbc06e60f1(DATARMNET4b39dc1574->
+DATARMNET42c3ecbd5e);DATARMNET14ed771dfb[DATARMNETbb5757569c]++;}void 
 DATARMNETcba2f7f7b6(struct DATARMNET63d7680df2*DATARMNET63b1a086d5,u8 
 DATARMNETf345c1d909){struct sk_buff*skb=NULL;struct sk_buff*DATARMNETcebafc57a4=
 NULL;struct DATARMNETe600c5b727*DATARMNETa4055affd5;u32 DATARMNETe20a9cab2b=
@@ -535,14 +558,15 @@ DATARMNET0997c5650d[DATARMNET42a992465f].DATARMNETef866573e0&&
 DATARMNETecc0627c70.DATARMNET6625085b71!=DATARMNET42a992465f&&
 DATARMNET42a992465f!=(0xd26+209-0xdf6)){DATARMNETba6017a3a9=(!
 DATARMNET7845d39672)?DATARMNET249a927510:DATARMNETba6017a3a9;DATARMNET0997c5650d
-[DATARMNET42a992465f].DATARMNETef866573e0=(0xd26+209-0xdf6);DATARMNETfb7007f025(
-);if(hrtimer_active(&DATARMNETba5ea4329f(DATARMNET42a992465f)))hrtimer_cancel(&
-DATARMNETba5ea4329f(DATARMNET42a992465f));hrtimer_start(&DATARMNETba5ea4329f(
-DATARMNET42a992465f),ns_to_ktime(DATARMNETba6017a3a9*DATARMNET68fc0be252),
-HRTIMER_MODE_REL);DATARMNETb7ddf3c5dd[DATARMNETd9d8392917]++;}}void 
-DATARMNETe377e0368d(u8 DATARMNETded3da1a77,u8 DATARMNET5447204733){struct 
-DATARMNET63d7680df2*DATARMNET3f85732c70=NULL;struct list_head*
-DATARMNET7b34b7b5be=NULL,*next=NULL;int DATARMNET42a992465f;u32 
+[DATARMNET42a992465f].DATARMNETef866573e0=(0xd26+209-0xdf6);DATARMNET83dcd391f0(
+DATARMNET14d6334da6,DATARMNET42a992465f,(0xd2d+202-0xdf7),DATARMNETea08087fc0,
+(0xd26+209-0xdf6));DATARMNETfb7007f025();if(hrtimer_active(&DATARMNETba5ea4329f(
+DATARMNET42a992465f)))hrtimer_cancel(&DATARMNETba5ea4329f(DATARMNET42a992465f));
+hrtimer_start(&DATARMNETba5ea4329f(DATARMNET42a992465f),ns_to_ktime(
+DATARMNETba6017a3a9*DATARMNET68fc0be252),HRTIMER_MODE_REL);DATARMNETb7ddf3c5dd[
+DATARMNETd9d8392917]++;}}void DATARMNETe377e0368d(u8 DATARMNETded3da1a77,u8 
+DATARMNET5447204733){struct DATARMNET63d7680df2*DATARMNET3f85732c70=NULL;struct 
+list_head*DATARMNET7b34b7b5be=NULL,*next=NULL;int DATARMNET42a992465f;u32 
 DATARMNET61ab18a4bd;u32 DATARMNETed7800fc72=(0xd2d+202-0xdf7);u32 
 DATARMNETa0df5de99d=(0xd2d+202-0xdf7);u32 DATARMNETe56f4fbbe6=(0xd2d+202-0xdf7);
 u32 DATARMNET8bf94cc2f7=(0xd2d+202-0xdf7);u32 DATARMNET76192fa639=
@@ -602,8 +626,20 @@ DATARMNETecc0627c70.DATARMNETa2e32cdd3a){if(hrtimer_active(&DATARMNETecc0627c70.
 DATARMNET6fd692fc7a))hrtimer_cancel(&DATARMNETecc0627c70.DATARMNET6fd692fc7a);
 hrtimer_start(&DATARMNETecc0627c70.DATARMNET6fd692fc7a,ns_to_ktime(
 DATARMNET4ac8af832c*DATARMNET68fc0be252),HRTIMER_MODE_REL);}DATARMNET14ed771dfb[
-DATARMNETd45c383019]++;}spin_unlock_bh(&DATARMNET3764d083f0);}void 
-DATARMNET495dab3d72(struct sk_buff*skb,struct DATARMNET63d7680df2*
+DATARMNETd45c383019]++;}spin_unlock_bh(&DATARMNET3764d083f0);}static void 
+DATARMNET4df6b012fb(struct DATARMNET63d7680df2*node_p){u32 DATARMNETe3a3ba6840=
+node_p->DATARMNETae4b27456e.DATARMNET6215127f48;u32 DATARMNET32b367a6fd=node_p->
+DATARMNETae4b27456e.DATARMNETbaa5765693;if(node_p->DATARMNET85c698ec34||!
+DATARMNETe3a3ba6840)return;DATARMNETb1157fd5c4(node_p->map_cpu);if(
+DATARMNET15138f8fcb(node_p))return;if(!DATARMNETe02152c351(node_p,
+(0xd2d+202-0xdf7),DATARMNET0b15fd8b54))return;DATARMNETb7ddf3c5dd[
+DATARMNET51bd9b5b87]++;DATARMNETecc0627c70.DATARMNETc252a1f55d-=
+DATARMNET32b367a6fd;DATARMNETecc0627c70.DATARMNETa2e32cdd3a-=DATARMNETe3a3ba6840
+;DATARMNET0997c5650d[node_p->map_cpu].DATARMNET4133fc9428-=DATARMNETe3a3ba6840;
+node_p->DATARMNETae4b27456e.DATARMNET35234676d4=(0xd2d+202-0xdf7);
+DATARMNETb1157fd5c4(node_p->map_cpu);node_p->queue_head=DATARMNETeb3978575d(
+node_p->map_cpu);}void DATARMNET495dab3d72(struct sk_buff*skb,struct 
+DATARMNET63d7680df2*
 DATARMNET63b1a086d5,struct rmnet_shs_clnt_s*DATARMNET0bf01e7c6f){u8 
 DATARMNET7d63e92341=(0xd2d+202-0xdf7);
 #ifdef DATARMNETdddae6afa8
@@ -631,31 +667,32 @@ DATARMNETae4b27456e.head=skb;DATARMNET63b1a086d5->DATARMNETae4b27456e.tail=skb;}
 DATARMNET63b1a086d5->DATARMNETae4b27456e.DATARMNET6215127f48+=(0xd26+209-0xdf6);
 DATARMNETecc0627c70.DATARMNETa2e32cdd3a+=(0xd26+209-0xdf6);if(unlikely(
 DATARMNET7d63e92341))DATARMNETe377e0368d((0xd2d+202-0xdf7),DATARMNET0b15fd8b54);
-DATARMNET52de1f3dc0(DATARMNET720469c0a9,DATARMNETf5c836f9ae,DATARMNET63b1a086d5
-->DATARMNETae4b27456e.DATARMNET6215127f48,DATARMNET63b1a086d5->
-DATARMNETae4b27456e.DATARMNETbaa5765693,DATARMNETecc0627c70.DATARMNETa2e32cdd3a,
-DATARMNETecc0627c70.DATARMNETc252a1f55d,skb,DATARMNET63b1a086d5);}static void 
-DATARMNETa7afc8cdaa(struct work_struct*DATARMNET33110a3ff5){DATARMNET52de1f3dc0(
-DATARMNET4510abc30d,DATARMNET816bb1e327,(0xd2d+202-0xdf7),DATARMNETecc0627c70.
-DATARMNET34097703c8,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);if(
-DATARMNETecc0627c70.DATARMNETa2e32cdd3a&&DATARMNETecc0627c70.DATARMNET34097703c8
-==DATARMNETb3e3b2a799){local_bh_disable();DATARMNETa4bf9fbf64((0xd2d+202-0xdf7),
-DATARMNET5b5927fd7e);local_bh_enable();}DATARMNET52de1f3dc0(DATARMNET4510abc30d,
-DATARMNETf311f20c00,(0xd2d+202-0xdf7),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-(0x16e8+787-0xc0c),NULL,NULL);}enum hrtimer_restart DATARMNET0a73c53ae6(struct 
-hrtimer*DATARMNET6e4292679f){enum hrtimer_restart ret=HRTIMER_NORESTART;
-DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNET237e7bd5f6,DATARMNETecc0627c70.
-DATARMNET34097703c8,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-NULL,NULL);if(DATARMNETecc0627c70.DATARMNETa2e32cdd3a>(0xd2d+202-0xdf7)){if(
-DATARMNETecc0627c70.DATARMNET34097703c8==DATARMNET7bc926fdbe){
-DATARMNETecc0627c70.DATARMNET34097703c8=DATARMNETb3e3b2a799;hrtimer_forward(
-DATARMNET6e4292679f,hrtimer_cb_get_time(DATARMNET6e4292679f),ns_to_ktime(
-DATARMNET00d5787aad));ret=HRTIMER_RESTART;DATARMNET52de1f3dc0(
-DATARMNET4510abc30d,DATARMNETf16e78412b,DATARMNETecc0627c70.DATARMNETa2e32cdd3a,
-(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);}else if(
-DATARMNETecc0627c70.DATARMNET34097703c8==DATARMNET8dcf06727b){
-DATARMNETecc0627c70.DATARMNET34097703c8=DATARMNET7bc926fdbe;}else if(
-DATARMNETecc0627c70.DATARMNET34097703c8==DATARMNETb3e3b2a799){
+else if(unlikely(DATARMNET63b1a086d5->DATARMNET88d372a2ae)&&DATARMNET654bd3aabc)
+DATARMNET4df6b012fb(DATARMNET63b1a086d5);DATARMNET52de1f3dc0(DATARMNET720469c0a9
+,DATARMNETf5c836f9ae,DATARMNET63b1a086d5->DATARMNETae4b27456e.
+DATARMNET6215127f48,DATARMNET63b1a086d5->DATARMNETae4b27456e.DATARMNETbaa5765693
+,DATARMNETecc0627c70.DATARMNETa2e32cdd3a,DATARMNETecc0627c70.DATARMNETc252a1f55d
+,skb,DATARMNET63b1a086d5);}static void DATARMNETa7afc8cdaa(struct work_struct*
+DATARMNET33110a3ff5){DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNET816bb1e327
+,(0xd2d+202-0xdf7),DATARMNETecc0627c70.DATARMNET34097703c8,(0x16e8+787-0xc0c),
+(0x16e8+787-0xc0c),NULL,NULL);if(DATARMNETecc0627c70.DATARMNETa2e32cdd3a&&
+DATARMNETecc0627c70.DATARMNET34097703c8==DATARMNETb3e3b2a799){local_bh_disable()
+;DATARMNETa4bf9fbf64((0xd2d+202-0xdf7),DATARMNET5b5927fd7e);local_bh_enable();}
+DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNETf311f20c00,(0xd2d+202-0xdf7),
+(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);}enum 
+hrtimer_restart DATARMNET0a73c53ae6(struct hrtimer*DATARMNET6e4292679f){enum 
+hrtimer_restart ret=HRTIMER_NORESTART;DATARMNET52de1f3dc0(DATARMNET4510abc30d,
+DATARMNET237e7bd5f6,DATARMNETecc0627c70.DATARMNET34097703c8,(0x16e8+787-0xc0c),
+(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);if(DATARMNETecc0627c70.
+DATARMNETa2e32cdd3a>(0xd2d+202-0xdf7)){if(DATARMNETecc0627c70.
+DATARMNET34097703c8==DATARMNET7bc926fdbe){DATARMNETecc0627c70.
+DATARMNET34097703c8=DATARMNETb3e3b2a799;hrtimer_forward(DATARMNET6e4292679f,
+hrtimer_cb_get_time(DATARMNET6e4292679f),ns_to_ktime(DATARMNET00d5787aad));ret=
+HRTIMER_RESTART;DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNETf16e78412b,
+DATARMNETecc0627c70.DATARMNETa2e32cdd3a,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
+(0x16e8+787-0xc0c),NULL,NULL);}else if(DATARMNETecc0627c70.DATARMNET34097703c8==
+DATARMNET8dcf06727b){DATARMNETecc0627c70.DATARMNET34097703c8=DATARMNET7bc926fdbe
+;}else if(DATARMNETecc0627c70.DATARMNET34097703c8==DATARMNETb3e3b2a799){
 DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNET83147a2e7d,DATARMNETecc0627c70.
 DATARMNET34097703c8,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
 NULL,NULL);schedule_work((struct work_struct*)&shs_rx_work);}}return ret;}enum 
@@ -214,3 +214,17 @@ DATARMNET68d84e7b98,ulong,NULL,(0xcb7+5769-0x221c));MODULE_PARM_DESC(
 DATARMNET68d84e7b98,
 "\x72\x6d\x6e\x65\x74\x20\x73\x68\x73\x20\x63\x72\x74\x69\x63\x61\x6c\x20\x65\x72\x72\x6f\x72\x20\x74\x79\x70\x65"
 );
+unsigned int DATARMNET654bd3aabc __read_mostly=(0xd26+209-0xdf6);module_param(
+DATARMNET654bd3aabc,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNET654bd3aabc,
+"\x45\x6e\x61\x62\x6c\x65\x20\x66\x65\x6e\x63\x65\x20\x62\x61\x73\x65\x64\x20\x66\x6c\x6f\x77\x20\x6d\x69\x67\x72\x61\x74\x69\x6f\x6e"
+);unsigned long DATARMNETd8e270cda0[DATARMNET0746c2adf5];module_param_array(
+DATARMNETd8e270cda0,ulong,NULL,(0xcb7+5769-0x221c));MODULE_PARM_DESC(
+DATARMNETd8e270cda0,
+"\x46\x6c\x6f\x77\x20\x6d\x69\x67\x72\x61\x74\x69\x6f\x6e\x20\x66\x65\x6e\x63\x65\x20\x77\x61\x69\x74\x20\x68\x69\x73\x74\x6f\x67\x72\x61\x6d\x20\x69\x6e\x20\x75\x73\x65\x63"
+);
+unsigned long DATARMNET737bdec585[DATARMNET5167689119];module_param_array(
+DATARMNET737bdec585,ulong,NULL,(0xcb7+5769-0x221c));MODULE_PARM_DESC(
+DATARMNET737bdec585,
+"\x53\x48\x53\x20\x65\x76\x65\x6e\x74\x20\x72\x69\x6e\x67\x20\x70\x72\x6f\x64\x75\x63\x65\x64\x2c\x20\x64\x72\x6f\x70\x70\x65\x64\x20\x61\x6e\x64\x20\x61\x74\x74\x61\x63\x68\x20\x66\x61\x69\x6c\x75\x72\x65\x73"
+);
@@ -51,8 +51,11 @@ DATARMNETc6782fed88];extern unsigned int DATARMNET4ac8af832c;extern unsigned int
 ];extern unsigned int DATARMNET443cf5aaaf[DATARMNETc6782fed88];extern unsigned 
 int DATARMNETd75e474598[DATARMNETc6782fed88];extern unsigned int 
 DATARMNET25c61a512c;extern unsigned int DATARMNET1ad396a890;extern unsigned int 
-DATARMNET756bdd424a;extern unsigned int DATARMNET58b009b16b __read_mostly;extern
- unsigned long DATARMNET68d84e7b98[DATARMNETf3110711cb];extern unsigned long 
+DATARMNET756bdd424a;extern unsigned int DATARMNET58b009b16b __read_mostly;extern 
+unsigned int DATARMNET654bd3aabc __read_mostly;extern unsigned long 
+DATARMNETd8e270cda0[DATARMNET0746c2adf5];extern unsigned long 
+DATARMNET737bdec585[DATARMNET5167689119];extern unsigned long 
+DATARMNET68d84e7b98[DATARMNETf3110711cb];extern unsigned long 
 DATARMNET930a441406[DATARMNET0d61981934];
 #endif
 
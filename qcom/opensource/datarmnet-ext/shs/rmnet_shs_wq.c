@@ -613,13 +613,15 @@ DATARMNETe46ae760db||!DATARMNETb436c3f30b||!DATARMNETf0fb155a9c||!
 DATARMNET3208cd0982){DATARMNET68d84e7b98[DATARMNETac729c3d29]++;return;}
 list_sort(NULL,DATARMNETe46ae760db,&DATARMNET85af86a36d);list_sort(NULL,
 DATARMNETb436c3f30b,&DATARMNETd5c15f1ff3);list_sort(NULL,DATARMNET3208cd0982,&
-DATARMNET3c489db64a);DATARMNET5157210c44(DATARMNETe46ae760db);
-DATARMNET0e273eab79(DATARMNETb436c3f30b);DATARMNETe15af8eb6d(DATARMNETf0fb155a9c
-);DATARMNET78f3a0ca4f(DATARMNET3208cd0982);DATARMNET78666f33a1();
-DATARMNET5945236cd3(DATARMNET7afb49ee3f);trace_rmnet_shs_wq_high(
-DATARMNETa0ecb9daac,DATARMNET1fc50aac59,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);}void DATARMNET95736008d9(void)
-{struct DATARMNETc8fdbf9c85*DATARMNET7bea4a06a6=&DATARMNET6cdd58e74c;struct 
+DATARMNET3c489db64a);if(DATARMNETded7f7207f()){DATARMNET3c73c316fd(
+DATARMNETe46ae760db,DATARMNETb436c3f30b,DATARMNETf0fb155a9c);}else{
+DATARMNET5157210c44(DATARMNETe46ae760db);DATARMNET0e273eab79(DATARMNETb436c3f30b
+);DATARMNETe15af8eb6d(DATARMNETf0fb155a9c);}DATARMNET78f3a0ca4f(
+DATARMNET3208cd0982);DATARMNET78666f33a1();DATARMNET5945236cd3(
+DATARMNET7afb49ee3f);trace_rmnet_shs_wq_high(DATARMNETa0ecb9daac,
+DATARMNET1fc50aac59,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
+(0x16e8+787-0xc0c),NULL,NULL);}void DATARMNET95736008d9(void){struct 
+DATARMNETc8fdbf9c85*DATARMNET7bea4a06a6=&DATARMNET6cdd58e74c;struct 
 DATARMNET228056d4b7*DATARMNET373ff1422a;u64 DATARMNETc7c10881f4,
 DATARMNET4a7d30059b,DATARMNETed01f76643;u64 DATARMNET629c75e1fa,
 DATARMNET253a9fc708;u64 DATARMNET264b01f4d5,DATARMNET53ce143c7e=
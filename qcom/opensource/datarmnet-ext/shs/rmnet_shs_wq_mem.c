@@ -16,6 +16,7 @@
 #include "rmnet_shs_wq_mem.h"
 #include <linux/proc_fs.h>
 #include <linux/refcount.h>
+#include <linux/vmalloc.h>
 MODULE_LICENSE("\x47\x50\x4c\x20\x76\x32");struct proc_dir_entry*
 DATARMNETe4c5563cdb;struct DATARMNET33582f7450 DATARMNET63c47f3c37[
 DATARMNETc6782fed88];struct DATARMNETf44cda1bf2 DATARMNET22b4032799[
@@ -29,49 +30,50 @@ DATARMNETe46ae760db);struct list_head DATARMNET3208cd0982=LIST_HEAD_INIT(
 DATARMNET3208cd0982);struct DATARMNETa41d4c4a12*DATARMNET410036d5ac;struct 
 DATARMNETa41d4c4a12*DATARMNET19c47a9f3a;struct DATARMNETa41d4c4a12*
 DATARMNET22e796eff3;struct DATARMNETa41d4c4a12*DATARMNET9b8000d2a7;struct 
-DATARMNETa41d4c4a12*DATARMNET67d31dc40a;static void DATARMNET6069bf201a(struct 
-vm_area_struct*vma){return;}static void DATARMNET0f6b7f3f93(struct 
-vm_area_struct*vma){return;}static vm_fault_t DATARMNET9efe8a3d18(struct 
-vm_fault*DATARMNETca901b4e1f){struct page*page=NULL;struct DATARMNETa41d4c4a12*
-DATARMNET54338da2ff;DATARMNET6bf538fa23();if(DATARMNET410036d5ac){
-DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)DATARMNETca901b4e1f->vma->
-vm_private_data;if(DATARMNET54338da2ff->data){page=virt_to_page(
-DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page=page;}else{
-DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{DATARMNETaea4c85748();
-return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return(0xd2d+202-0xdf7);}static 
-vm_fault_t DATARMNETd005aa7157(struct vm_fault*DATARMNETca901b4e1f){struct page*
-page=NULL;struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;DATARMNET6bf538fa23();
-if(DATARMNET19c47a9f3a){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
+DATARMNETa41d4c4a12*DATARMNET67d31dc40a;static void __rcu*DATARMNET22915505c6;
+static int DATARMNET7c24840301;
+static void DATARMNET6069bf201a(struct vm_area_struct*vma){return;}static void 
+DATARMNET0f6b7f3f93(struct vm_area_struct*vma){return;}static vm_fault_t 
+DATARMNET9efe8a3d18(struct vm_fault*DATARMNETca901b4e1f){struct page*page=NULL;
+struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;DATARMNET6bf538fa23();if(
+DATARMNET410036d5ac){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
 DATARMNETca901b4e1f->vma->vm_private_data;if(DATARMNET54338da2ff->data){page=
 virt_to_page(DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page
 =page;}else{DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{
 DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return
-(0xd2d+202-0xdf7);}static vm_fault_t DATARMNETb3a7180954(struct vm_fault*
+(0xd2d+202-0xdf7);}static vm_fault_t DATARMNETd005aa7157(struct vm_fault*
 DATARMNETca901b4e1f){struct page*page=NULL;struct DATARMNETa41d4c4a12*
-DATARMNET54338da2ff;DATARMNET6bf538fa23();if(DATARMNET22e796eff3){
+DATARMNET54338da2ff;DATARMNET6bf538fa23();if(DATARMNET19c47a9f3a){
 DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)DATARMNETca901b4e1f->vma->
 vm_private_data;if(DATARMNET54338da2ff->data){page=virt_to_page(
 DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page=page;}else{
 DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{DATARMNETaea4c85748();
 return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return(0xd2d+202-0xdf7);}static 
-vm_fault_t DATARMNETe35719979c(struct vm_fault*DATARMNETca901b4e1f){struct page*
+vm_fault_t DATARMNETb3a7180954(struct vm_fault*DATARMNETca901b4e1f){struct page*
 page=NULL;struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;DATARMNET6bf538fa23();
-if(DATARMNET9b8000d2a7){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
+if(DATARMNET22e796eff3){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
 DATARMNETca901b4e1f->vma->vm_private_data;if(DATARMNET54338da2ff->data){page=
 virt_to_page(DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page
 =page;}else{DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{
 DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return
-(0xd2d+202-0xdf7);}static vm_fault_t DATARMNETe421c4e1db(struct vm_fault*
+(0xd2d+202-0xdf7);}static vm_fault_t DATARMNETe35719979c(struct vm_fault*
 DATARMNETca901b4e1f){struct page*page=NULL;struct DATARMNETa41d4c4a12*
-DATARMNET54338da2ff;DATARMNET6bf538fa23();if(DATARMNET67d31dc40a){
+DATARMNET54338da2ff;DATARMNET6bf538fa23();if(DATARMNET9b8000d2a7){
 DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)DATARMNETca901b4e1f->vma->
 vm_private_data;if(DATARMNET54338da2ff->data){page=virt_to_page(
 DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page=page;}else{
 DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{DATARMNETaea4c85748();
 return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return(0xd2d+202-0xdf7);}static 
-const struct vm_operations_struct DATARMNETfa4e968e7d={.close=
-DATARMNET0f6b7f3f93,.open=DATARMNET6069bf201a,.fault=DATARMNET9efe8a3d18,};
-static const struct vm_operations_struct DATARMNETe9c0626068={.close=
+vm_fault_t DATARMNETe421c4e1db(struct vm_fault*DATARMNETca901b4e1f){struct page*
+page=NULL;struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;DATARMNET6bf538fa23();
+if(DATARMNET67d31dc40a){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
+DATARMNETca901b4e1f->vma->vm_private_data;if(DATARMNET54338da2ff->data){page=
+virt_to_page(DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page
+=page;}else{DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{
+DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return
+(0xd2d+202-0xdf7);}static const struct vm_operations_struct DATARMNETfa4e968e7d=
+{.close=DATARMNET0f6b7f3f93,.open=DATARMNET6069bf201a,.fault=DATARMNET9efe8a3d18
+,};static const struct vm_operations_struct DATARMNETe9c0626068={.close=
 DATARMNET0f6b7f3f93,.open=DATARMNET6069bf201a,.fault=DATARMNETd005aa7157,};
 static const struct vm_operations_struct DATARMNET9a89317a86={.close=
 DATARMNET0f6b7f3f93,.open=DATARMNET6069bf201a,.fault=DATARMNETb3a7180954,};
@@ -244,7 +246,75 @@ DATARMNET59b415aded,.proc_read=DATARMNETaf2aa1d70f,.proc_write=
 DATARMNET4761dcd3fd,};static const struct proc_ops DATARMNET6eb63d9ad0={.
 proc_mmap=DATARMNET444e2eb654,.proc_open=DATARMNETb9d10d8cc0,.proc_release=
 DATARMNET18464ea5e3,.proc_read=DATARMNETaf2aa1d70f,.proc_write=
-DATARMNET4761dcd3fd,};void DATARMNET28a80d526e(struct DATARMNET6c78e47d24*
+DATARMNET4761dcd3fd,};static int DATARMNETfebd0558fa(struct file*
+DATARMNET3cc114dce0,struct vm_area_struct*vma){void*ring;int ret=-ENODEV;if(vma
+->vm_end-vma->vm_start>DATARMNET50cd9192d2)return-EINVAL;ring=
+rcu_dereference_protected(DATARMNET22915505c6,(0xd26+209-0xdf6));if(ring)ret=
+remap_vmalloc_range(vma,ring,vma->vm_pgoff);return ret;}static int 
+DATARMNET19af79e113(struct inode*inode,struct file*DATARMNET3cc114dce0){struct 
+DATARMNETe4eabe1aaa*hdr;void*ring=NULL;rm_err("\x25\x73",
+"\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x6f\x70\x65\x6e\x20\x65\x76\x65\x6e\x74\x73\x20\x2d\x20\x65\x6e\x74\x72\x79\x0a"
+);if(!rcu_access_pointer(DATARMNET22915505c6)){ring=vmalloc_user(
+DATARMNET50cd9192d2);if(!ring){DATARMNET737bdec585[DATARMNETd44c1c744c]++;return
+-ENOMEM;}hdr=ring;hdr->DATARMNETd1221d8d98=DATARMNETe185c60d69;hdr->
+DATARMNET62c3f66230=DATARMNETfe5914c73f;hdr->DATARMNET3c260ccbdb=sizeof(struct 
+DATARMNETdfa8487bfe);hdr->DATARMNET79ead79e68=PAGE_SIZE;hdr->DATARMNET4f1c0e9a27
+=nr_cpu_ids;hdr->DATARMNETb2d8e6a31c=DATARMNET0b6e2c9d41;hdr->
+DATARMNET6a0f93d1e4=SMP_CACHE_BYTES;}DATARMNET6bf538fa23();
+if(!rcu_access_pointer(DATARMNET22915505c6)){if(!ring){DATARMNETaea4c85748();
+DATARMNET737bdec585[DATARMNETd44c1c744c]++;return-EAGAIN;}rcu_assign_pointer(
+DATARMNET22915505c6,ring);ring=NULL;}DATARMNET7c24840301++;DATARMNETaea4c85748()
+;vfree(ring);return(0xd2d+202-0xdf7);}static int DATARMNETd797d49ba5(struct 
+inode*inode,struct file*DATARMNET3cc114dce0){void*ring=NULL;rm_err("\x25\x73",
+"\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x72\x65\x6c\x65\x61\x73\x65\x20\x65\x76\x65\x6e\x74\x73\x20\x2d\x20\x65\x6e\x74\x72\x79\x0a"
+);DATARMNET6bf538fa23();if(DATARMNET7c24840301&&!--DATARMNET7c24840301){ring=
+rcu_dereference_protected(DATARMNET22915505c6,(0xd26+209-0xdf6));
+RCU_INIT_POINTER(DATARMNET22915505c6,NULL);}DATARMNETaea4c85748();if(ring){
+synchronize_rcu();vfree(ring);}return(0xd2d+202-0xdf7);}static const struct 
+proc_ops DATARMNETfb4493bb4b={.proc_mmap=DATARMNETfebd0558fa,.proc_open=
+DATARMNET19af79e113,.proc_release=DATARMNETd797d49ba5,.proc_read=
+DATARMNETaf2aa1d70f,.proc_write=DATARMNET4761dcd3fd,};bool DATARMNETded7f7207f(
+void){return rcu_access_pointer(DATARMNET22915505c6)!=NULL;}void 
+DATARMNET83dcd391f0(u16 DATARMNETa6e70aefd6,u16 DATARMNET8a2335a906,u32 hash,u64 
+DATARMNET1c6a6e8438,u64 DATARMNET23bc8a1008){struct DATARMNETe4eabe1aaa*hdr;
+struct DATARMNET8e2b51c7d0*DATARMNET5f3d0b6a19;struct DATARMNETdfa8487bfe*
+DATARMNETbecb2851a0;unsigned long flags;u64 head;rcu_read_lock();hdr=
+rcu_dereference(DATARMNET22915505c6);if(!hdr){rcu_read_unlock();return;}
+local_irq_save(flags);DATARMNET5f3d0b6a19=(struct DATARMNET8e2b51c7d0*)((char*)
+hdr+PAGE_SIZE+smp_processor_id()*DATARMNET0b6e2c9d41);head=DATARMNET5f3d0b6a19->
+DATARMNET0c0a2c66a0;if(head-smp_load_acquire(&DATARMNET5f3d0b6a19->
+DATARMNET61d53b34aa)>=DATARMNETfe5914c73f){WRITE_ONCE(DATARMNET5f3d0b6a19->
+DATARMNETc3e727067e,DATARMNET5f3d0b6a19->DATARMNETc3e727067e+(0xd26+209-0xdf6));
+DATARMNET737bdec585[DATARMNET9059f3ae29]++;goto DATARMNET557c8ae61a;}
+DATARMNETbecb2851a0=(struct DATARMNETdfa8487bfe*)((char*)DATARMNET5f3d0b6a19+
+SMP_CACHE_BYTES)+(head&(DATARMNETfe5914c73f-(0xd26+209-0xdf6)));
+DATARMNETbecb2851a0->DATARMNET85486d4793=head;DATARMNETbecb2851a0->
+DATARMNET5ff941e305=ktime_get_ns();DATARMNETbecb2851a0->DATARMNET1c6a6e8438=
+DATARMNET1c6a6e8438;DATARMNETbecb2851a0->DATARMNET23bc8a1008=DATARMNET23bc8a1008
+;DATARMNETbecb2851a0->hash=hash;DATARMNETbecb2851a0->DATARMNETa6e70aefd6=
+DATARMNETa6e70aefd6;DATARMNETbecb2851a0->DATARMNET8a2335a906=DATARMNET8a2335a906
+;smp_store_release(&DATARMNET5f3d0b6a19->DATARMNET0c0a2c66a0,head+
+(0xd26+209-0xdf6));DATARMNET737bdec585[DATARMNETa7aff0dcc3]++;
+DATARMNET557c8ae61a:local_irq_restore(flags);rcu_read_unlock();}void 
+DATARMNET3c73c316fd(struct list_head*DATARMNETe46ae760db,struct list_head*
+DATARMNETb436c3f30b,struct list_head*DATARMNETf0fb155a9c){struct 
+DATARMNET47a6995138*DATARMNETace28a2c7f;struct DATARMNET09a412b1c6*
+DATARMNET4238158b2a;struct DATARMNETa52c09a590*DATARMNET0f551e8a47;if(!
+DATARMNETe46ae760db||!DATARMNETb436c3f30b||!DATARMNETf0fb155a9c){
+DATARMNET68d84e7b98[DATARMNETac729c3d29]++;return;}list_for_each_entry(
+DATARMNETace28a2c7f,DATARMNETe46ae760db,DATARMNET02523bfb57)DATARMNET83dcd391f0(
+DATARMNETc1bffb80ed,DATARMNETace28a2c7f->DATARMNET42a992465f,(0xd2d+202-0xdf7),
+DATARMNETace28a2c7f->DATARMNET18b7a5b761,DATARMNETace28a2c7f->
+DATARMNET4da6031170);list_for_each_entry(DATARMNET4238158b2a,DATARMNETb436c3f30b
+,DATARMNETd502c0412a){if(!DATARMNET4238158b2a->DATARMNET324c1a8f98)continue;
+DATARMNET83dcd391f0(DATARMNET2106d3f0a9,DATARMNET4238158b2a->DATARMNET42a992465f
+,DATARMNET4238158b2a->hash,DATARMNET4238158b2a->DATARMNET324c1a8f98,
+DATARMNET4238158b2a->DATARMNET253a9fc708);}list_for_each_entry(
+DATARMNET0f551e8a47,DATARMNETf0fb155a9c,DATARMNET6f898987df){if(!
+DATARMNET0f551e8a47->DATARMNET324c1a8f98)continue;DATARMNET83dcd391f0(
+DATARMNET46755501a4,DATARMNET0f551e8a47->DATARMNET42a992465f,DATARMNET0f551e8a47
+->hash,DATARMNET0f551e8a47->DATARMNET324c1a8f98,DATARMNET0f551e8a47->
+DATARMNETbb80fccd97);}}void DATARMNET28a80d526e(struct DATARMNET6c78e47d24*
 DATARMNETd2a694d52a,struct list_head*DATARMNETf0fb155a9c){struct 
 DATARMNETa52c09a590*DATARMNET0f551e8a47;if(!DATARMNETd2a694d52a||!
 DATARMNETf0fb155a9c){DATARMNET68d84e7b98[DATARMNETac729c3d29]++;return;}
@@ -518,13 +588,16 @@ DATARMNETe84fbaa6af);proc_create(DATARMNETeb2a21dd7c,(0xdb7+6665-0x261c),
 DATARMNETe4c5563cdb,&DATARMNET8fe5f892a8);proc_create(DATARMNET1c4ea23858,
 (0xdb7+6665-0x261c),DATARMNETe4c5563cdb,&DATARMNET0104d40d4b);proc_create(
 DATARMNETe98d39b779,(0xdb7+6665-0x261c),DATARMNETe4c5563cdb,&DATARMNET6eb63d9ad0
-);DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;DATARMNET19c47a9f3a=NULL;
+);proc_create(DATARMNETcbea538104,(0xdb7+6665-0x261c),DATARMNETe4c5563cdb,&
+DATARMNETfb4493bb4b);DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;
+DATARMNET19c47a9f3a=NULL;
 DATARMNET22e796eff3=NULL;DATARMNET9b8000d2a7=NULL;DATARMNET67d31dc40a=NULL;
 DATARMNETaea4c85748();}void DATARMNET28d33bd09f(void){remove_proc_entry(
 DATARMNET41be983a65,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET5ddc91451c,
 DATARMNETe4c5563cdb);remove_proc_entry(DATARMNETeb2a21dd7c,DATARMNETe4c5563cdb);
 remove_proc_entry(DATARMNET1c4ea23858,DATARMNETe4c5563cdb);remove_proc_entry(
-DATARMNETe98d39b779,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET6517f07a36,
-NULL);DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;DATARMNET19c47a9f3a=NULL;
+DATARMNETe98d39b779,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNETcbea538104,
+DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET6517f07a36,NULL);
+DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;DATARMNET19c47a9f3a=NULL;
 DATARMNET22e796eff3=NULL;DATARMNET9b8000d2a7=NULL;DATARMNET67d31dc40a=NULL;
 DATARMNETaea4c85748();}
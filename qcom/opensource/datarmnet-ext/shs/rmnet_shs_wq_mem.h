@@ -30,6 +30,13 @@
 #define DATARMNETe4d15b9332 ((0xec7+1166-0x132d))
 #define DATARMNET9ae5f81f71 ((0xeb7+1158-0x132d))
 #define DATARMNET29d29f44cf ((0xd2d+202-0xdf7))
+#define DATARMNETcbea538104 \
+"\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x65\x76\x65\x6e\x74\x73"
+#define DATARMNETe185c60d69 ((0xd1f+216-0xdf5))
+#define DATARMNETfe5914c73f ((0xdf7+2629-0x143c))
+#define DATARMNET0b6e2c9d41 (PAGE_ALIGN(SMP_CACHE_BYTES+DATARMNETfe5914c73f*\
+sizeof(struct DATARMNETdfa8487bfe)))
+#define DATARMNET50cd9192d2 (PAGE_SIZE+nr_cpu_ids*DATARMNET0b6e2c9d41)
 struct __attribute__((__packed__))DATARMNET33582f7450{u64 DATARMNET18b7a5b761;
 u64 DATARMNET4da6031170;u64 DATARMNET4df302dbd6;u16 DATARMNET42a992465f;};struct
  __attribute__((__packed__))DATARMNETf44cda1bf2{u64 DATARMNET324c1a8f98;u64 
@@ -48,8 +55,17 @@ coal_udp_bytes;u64 DATARMNET257fc4b2d4;u64 DATARMNET4eb77c78e6;u8 mux_id;};
 extern struct list_head DATARMNET6c23f11e81;extern struct list_head 
 DATARMNETf91b305f4e;extern struct list_head DATARMNET3208cd0982;extern struct 
 list_head DATARMNETe46ae760db;enum{DATARMNETbd4083a6a4=(0x24f5+499-0x16e8)};
-struct DATARMNETa41d4c4a12{char*data;refcount_t refcnt;};void 
-DATARMNET28a80d526e(struct DATARMNET6c78e47d24*DATARMNETd2a694d52a,struct 
+struct DATARMNETa41d4c4a12{char*data;refcount_t refcnt;};enum 
+DATARMNETba3201c5cc{DATARMNET8c53b734ff=(0xd26+209-0xdf6),DATARMNETc1bffb80ed,
+DATARMNET2106d3f0a9,DATARMNET46755501a4,DATARMNET14d6334da6};struct 
+DATARMNETe4eabe1aaa{u32 DATARMNETd1221d8d98;u32 DATARMNET62c3f66230;u32 
+DATARMNET3c260ccbdb;u32 DATARMNET79ead79e68;u32 DATARMNET4f1c0e9a27;u32 
+DATARMNETb2d8e6a31c;u32 DATARMNET6a0f93d1e4;u32 DATARMNET0d95e1b7c2;};struct 
+DATARMNET8e2b51c7d0{u64 DATARMNET0c0a2c66a0;u64 DATARMNET61d53b34aa;u64 
+DATARMNETc3e727067e;};struct DATARMNETdfa8487bfe{u64 
+DATARMNET85486d4793;u64 DATARMNET5ff941e305;u64 DATARMNET1c6a6e8438;u64 
+DATARMNET23bc8a1008;u32 hash;u16 DATARMNETa6e70aefd6;u16 DATARMNET8a2335a906;};
+void DATARMNET28a80d526e(struct DATARMNET6c78e47d24*DATARMNETd2a694d52a,struct 
 list_head*DATARMNETf0fb155a9c);void DATARMNET24e4475345(struct 
 DATARMNET6c78e47d24*DATARMNETd2a694d52a,struct list_head*DATARMNETb436c3f30b);
 void DATARMNET6f4b0915d3(struct DATARMNET6c78e47d24*DATARMNETd2a694d52a,struct 
@@ -64,6 +80,10 @@ DATARMNETe46ae760db);void DATARMNET0e273eab79(struct list_head*
 DATARMNETb436c3f30b);void DATARMNETe15af8eb6d(struct list_head*
 DATARMNETf0fb155a9c);void DATARMNET78f3a0ca4f(struct list_head*
 DATARMNET3208cd0982);void DATARMNET78666f33a1(void);void DATARMNETf5f83b943f(
-void);void DATARMNET28d33bd09f(void);
+void);void DATARMNET28d33bd09f(void);bool DATARMNETded7f7207f(void);void 
+DATARMNET83dcd391f0(u16 DATARMNETa6e70aefd6,u16 DATARMNET8a2335a906,u32 hash,u64 
+DATARMNET1c6a6e8438,u64 DATARMNET23bc8a1008);void DATARMNET3c73c316fd(struct 
+list_head*DATARMNETe46ae760db,struct list_head*DATARMNETb436c3f30b,struct 
+list_head*DATARMNETf0fb155a9c);
 #endif 
 
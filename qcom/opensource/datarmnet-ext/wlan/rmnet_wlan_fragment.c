@@ -13,13 +13,14 @@
 #include <linux/rcupdate.h>
 #include <linux/list.h>
 #include <linux/rculist.h>
-#include <linux/hashtable.h>
+#include <linux/jhash.h>
 #include <linux/hrtimer.h>
 #include "rmnet_wlan.h"
 #include "rmnet_wlan_stats.h"
 #include "rmnet_wlan_fragment.h"
-#define DATARMNET598d70a086 ((0xeb7+1158-0x132d))
-#define DATARMNETeaee3af609 (const_ilog2(DATARMNET598d70a086))
+#define DATARMNET598d70a086 ((0xef7+1142-0x132d))
+#define DATARMNET08d71f54bf ((0xeb7+1158-0x132d))
+#define DATARMNET75fae8c61b ((0xb9f+4175-0x19ee))
 #define DATARMNET63a285d479 (110000000)
 #define DATARMNETb7cc384fbe (10000000)
 struct DATARMNETdadb4e2c65{union{__be32 DATARMNETdfe430c2d6;struct in6_addr 
@@ -27,75 +28,137 @@ DATARMNET815cbb4bf5;};union{__be32 DATARMNET2cb607d686;struct in6_addr
 DATARMNETc3f31215b7;};__be32 id;u16 DATARMNET611d08d671;u16 DATARMNETb65c469a15;
 u8 DATARMNET0d956cc77a;};struct DATARMNET6f3b954709{struct hlist_node 
 DATARMNETe8608dd267;spinlock_t DATARMNET94b1f9ee09;struct list_head 
-DATARMNET0f34bf3ea9;struct rcu_head DATARMNET28bfe9e6ad;struct hrtimer 
-DATARMNET9f31ce5d2d;struct DATARMNETdadb4e2c65 DATARMNET54338da2ff;struct 
-DATARMNET8d3c2559ca*DATARMNET7ed5754a5c;};static DEFINE_SPINLOCK(
-DATARMNET531b038fcd);static DEFINE_HASHTABLE(DATARMNET6e79f38051,
-DATARMNETeaee3af609);static int DATARMNET24669a931d(const struct sk_buff*
-DATARMNET543491eb0f,unsigned int*DATARMNETb65c469a15,int DATARMNETbfd7eb99fe,
-unsigned short*DATARMNET0823b5e89c,int*DATARMNETfb0677cc3c){unsigned int 
-DATARMNETab6f68a65c=skb_network_offset(DATARMNET543491eb0f)+sizeof(struct 
-ipv6hdr);u8 nexthdr=ipv6_hdr(DATARMNET543491eb0f)->nexthdr;bool 
-DATARMNET1034358542;if(DATARMNET0823b5e89c)*DATARMNET0823b5e89c=
-(0xd2d+202-0xdf7);if(*DATARMNETb65c469a15){struct ipv6hdr DATARMNET982faca395,*
-DATARMNETc46d75f0b8;DATARMNETc46d75f0b8=skb_header_pointer(DATARMNET543491eb0f,*
-DATARMNETb65c469a15,sizeof(DATARMNET982faca395),&DATARMNET982faca395);if(!
-DATARMNETc46d75f0b8||(DATARMNETc46d75f0b8->version!=(0xd03+244-0xdf1)))return-
-EBADMSG;DATARMNETab6f68a65c=*DATARMNETb65c469a15+sizeof(struct ipv6hdr);nexthdr=
-DATARMNETc46d75f0b8->nexthdr;}do{struct ipv6_opt_hdr DATARMNETb18a0d17a5,*
-DATARMNET7c56b76ea0;unsigned int DATARMNET4593c3f2c2;DATARMNET1034358542=(
-nexthdr==DATARMNETbfd7eb99fe);if((!ipv6_ext_hdr(nexthdr))||nexthdr==NEXTHDR_NONE
-){if(DATARMNETbfd7eb99fe<(0xd2d+202-0xdf7)||DATARMNET1034358542)break;return-
-ENOENT;}DATARMNET7c56b76ea0=skb_header_pointer(DATARMNET543491eb0f,
-DATARMNETab6f68a65c,sizeof(DATARMNETb18a0d17a5),&DATARMNETb18a0d17a5);if(!
-DATARMNET7c56b76ea0)return-EBADMSG;if(nexthdr==NEXTHDR_ROUTING){struct 
-ipv6_rt_hdr DATARMNET942c8f7153,*DATARMNETb2650cb3cb;DATARMNETb2650cb3cb=
+DATARMNET0f34bf3ea9;struct rcu_head DATARMNET28bfe9e6ad;struct list_head 
+DATARMNETdaa01e0f2f;u64 DATARMNETbc45f647fa;struct DATARMNETdadb4e2c65 
+DATARMNET54338da2ff;struct DATARMNET8d3c2559ca*DATARMNET7ed5754a5c;u16 
+DATARMNET65e8a99cbb;u8 DATARMNET1c042bd734;u8 DATARMNET8e4e923849;};struct 
+DATARMNETc18cc7fe6a{struct hlist_head DATARMNET98cdf239a2;spinlock_t 
+DATARMNETb94b7b7d16;};static struct DATARMNETc18cc7fe6a DATARMNET94efc23b1c[
+DATARMNET598d70a086];static struct DATARMNET6f3b954709 DATARMNET4adf478552[
+DATARMNET75fae8c61b];static LIST_HEAD(DATARMNETf316ea53dd);static 
+DEFINE_SPINLOCK(DATARMNET40ef359d98);static struct list_head DATARMNET12ca4475bb
+[DATARMNET08d71f54bf];static DEFINE_SPINLOCK(DATARMNET2a6f0d390a);static struct 
+hrtimer DATARMNETaeb883af6b;static u64 DATARMNET8573319e4f;static u32 
+DATARMNET4fb191309f;static bool DATARMNET969819718c;static int 
+DATARMNET24669a931d(const struct sk_buff*DATARMNET543491eb0f,unsigned int*
+DATARMNETb65c469a15,int DATARMNETbfd7eb99fe,unsigned short*DATARMNET0823b5e89c,
+int*DATARMNETfb0677cc3c){unsigned int DATARMNETab6f68a65c=skb_network_offset(
+DATARMNET543491eb0f)+sizeof(struct ipv6hdr);u8 nexthdr=ipv6_hdr(
+DATARMNET543491eb0f)->nexthdr;bool DATARMNET1034358542;if(DATARMNET0823b5e89c)*
+DATARMNET0823b5e89c=(0xd2d+202-0xdf7);if(*DATARMNETb65c469a15){struct ipv6hdr 
+DATARMNET982faca395,*DATARMNETc46d75f0b8;DATARMNETc46d75f0b8=skb_header_pointer(
+DATARMNET543491eb0f,*DATARMNETb65c469a15,sizeof(DATARMNET982faca395),&
+DATARMNET982faca395);if(!DATARMNETc46d75f0b8||(DATARMNETc46d75f0b8->version!=
+(0xd03+244-0xdf1)))return-EBADMSG;DATARMNETab6f68a65c=*DATARMNETb65c469a15+
+sizeof(struct ipv6hdr);nexthdr=DATARMNETc46d75f0b8->nexthdr;}do{struct 
+ipv6_opt_hdr DATARMNETb18a0d17a5,*DATARMNET7c56b76ea0;unsigned int 
+DATARMNET4593c3f2c2;DATARMNET1034358542=(nexthdr==DATARMNETbfd7eb99fe);if((!
+ipv6_ext_hdr(nexthdr))||nexthdr==NEXTHDR_NONE){if(DATARMNETbfd7eb99fe<
+(0xd2d+202-0xdf7)||DATARMNET1034358542)break;return-ENOENT;}DATARMNET7c56b76ea0=
 skb_header_pointer(DATARMNET543491eb0f,DATARMNETab6f68a65c,sizeof(
-DATARMNET942c8f7153),&DATARMNET942c8f7153);if(!DATARMNETb2650cb3cb)return-
-EBADMSG;if(DATARMNETfb0677cc3c&&(*DATARMNETfb0677cc3c&IP6_FH_F_SKIP_RH)&&
-DATARMNETb2650cb3cb->segments_left==(0xd2d+202-0xdf7))DATARMNET1034358542=false;
-}if(nexthdr==NEXTHDR_FRAGMENT){unsigned short DATARMNET3ed4d6b164;__be16*
-DATARMNET748d4c9015;if(DATARMNETfb0677cc3c)*DATARMNETfb0677cc3c|=IP6_FH_F_FRAG;
-DATARMNET748d4c9015=skb_header_pointer(DATARMNET543491eb0f,DATARMNETab6f68a65c+
-offsetof(struct frag_hdr,frag_off),sizeof(DATARMNET3ed4d6b164),&
-DATARMNET3ed4d6b164);if(!DATARMNET748d4c9015)return-EBADMSG;DATARMNET3ed4d6b164=
-ntohs(*DATARMNET748d4c9015)&~(0xcfc+267-0xe00);if(DATARMNET3ed4d6b164){if(
-DATARMNETbfd7eb99fe<(0xd2d+202-0xdf7)&&((!ipv6_ext_hdr(DATARMNET7c56b76ea0->
-nexthdr))||DATARMNET7c56b76ea0->nexthdr==NEXTHDR_NONE)){if(DATARMNET0823b5e89c)*
-DATARMNET0823b5e89c=DATARMNET3ed4d6b164;return DATARMNET7c56b76ea0->nexthdr;}if(
-!DATARMNET1034358542)return-ENOENT;if(DATARMNET0823b5e89c)*DATARMNET0823b5e89c=
-DATARMNET3ed4d6b164;break;}DATARMNET4593c3f2c2=(0xd35+210-0xdff);}else if(
-nexthdr==NEXTHDR_AUTH){if(DATARMNETfb0677cc3c&&(*DATARMNETfb0677cc3c&
-IP6_FH_F_AUTH)&&(DATARMNETbfd7eb99fe<(0xd2d+202-0xdf7)))break;
-DATARMNET4593c3f2c2=ipv6_authlen(DATARMNET7c56b76ea0);}else DATARMNET4593c3f2c2=
-ipv6_optlen(DATARMNET7c56b76ea0);if(!DATARMNET1034358542){nexthdr=
-DATARMNET7c56b76ea0->nexthdr;DATARMNETab6f68a65c+=DATARMNET4593c3f2c2;}}while(!
-DATARMNET1034358542);*DATARMNETb65c469a15=DATARMNETab6f68a65c;return nexthdr;}
-static void DATARMNETc7c83f614f(struct DATARMNET6f3b954709*DATARMNET63b1a086d5,
-bool DATARMNET7a9bcaf1a3){struct DATARMNET8d3c2559ca*DATARMNET54338da2ff;int(*
-DATARMNET456ac0e8eb)(struct sk_buff*DATARMNET543491eb0f);struct sk_buff*
-DATARMNET543491eb0f,*DATARMNET0386f6f82a;unsigned long DATARMNETfb0677cc3c;
-DATARMNET456ac0e8eb=(DATARMNET7a9bcaf1a3)?netif_receive_skb:netif_rx;
-DATARMNET54338da2ff=DATARMNET63b1a086d5->DATARMNET7ed5754a5c;spin_lock_irqsave(&
-DATARMNET63b1a086d5->DATARMNET94b1f9ee09,DATARMNETfb0677cc3c);
-list_for_each_entry_safe(DATARMNET543491eb0f,DATARMNET0386f6f82a,&
-DATARMNET63b1a086d5->DATARMNET0f34bf3ea9,list){u32 DATARMNET248f120dd5;list_del(
-&DATARMNET543491eb0f->list);DATARMNET543491eb0f->next=NULL;DATARMNET543491eb0f->
-prev=NULL;if(IS_ERR_OR_NULL(DATARMNET54338da2ff)){DATARMNET456ac0e8eb(
-DATARMNET543491eb0f);continue;}if(DATARMNET4899053671(DATARMNET543491eb0f,
-DATARMNET54338da2ff)){DATARMNET248f120dd5=DATARMNETba232077da;
-DATARMNET456ac0e8eb(DATARMNET543491eb0f);}else{DATARMNET248f120dd5=
-DATARMNET7a58a5c1fc;}DATARMNET5ca94dbc3c(DATARMNET248f120dd5);}
-spin_unlock_irqrestore(&DATARMNET63b1a086d5->DATARMNET94b1f9ee09,
-DATARMNETfb0677cc3c);}static enum hrtimer_restart DATARMNETef43eced5f(struct 
-hrtimer*DATARMNET6e4292679f){struct DATARMNET6f3b954709*DATARMNET63b1a086d5;
-unsigned long DATARMNETfb0677cc3c;spin_lock_irqsave(&DATARMNET531b038fcd,
-DATARMNETfb0677cc3c);DATARMNET63b1a086d5=container_of(DATARMNET6e4292679f,struct
- DATARMNET6f3b954709,DATARMNET9f31ce5d2d);hash_del_rcu(&DATARMNET63b1a086d5->
-DATARMNETe8608dd267);DATARMNETc7c83f614f(DATARMNET63b1a086d5,false);kfree_rcu(
-DATARMNET63b1a086d5,DATARMNET28bfe9e6ad);spin_unlock_irqrestore(&
-DATARMNET531b038fcd,DATARMNETfb0677cc3c);DATARMNET5ca94dbc3c(DATARMNETd691057b85
-);return HRTIMER_NORESTART;}static bool DATARMNETc529ac78b2(struct 
+DATARMNETb18a0d17a5),&DATARMNETb18a0d17a5);if(!DATARMNET7c56b76ea0)return-
+EBADMSG;if(nexthdr==NEXTHDR_ROUTING){struct ipv6_rt_hdr DATARMNET942c8f7153,*
+DATARMNETb2650cb3cb;DATARMNETb2650cb3cb=skb_header_pointer(DATARMNET543491eb0f,
+DATARMNETab6f68a65c,sizeof(DATARMNET942c8f7153),&DATARMNET942c8f7153);if(!
+DATARMNETb2650cb3cb)return-EBADMSG;if(DATARMNETfb0677cc3c&&(*DATARMNETfb0677cc3c
+&IP6_FH_F_SKIP_RH)&&DATARMNETb2650cb3cb->segments_left==(0xd2d+202-0xdf7))
+DATARMNET1034358542=false;}if(nexthdr==NEXTHDR_FRAGMENT){unsigned short 
+DATARMNET3ed4d6b164;__be16*DATARMNET748d4c9015;if(DATARMNETfb0677cc3c)*
+DATARMNETfb0677cc3c|=IP6_FH_F_FRAG;DATARMNET748d4c9015=skb_header_pointer(
+DATARMNET543491eb0f,DATARMNETab6f68a65c+offsetof(struct frag_hdr,frag_off),
+sizeof(DATARMNET3ed4d6b164),&DATARMNET3ed4d6b164);if(!DATARMNET748d4c9015)return
+-EBADMSG;DATARMNET3ed4d6b164=ntohs(*DATARMNET748d4c9015)&~(0xcfc+267-0xe00);if(
+DATARMNET3ed4d6b164){if(DATARMNETbfd7eb99fe<(0xd2d+202-0xdf7)&&((!ipv6_ext_hdr(
+DATARMNET7c56b76ea0->nexthdr))||DATARMNET7c56b76ea0->nexthdr==NEXTHDR_NONE)){if(
+DATARMNET0823b5e89c)*DATARMNET0823b5e89c=DATARMNET3ed4d6b164;return 
+DATARMNET7c56b76ea0->nexthdr;}if(!DATARMNET1034358542)return-ENOENT;if(
+DATARMNET0823b5e89c)*DATARMNET0823b5e89c=DATARMNET3ed4d6b164;break;}
+DATARMNET4593c3f2c2=(0xd35+210-0xdff);}else if(nexthdr==NEXTHDR_AUTH){if(
+DATARMNETfb0677cc3c&&(*DATARMNETfb0677cc3c&IP6_FH_F_AUTH)&&(DATARMNETbfd7eb99fe<
+(0xd2d+202-0xdf7)))break;DATARMNET4593c3f2c2=ipv6_authlen(DATARMNET7c56b76ea0);}
+else DATARMNET4593c3f2c2=ipv6_optlen(DATARMNET7c56b76ea0);if(!
+DATARMNET1034358542){nexthdr=DATARMNET7c56b76ea0->nexthdr;DATARMNETab6f68a65c+=
+DATARMNET4593c3f2c2;}}while(!DATARMNET1034358542);*DATARMNETb65c469a15=
+DATARMNETab6f68a65c;return nexthdr;}static void DATARMNETc7c83f614f(struct 
+DATARMNET6f3b954709*DATARMNET63b1a086d5,bool DATARMNET7a9bcaf1a3){struct 
+DATARMNET8d3c2559ca*DATARMNET54338da2ff;int(*DATARMNET456ac0e8eb)(struct sk_buff
+*DATARMNET543491eb0f);struct sk_buff*DATARMNET543491eb0f,*DATARMNET0386f6f82a;
+unsigned long DATARMNETfb0677cc3c;DATARMNET456ac0e8eb=(DATARMNET7a9bcaf1a3)?
+netif_receive_skb:netif_rx;DATARMNET54338da2ff=DATARMNET63b1a086d5->
+DATARMNET7ed5754a5c;spin_lock_irqsave(&DATARMNET63b1a086d5->DATARMNET94b1f9ee09,
+DATARMNETfb0677cc3c);list_for_each_entry_safe(DATARMNET543491eb0f,
+DATARMNET0386f6f82a,&DATARMNET63b1a086d5->DATARMNET0f34bf3ea9,list){u32 
+DATARMNET248f120dd5;list_del(&DATARMNET543491eb0f->list);DATARMNET543491eb0f->
+next=NULL;DATARMNET543491eb0f->prev=NULL;if(IS_ERR_OR_NULL(DATARMNET54338da2ff))
+{DATARMNET456ac0e8eb(DATARMNET543491eb0f);continue;}if(DATARMNET4899053671(
+DATARMNET543491eb0f,DATARMNET54338da2ff)){DATARMNET248f120dd5=
+DATARMNETba232077da;DATARMNET456ac0e8eb(DATARMNET543491eb0f);}else{
+DATARMNET248f120dd5=DATARMNET7a58a5c1fc;}DATARMNET5ca94dbc3c(DATARMNET248f120dd5
+);}spin_unlock_irqrestore(&DATARMNET63b1a086d5->DATARMNET94b1f9ee09,
+DATARMNETfb0677cc3c);}static struct DATARMNET6f3b954709*DATARMNETc415b718ca(void
+){struct DATARMNET6f3b954709*DATARMNET63b1a086d5;unsigned long 
+DATARMNETfb0677cc3c;spin_lock_irqsave(&DATARMNET40ef359d98,DATARMNETfb0677cc3c);
+DATARMNET63b1a086d5=list_first_entry_or_null(&DATARMNETf316ea53dd,struct 
+DATARMNET6f3b954709,DATARMNETdaa01e0f2f);if(DATARMNET63b1a086d5)list_del(&
+DATARMNET63b1a086d5->DATARMNETdaa01e0f2f);spin_unlock_irqrestore(&
+DATARMNET40ef359d98,DATARMNETfb0677cc3c);if(DATARMNET63b1a086d5){memset(
+DATARMNET63b1a086d5,(0xd2d+202-0xdf7),sizeof(*DATARMNET63b1a086d5));
+DATARMNET63b1a086d5->DATARMNET1c042bd734=(0xd26+209-0xdf6);return 
+DATARMNET63b1a086d5;}DATARMNET4062502808(DATARMNET9a54dab2b9,(0xd26+209-0xdf6));
+return kzalloc(sizeof(*DATARMNET63b1a086d5),GFP_ATOMIC);}static void 
+DATARMNET8499ebd19b(struct rcu_head*DATARMNETa1aa68b77b){struct 
+DATARMNET6f3b954709*DATARMNET63b1a086d5;unsigned long DATARMNETfb0677cc3c;
+DATARMNET63b1a086d5=container_of(DATARMNETa1aa68b77b,struct DATARMNET6f3b954709,
+DATARMNET28bfe9e6ad);if(!DATARMNET63b1a086d5->DATARMNET1c042bd734){kfree(
+DATARMNET63b1a086d5);return;}spin_lock_irqsave(&DATARMNET40ef359d98,
+DATARMNETfb0677cc3c);list_add(&DATARMNET63b1a086d5->DATARMNETdaa01e0f2f,&
+DATARMNETf316ea53dd);spin_unlock_irqrestore(&DATARMNET40ef359d98,
+DATARMNETfb0677cc3c);}static void DATARMNETa973271dd6(struct DATARMNET6f3b954709
+*DATARMNET63b1a086d5){struct DATARMNETc18cc7fe6a*DATARMNET65e8a99cbb=&
+DATARMNET94efc23b1c[DATARMNET63b1a086d5->DATARMNET65e8a99cbb];unsigned long 
+DATARMNETfb0677cc3c;spin_lock_irqsave(&DATARMNET65e8a99cbb->DATARMNETb94b7b7d16,
+DATARMNETfb0677cc3c);WRITE_ONCE(DATARMNET63b1a086d5->DATARMNET8e4e923849,
+(0xd26+209-0xdf6));hlist_del_rcu(&DATARMNET63b1a086d5->DATARMNETe8608dd267);
+spin_unlock_irqrestore(&DATARMNET65e8a99cbb->DATARMNETb94b7b7d16,
+DATARMNETfb0677cc3c);}static u32 DATARMNETc471c6bd0b(u64 DATARMNETbc45f647fa){
+return(u32)div_u64(DATARMNETbc45f647fa,DATARMNETb7cc384fbe)&(DATARMNET08d71f54bf
+-(0xd26+209-0xdf6));}static enum hrtimer_restart DATARMNETef43eced5f(struct 
+hrtimer*DATARMNET6e4292679f){struct DATARMNET6f3b954709*DATARMNET63b1a086d5,*
+DATARMNET198704c6ee;enum hrtimer_restart DATARMNET0eaa11c00b=HRTIMER_RESTART;u64 
+DATARMNET6c1f17daa8=ktime_get_ns();u64 DATARMNET8ce5ac6692=div_u64(
+DATARMNET6c1f17daa8,DATARMNETb7cc384fbe);unsigned long DATARMNETfb0677cc3c;
+LIST_HEAD(DATARMNETc805b97f6b);u32 DATARMNET578fae2bb5;spin_lock_irqsave(&
+DATARMNET2a6f0d390a,DATARMNETfb0677cc3c);if(DATARMNET8ce5ac6692-
+DATARMNET8573319e4f>DATARMNET08d71f54bf)DATARMNET8573319e4f=DATARMNET8ce5ac6692-
+DATARMNET08d71f54bf;for(;DATARMNET8573319e4f<DATARMNET8ce5ac6692;
+DATARMNET8573319e4f++){DATARMNET578fae2bb5=DATARMNET8573319e4f&(
+DATARMNET08d71f54bf-(0xd26+209-0xdf6));list_for_each_entry_safe(
+DATARMNET63b1a086d5,DATARMNET198704c6ee,&DATARMNET12ca4475bb[DATARMNET578fae2bb5
+],DATARMNETdaa01e0f2f){u64 DATARMNETbc45f647fa=READ_ONCE(DATARMNET63b1a086d5->
+DATARMNETbc45f647fa);if(DATARMNETbc45f647fa<=DATARMNET6c1f17daa8){list_move_tail
+(&DATARMNET63b1a086d5->DATARMNETdaa01e0f2f,&DATARMNETc805b97f6b);
+DATARMNET4fb191309f--;continue;}if(DATARMNETc471c6bd0b(DATARMNETbc45f647fa)!=
+DATARMNET578fae2bb5)list_move_tail(&DATARMNET63b1a086d5->DATARMNETdaa01e0f2f,&
+DATARMNET12ca4475bb[DATARMNETc471c6bd0b(DATARMNETbc45f647fa)]);}}if(!
+DATARMNET4fb191309f){DATARMNET969819718c=false;DATARMNET0eaa11c00b=
+HRTIMER_NORESTART;}else{hrtimer_forward_now(DATARMNET6e4292679f,ns_to_ktime(
+DATARMNETb7cc384fbe));}spin_unlock_irqrestore(&DATARMNET2a6f0d390a,
+DATARMNETfb0677cc3c);list_for_each_entry_safe(DATARMNET63b1a086d5,
+DATARMNET198704c6ee,&DATARMNETc805b97f6b,DATARMNETdaa01e0f2f){list_del(&
+DATARMNET63b1a086d5->DATARMNETdaa01e0f2f);DATARMNETa973271dd6(
+DATARMNET63b1a086d5);DATARMNETc7c83f614f(DATARMNET63b1a086d5,false);
+DATARMNET2871cbea01(DATARMNET6c1f17daa8-DATARMNET63b1a086d5->DATARMNETbc45f647fa
+);call_rcu(&DATARMNET63b1a086d5->DATARMNET28bfe9e6ad,DATARMNET8499ebd19b);
+DATARMNET5ca94dbc3c(DATARMNETd691057b85);}DATARMNETf974f158f4(
+DATARMNET6c1f17daa8);return DATARMNET0eaa11c00b;}static u32 DATARMNETe7b022d0a0(
+struct DATARMNETdadb4e2c65*DATARMNET54338da2ff){u32 DATARMNET396ee583b5;if(
+DATARMNET54338da2ff->DATARMNET0d956cc77a==(0xd11+230-0xdf3))DATARMNET396ee583b5=
+(__force u32)(DATARMNET54338da2ff->DATARMNETdfe430c2d6^DATARMNET54338da2ff->
+DATARMNET2cb607d686);else DATARMNET396ee583b5=ipv6_addr_hash(&
+DATARMNET54338da2ff->DATARMNET815cbb4bf5)^ipv6_addr_hash(&DATARMNET54338da2ff->
+DATARMNETc3f31215b7);return jhash_2words((__force u32)DATARMNET54338da2ff->id,
+DATARMNET396ee583b5,DATARMNET54338da2ff->DATARMNET0d956cc77a)&(
+DATARMNET598d70a086-(0xd26+209-0xdf6));}static bool DATARMNETc529ac78b2(struct 
 DATARMNETdadb4e2c65*DATARMNET75decd6f60,struct DATARMNETdadb4e2c65*
 DATARMNET6745cad668){if(DATARMNET75decd6f60->DATARMNET0d956cc77a!=
 DATARMNET6745cad668->DATARMNET0d956cc77a||DATARMNET75decd6f60->id!=
@@ -106,59 +169,75 @@ DATARMNET2cb607d686==DATARMNET6745cad668->DATARMNET2cb607d686;return!
 ipv6_addr_cmp(&DATARMNET75decd6f60->DATARMNET815cbb4bf5,&DATARMNET6745cad668->
 DATARMNET815cbb4bf5)&&!ipv6_addr_cmp(&DATARMNET75decd6f60->DATARMNETc3f31215b7,&
 DATARMNET6745cad668->DATARMNETc3f31215b7);}static struct DATARMNET6f3b954709*
-DATARMNET52b387f6cd(struct DATARMNETdadb4e2c65*DATARMNET54338da2ff){struct 
-DATARMNET6f3b954709*DATARMNET63b1a086d5;unsigned long DATARMNETfb0677cc3c;
-spin_lock_irqsave(&DATARMNET531b038fcd,DATARMNETfb0677cc3c);
-hash_for_each_possible_rcu(DATARMNET6e79f38051,DATARMNET63b1a086d5,
-DATARMNETe8608dd267,DATARMNET54338da2ff->id){if(DATARMNETc529ac78b2(
+DATARMNET52b387f6cd(struct DATARMNETdadb4e2c65*DATARMNET54338da2ff)__must_hold(
+RCU){struct DATARMNET6f3b954709*DATARMNET63b1a086d5;struct DATARMNETc18cc7fe6a*
+DATARMNET65e8a99cbb;unsigned long DATARMNETfb0677cc3c;u32 DATARMNET578fae2bb5=
+DATARMNETe7b022d0a0(DATARMNET54338da2ff);u64 DATARMNET6c1f17daa8;
+DATARMNET65e8a99cbb=&DATARMNET94efc23b1c[DATARMNET578fae2bb5];
+hlist_for_each_entry_rcu(DATARMNET63b1a086d5,&DATARMNET65e8a99cbb->
+DATARMNET98cdf239a2,DATARMNETe8608dd267){if(!READ_ONCE(DATARMNET63b1a086d5->
+DATARMNET8e4e923849)&&DATARMNETc529ac78b2(DATARMNET54338da2ff,&
+DATARMNET63b1a086d5->DATARMNET54338da2ff))return DATARMNET63b1a086d5;}
+spin_lock_irqsave(&DATARMNET65e8a99cbb->DATARMNETb94b7b7d16,DATARMNETfb0677cc3c)
+;hlist_for_each_entry(DATARMNET63b1a086d5,&DATARMNET65e8a99cbb->
+DATARMNET98cdf239a2,DATARMNETe8608dd267){if(DATARMNETc529ac78b2(
 DATARMNET54338da2ff,&DATARMNET63b1a086d5->DATARMNET54338da2ff))goto 
-DATARMNETbf4095f79e;}DATARMNET63b1a086d5=kzalloc(sizeof(*DATARMNET63b1a086d5),
-GFP_ATOMIC);if(!DATARMNET63b1a086d5)goto DATARMNETbf4095f79e;spin_lock_init(&
-DATARMNET63b1a086d5->DATARMNET94b1f9ee09);INIT_LIST_HEAD(&DATARMNET63b1a086d5->
-DATARMNET0f34bf3ea9);memcpy(&DATARMNET63b1a086d5->DATARMNET54338da2ff,
-DATARMNET54338da2ff,sizeof(*DATARMNET54338da2ff));hrtimer_init(&
-DATARMNET63b1a086d5->DATARMNET9f31ce5d2d,CLOCK_MONOTONIC,HRTIMER_MODE_REL);
-DATARMNET63b1a086d5->DATARMNET9f31ce5d2d.function=DATARMNETef43eced5f;
-hrtimer_start(&DATARMNET63b1a086d5->DATARMNET9f31ce5d2d,DATARMNET63a285d479,
-HRTIMER_MODE_REL);INIT_HLIST_NODE(&DATARMNET63b1a086d5->DATARMNETe8608dd267);
-hash_add_rcu(DATARMNET6e79f38051,&DATARMNET63b1a086d5->DATARMNETe8608dd267,
-DATARMNET54338da2ff->id);DATARMNETbf4095f79e:spin_unlock_irqrestore(&
-DATARMNET531b038fcd,DATARMNETfb0677cc3c);return DATARMNET63b1a086d5;}static int 
-DATARMNET9d6ad3b16f(struct sk_buff*DATARMNET543491eb0f,struct 
-DATARMNETb89ecedefc*DATARMNET3396919a68,struct DATARMNETdadb4e2c65*
-DATARMNET54338da2ff,struct DATARMNET8d3c2559ca*DATARMNET2d4b4cfc9e)__must_hold(
-RCU){struct DATARMNET6f3b954709*DATARMNET63b1a086d5;int DATARMNET61c2303133=
-(0xd26+209-0xdf6);DATARMNET5ca94dbc3c(DATARMNETd8273aa7e1);DATARMNET63b1a086d5=
-DATARMNET52b387f6cd(DATARMNET54338da2ff);if(!DATARMNET63b1a086d5){
-DATARMNET61c2303133=(-(0xd26+209-0xdf6));goto DATARMNETbf4095f79e;}if(unlikely(!
-hrtimer_is_queued(&DATARMNET63b1a086d5->DATARMNET9f31ce5d2d))){goto 
-DATARMNETbf4095f79e;}else if(hrtimer_get_remaining(&DATARMNET63b1a086d5->
-DATARMNET9f31ce5d2d)<=DATARMNETb7cc384fbe){goto DATARMNETbf4095f79e;}
-hrtimer_start(&DATARMNET63b1a086d5->DATARMNET9f31ce5d2d,DATARMNET63a285d479,
-HRTIMER_MODE_REL);if(DATARMNET63b1a086d5->DATARMNET7ed5754a5c){if(IS_ERR(
-DATARMNET63b1a086d5->DATARMNET7ed5754a5c))goto DATARMNETbf4095f79e;if(!
-DATARMNET4899053671(DATARMNET543491eb0f,DATARMNET63b1a086d5->DATARMNET7ed5754a5c
-)){DATARMNET5ca94dbc3c(DATARMNET7a58a5c1fc);DATARMNET61c2303133=
-(0xd2d+202-0xdf7);goto DATARMNETbf4095f79e;}DATARMNET5ca94dbc3c(
-DATARMNETba232077da);goto DATARMNETbf4095f79e;}if(DATARMNET54338da2ff->
-DATARMNETb65c469a15){unsigned long DATARMNETfb0677cc3c;spin_lock_irqsave(&
-DATARMNET63b1a086d5->DATARMNET94b1f9ee09,DATARMNETfb0677cc3c);list_add_tail(&
-DATARMNET543491eb0f->list,&DATARMNET63b1a086d5->DATARMNET0f34bf3ea9);
-spin_unlock_irqrestore(&DATARMNET63b1a086d5->DATARMNET94b1f9ee09,
-DATARMNETfb0677cc3c);DATARMNET61c2303133=(0xd2d+202-0xdf7);DATARMNET5ca94dbc3c(
-DATARMNETe75ad1a949);goto DATARMNETbf4095f79e;}if(DATARMNET3396919a68->
-DATARMNET4924e79411==IPPROTO_TCP||DATARMNET3396919a68->DATARMNET4924e79411==
-IPPROTO_UDP){struct udphdr*DATARMNET75be5f3406=(struct udphdr*)(
+DATARMNETbf4095f79e;}DATARMNET63b1a086d5=DATARMNETc415b718ca();if(!
+DATARMNET63b1a086d5)goto DATARMNETbf4095f79e;spin_lock_init(&DATARMNET63b1a086d5
+->DATARMNET94b1f9ee09);INIT_LIST_HEAD(&DATARMNET63b1a086d5->DATARMNET0f34bf3ea9)
+;memcpy(&DATARMNET63b1a086d5->DATARMNET54338da2ff,DATARMNET54338da2ff,sizeof(*
+DATARMNET54338da2ff));DATARMNET63b1a086d5->DATARMNET65e8a99cbb=
+DATARMNET578fae2bb5;DATARMNET6c1f17daa8=ktime_get_ns();DATARMNET63b1a086d5->
+DATARMNETbc45f647fa=DATARMNET6c1f17daa8+DATARMNET63a285d479;hlist_add_head_rcu(&
+DATARMNET63b1a086d5->DATARMNETe8608dd267,&DATARMNET65e8a99cbb->
+DATARMNET98cdf239a2);spin_unlock_irqrestore(&DATARMNET65e8a99cbb->
+DATARMNETb94b7b7d16,DATARMNETfb0677cc3c);spin_lock_irqsave(&DATARMNET2a6f0d390a,
+DATARMNETfb0677cc3c);if(!DATARMNET969819718c){DATARMNET969819718c=true;
+DATARMNET8573319e4f=div_u64(DATARMNET6c1f17daa8,DATARMNETb7cc384fbe);
+hrtimer_start(&DATARMNETaeb883af6b,ns_to_ktime(DATARMNETb7cc384fbe),
+HRTIMER_MODE_REL);}list_add_tail(&DATARMNET63b1a086d5->DATARMNETdaa01e0f2f,&
+DATARMNET12ca4475bb[DATARMNETc471c6bd0b(DATARMNET63b1a086d5->DATARMNETbc45f647fa
+)]);DATARMNET4fb191309f++;spin_unlock_irqrestore(&DATARMNET2a6f0d390a,
+DATARMNETfb0677cc3c);DATARMNET4062502808(DATARMNETd51e993c69,(0xd26+209-0xdf6));
+return DATARMNET63b1a086d5;DATARMNETbf4095f79e:spin_unlock_irqrestore(&
+DATARMNET65e8a99cbb->DATARMNETb94b7b7d16,DATARMNETfb0677cc3c);return 
+DATARMNET63b1a086d5;}static int DATARMNET9d6ad3b16f(struct sk_buff*
+DATARMNET543491eb0f,struct DATARMNETb89ecedefc*DATARMNET3396919a68,struct 
+DATARMNETdadb4e2c65*DATARMNET54338da2ff,struct DATARMNET8d3c2559ca*
+DATARMNET2d4b4cfc9e)__must_hold(RCU){struct DATARMNET6f3b954709*
+DATARMNET63b1a086d5;int DATARMNET61c2303133=(0xd26+209-0xdf6);u64 
+DATARMNET6c1f17daa8;DATARMNET5ca94dbc3c(DATARMNETd8273aa7e1);DATARMNET4062502808
+(DATARMNETa6e6e93e1c,(0xd26+209-0xdf6));DATARMNET63b1a086d5=DATARMNET52b387f6cd(
+DATARMNET54338da2ff);if(!DATARMNET63b1a086d5){DATARMNET61c2303133=(-
+(0xd26+209-0xdf6));goto DATARMNETbf4095f79e;}DATARMNET6c1f17daa8=ktime_get_ns();
+if(unlikely(READ_ONCE(DATARMNET63b1a086d5->DATARMNET8e4e923849))){goto 
+DATARMNETbf4095f79e;}else if(READ_ONCE(DATARMNET63b1a086d5->DATARMNETbc45f647fa)
+<=DATARMNET6c1f17daa8+DATARMNETb7cc384fbe){goto DATARMNETbf4095f79e;}WRITE_ONCE(
+DATARMNET63b1a086d5->DATARMNETbc45f647fa,DATARMNET6c1f17daa8+DATARMNET63a285d479
+);if(DATARMNET63b1a086d5->DATARMNET7ed5754a5c){if(IS_ERR(DATARMNET63b1a086d5->
+DATARMNET7ed5754a5c))goto DATARMNETbf4095f79e;if(!DATARMNET4899053671(
+DATARMNET543491eb0f,DATARMNET63b1a086d5->DATARMNET7ed5754a5c)){
+DATARMNET5ca94dbc3c(DATARMNET7a58a5c1fc);DATARMNET61c2303133=(0xd2d+202-0xdf7);
+goto DATARMNETbf4095f79e;}DATARMNET5ca94dbc3c(DATARMNETba232077da);goto 
+DATARMNETbf4095f79e;}if(DATARMNET54338da2ff->DATARMNETb65c469a15){unsigned long 
+DATARMNETfb0677cc3c;spin_lock_irqsave(&DATARMNET63b1a086d5->DATARMNET94b1f9ee09,
+DATARMNETfb0677cc3c);list_add_tail(&DATARMNET543491eb0f->list,&
+DATARMNET63b1a086d5->DATARMNET0f34bf3ea9);spin_unlock_irqrestore(&
+DATARMNET63b1a086d5->DATARMNET94b1f9ee09,DATARMNETfb0677cc3c);
+DATARMNET61c2303133=(0xd2d+202-0xdf7);DATARMNET5ca94dbc3c(DATARMNETe75ad1a949);
+goto DATARMNETbf4095f79e;}if(DATARMNET3396919a68->DATARMNET4924e79411==
+IPPROTO_TCP||DATARMNET3396919a68->DATARMNET4924e79411==IPPROTO_UDP){struct 
+udphdr*DATARMNET75be5f3406=(struct udphdr*)(DATARMNET543491eb0f->data+
+DATARMNET54338da2ff->DATARMNET611d08d671);DATARMNET3396919a68->
+DATARMNETf0d9de7e2f=DATARMNET75be5f3406->dest;if(DATARMNETa8b2566e6a(
+DATARMNET543491eb0f,DATARMNET3396919a68,DATARMNET54338da2ff->DATARMNET611d08d671
+)){if(DATARMNET0a4704e5e0(DATARMNET3396919a68)){kfree_skb(DATARMNET543491eb0f);
+DATARMNET61c2303133=(0xd2d+202-0xdf7);DATARMNET5ca94dbc3c(DATARMNET0981317411);
+goto DATARMNETbf4095f79e;}DATARMNET5ca94dbc3c(DATARMNETd1ad664d00);goto 
+DATARMNET07fc49caf2;}}else if(DATARMNET3396919a68->DATARMNET4924e79411==
+IPPROTO_ESP){struct ip_esp_hdr*DATARMNET73ee6a7020=(struct ip_esp_hdr*)(
 DATARMNET543491eb0f->data+DATARMNET54338da2ff->DATARMNET611d08d671);
-DATARMNET3396919a68->DATARMNETf0d9de7e2f=DATARMNET75be5f3406->dest;if(
-DATARMNETa8b2566e6a(DATARMNET543491eb0f,DATARMNET3396919a68,DATARMNET54338da2ff
-->DATARMNET611d08d671)){if(DATARMNET0a4704e5e0(DATARMNET3396919a68)){kfree_skb(
-DATARMNET543491eb0f);DATARMNET61c2303133=(0xd2d+202-0xdf7);DATARMNET5ca94dbc3c(
-DATARMNET0981317411);goto DATARMNETbf4095f79e;}DATARMNET5ca94dbc3c(
-DATARMNETd1ad664d00);goto DATARMNET07fc49caf2;}}else if(DATARMNET3396919a68->
-DATARMNET4924e79411==IPPROTO_ESP){struct ip_esp_hdr*DATARMNET73ee6a7020=(struct 
-ip_esp_hdr*)(DATARMNET543491eb0f->data+DATARMNET54338da2ff->DATARMNET611d08d671)
-;DATARMNET3396919a68->DATARMNET906b2ee561=DATARMNET73ee6a7020->spi;}if(
+DATARMNET3396919a68->DATARMNET906b2ee561=DATARMNET73ee6a7020->spi;}if(
 DATARMNET4eafcdee07(DATARMNET3396919a68)){u32 DATARMNET248f120dd5;
 DATARMNET63b1a086d5->DATARMNET7ed5754a5c=DATARMNET2d4b4cfc9e;if(!
 DATARMNET4899053671(DATARMNET543491eb0f,DATARMNET2d4b4cfc9e)){
@@ -203,13 +282,40 @@ DATARMNET611d08d671=(u16)DATARMNET611d08d671;if(DATARMNET3396919a68->
 DATARMNET4924e79411==NEXTHDR_FRAGMENT)DATARMNET54338da2ff.DATARMNET611d08d671+=
 sizeof(*frag_hdr);return DATARMNET9d6ad3b16f(DATARMNET543491eb0f,
 DATARMNET3396919a68,&DATARMNET54338da2ff,DATARMNET2d4b4cfc9e);}void 
-DATARMNET8c0e010dfb(void){struct DATARMNET6f3b954709*DATARMNET63b1a086d5;int 
-DATARMNET5c2fd31d7b;rcu_read_lock();hash_for_each_rcu(DATARMNET6e79f38051,
-DATARMNET5c2fd31d7b,DATARMNET63b1a086d5,DATARMNETe8608dd267)hrtimer_cancel(&
-DATARMNET63b1a086d5->DATARMNET9f31ce5d2d);rcu_read_unlock();}void 
+DATARMNETdeca828710(void){int DATARMNET5c2fd31d7b;for(DATARMNET5c2fd31d7b=
+(0xd2d+202-0xdf7);DATARMNET5c2fd31d7b<DATARMNET598d70a086;DATARMNET5c2fd31d7b++)
+{INIT_HLIST_HEAD(&DATARMNET94efc23b1c[DATARMNET5c2fd31d7b].DATARMNET98cdf239a2);
+spin_lock_init(&DATARMNET94efc23b1c[DATARMNET5c2fd31d7b].DATARMNETb94b7b7d16);}
+for(DATARMNET5c2fd31d7b=(0xd2d+202-0xdf7);DATARMNET5c2fd31d7b<
+DATARMNET08d71f54bf;DATARMNET5c2fd31d7b++)INIT_LIST_HEAD(&DATARMNET12ca4475bb[
+DATARMNET5c2fd31d7b]);for(DATARMNET5c2fd31d7b=(0xd2d+202-0xdf7);
+DATARMNET5c2fd31d7b<DATARMNET75fae8c61b;DATARMNET5c2fd31d7b++){
+DATARMNET4adf478552[DATARMNET5c2fd31d7b].DATARMNET1c042bd734=(0xd26+209-0xdf6);
+list_add_tail(&DATARMNET4adf478552[DATARMNET5c2fd31d7b].DATARMNETdaa01e0f2f,&
+DATARMNETf316ea53dd);}hrtimer_init(&DATARMNETaeb883af6b,CLOCK_MONOTONIC,
+HRTIMER_MODE_REL);DATARMNETaeb883af6b.function=DATARMNETef43eced5f;}void 
+DATARMNET8c0e010dfb(void){struct DATARMNET6f3b954709*DATARMNET63b1a086d5,*
+DATARMNET198704c6ee;struct sk_buff*DATARMNET543491eb0f,*DATARMNET0386f6f82a;
+unsigned long DATARMNETfb0677cc3c;LIST_HEAD(DATARMNETc805b97f6b);int 
+DATARMNET5c2fd31d7b;hrtimer_cancel(&DATARMNETaeb883af6b);spin_lock_irqsave(&
+DATARMNET2a6f0d390a,DATARMNETfb0677cc3c);for(DATARMNET5c2fd31d7b=
+(0xd2d+202-0xdf7);DATARMNET5c2fd31d7b<DATARMNET08d71f54bf;DATARMNET5c2fd31d7b++)
+list_splice_init(&DATARMNET12ca4475bb[DATARMNET5c2fd31d7b],&DATARMNETc805b97f6b)
+;DATARMNET4fb191309f=(0xd2d+202-0xdf7);DATARMNET969819718c=false;
+spin_unlock_irqrestore(&DATARMNET2a6f0d390a,DATARMNETfb0677cc3c);
+list_for_each_entry_safe(DATARMNET63b1a086d5,DATARMNET198704c6ee,&
+DATARMNETc805b97f6b,DATARMNETdaa01e0f2f){list_del(&DATARMNET63b1a086d5->
+DATARMNETdaa01e0f2f);DATARMNETa973271dd6(DATARMNET63b1a086d5);
+list_for_each_entry_safe(DATARMNET543491eb0f,DATARMNET0386f6f82a,&
+DATARMNET63b1a086d5->DATARMNET0f34bf3ea9,list){list_del(&DATARMNET543491eb0f->
+list);kfree_skb(DATARMNET543491eb0f);}call_rcu(&DATARMNET63b1a086d5->
+DATARMNET28bfe9e6ad,DATARMNET8499ebd19b);}rcu_barrier();}void 
 DATARMNETedae8262e1(struct DATARMNET8d3c2559ca*DATARMNET54338da2ff){struct 
 DATARMNET6f3b954709*DATARMNET63b1a086d5;int DATARMNET5c2fd31d7b;rcu_read_lock();
-hash_for_each_rcu(DATARMNET6e79f38051,DATARMNET5c2fd31d7b,DATARMNET63b1a086d5,
-DATARMNETe8608dd267){if(DATARMNET63b1a086d5->DATARMNET7ed5754a5c==
-DATARMNET54338da2ff)DATARMNET63b1a086d5->DATARMNET7ed5754a5c=ERR_PTR(-EINVAL);}
+for(DATARMNET5c2fd31d7b=(0xd2d+202-0xdf7);DATARMNET5c2fd31d7b<
+DATARMNET598d70a086;DATARMNET5c2fd31d7b++){hlist_for_each_entry_rcu(
+DATARMNET63b1a086d5,&DATARMNET94efc23b1c[DATARMNET5c2fd31d7b].
+DATARMNET98cdf239a2,DATARMNETe8608dd267){if(DATARMNET63b1a086d5->
+DATARMNET7ed5754a5c==DATARMNET54338da2ff)DATARMNET63b1a086d5->
+DATARMNET7ed5754a5c=ERR_PTR(-EINVAL);}}
 rcu_read_unlock();}
@@ -14,7 +14,8 @@ DATARMNET611d08d671,struct DATARMNETb89ecedefc*DATARMNET3396919a68,struct
 DATARMNET8d3c2559ca*DATARMNET2d4b4cfc9e);int DATARMNETaca8ca54ed(struct sk_buff*
 DATARMNET543491eb0f,int DATARMNET611d08d671,struct DATARMNETb89ecedefc*
 DATARMNET3396919a68,struct DATARMNET8d3c2559ca*DATARMNET2d4b4cfc9e);void 
-DATARMNET8c0e010dfb(void);void DATARMNETedae8262e1(struct DATARMNET8d3c2559ca*
+DATARMNETdeca828710(void);void DATARMNET8c0e010dfb(void);void 
+DATARMNETedae8262e1(struct DATARMNET8d3c2559ca*
 DATARMNET54338da2ff);
 #endif
 
@@ -6,6 +6,7 @@
  */
 
 #include <linux/moduleparam.h>
+#include <linux/math64.h>
 #include "rmnet_wlan_stats.h"
 static u64 DATARMNET24d235c444[DATARMNETc6bf075f65];module_param_array_named(
 rmnet_wlan_stat,DATARMNET24d235c444,ullong,NULL,(0xcb7+5769-0x221c));static u64 
@@ -16,3 +17,20 @@ DATARMNETc6bf075f65)DATARMNET24d235c444[DATARMNET248f120dd5]+=(0xd26+209-0xdf6);
 }void DATARMNET17f6bc1be5(u32 DATARMNET248f120dd5){if(DATARMNET248f120dd5<
 DATARMNETfe1714cc0e)DATARMNET9f5801b25f[DATARMNET248f120dd5]+=(0xd26+209-0xdf6);
 }
+static u64 DATARMNETba843c43bb[DATARMNETd74b506181];module_param_array_named(
+rmnet_wlan_frag_stat,DATARMNETba843c43bb,ullong,NULL,(0xcb7+5769-0x221c));static 
+u64 DATARMNETbef7962fcd;static u64 DATARMNET11103dbeeb;void DATARMNET4062502808(
+u32 DATARMNET248f120dd5,u64 DATARMNET99d8b21851){if(DATARMNET248f120dd5<
+DATARMNETd74b506181)DATARMNETba843c43bb[DATARMNET248f120dd5]+=
+DATARMNET99d8b21851;}void DATARMNET2871cbea01(u64 DATARMNETc5b519b110){u64 
+DATARMNETe2f2a05765=div_u64(DATARMNETc5b519b110,NSEC_PER_USEC);
+DATARMNETba843c43bb[DATARMNET0fc319d9d5]+=(0xd26+209-0xdf6);DATARMNETba843c43bb[
+DATARMNET868d9d166c]+=DATARMNETe2f2a05765;if(DATARMNETe2f2a05765>
+DATARMNETba843c43bb[DATARMNET4a18f70d0d])DATARMNETba843c43bb[DATARMNET4a18f70d0d
+]=DATARMNETe2f2a05765;}void DATARMNETf974f158f4(u64 DATARMNET6c1f17daa8){u64 
+DATARMNETb00e73ea49=DATARMNET6c1f17daa8-DATARMNETbef7962fcd;u64 
+DATARMNETe6d3af4879=DATARMNETba843c43bb[DATARMNETa6e6e93e1c];if(
+DATARMNETb00e73ea49<NSEC_PER_SEC)return;if(DATARMNETbef7962fcd)
+DATARMNETba843c43bb[DATARMNET0cb85f8fae]=div64_u64((DATARMNETe6d3af4879-
+DATARMNET11103dbeeb)*NSEC_PER_SEC,DATARMNETb00e73ea49);DATARMNETbef7962fcd=
+DATARMNET6c1f17daa8;DATARMNET11103dbeeb=DATARMNETe6d3af4879;}
@@ -26,7 +26,12 @@ DATARMNET0078f1d36d,DATARMNET661bdeccd4,DATARMNET28e7704d13,DATARMNET7c6c30b7d2,
 DATARMNET39d80cc483,DATARMNET1be480319c,DATARMNET15d1a78b15,DATARMNETddb1bc27cb,
 DATARMNETc730640bf7,DATARMNET521b065310,DATARMNET8a15bcdcc7,DATARMNET0978ff973f,
 DATARMNETc52168a41e,DATARMNET666fc9a664,DATARMNET7803c877c0,DATARMNET4c5aeeb476,
-DATARMNETfe1714cc0e,};void DATARMNET5ca94dbc3c(u32 DATARMNET248f120dd5);void 
-DATARMNET17f6bc1be5(u32 DATARMNET248f120dd5);
+DATARMNETfe1714cc0e,};enum{DATARMNETa6e6e93e1c,DATARMNETd51e993c69,
+DATARMNET0fc319d9d5,DATARMNET9a54dab2b9,DATARMNET0cb85f8fae,DATARMNET868d9d166c,
+DATARMNET4a18f70d0d,DATARMNETd74b506181,};void DATARMNET5ca94dbc3c(u32 
+DATARMNET248f120dd5);void DATARMNET17f6bc1be5(u32 DATARMNET248f120dd5);void 
+DATARMNET4062502808(u32 DATARMNET248f120dd5,u64 DATARMNET99d8b21851);void 
+DATARMNET2871cbea01(u64 DATARMNETc5b519b110);void DATARMNETf974f158f4(u64 
+DATARMNET6c1f17daa8);
 #endif
 
@@ -30,6 +30,7 @@
 #include "rmnet_genl.h"
 #include "rmnet_qmi.h"
 #include "qmi_rmnet.h"
+#include "rmnet_module.h"
 #define CONFIG_QTI_QMI_RMNET 1
 #define CONFIG_QTI_QMI_DFC  1
 #define CONFIG_QTI_QMI_POWER_COLLAPSE 1
@@ -1002,6 +1003,7 @@ static int __init rmnet_init(void)
 	}
 
 	rmnet_core_genl_init();
+	rmnet_hook_prof_init();
 
 	try_module_get(THIS_MODULE);
 	return 0;
@@ -1023,6 +1025,7 @@ static void __exit rmnet_exit(void)
 	rtnl_link_unregister(&rmnet_link_ops);
 	rmnet_ll_exit();
 	rmnet_core_genl_deinit();
+	rmnet_hook_prof_exit();
 
 	module_put(THIS_MODULE);
 }
@@ -27,6 +27,7 @@
 #include "rmnet_qmi.h"
 #include "rmnet_trace.h"
 #include "qmi_rmnet.h"
+#include "rmnet_module.h"
 
 #define RMNET_FRAG_DESCRIPTOR_POOL_SIZE 64
 #define RMNET_DL_IND_HDR_SIZE (sizeof(struct rmnet_map_dl_ind_hdr) + \
@@ -784,8 +785,13 @@ static void rmnet_frag_partial_csum(struct sk_buff *skb,
 		skb->csum_offset = offsetof(struct tcphdr, check);
 
 		rmnet_perf_tether_ingress = rcu_dereference(rmnet_perf_tether_ingress_hook);
-		if (rmnet_perf_tether_ingress)
+		if (rmnet_perf_tether_ingress) {
+			cycles_t prof = rmnet_hook_prof_start();
+
 			rmnet_perf_tether_ingress(tp, skb);
+			rmnet_hook_prof_end(RMNET_HOOK_PROF_PERF_TETHER_INGRESS,
+					    prof);
+		}
 	} else {
 		struct udphdr *up = (struct udphdr *)
 				    ((u8 *)iph + frag_desc->ip_len);
@@ -1827,8 +1833,11 @@ __rmnet_frag_ingress_handler(struct rmnet_frag_descriptor *frag_desc,
 	rmnet_perf_ingress = rcu_dereference(rmnet_perf_desc_entry);
 	if (rmnet_perf_ingress) {
 		list_for_each_entry_safe(frag, tmp, &segs, list) {
+			cycles_t prof = rmnet_hook_prof_start();
+
 			list_del_init(&frag->list);
 			rmnet_perf_ingress(frag, port);
+			rmnet_hook_prof_end(RMNET_HOOK_PROF_PERF_DESC, prof);
 		}
 		rcu_read_unlock();
 		return;
@@ -1927,8 +1936,12 @@ void rmnet_frag_ingress_handler(struct sk_buff *skb,
 
 	rcu_read_lock();
 	rmnet_perf_opt_chain_end = rcu_dereference(rmnet_perf_chain_end);
-	if (rmnet_perf_opt_chain_end)
+	if (rmnet_perf_opt_chain_end) {
+		cycles_t prof = rmnet_hook_prof_start();
+
 		rmnet_perf_opt_chain_end();
+		rmnet_hook_prof_end(RMNET_HOOK_PROF_PERF_CHAIN_END, prof);
+	}
 	rcu_read_unlock();
 }
 
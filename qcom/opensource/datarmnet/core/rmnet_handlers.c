@@ -33,6 +33,7 @@
 
 #include "rmnet_qmi.h"
 #include "qmi_rmnet.h"
+#include "rmnet_module.h"
 
 #define CREATE_TRACE_POINTS
 #include "rmnet_trace.h"
@@ -85,8 +86,13 @@ bool rmnet_slow_start_on(u32 hash_key)
 	bool (*rmnet_shs_slow_start_on)(u32 hash_key);
 
 	rmnet_shs_slow_start_on = rcu_dereference(rmnet_shs_slow_start_detect);
-	if (rmnet_shs_slow_start_on)
-		return rmnet_shs_slow_start_on(hash_key);
+	if (rmnet_shs_slow_start_on) {
+		cycles_t prof = rmnet_hook_prof_start();
+		bool on = rmnet_shs_slow_start_on(hash_key);
+
+		rmnet_hook_prof_end(RMNET_HOOK_PROF_SHS_SLOW_START, prof);
+		return on;
+	}
 
 	return false;
 }
@@ -130,7 +136,10 @@ rmnet_deliver_skb(struct sk_buff *skb, struct rmnet_port *port)
 	rcu_read_lock();
 	rmnet_shs_stamp = rcu_dereference(rmnet_shs_skb_entry);
 	if (rmnet_shs_stamp) {
+		cycles_t prof = rmnet_hook_prof_start();
+
 		rmnet_shs_stamp(skb, &port->shs_cfg);
+		rmnet_hook_prof_end(RMNET_HOOK_PROF_SHS_SKB_ENTRY, prof);
 		rcu_read_unlock();
 		return;
 	}
@@ -166,7 +175,11 @@ rmnet_deliver_skb_wq(struct sk_buff *skb, struct rmnet_port *port,
 	rmnet_shs_stamp = (!ctx) ? rcu_dereference(rmnet_shs_skb_entry) :
 				   rcu_dereference(rmnet_shs_skb_entry_wq);
 	if (rmnet_shs_stamp) {
+		cycles_t prof = rmnet_hook_prof_start();
+
 		rmnet_shs_stamp(skb, &port->shs_cfg);
+		rmnet_hook_prof_end(ctx ? RMNET_HOOK_PROF_SHS_SKB_ENTRY_WQ :
+				    RMNET_HOOK_PROF_SHS_SKB_ENTRY, prof);
 		rcu_read_unlock();
 		return;
 	}
@@ -392,7 +405,10 @@ rmnet_map_ingress_handler(struct sk_buff *skb,
 	rcu_read_lock();
 	rmnet_perf_core_deaggregate = rcu_dereference(rmnet_perf_deag_entry);
 	if (rmnet_perf_core_deaggregate) {
+		cycles_t prof = rmnet_hook_prof_start();
+
 		rmnet_perf_core_deaggregate(skb, port);
+		rmnet_hook_prof_end(RMNET_HOOK_PROF_PERF_DEAG, prof);
 		rcu_read_unlock();
 		return;
 	}
@@ -539,8 +555,11 @@ rx_handler_result_t rmnet_rx_handler(struct sk_buff **pskb)
 		cb = RMNET_SKB_CB(skb);
 		if (rmnet_core_shs_switch && !cb->qmap_steer &&
 		    skb->priority != 0xda1a) {
+			cycles_t prof = rmnet_hook_prof_start();
+
 			cb->qmap_steer = 1;
 			rmnet_core_shs_switch(skb, &port->phy_shs_cfg);
+			rmnet_hook_prof_end(RMNET_HOOK_PROF_SHS_SWITCH, prof);
 			rcu_read_unlock();
 			return RX_HANDLER_CONSUMED;
 		}
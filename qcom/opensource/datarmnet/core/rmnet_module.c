@@ -10,6 +10,9 @@
  * GNU General Public License for more details.
  */
 
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/percpu.h>
 #include "rmnet_module.h"
 
 struct rmnet_module_hook_info {
@@ -77,8 +80,10 @@ __RMNET_HOOK_PROTO(RMNET_HOOK_PARAMS(proto), ret_type) \
 	rcu_read_lock(); \
 	__func = rcu_dereference(__info->func); \
 	if (__func) { \
+		cycles_t __prof = rmnet_hook_prof_start(); \
 		RMNET_HOOK_IF_NON_VOID_TYPE(ret_type)( ret_type __rc = ) \
 		__func(args); \
+		rmnet_hook_prof_end(hook_num, __prof); \
 		__ret = 1; \
 \
 		RMNET_HOOK_IF_NON_VOID_TYPE(ret_type)( if (__ret_code) \
@@ -98,3 +103,165 @@ __RMNET_HOOK_DEFINE(call, hook_num, RMNET_HOOK_PARAMS(proto), \
 #define __RMNET_HOOK_MULTIREAD__
 #include "rmnet_hook.h"
 
+/* Hook cost profiler */
+#define RMNET_HOOK_PROF_BUCKETS 20
+
+struct rmnet_hook_prof_stat {
+	u64 calls;
+	u64 cycles;
+	u64 max;
+	u64 hist[RMNET_HOOK_PROF_BUCKETS];
+};
+
+struct rmnet_hook_prof_cpu {
+	struct rmnet_hook_prof_stat hook[__RMNET_HOOK_PROF_NUM];
+};
+
+DEFINE_STATIC_KEY_FALSE(rmnet_hook_prof_key);
+EXPORT_SYMBOL(rmnet_hook_prof_key);
+
+static DEFINE_PER_CPU(struct rmnet_hook_prof_cpu, rmnet_hook_prof_cpu);
+static DEFINE_MUTEX(rmnet_hook_prof_lock);
+static unsigned long rmnet_hook_prof_since;
+static struct dentry *rmnet_hook_prof_dir;
+
+static const char * const rmnet_hook_prof_names[__RMNET_HOOK_PROF_NUM] = {
+	[RMNET_MODULE_HOOK_OFFLOAD_INGRESS] = "offload_ingress",
+	[RMNET_MODULE_HOOK_OFFLOAD_CHAIN_END] = "offload_chain_end",
+	[RMNET_MODULE_HOOK_SHS_SKB_ENTRY] = "shs_skb_entry",
+	[RMNET_MODULE_HOOK_SHS_SWITCH] = "shs_switch",
+	[RMNET_MODULE_HOOK_PERF_TETHER_INGRESS] = "perf_tether_ingress",
+	[RMNET_MODULE_HOOK_PERF_TETHER_EGRESS] = "perf_tether_egress",
+	[RMNET_MODULE_HOOK_PERF_TETHER_CMD] = "perf_tether_cmd",
+	[RMNET_MODULE_HOOK_PERF_INGRESS] = "perf_ingress",
+	[RMNET_MODULE_HOOK_PERF_EGRESS] = "perf_egress",
+	[RMNET_MODULE_HOOK_APS_PRE_QUEUE] = "aps_pre_queue",
+	[RMNET_MODULE_HOOK_APS_POST_QUEUE] = "aps_post_queue",
+	[RMNET_MODULE_HOOK_WLAN_FLOW_MATCH] = "wlan_flow_match",
+	[RMNET_HOOK_PROF_PERF_DEAG] = "legacy_perf_deag_entry",
+	[RMNET_HOOK_PROF_PERF_DESC] = "legacy_perf_desc_entry",
+	[RMNET_HOOK_PROF_PERF_CHAIN_END] = "legacy_perf_chain_end",
+	[RMNET_HOOK_PROF_PERF_EGRESS1] = "legacy_perf_egress_hook1",
+	[RMNET_HOOK_PROF_PERF_TETHER_INGRESS] = "legacy_perf_tether_ingress",
+	[RMNET_HOOK_PROF_PERF_TETHER_EGRESS] = "legacy_perf_tether_egress",
+	[RMNET_HOOK_PROF_SHS_SKB_ENTRY] = "legacy_shs_skb_entry",
+	[RMNET_HOOK_PROF_SHS_SKB_ENTRY_WQ] = "legacy_shs_skb_entry_wq",
+	[RMNET_HOOK_PROF_SHS_SWITCH] = "legacy_shs_switch",
+	[RMNET_HOOK_PROF_SHS_SLOW_START] = "legacy_shs_slow_start",
+	[RMNET_HOOK_PROF_APS_SET_PRIO] = "legacy_aps_set_prio",
+};
+
+void rmnet_hook_prof_record(int hook, cycles_t cycles)
+{
+	struct rmnet_hook_prof_stat *stat;
+	int bucket;
+
+	if (hook >= __RMNET_HOOK_PROF_NUM)
+		return;
+
+	/* Callers run in softirq and process context alike. A stray
+	 * migration only misattributes one sample to the wrong CPU.
+	 */
+	stat = raw_cpu_ptr(&rmnet_hook_prof_cpu.hook[hook]);
+	bucket = min_t(int, fls64(cycles), RMNET_HOOK_PROF_BUCKETS - 1);
+	stat->calls++;
+	stat->cycles += cycles;
+	stat->hist[bucket]++;
+	if (cycles > stat->max)
+		stat->max = cycles;
+}
+EXPORT_SYMBOL(rmnet_hook_prof_record);
+
+static void rmnet_hook_prof_reset(void)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu)
+		memset(per_cpu_ptr(&rmnet_hook_prof_cpu, cpu), 0,
+		       sizeof(struct rmnet_hook_prof_cpu));
+
+	rmnet_hook_prof_since = jiffies;
+}
+
+static int rmnet_hook_prof_show(struct seq_file *s, void *unused)
+{
+	struct rmnet_hook_prof_stat sum;
+	unsigned long secs;
+	int hook, cpu, i;
+
+	secs = max_t(unsigned long,
+		     (jiffies - rmnet_hook_prof_since) / HZ, 1);
+	seq_printf(s, "enabled %d window %lus\n",
+		   static_key_enabled(&rmnet_hook_prof_key), secs);
+	seq_puts(s, "hook calls calls/s avg_cycles max_cycles hist(log2 cycles)\n");
+
+	for (hook = 0; hook < __RMNET_HOOK_PROF_NUM; hook++) {
+		memset(&sum, 0, sizeof(sum));
+		for_each_possible_cpu(cpu) {
+			struct rmnet_hook_prof_stat *stat;
+
+			stat = per_cpu_ptr(&rmnet_hook_prof_cpu.hook[hook], cpu);
+			sum.calls += stat->calls;
+			sum.cycles += stat->cycles;
+			sum.max = max(sum.max, stat->max);
+			for (i = 0; i < RMNET_HOOK_PROF_BUCKETS; i++)
+				sum.hist[i] += stat->hist[i];
+		}
+
+		if (!sum.calls)
+			continue;
+
+		seq_printf(s, "%s %llu %llu %llu %llu",
+			   rmnet_hook_prof_names[hook], sum.calls,
+			   div64_u64(sum.calls, secs),
+			   div64_u64(sum.cycles, sum.calls), sum.max);
+		for (i = 0; i < RMNET_HOOK_PROF_BUCKETS; i++)
+			seq_printf(s, " %llu", sum.hist[i]);
+		seq_putc(s, '\n');
+	}
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(rmnet_hook_prof);
+
+static int rmnet_hook_prof_enable_get(void *data, u64 *val)
+{
+	*val = static_key_enabled(&rmnet_hook_prof_key);
+	return 0;
+}
+
+static int rmnet_hook_prof_enable_set(void *data, u64 val)
+{
+	mutex_lock(&rmnet_hook_prof_lock);
+	if (val && !static_key_enabled(&rmnet_hook_prof_key)) {
+		rmnet_hook_prof_reset();
+		static_branch_enable(&rmnet_hook_prof_key);
+	} else if (!val && static_key_enabled(&rmnet_hook_prof_key)) {
+		static_branch_disable(&rmnet_hook_prof_key);
+	}
+	mutex_unlock(&rmnet_hook_prof_lock);
+
+	return 0;
+}
+DEFINE_DEBUGFS_ATTRIBUTE(rmnet_hook_prof_enable_fops,
+			 rmnet_hook_prof_enable_get,
+			 rmnet_hook_prof_enable_set, "%llu\n");
+
+void rmnet_hook_prof_init(void)
+{
+	rmnet_hook_prof_dir = debugfs_create_dir("rmnet_hook_prof", NULL);
+	if (IS_ERR_OR_NULL(rmnet_hook_prof_dir))
+		return;
+
+	debugfs_create_file_unsafe("enable", 0644, rmnet_hook_prof_dir, NULL,
+			    &rmnet_hook_prof_enable_fops);
+	debugfs_create_file("stats", 0444, rmnet_hook_prof_dir, NULL,
+			    &rmnet_hook_prof_fops);
+}
+
+void rmnet_hook_prof_exit(void)
+{
+	static_branch_disable(&rmnet_hook_prof_key);
+	debugfs_remove_recursive(rmnet_hook_prof_dir);
+	rmnet_hook_prof_dir = NULL;
+}
@@ -14,6 +14,8 @@
 #define __RMNET_MODULE_H__
 
 #include <linux/rcupdate.h>
+#include <linux/jump_label.h>
+#include <linux/timex.h>
 
 enum {
 	RMNET_MODULE_HOOK_OFFLOAD_INGRESS,
@@ -31,6 +33,47 @@ enum {
 	__RMNET_MODULE_NUM_HOOKS,
 };
 
+/* Legacy hook pointers dispatched directly by the core. Numbered after the
+ * module hooks so both share the profiler tables.
+ */
+enum {
+	RMNET_HOOK_PROF_PERF_DEAG = __RMNET_MODULE_NUM_HOOKS,
+	RMNET_HOOK_PROF_PERF_DESC,
+	RMNET_HOOK_PROF_PERF_CHAIN_END,
+	RMNET_HOOK_PROF_PERF_EGRESS1,
+	RMNET_HOOK_PROF_PERF_TETHER_INGRESS,
+	RMNET_HOOK_PROF_PERF_TETHER_EGRESS,
+	RMNET_HOOK_PROF_SHS_SKB_ENTRY,
+	RMNET_HOOK_PROF_SHS_SKB_ENTRY_WQ,
+	RMNET_HOOK_PROF_SHS_SWITCH,
+	RMNET_HOOK_PROF_SHS_SLOW_START,
+	RMNET_HOOK_PROF_APS_SET_PRIO,
+	__RMNET_HOOK_PROF_NUM,
+};
+
+DECLARE_STATIC_KEY_FALSE(rmnet_hook_prof_key);
+
+void rmnet_hook_prof_record(int hook, cycles_t cycles);
+void rmnet_hook_prof_init(void);
+void rmnet_hook_prof_exit(void);
+
+/* Wrap a hook dispatch with rmnet_hook_prof_start()/rmnet_hook_prof_end().
+ * Both are a patched-out branch unless profiling is enabled from debugfs.
+ */
+static __always_inline cycles_t rmnet_hook_prof_start(void)
+{
+	if (static_branch_unlikely(&rmnet_hook_prof_key))
+		return get_cycles();
+
+	return 0;
+}
+
+static __always_inline void rmnet_hook_prof_end(int hook, cycles_t start)
+{
+	if (static_branch_unlikely(&rmnet_hook_prof_key) && start)
+		rmnet_hook_prof_record(hook, get_cycles() - start);
+}
+
 struct rmnet_module_hook_register_info {
 	int hooknum;
 	void *func;
@@ -36,6 +36,7 @@
 
 #include "qmi_rmnet.h"
 #include "rmnet_qmi.h"
+#include "rmnet_module.h"
 #include "rmnet_trace.h"
 
 typedef void (*rmnet_perf_tether_egress_hook_t)(struct sk_buff *skb);
@@ -96,7 +97,11 @@ static netdev_tx_t rmnet_vnd_start_xmit(struct sk_buff *skb,
 		trace_rmnet_xmit_skb(skb);
 		rmnet_perf_tether_egress = rcu_dereference(rmnet_perf_tether_egress_hook);
 		if (rmnet_perf_tether_egress) {
+			cycles_t prof = rmnet_hook_prof_start();
+
 			rmnet_perf_tether_egress(skb);
+			rmnet_hook_prof_end(RMNET_HOOK_PROF_PERF_TETHER_EGRESS,
+					    prof);
 		}
 
 		qmi_rmnet_get_flow_state(dev, skb, &need_to_drop, &low_latency);
@@ -279,7 +284,10 @@ static u16 rmnet_vnd_select_queue(struct net_device *dev,
 
 	rmnet_perf_egress1 = rcu_dereference(rmnet_perf_egress_hook1);
 	if (rmnet_perf_egress1) {
+		cycles_t prof = rmnet_hook_prof_start();
+
 		rmnet_perf_egress1(skb);
+		rmnet_hook_prof_end(RMNET_HOOK_PROF_PERF_EGRESS1, prof);
 	}
 
 	if (trace_print_icmp_tx_enabled()) {
@@ -440,8 +448,12 @@ skip_trace:
 
 	rcu_read_lock();
 	aps_set_prio = READ_ONCE(rmnet_aps_set_prio);
-	if (aps_set_prio)
+	if (aps_set_prio) {
+		cycles_t prof = rmnet_hook_prof_start();
+
 		aps_set_prio(dev, skb);
+		rmnet_hook_prof_end(RMNET_HOOK_PROF_APS_SET_PRIO, prof);
+	}
 	rcu_read_unlock();
 
 	return (txq < dev->real_num_tx_queues) ? txq : 0;
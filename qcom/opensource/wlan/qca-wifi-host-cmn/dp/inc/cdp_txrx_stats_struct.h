@@ -2363,6 +2363,8 @@ struct cdp_pdev_stats {
 	struct {
 		uint64_t num_bufs_refilled;
 		uint64_t num_bufs_allocated;
+		uint64_t num_bufs_recycled;
+		uint64_t num_bufs_reused;
 	} rx_refill_buff_pool;
 
 	uint32_t peer_unauth_rx_pkt_drop;
@@ -433,7 +433,9 @@ more_data:
 
 		/*
 		 * move unmap after scattered msdu waiting break logic
-		 * in case double skb unmap happened.
+		 * in case double skb unmap happened. Page pool backed
+		 * refill buffers are only synced for the CPU and keep
+		 * their mapping for the next replenish.
 		 */
 		rx_desc_pool = &soc->rx_desc_buf[rx_desc->pool_id];
 		dp_ipa_reo_ctx_buf_mapping_lock(soc, reo_ring_num);
@@ -468,7 +470,8 @@ more_data:
 			break;
 	}
 done:
-	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+	dp_rx_reo_ring_access_end(int_ctx, soc, hal_ring_hdl, reo_ring_num,
+				  num_rx_bufs_reaped);
 
 	replenish_soc = dp_rx_replensih_soc_get(soc, reo_ring_num);
 	for (mac_id = 0; mac_id < MAX_PDEV_CNT; mac_id++) {
@@ -844,6 +847,8 @@ done:
 							   &near_full);
 			if (num_pending) {
 				DP_STATS_INC(soc, rx.hp_oos2, 1);
+				hif_exec_update_backlog(scn, intr_id,
+							num_pending);
 
 				if (!hif_exec_should_yield(scn, intr_id))
 					goto more_data;
@@ -864,6 +869,8 @@ done:
 		}
 	}
 
+	dp_rx_reo_ring_flush(int_ctx, soc, hal_ring_hdl, reo_ring_num);
+
 	/* Update histogram statistics by looping through pdev's */
 	DP_RX_HIST_STATS_PER_PDEV();
 
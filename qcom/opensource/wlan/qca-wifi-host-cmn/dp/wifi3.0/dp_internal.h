@@ -1737,6 +1737,22 @@ dp_print_pdev_rx_stats(struct dp_pdev *pdev);
  */
 void dp_print_soc_tx_stats(struct dp_soc *soc);
 
+#ifdef DP_TX_DESC_PERCPU_CACHE
+/**
+ * dp_print_soc_tx_desc_cache_stats() - Print per-CPU tx descriptor
+ *					magazine occupancy and pool lock
+ *					contention
+ * @soc: DP_SOC Handle
+ *
+ * Return: void
+ */
+void dp_print_soc_tx_desc_cache_stats(struct dp_soc *soc);
+#else
+static inline void dp_print_soc_tx_desc_cache_stats(struct dp_soc *soc)
+{
+}
+#endif
+
 /**
  * dp_print_soc_interrupt_stats() - Print interrupt stats for the soc
  * @soc: dp_soc handle
@@ -1753,6 +1769,14 @@ void dp_print_soc_interrupt_stats(struct dp_soc *soc);
  */
 void dp_print_soc_rx_stats(struct dp_soc *soc);
 
+/**
+ * dp_print_soc_hash_lock_stats() - Print peer/AST/MEC hash lock stats
+ * @soc: DP_SOC Handle
+ *
+ * Return: void
+ */
+void dp_print_soc_hash_lock_stats(struct dp_soc *soc);
+
 /**
  * dp_get_mac_id_for_pdev() -  Return mac corresponding to pdev for mac
  *
@@ -2126,6 +2150,12 @@ dp_hal_srng_access_end(hal_soc_handle_t soc, hal_ring_handle_t hal_ring_hdl)
 	hal_srng_access_end_unlocked(soc, hal_ring_hdl);
 }
 
+static inline void
+dp_hal_srng_access_end_reap(hal_soc_handle_t soc,
+			    hal_ring_handle_t hal_ring_hdl)
+{
+}
+
 #else
 static inline int
 dp_hal_srng_access_start(hal_soc_handle_t soc, hal_ring_handle_t hal_ring_hdl)
@@ -2138,6 +2168,13 @@ dp_hal_srng_access_end(hal_soc_handle_t soc, hal_ring_handle_t hal_ring_hdl)
 {
 	hal_srng_access_end(soc, hal_ring_hdl);
 }
+
+static inline void
+dp_hal_srng_access_end_reap(hal_soc_handle_t soc,
+			    hal_ring_handle_t hal_ring_hdl)
+{
+	hal_srng_access_end_reap(soc, hal_ring_hdl);
+}
 #endif
 
 #ifdef WLAN_FEATURE_DP_EVENT_HISTORY
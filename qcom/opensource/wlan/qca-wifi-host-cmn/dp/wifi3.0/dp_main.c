@@ -584,7 +584,8 @@ static void dp_service_lmac_rings(void *arg)
 void dp_peer_mec_flush_entries(struct dp_soc *soc)
 {
 	unsigned int index;
-	struct dp_mec_entry *mecentry, *mecentry_next;
+	struct dp_mec_entry *mecentry;
+	struct qdf_hlist_node *mecentry_next;
 
 	TAILQ_HEAD(, dp_mec_entry) free_list;
 	TAILQ_INIT(&free_list);
@@ -598,16 +599,18 @@ void dp_peer_mec_flush_entries(struct dp_soc *soc)
 	if (!qdf_atomic_read(&soc->mec_cnt))
 		return;
 
-	qdf_spin_lock_bh(&soc->mec_lock);
 	for (index = 0; index <= soc->mec_hash.mask; index++) {
-		if (!TAILQ_EMPTY(&soc->mec_hash.bins[index])) {
-			TAILQ_FOREACH_SAFE(mecentry, &soc->mec_hash.bins[index],
-					   hash_list_elem, mecentry_next) {
-			    dp_peer_mec_detach_entry(soc, mecentry, &free_list);
-			}
+		if (qdf_hlist_empty(&soc->mec_hash.bins[index]))
+			continue;
+
+		dp_peer_mec_bucket_lock(soc, index);
+		qdf_hlist_for_each_entry_safe(mecentry, mecentry_next,
+					      &soc->mec_hash.bins[index],
+					      hash_list_elem) {
+			dp_peer_mec_detach_entry(soc, mecentry, &free_list);
 		}
+		dp_peer_mec_bucket_unlock(soc, index);
 	}
-	qdf_spin_unlock_bh(&soc->mec_lock);
 
 	dp_peer_mec_free_list(soc, &free_list);
 }
@@ -639,21 +642,19 @@ static void dp_print_mec_stats(struct dp_soc *soc)
 	}
 
 	DP_PRINT_STATS("MEC Table:");
+	qdf_rcu_read_lock();
 	for (index = 0; index <= soc->mec_hash.mask; index++) {
-		qdf_spin_lock_bh(&soc->mec_lock);
-		if (TAILQ_EMPTY(&soc->mec_hash.bins[index])) {
-			qdf_spin_unlock_bh(&soc->mec_lock);
-			continue;
-		}
-
-		TAILQ_FOREACH(mecentry, &soc->mec_hash.bins[index],
-			      hash_list_elem) {
+		qdf_hlist_for_each_entry_rcu(mecentry,
+					     &soc->mec_hash.bins[index],
+					     hash_list_elem) {
+			if (num_entries >= DP_PEER_MAX_MEC_ENTRY)
+				break;
 			qdf_mem_copy(&mec_list[num_entries], mecentry,
 				     sizeof(*mecentry));
 			num_entries++;
 		}
-		qdf_spin_unlock_bh(&soc->mec_lock);
 	}
+	qdf_rcu_read_unlock();
 
 	if (!num_entries) {
 		qdf_mem_free(mec_list);
@@ -5689,6 +5690,8 @@ static void dp_soc_deinit(void *txrx_soc)
 
 	qdf_spinlock_destroy(&soc->ast_lock);
 
+	dp_peer_ast_spinlock_destroy(soc);
+
 	dp_peer_mec_spinlock_destroy(soc);
 
 	qdf_nbuf_queue_free(&soc->htt_stats.msg);
@@ -7421,7 +7424,7 @@ static QDF_STATUS dp_cp_peer_del_resp_handler(struct cdp_soc_t *soc_hdl,
 		   cookie,
 		   CDP_TXRX_AST_DELETED);
 	}
-	qdf_mem_free(ast_entry);
+	dp_peer_ast_entry_rcu_free(ast_entry);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -7876,6 +7879,20 @@ free_vdev:
 
 qdf_export_symbol(dp_vdev_unref_delete);
 
+/*
+ * dp_peer_rcu_free() - free peer memory after an RCU grace period
+ * @head: RCU head embedded in the peer
+ *
+ * Link peers are looked up from the soc peer hash under RCU, so the
+ * memory must stay valid until those readers are done with it.
+ *
+ * Return: None
+ */
+static void dp_peer_rcu_free(struct qdf_rcu_head *head)
+{
+	qdf_mem_free(qdf_container_of(head, struct dp_peer, rcu));
+}
+
 /*
  * dp_peer_unref_delete() - unref and delete peer
  * @peer_handle:    Datapath peer handle
@@ -7961,7 +7978,7 @@ void dp_peer_unref_delete(struct dp_peer *peer, enum dp_mod_id mod_id)
 		dp_monitor_peer_detach(soc, peer);
 
 		qdf_spinlock_destroy(&peer->peer_state_lock);
-		qdf_mem_free(peer);
+		qdf_call_rcu(&peer->rcu, dp_peer_rcu_free);
 
 		/*
 		 * Decrement ref count taken at peer create
@@ -8945,6 +8962,7 @@ dp_print_host_stats(struct dp_vdev *vdev,
 	case TXRX_TX_HOST_STATS:
 		dp_print_pdev_tx_stats(pdev);
 		dp_print_soc_tx_stats(pdev->soc);
+		dp_print_soc_tx_desc_cache_stats(pdev->soc);
 		break;
 	case TXRX_RX_HOST_STATS:
 		dp_print_pdev_rx_stats(pdev);
@@ -8953,6 +8971,7 @@ dp_print_host_stats(struct dp_vdev *vdev,
 	case TXRX_AST_STATS:
 		dp_print_ast_stats(pdev->soc);
 		dp_print_mec_stats(pdev->soc);
+		dp_print_soc_hash_lock_stats(pdev->soc);
 		dp_print_peer_table(vdev);
 		break;
 	case TXRX_SRNG_PTR_STATS:
@@ -13558,6 +13577,7 @@ void *dp_soc_init(struct dp_soc *soc, HTC_HANDLE htc_handle,
 	qdf_nbuf_queue_init(&soc->htt_stats.msg);
 
 	qdf_spinlock_create(&soc->ast_lock);
+	dp_peer_ast_spinlock_create(soc);
 	dp_peer_mec_spinlock_create(soc);
 
 	qdf_spinlock_create(&soc->reo_desc_freelist_lock);
@@ -228,6 +228,116 @@ dp_peer_find_hash_index(struct dp_soc *soc,
 	return index;
 }
 
+/*
+ * dp_peer_hash_locks_create() - create the peer hash writer lock stripes
+ * @soc: soc handle
+ *
+ * return: none
+ */
+static void dp_peer_hash_locks_create(struct dp_soc *soc)
+{
+	int i;
+
+	for (i = 0; i < DP_HASH_LOCK_STRIPES; i++)
+		qdf_spinlock_create(&soc->peer_hash_lock[i]);
+}
+
+/*
+ * dp_peer_hash_locks_destroy() - destroy the peer hash writer lock stripes
+ * @soc: soc handle
+ *
+ * return: none
+ */
+static void dp_peer_hash_locks_destroy(struct dp_soc *soc)
+{
+	int i;
+
+	for (i = 0; i < DP_HASH_LOCK_STRIPES; i++)
+		qdf_spinlock_destroy(&soc->peer_hash_lock[i]);
+}
+
+/*
+ * dp_peer_hash_bucket_lock() - take the writer lock covering a peer bucket
+ * @soc: soc handle
+ * @index: peer hash bucket index
+ *
+ * Lookups walk the buckets under RCU and never take this lock, it only
+ * serializes add and remove of peers hashing to the same lock stripe.
+ *
+ * return: none
+ */
+static inline void dp_peer_hash_bucket_lock(struct dp_soc *soc, uint32_t index)
+{
+	DP_MUTEX_TYPE *lock;
+
+	lock = &soc->peer_hash_lock[index & (DP_HASH_LOCK_STRIPES - 1)];
+	if (!qdf_spin_trylock_bh(lock)) {
+		qdf_spin_lock_bh(lock);
+		DP_STATS_INC(soc, peer_hash_lock.contended, 1);
+	}
+	DP_STATS_INC(soc, peer_hash_lock.acquired, 1);
+}
+
+/*
+ * dp_peer_hash_bucket_unlock() - release the writer lock of a peer bucket
+ * @soc: soc handle
+ * @index: peer hash bucket index
+ *
+ * return: none
+ */
+static inline void
+dp_peer_hash_bucket_unlock(struct dp_soc *soc, uint32_t index)
+{
+	qdf_spin_unlock_bh(&soc->peer_hash_lock[index &
+						(DP_HASH_LOCK_STRIPES - 1)]);
+}
+
+/*
+ * dp_peer_hash_bucket_find() - find a link peer in a bucket without locking
+ * @soc: soc handle
+ * @index: peer hash bucket index
+ * @mac_addr: aligned peer mac address
+ * @vdev_id: vdev_id, or DP_VDEV_ALL to match any vdev
+ * @pdev: pdev to match instead of @vdev_id, NULL to ignore
+ * @mod_id: id of module requesting reference
+ *
+ * The bucket is walked under RCU. A reference is taken before peer->vdev
+ * is dereferenced since the vdev is only pinned by the peer references;
+ * peers whose count already dropped to zero are being freed and skipped.
+ *
+ * return: referenced peer on success
+ *         NULL in failure
+ */
+static struct dp_peer *
+dp_peer_hash_bucket_find(struct dp_soc *soc, uint32_t index,
+			 union dp_align_mac_addr *mac_addr, uint8_t vdev_id,
+			 struct dp_pdev *pdev, enum dp_mod_id mod_id)
+{
+	struct dp_peer *peer;
+
+	qdf_rcu_read_lock();
+	qdf_hlist_for_each_entry_rcu(peer, &soc->peer_hash.bins[index],
+				     hash_node) {
+		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr))
+			continue;
+
+		if (dp_peer_get_ref(soc, peer, mod_id) != QDF_STATUS_SUCCESS)
+			continue;
+
+		if ((pdev && peer->vdev->pdev == pdev) ||
+		    (!pdev && (peer->vdev->vdev_id == vdev_id ||
+			       vdev_id == DP_VDEV_ALL))) {
+			qdf_rcu_read_unlock();
+			return peer;
+		}
+
+		dp_peer_unref_delete(peer, mod_id);
+	}
+	qdf_rcu_read_unlock();
+
+	return NULL;
+}
+
 #ifdef WLAN_FEATURE_11BE_MLO
 /*
  * dp_peer_find_hash_detach() - cleanup memory for peer_hash table
@@ -240,7 +350,7 @@ static void dp_peer_find_hash_detach(struct dp_soc *soc)
 	if (soc->peer_hash.bins) {
 		qdf_mem_free(soc->peer_hash.bins);
 		soc->peer_hash.bins = NULL;
-		qdf_spinlock_destroy(&soc->peer_hash_lock);
+		dp_peer_hash_locks_destroy(soc);
 	}
 
 	if (soc->arch_ops.mlo_peer_find_hash_detach)
@@ -266,16 +376,16 @@ static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 
 	soc->peer_hash.mask = hash_elems - 1;
 	soc->peer_hash.idx_bits = log2;
-	/* allocate an array of TAILQ peer object lists */
+	/* allocate an array of RCU protected peer object lists */
 	soc->peer_hash.bins = qdf_mem_malloc(
-		hash_elems * sizeof(TAILQ_HEAD(anonymous_tail_q, dp_peer)));
+		hash_elems * sizeof(*soc->peer_hash.bins));
 	if (!soc->peer_hash.bins)
 		return QDF_STATUS_E_NOMEM;
 
 	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&soc->peer_hash.bins[i]);
+		qdf_init_hlist_head(&soc->peer_hash.bins[i]);
 
-	qdf_spinlock_create(&soc->peer_hash_lock);
+	dp_peer_hash_locks_create(soc);
 
 	if (soc->arch_ops.mlo_peer_find_hash_attach &&
 	    (soc->arch_ops.mlo_peer_find_hash_attach(soc) !=
@@ -300,13 +410,13 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 
 	index = dp_peer_find_hash_index(soc, &peer->mac_addr);
 	if (peer->peer_type == CDP_LINK_PEER_TYPE) {
-		qdf_spin_lock_bh(&soc->peer_hash_lock);
+		dp_peer_hash_bucket_lock(soc, index);
 
 		if (QDF_IS_STATUS_ERROR(dp_peer_get_ref(soc, peer,
 							DP_MOD_ID_CONFIG))) {
 			dp_err("fail to get peer ref:" QDF_MAC_ADDR_FMT,
 			       QDF_MAC_ADDR_REF(peer->mac_addr.raw));
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
+			dp_peer_hash_bucket_unlock(soc, index);
 			return;
 		}
 
@@ -317,10 +427,10 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 		 * this ensures that if two entries with the same MAC address
 		 * are stored, the one added first will be found first.
 		 */
-		TAILQ_INSERT_TAIL(&soc->peer_hash.bins[index], peer,
-				  hash_list_elem);
+		qdf_hlist_add_tail_rcu(&peer->hash_node,
+				       &soc->peer_hash.bins[index]);
 
-		qdf_spin_unlock_bh(&soc->peer_hash_lock);
+		dp_peer_hash_bucket_unlock(soc, index);
 	} else if (peer->peer_type == CDP_MLD_PEER_TYPE) {
 		if (soc->arch_ops.mlo_peer_find_hash_add)
 			soc->arch_ops.mlo_peer_find_hash_add(soc, peer);
@@ -364,21 +474,10 @@ struct dp_peer *dp_peer_find_hash_find(struct dp_soc *soc,
 	}
 	/* search link peer table firstly */
 	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    ((peer->vdev->vdev_id == vdev_id) ||
-		     (vdev_id == DP_VDEV_ALL))) {
-			/* take peer reference before returning */
-			if (dp_peer_get_ref(soc, peer, mod_id) !=
-						QDF_STATUS_SUCCESS)
-				peer = NULL;
-
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
-			return peer;
-		}
-	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
+	peer = dp_peer_hash_bucket_find(soc, index, mac_addr, vdev_id, NULL,
+					mod_id);
+	if (peer)
+		return peer;
 
 	if (soc->arch_ops.mlo_peer_find_hash_find)
 		return soc->arch_ops.mlo_peer_find_hash_find(soc, peer_mac_addr,
@@ -399,29 +498,27 @@ qdf_export_symbol(dp_peer_find_hash_find);
 void dp_peer_find_hash_remove(struct dp_soc *soc, struct dp_peer *peer)
 {
 	unsigned index;
-	struct dp_peer *tmppeer = NULL;
 	int found = 0;
 
 	index = dp_peer_find_hash_index(soc, &peer->mac_addr);
 
 	if (peer->peer_type == CDP_LINK_PEER_TYPE) {
 		/* Check if tail is not empty before delete*/
-		QDF_ASSERT(!TAILQ_EMPTY(&soc->peer_hash.bins[index]));
+		QDF_ASSERT(!qdf_hlist_empty(&soc->peer_hash.bins[index]));
 
-		qdf_spin_lock_bh(&soc->peer_hash_lock);
-		TAILQ_FOREACH(tmppeer, &soc->peer_hash.bins[index],
-			      hash_list_elem) {
-			if (tmppeer == peer) {
-				found = 1;
-				break;
-			}
-		}
+		dp_peer_hash_bucket_lock(soc, index);
+		found = !qdf_hlist_unhashed(&peer->hash_node);
 		QDF_ASSERT(found);
-		TAILQ_REMOVE(&soc->peer_hash.bins[index], peer,
-			     hash_list_elem);
+		if (found)
+			qdf_hlist_del_init_rcu(&peer->hash_node);
+		dp_peer_hash_bucket_unlock(soc, index);
 
-		dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
-		qdf_spin_unlock_bh(&soc->peer_hash_lock);
+		/*
+		 * Lookups still walking past the peer hold no reference,
+		 * the final free is deferred until they are done.
+		 */
+		if (found)
+			dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 	} else if (peer->peer_type == CDP_MLD_PEER_TYPE) {
 		if (soc->arch_ops.mlo_peer_find_hash_remove)
 			soc->arch_ops.mlo_peer_find_hash_remove(soc, peer);
@@ -459,15 +556,12 @@ static bool dp_peer_exist_on_pdev(struct dp_soc *soc,
 		mac_addr = &local_mac_addr_aligned;
 	}
 	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    (peer->vdev->pdev == pdev)) {
-			found = true;
-			break;
-		}
+	peer = dp_peer_hash_bucket_find(soc, index, mac_addr, DP_VDEV_ALL,
+					pdev, DP_MOD_ID_CONFIG);
+	if (peer) {
+		found = true;
+		dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
 
 	return found;
 }
@@ -485,16 +579,16 @@ static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 
 	soc->peer_hash.mask = hash_elems - 1;
 	soc->peer_hash.idx_bits = log2;
-	/* allocate an array of TAILQ peer object lists */
+	/* allocate an array of RCU protected peer object lists */
 	soc->peer_hash.bins = qdf_mem_malloc(
-		hash_elems * sizeof(TAILQ_HEAD(anonymous_tail_q, dp_peer)));
+		hash_elems * sizeof(*soc->peer_hash.bins));
 	if (!soc->peer_hash.bins)
 		return QDF_STATUS_E_NOMEM;
 
 	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&soc->peer_hash.bins[i]);
+		qdf_init_hlist_head(&soc->peer_hash.bins[i]);
 
-	qdf_spinlock_create(&soc->peer_hash_lock);
+	dp_peer_hash_locks_create(soc);
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -503,7 +597,7 @@ static void dp_peer_find_hash_detach(struct dp_soc *soc)
 	if (soc->peer_hash.bins) {
 		qdf_mem_free(soc->peer_hash.bins);
 		soc->peer_hash.bins = NULL;
-		qdf_spinlock_destroy(&soc->peer_hash_lock);
+		dp_peer_hash_locks_destroy(soc);
 	}
 }
 
@@ -512,12 +606,12 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 	unsigned index;
 
 	index = dp_peer_find_hash_index(soc, &peer->mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
+	dp_peer_hash_bucket_lock(soc, index);
 
 	if (QDF_IS_STATUS_ERROR(dp_peer_get_ref(soc, peer, DP_MOD_ID_CONFIG))) {
 		dp_err("unable to get peer ref at MAP mac: "QDF_MAC_ADDR_FMT,
 		       QDF_MAC_ADDR_REF(peer->mac_addr.raw));
-		qdf_spin_unlock_bh(&soc->peer_hash_lock);
+		dp_peer_hash_bucket_unlock(soc, index);
 		return;
 	}
 
@@ -528,9 +622,9 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 	 * the same MAC address are stored, the one added first will be
 	 * found first.
 	 */
-	TAILQ_INSERT_TAIL(&soc->peer_hash.bins[index], peer, hash_list_elem);
+	qdf_hlist_add_tail_rcu(&peer->hash_node, &soc->peer_hash.bins[index]);
 
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
+	dp_peer_hash_bucket_unlock(soc, index);
 }
 
 struct dp_peer *dp_peer_find_hash_find(
@@ -554,22 +648,8 @@ struct dp_peer *dp_peer_find_hash_find(
 		mac_addr = &local_mac_addr_aligned;
 	}
 	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    ((peer->vdev->vdev_id == vdev_id) ||
-		     (vdev_id == DP_VDEV_ALL))) {
-			/* take peer reference before returning */
-			if (dp_peer_get_ref(soc, peer, mod_id) !=
-						QDF_STATUS_SUCCESS)
-				peer = NULL;
-
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
-			return peer;
-		}
-	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
-	return NULL; /* failure */
+	return dp_peer_hash_bucket_find(soc, index, mac_addr, vdev_id, NULL,
+					mod_id);
 }
 
 qdf_export_symbol(dp_peer_find_hash_find);
@@ -577,25 +657,25 @@ qdf_export_symbol(dp_peer_find_hash_find);
 void dp_peer_find_hash_remove(struct dp_soc *soc, struct dp_peer *peer)
 {
 	unsigned index;
-	struct dp_peer *tmppeer = NULL;
 	int found = 0;
 
 	index = dp_peer_find_hash_index(soc, &peer->mac_addr);
 	/* Check if tail is not empty before delete*/
-	QDF_ASSERT(!TAILQ_EMPTY(&soc->peer_hash.bins[index]));
+	QDF_ASSERT(!qdf_hlist_empty(&soc->peer_hash.bins[index]));
 
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(tmppeer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (tmppeer == peer) {
-			found = 1;
-			break;
-		}
-	}
+	dp_peer_hash_bucket_lock(soc, index);
+	found = !qdf_hlist_unhashed(&peer->hash_node);
 	QDF_ASSERT(found);
-	TAILQ_REMOVE(&soc->peer_hash.bins[index], peer, hash_list_elem);
+	if (found)
+		qdf_hlist_del_init_rcu(&peer->hash_node);
+	dp_peer_hash_bucket_unlock(soc, index);
 
-	dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
+	/*
+	 * Lookups still walking past the peer hold no reference,
+	 * the final free is deferred until they are done.
+	 */
+	if (found)
+		dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 }
 
 static bool dp_peer_exist_on_pdev(struct dp_soc *soc,
@@ -617,15 +697,12 @@ static bool dp_peer_exist_on_pdev(struct dp_soc *soc,
 		mac_addr = &local_mac_addr_aligned;
 	}
 	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    (peer->vdev->pdev == pdev)) {
-			found = true;
-			break;
-		}
+	peer = dp_peer_hash_bucket_find(soc, index, mac_addr, DP_VDEV_ALL,
+					pdev, DP_MOD_ID_CONFIG);
+	if (peer) {
+		found = true;
+		dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
 	return found;
 }
 #endif/* WLAN_FEATURE_11BE_MLO */
@@ -776,16 +853,15 @@ QDF_STATUS dp_peer_mec_hash_attach(struct dp_soc *soc)
 	dp_peer_info("%pK: max mec index: %d",
 		     soc, DP_PEER_MAX_MEC_IDX);
 
-	/* allocate an array of TAILQ mec object lists */
+	/* allocate an array of RCU protected mec object lists */
 	soc->mec_hash.bins = qdf_mem_malloc(hash_elems *
-					    sizeof(TAILQ_HEAD(anonymous_tail_q,
-							      dp_mec_entry)));
+					    sizeof(*soc->mec_hash.bins));
 
 	if (!soc->mec_hash.bins)
 		return QDF_STATUS_E_NOMEM;
 
 	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&soc->mec_hash.bins[i]);
+		qdf_init_hlist_head(&soc->mec_hash.bins[i]);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -810,6 +886,23 @@ static inline uint32_t dp_peer_mec_hash_index(struct dp_soc *soc,
 	return index;
 }
 
+void dp_peer_mec_bucket_lock(struct dp_soc *soc, uint32_t index)
+{
+	qdf_spinlock_t *lock;
+
+	lock = &soc->mec_lock[index & (DP_HASH_LOCK_STRIPES - 1)];
+	if (!qdf_spin_trylock_bh(lock)) {
+		qdf_spin_lock_bh(lock);
+		DP_STATS_INC(soc, mec_lock.contended, 1);
+	}
+	DP_STATS_INC(soc, mec_lock.acquired, 1);
+}
+
+void dp_peer_mec_bucket_unlock(struct dp_soc *soc, uint32_t index)
+{
+	qdf_spin_unlock_bh(&soc->mec_lock[index & (DP_HASH_LOCK_STRIPES - 1)]);
+}
+
 struct dp_mec_entry *dp_peer_mec_hash_find_by_pdevid(struct dp_soc *soc,
 						     uint8_t pdev_id,
 						     uint8_t *mec_mac_addr)
@@ -823,7 +916,8 @@ struct dp_mec_entry *dp_peer_mec_hash_find_by_pdevid(struct dp_soc *soc,
 	mac_addr = &local_mac_addr_aligned;
 
 	index = dp_peer_mec_hash_index(soc, mac_addr);
-	TAILQ_FOREACH(mecentry, &soc->mec_hash.bins[index], hash_list_elem) {
+	qdf_hlist_for_each_entry_rcu(mecentry, &soc->mec_hash.bins[index],
+				     hash_list_elem) {
 		if ((pdev_id == mecentry->pdev_id) &&
 		    !dp_peer_find_mac_addr_cmp(mac_addr, &mecentry->mac_addr))
 			return mecentry;
@@ -835,20 +929,30 @@ struct dp_mec_entry *dp_peer_mec_hash_find_by_pdevid(struct dp_soc *soc,
 /**
  * dp_peer_mec_hash_add() - Add MEC entry into hash table
  * @soc: SoC handle
+ * @index: MEC hash bucket of the entry
+ * @mecentry: MEC entry to add
  *
  * This function adds the MEC entry into SoC MEC hash table
+ * It assumes caller has taken the bucket lock of @index
  *
  * Return: None
  */
-static inline void dp_peer_mec_hash_add(struct dp_soc *soc,
+static inline void dp_peer_mec_hash_add(struct dp_soc *soc, uint32_t index,
 					struct dp_mec_entry *mecentry)
 {
-	uint32_t index;
+	qdf_hlist_add_tail_rcu(&mecentry->hash_list_elem,
+			       &soc->mec_hash.bins[index]);
+}
 
-	index = dp_peer_mec_hash_index(soc, &mecentry->mac_addr);
-	qdf_spin_lock_bh(&soc->mec_lock);
-	TAILQ_INSERT_TAIL(&soc->mec_hash.bins[index], mecentry, hash_list_elem);
-	qdf_spin_unlock_bh(&soc->mec_lock);
+/**
+ * dp_peer_mec_entry_rcu_free() - Free a MEC entry after a grace period
+ * @head: RCU head embedded in the MEC entry
+ *
+ * Return: None
+ */
+static void dp_peer_mec_entry_rcu_free(struct qdf_rcu_head *head)
+{
+	qdf_mem_free(qdf_container_of(head, struct dp_mec_entry, rcu));
 }
 
 QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
@@ -857,6 +961,7 @@ QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
 {
 	struct dp_mec_entry *mecentry = NULL;
 	struct dp_pdev *pdev = NULL;
+	uint32_t index;
 
 	if (!vdev) {
 		dp_peer_err("%pK: Peers vdev is NULL", soc);
@@ -872,16 +977,20 @@ QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
 		return QDF_STATUS_E_NOMEM;
 	}
 
-	qdf_spin_lock_bh(&soc->mec_lock);
+	/*
+	 * Refreshing an existing entry is the common case and only needs
+	 * the lockless lookup, is_active is a hint cleared by aging.
+	 */
+	qdf_rcu_read_lock();
 	mecentry = dp_peer_mec_hash_find_by_pdevid(soc, pdev->pdev_id,
 						   mac_addr);
 	if (qdf_likely(mecentry)) {
 		mecentry->is_active = TRUE;
-		qdf_spin_unlock_bh(&soc->mec_lock);
+		qdf_rcu_read_unlock();
 		return QDF_STATUS_E_ALREADY;
 	}
 
-	qdf_spin_unlock_bh(&soc->mec_lock);
+	qdf_rcu_read_unlock();
 
 	dp_peer_debug("%pK: pdevid: %u vdev: %u type: MEC mac_addr: "
 		      QDF_MAC_ADDR_FMT,
@@ -901,7 +1010,17 @@ QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
 	mecentry->pdev_id = pdev->pdev_id;
 	mecentry->vdev_id = vdev->vdev_id;
 	mecentry->is_active = TRUE;
-	dp_peer_mec_hash_add(soc, mecentry);
+
+	/* recheck under the bucket lock, another CPU may have raced us */
+	index = dp_peer_mec_hash_index(soc, &mecentry->mac_addr);
+	dp_peer_mec_bucket_lock(soc, index);
+	if (dp_peer_mec_hash_find_by_pdevid(soc, pdev->pdev_id, mac_addr)) {
+		dp_peer_mec_bucket_unlock(soc, index);
+		qdf_mem_free(mecentry);
+		return QDF_STATUS_E_ALREADY;
+	}
+	dp_peer_mec_hash_add(soc, index, mecentry);
+	dp_peer_mec_bucket_unlock(soc, index);
 
 	qdf_atomic_inc(&soc->mec_cnt);
 	DP_STATS_INC(soc, mec.added, 1);
@@ -912,13 +1031,10 @@ QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
 void dp_peer_mec_detach_entry(struct dp_soc *soc, struct dp_mec_entry *mecentry,
 			      void *ptr)
 {
-	uint32_t index = dp_peer_mec_hash_index(soc, &mecentry->mac_addr);
-
 	TAILQ_HEAD(, dp_mec_entry) * free_list = ptr;
 
-	TAILQ_REMOVE(&soc->mec_hash.bins[index], mecentry,
-		     hash_list_elem);
-	TAILQ_INSERT_TAIL(free_list, mecentry, hash_list_elem);
+	qdf_hlist_del_init_rcu(&mecentry->hash_list_elem);
+	TAILQ_INSERT_TAIL(free_list, mecentry, free_list_elem);
 }
 
 void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr)
@@ -927,11 +1043,11 @@ void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr)
 
 	TAILQ_HEAD(, dp_mec_entry) * free_list = ptr;
 
-	TAILQ_FOREACH_SAFE(mecentry, free_list, hash_list_elem,
+	TAILQ_FOREACH_SAFE(mecentry, free_list, free_list_elem,
 			   mecentry_next) {
 		dp_peer_debug("%pK: MEC delete for mac_addr " QDF_MAC_ADDR_FMT,
 			      soc, QDF_MAC_ADDR_REF(&mecentry->mac_addr));
-		qdf_mem_free(mecentry);
+		qdf_call_rcu(&mecentry->rcu, dp_peer_mec_entry_rcu_free);
 		qdf_atomic_dec(&soc->mec_cnt);
 		DP_STATS_INC(soc, mec.deleted, 1);
 	}
@@ -952,12 +1068,18 @@ void dp_peer_mec_hash_detach(struct dp_soc *soc)
 
 void dp_peer_mec_spinlock_destroy(struct dp_soc *soc)
 {
-	qdf_spinlock_destroy(&soc->mec_lock);
+	int i;
+
+	for (i = 0; i < DP_HASH_LOCK_STRIPES; i++)
+		qdf_spinlock_destroy(&soc->mec_lock[i]);
 }
 
 void dp_peer_mec_spinlock_create(struct dp_soc *soc)
 {
-	qdf_spinlock_create(&soc->mec_lock);
+	int i;
+
+	for (i = 0; i < DP_HASH_LOCK_STRIPES; i++)
+		qdf_spinlock_create(&soc->mec_lock[i]);
 }
 #else
 QDF_STATUS dp_peer_mec_hash_attach(struct dp_soc *soc)
@@ -994,16 +1116,15 @@ QDF_STATUS dp_peer_ast_hash_attach(struct dp_soc *soc)
 	dp_peer_info("%pK: ast hash_elems: %d, max_ast_idx: %d",
 		     soc, hash_elems, max_ast_idx);
 
-	/* allocate an array of TAILQ peer object lists */
+	/* allocate an array of RCU protected ast object lists */
 	soc->ast_hash.bins = qdf_mem_malloc(
-		hash_elems * sizeof(TAILQ_HEAD(anonymous_tail_q,
-				dp_ast_entry)));
+		hash_elems * sizeof(*soc->ast_hash.bins));
 
 	if (!soc->ast_hash.bins)
 		return QDF_STATUS_E_NOMEM;
 
 	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&soc->ast_hash.bins[i]);
+		qdf_init_hlist_head(&soc->ast_hash.bins[i]);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -1044,7 +1165,8 @@ static inline void dp_peer_ast_cleanup(struct dp_soc *soc,
 void dp_peer_ast_hash_detach(struct dp_soc *soc)
 {
 	unsigned int index;
-	struct dp_ast_entry *ast, *ast_next;
+	struct dp_ast_entry *ast;
+	struct qdf_hlist_node *ast_next;
 
 	if (!soc->ast_hash.mask)
 		return;
@@ -1056,11 +1178,11 @@ void dp_peer_ast_hash_detach(struct dp_soc *soc)
 
 	qdf_spin_lock_bh(&soc->ast_lock);
 	for (index = 0; index <= soc->ast_hash.mask; index++) {
-		if (!TAILQ_EMPTY(&soc->ast_hash.bins[index])) {
-			TAILQ_FOREACH_SAFE(ast, &soc->ast_hash.bins[index],
-					   hash_list_elem, ast_next) {
-				TAILQ_REMOVE(&soc->ast_hash.bins[index], ast,
-					     hash_list_elem);
+		if (!qdf_hlist_empty(&soc->ast_hash.bins[index])) {
+			qdf_hlist_for_each_entry_safe(ast, ast_next,
+						      &soc->ast_hash.bins[index],
+						      hash_list_elem) {
+				qdf_hlist_del_init_rcu(&ast->hash_list_elem);
 				dp_peer_ast_cleanup(soc, ast);
 				soc->num_ast_entries--;
 				qdf_mem_free(ast);
@@ -1093,12 +1215,52 @@ static inline uint32_t dp_peer_ast_hash_index(struct dp_soc *soc,
 	return index;
 }
 
+void dp_peer_ast_spinlock_create(struct dp_soc *soc)
+{
+	int i;
+
+	for (i = 0; i < DP_HASH_LOCK_STRIPES; i++)
+		qdf_spinlock_create(&soc->ast_hash_lock[i]);
+}
+
+void dp_peer_ast_spinlock_destroy(struct dp_soc *soc)
+{
+	int i;
+
+	for (i = 0; i < DP_HASH_LOCK_STRIPES; i++)
+		qdf_spinlock_destroy(&soc->ast_hash_lock[i]);
+}
+
+void dp_peer_ast_bucket_lock(struct dp_soc *soc, struct dp_ast_entry *ase)
+{
+	qdf_spinlock_t *lock;
+	uint32_t index;
+
+	index = dp_peer_ast_hash_index(soc, &ase->mac_addr);
+	lock = &soc->ast_hash_lock[index & (DP_HASH_LOCK_STRIPES - 1)];
+	if (!qdf_spin_trylock_bh(lock)) {
+		qdf_spin_lock_bh(lock);
+		DP_STATS_INC(soc, ast_hash_lock.contended, 1);
+	}
+	DP_STATS_INC(soc, ast_hash_lock.acquired, 1);
+}
+
+void dp_peer_ast_bucket_unlock(struct dp_soc *soc, struct dp_ast_entry *ase)
+{
+	uint32_t index;
+
+	index = dp_peer_ast_hash_index(soc, &ase->mac_addr);
+	qdf_spin_unlock_bh(&soc->ast_hash_lock[index &
+					       (DP_HASH_LOCK_STRIPES - 1)]);
+}
+
 /*
  * dp_peer_ast_hash_add() - Add AST entry into hash table
  * @soc: SoC handle
  *
  * This function adds the AST entry into SoC AST hash table
- * It assumes caller has taken the ast lock to protect the access to this table
+ * It assumes caller has taken the ast lock to protect the access to this
+ * table; the bucket lock is taken here for the rx path entry updates
  *
  * Return: None
  */
@@ -1108,7 +1270,9 @@ static inline void dp_peer_ast_hash_add(struct dp_soc *soc,
 	uint32_t index;
 
 	index = dp_peer_ast_hash_index(soc, &ase->mac_addr);
-	TAILQ_INSERT_TAIL(&soc->ast_hash.bins[index], ase, hash_list_elem);
+	dp_peer_ast_bucket_lock(soc, ase);
+	qdf_hlist_add_tail_rcu(&ase->hash_list_elem, &soc->ast_hash.bins[index]);
+	dp_peer_ast_bucket_unlock(soc, ase);
 }
 
 /*
@@ -1116,7 +1280,8 @@ static inline void dp_peer_ast_hash_add(struct dp_soc *soc,
  * @soc: SoC handle
  *
  * This function removes the AST entry from soc AST hash table
- * It assumes caller has taken the ast lock to protect the access to this table
+ * It assumes caller has taken the ast lock to protect the access to this
+ * table; the bucket lock is taken here for the rx path entry updates
  *
  * Return: None
  */
@@ -1124,7 +1289,6 @@ void dp_peer_ast_hash_remove(struct dp_soc *soc,
 			     struct dp_ast_entry *ase)
 {
 	unsigned index;
-	struct dp_ast_entry *tmpase;
 	int found = 0;
 
 	if (soc->ast_offload_support)
@@ -1132,22 +1296,36 @@ void dp_peer_ast_hash_remove(struct dp_soc *soc,
 
 	index = dp_peer_ast_hash_index(soc, &ase->mac_addr);
 	/* Check if tail is not empty before delete*/
-	QDF_ASSERT(!TAILQ_EMPTY(&soc->ast_hash.bins[index]));
+	QDF_ASSERT(!qdf_hlist_empty(&soc->ast_hash.bins[index]));
 
 	dp_peer_debug("ID: %u idx: %u mac_addr: " QDF_MAC_ADDR_FMT,
 		      ase->peer_id, index, QDF_MAC_ADDR_REF(ase->mac_addr.raw));
 
-	TAILQ_FOREACH(tmpase, &soc->ast_hash.bins[index], hash_list_elem) {
-		if (tmpase == ase) {
-			found = 1;
-			break;
-		}
-	}
+	found = !qdf_hlist_unhashed(&ase->hash_list_elem);
 
 	QDF_ASSERT(found);
 
-	if (found)
-		TAILQ_REMOVE(&soc->ast_hash.bins[index], ase, hash_list_elem);
+	if (found) {
+		dp_peer_ast_bucket_lock(soc, ase);
+		qdf_hlist_del_init_rcu(&ase->hash_list_elem);
+		dp_peer_ast_bucket_unlock(soc, ase);
+	}
+}
+
+/*
+ * dp_peer_ast_entry_rcu_free_cb() - Free an AST entry after a grace period
+ * @head: RCU head embedded in the AST entry
+ *
+ * Return: None
+ */
+static void dp_peer_ast_entry_rcu_free_cb(struct qdf_rcu_head *head)
+{
+	qdf_mem_free(qdf_container_of(head, struct dp_ast_entry, rcu));
+}
+
+void dp_peer_ast_entry_rcu_free(struct dp_ast_entry *ase)
+{
+	qdf_call_rcu(&ase->rcu, dp_peer_ast_entry_rcu_free_cb);
 }
 
 /*
@@ -1155,7 +1333,8 @@ void dp_peer_ast_hash_remove(struct dp_soc *soc,
  * @soc: SoC handle
  *
  * It assumes caller has taken the ast lock to protect the access to
- * AST hash table
+ * AST hash table, or is in a qdf_rcu_read_lock() section and only reads
+ * the returned entry before leaving it
  *
  * Return: AST entry
  */
@@ -1172,7 +1351,8 @@ struct dp_ast_entry *dp_peer_ast_hash_find_by_vdevid(struct dp_soc *soc,
 	mac_addr = &local_mac_addr_aligned;
 
 	index = dp_peer_ast_hash_index(soc, mac_addr);
-	TAILQ_FOREACH(ase, &soc->ast_hash.bins[index], hash_list_elem) {
+	qdf_hlist_for_each_entry_rcu(ase, &soc->ast_hash.bins[index],
+				     hash_list_elem) {
 		if ((vdev_id == ase->vdev_id) &&
 		    !dp_peer_find_mac_addr_cmp(mac_addr, &ase->mac_addr)) {
 			return ase;
@@ -1187,7 +1367,8 @@ struct dp_ast_entry *dp_peer_ast_hash_find_by_vdevid(struct dp_soc *soc,
  * @soc: SoC handle
  *
  * It assumes caller has taken the ast lock to protect the access to
- * AST hash table
+ * AST hash table, or is in a qdf_rcu_read_lock() section and only reads
+ * the returned entry before leaving it
  *
  * Return: AST entry
  */
@@ -1204,7 +1385,8 @@ struct dp_ast_entry *dp_peer_ast_hash_find_by_pdevid(struct dp_soc *soc,
 	mac_addr = &local_mac_addr_aligned;
 
 	index = dp_peer_ast_hash_index(soc, mac_addr);
-	TAILQ_FOREACH(ase, &soc->ast_hash.bins[index], hash_list_elem) {
+	qdf_hlist_for_each_entry_rcu(ase, &soc->ast_hash.bins[index],
+				     hash_list_elem) {
 		if ((pdev_id == ase->pdev_id) &&
 		    !dp_peer_find_mac_addr_cmp(mac_addr, &ase->mac_addr)) {
 			return ase;
@@ -1219,7 +1401,8 @@ struct dp_ast_entry *dp_peer_ast_hash_find_by_pdevid(struct dp_soc *soc,
  * @soc: SoC handle
  *
  * It assumes caller has taken the ast lock to protect the access to
- * AST hash table
+ * AST hash table, or is in a qdf_rcu_read_lock() section and only reads
+ * the returned entry before leaving it
  *
  * Return: AST entry
  */
@@ -1235,7 +1418,8 @@ struct dp_ast_entry *dp_peer_ast_hash_find_soc(struct dp_soc *soc,
 	mac_addr = &local_mac_addr_aligned;
 
 	index = dp_peer_ast_hash_index(soc, mac_addr);
-	TAILQ_FOREACH(ase, &soc->ast_hash.bins[index], hash_list_elem) {
+	qdf_hlist_for_each_entry_rcu(ase, &soc->ast_hash.bins[index],
+				     hash_list_elem) {
 		if (dp_peer_find_mac_addr_cmp(mac_addr, &ase->mac_addr) == 0) {
 			return ase;
 		}
@@ -1695,7 +1879,7 @@ void dp_peer_free_ast_entry(struct dp_soc *soc,
 	DP_STATS_INC(soc, ast.deleted, 1);
 	dp_peer_ast_hash_remove(soc, ast_entry);
 	dp_peer_ast_cleanup(soc, ast_entry);
-	qdf_mem_free(ast_entry);
+	dp_peer_ast_entry_rcu_free(ast_entry);
 	soc->num_ast_entries--;
 }
 
@@ -1988,6 +2172,22 @@ QDF_STATUS dp_peer_ast_hash_attach(struct dp_soc *soc)
 	return QDF_STATUS_SUCCESS;
 }
 
+void dp_peer_ast_spinlock_create(struct dp_soc *soc)
+{
+}
+
+void dp_peer_ast_spinlock_destroy(struct dp_soc *soc)
+{
+}
+
+void dp_peer_ast_bucket_lock(struct dp_soc *soc, struct dp_ast_entry *ase)
+{
+}
+
+void dp_peer_ast_bucket_unlock(struct dp_soc *soc, struct dp_ast_entry *ase)
+{
+}
+
 static inline QDF_STATUS dp_peer_map_ast(struct dp_soc *soc,
 					 struct dp_peer *peer,
 					 uint8_t *mac_addr,
@@ -2110,7 +2310,7 @@ static uint32_t dp_peer_ast_free_wds_entries(struct dp_soc *soc,
 					    ast_entry->cookie,
 					    CDP_TXRX_AST_DELETED);
 
-		qdf_mem_free(ast_entry);
+		dp_peer_ast_entry_rcu_free(ast_entry);
 	}
 
 	return num_ast;
@@ -2233,15 +2433,17 @@ void dp_peer_find_hash_erase(struct dp_soc *soc)
 	 * it's known that the soc is no longer in use.
 	 */
 	for (i = 0; i <= soc->peer_hash.mask; i++) {
-		if (!TAILQ_EMPTY(&soc->peer_hash.bins[i])) {
-			struct dp_peer *peer, *peer_next;
+		if (!qdf_hlist_empty(&soc->peer_hash.bins[i])) {
+			struct dp_peer *peer;
+			struct qdf_hlist_node *peer_next;
 
 			/*
-			 * TAILQ_FOREACH_SAFE must be used here to avoid any
+			 * the _safe iterator must be used here to avoid any
 			 * memory access violation after peer is freed
 			 */
-			TAILQ_FOREACH_SAFE(peer, &soc->peer_hash.bins[i],
-				hash_list_elem, peer_next) {
+			qdf_hlist_for_each_entry_safe(peer, peer_next,
+						      &soc->peer_hash.bins[i],
+						      hash_node) {
 				/*
 				 * Don't remove the peer from the hash table -
 				 * that would modify the list we are currently
@@ -2817,6 +3019,9 @@ dp_peer_find_detach(struct dp_soc *soc)
 	dp_peer_ast_hash_detach(soc);
 	dp_peer_ast_table_detach(soc);
 	dp_peer_mec_hash_detach(soc);
+
+	/* wait for peer, AST and MEC entries queued for deferred free */
+	qdf_rcu_barrier();
 }
 #else
 void
@@ -2824,6 +3029,9 @@ dp_peer_find_detach(struct dp_soc *soc)
 {
 	dp_peer_find_map_detach(soc);
 	dp_peer_find_hash_detach(soc);
+
+	/* wait for peers queued for deferred free */
+	qdf_rcu_barrier();
 }
 #endif
 
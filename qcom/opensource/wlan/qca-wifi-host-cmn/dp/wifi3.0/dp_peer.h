@@ -680,6 +680,53 @@ void dp_peer_free_hmwds_cb(struct cdp_ctrl_objmgr_psoc *ctrl_psoc,
 void dp_peer_ast_hash_remove(struct dp_soc *soc,
 			     struct dp_ast_entry *ase);
 
+/**
+ * dp_peer_ast_spinlock_create() - Create the AST hash bucket locks
+ * @soc: SoC handle
+ *
+ * Return: none
+ */
+void dp_peer_ast_spinlock_create(struct dp_soc *soc);
+
+/**
+ * dp_peer_ast_spinlock_destroy() - Destroy the AST hash bucket locks
+ * @soc: SoC handle
+ *
+ * Return: none
+ */
+void dp_peer_ast_spinlock_destroy(struct dp_soc *soc);
+
+/**
+ * dp_peer_ast_bucket_lock() - Take the lock covering an AST entry's bucket
+ * @soc: SoC handle
+ * @ase: AST entry
+ *
+ * The bucket lock serializes hash insert/remove with the rx path updates
+ * of an entry found under qdf_rcu_read_lock(), without taking ast_lock.
+ * It nests inside ast_lock.
+ *
+ * Return: none
+ */
+void dp_peer_ast_bucket_lock(struct dp_soc *soc, struct dp_ast_entry *ase);
+
+/**
+ * dp_peer_ast_bucket_unlock() - Release the lock of an AST entry's bucket
+ * @soc: SoC handle
+ * @ase: AST entry
+ *
+ * Return: none
+ */
+void dp_peer_ast_bucket_unlock(struct dp_soc *soc, struct dp_ast_entry *ase);
+
+/**
+ * dp_peer_ast_entry_rcu_free() - Free an AST entry once lockless readers
+ *				  are done with it
+ * @ase: AST entry already removed from the AST hash table
+ *
+ * Return: None
+ */
+void dp_peer_ast_entry_rcu_free(struct dp_ast_entry *ase);
+
 void dp_peer_free_ast_entry(struct dp_soc *soc,
 			    struct dp_ast_entry *ast_entry);
 
@@ -694,7 +741,7 @@ void dp_peer_unlink_ast_entry(struct dp_soc *soc,
  * @ptr: pointer to free list
  *
  * The MEC entry is detached from MEC table and added to free_list
- * to free the object outside lock
+ * to free the object outside lock. Caller holds the bucket lock.
  *
  * Return: None
  */
@@ -706,6 +753,9 @@ void dp_peer_mec_detach_entry(struct dp_soc *soc, struct dp_mec_entry *mecentry,
  * @soc: SoC handle
  * @ptr: pointer to free list
  *
+ * Memory is released after an RCU grace period, lockless readers may
+ * still be looking at the entries.
+ *
  * Return: None
  */
 void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr);
@@ -717,8 +767,7 @@ void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr);
  * @mac_addr: MAC address of mec node
  *
  * This function allocates and adds MEC entry to MEC table.
- * It assumes caller has taken the mec lock to protect the access to these
- * tables
+ * The bucket lock of the entry is taken internally
  *
  * Return: QDF_STATUS
  */
@@ -731,7 +780,8 @@ QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
  * within pdev
  * @soc: SoC handle
  *
- * It assumes caller has taken the mec_lock to protect the access to
+ * It assumes caller has taken the bucket lock via dp_peer_mec_bucket_lock()
+ * or is in a qdf_rcu_read_lock() section to protect the access to
  * MEC hash table
  *
  * Return: MEC entry
@@ -964,6 +1014,24 @@ void dp_peer_mec_spinlock_destroy(struct dp_soc *soc);
  * Return: None
  */
 void dp_peer_mec_flush_entries(struct dp_soc *soc);
+
+/**
+ * dp_peer_mec_bucket_lock() - Take the writer lock covering a MEC bucket
+ * @soc: SoC handle
+ * @index: MEC hash bucket index
+ *
+ * Return: none
+ */
+void dp_peer_mec_bucket_lock(struct dp_soc *soc, uint32_t index);
+
+/**
+ * dp_peer_mec_bucket_unlock() - Release the writer lock of a MEC bucket
+ * @soc: SoC handle
+ * @index: MEC hash bucket index
+ *
+ * Return: none
+ */
+void dp_peer_mec_bucket_unlock(struct dp_soc *soc, uint32_t index);
 #else
 static inline void dp_peer_mec_spinlock_create(struct dp_soc *soc)
 {
@@ -32,6 +32,9 @@
 #include "dp_ipa.h"
 #include "dp_hist.h"
 #include "dp_rx_buffer_pool.h"
+#ifdef WLAN_DP_FEATURE_SW_LATENCY_MGR
+#include <dp_swlm.h>
+#endif
 #ifdef WIFI_MONITOR_SUPPORT
 #include "dp_htt.h"
 #include <dp_mon.h>
@@ -296,6 +299,7 @@ QDF_STATUS __dp_rx_buffers_replenish(struct dp_soc *dp_soc, uint32_t mac_id,
 	uint16_t num_desc_to_free = 0;
 	struct dp_pdev *dp_pdev = dp_get_pdev_for_lmac_id(dp_soc, mac_id);
 	uint32_t num_entries_avail;
+	uint32_t num_entries_used;
 	uint32_t count;
 	int sync_hw_ptr = 1;
 	struct dp_rx_nbuf_frag_info nbuf_frag_info = {0};
@@ -332,6 +336,7 @@ QDF_STATUS __dp_rx_buffers_replenish(struct dp_soc *dp_soc, uint32_t mac_id,
 
 	dp_rx_debug("%pK: no of available entries in rxdma ring: %d",
 		    dp_soc, num_entries_avail);
+	num_entries_used = dp_rxdma_srng->num_entries - num_entries_avail;
 
 	if (!(*desc_list) && (num_entries_avail >
 		((dp_rxdma_srng->num_entries * 3) / 4))) {
@@ -365,7 +370,8 @@ QDF_STATUS __dp_rx_buffers_replenish(struct dp_soc *dp_soc, uint32_t mac_id,
 
 	if (qdf_unlikely(!num_req_buffers)) {
 		num_desc_to_free = num_req_buffers;
-		hal_srng_access_end(dp_soc->hal_soc, rxdma_srng);
+		dp_rx_refill_ring_access_end(dp_soc, mac_id, dp_rxdma_srng,
+					     num_entries_used, 0);
 		goto free_descs;
 	}
 
@@ -383,7 +389,9 @@ QDF_STATUS __dp_rx_buffers_replenish(struct dp_soc *dp_soc, uint32_t mac_id,
 			dp_rx_err("%pK: no free rx_descs in freelist", dp_soc);
 			DP_STATS_INC(dp_pdev, err.desc_alloc_fail,
 					num_req_buffers);
-			hal_srng_access_end(dp_soc->hal_soc, rxdma_srng);
+			dp_rx_refill_ring_access_end(dp_soc, mac_id,
+						     dp_rxdma_srng,
+						     num_entries_used, 0);
 			return QDF_STATUS_E_NOMEM;
 		}
 
@@ -453,7 +461,8 @@ QDF_STATUS __dp_rx_buffers_replenish(struct dp_soc *dp_soc, uint32_t mac_id,
 	dp_rx_refill_ring_record_entry(dp_soc, dp_pdev->lmac_id, rxdma_srng,
 				       num_req_buffers, count);
 
-	hal_srng_access_end(dp_soc->hal_soc, rxdma_srng);
+	dp_rx_refill_ring_access_end(dp_soc, mac_id, dp_rxdma_srng,
+				     num_entries_used, count);
 
 	dp_rx_schedule_refill_thread(dp_soc);
 
@@ -2133,6 +2142,74 @@ void dp_rx_update_stats(struct dp_soc *soc, qdf_nbuf_t nbuf)
 	DP_STATS_INC_PKT(soc, rx.ingress, 1,
 			 QDF_NBUF_CB_RX_PKT_LEN(nbuf));
 }
+
+void dp_rx_reo_ring_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
+			       hal_ring_handle_t hal_ring_hdl,
+			       uint8_t reo_ring_num, uint32_t num_reaped)
+{
+	struct dp_swlm *swlm = &soc->swlm;
+	struct dp_swlm_reo_data reo_data = {0};
+	union swlm_data swlm_query_data;
+
+	if (!swlm->is_enabled) {
+		if (dp_swlm_reo_is_pending(soc, reo_ring_num))
+			dp_swlm_reo_session_end(soc, reo_ring_num);
+		dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+		return;
+	}
+
+	reo_data.ring_id = reo_ring_num;
+	reo_data.num_reaped = num_reaped;
+	swlm_query_data.reo_data = &reo_data;
+
+	if (dp_swlm_query_policy(soc, REO_DST, swlm_query_data))
+		dp_rx_srng_access_end_reap(int_ctx, soc, hal_ring_hdl);
+	else
+		dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+}
+
+void dp_rx_reo_ring_flush(struct dp_intr *int_ctx, struct dp_soc *soc,
+			  hal_ring_handle_t hal_ring_hdl, uint8_t reo_ring_num)
+{
+	if (!dp_swlm_reo_is_pending(soc, reo_ring_num))
+		return;
+
+	if (qdf_unlikely(dp_rx_srng_access_start(int_ctx, soc,
+						 hal_ring_hdl))) {
+		DP_STATS_INC(soc, rx.err.hal_ring_access_fail, 1);
+		return;
+	}
+
+	dp_swlm_reo_session_end(soc, reo_ring_num);
+	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+}
+
+void dp_rx_refill_ring_access_end(struct dp_soc *soc, uint32_t mac_id,
+				  struct dp_srng *dp_rxdma_srng,
+				  uint32_t num_used, uint32_t num_posted)
+{
+	struct dp_swlm *swlm = &soc->swlm;
+	struct dp_swlm_refill_data refill_data = {0};
+	union swlm_data swlm_query_data;
+	hal_ring_handle_t hal_ring_hdl = dp_rxdma_srng->hal_srng;
+
+	/* only the host owned refill rings are coalesced */
+	if (!swlm->is_enabled || mac_id >= MAX_PDEV_CNT ||
+	    dp_rxdma_srng != &soc->rx_refill_buf_ring[mac_id]) {
+		hal_srng_access_end(soc->hal_soc, hal_ring_hdl);
+		return;
+	}
+
+	refill_data.ring_id = mac_id;
+	refill_data.num_used = num_used;
+	refill_data.num_posted = num_posted;
+	swlm_query_data.refill_data = &refill_data;
+
+	if (dp_swlm_query_policy(soc, RXDMA_BUF, swlm_query_data))
+		hal_srng_access_end_reap(soc->hal_soc, hal_ring_hdl);
+	else
+		hal_srng_access_end(soc->hal_soc, hal_ring_hdl);
+}
 #endif
 
 #ifdef WLAN_FEATURE_PKT_CAPTURE_V2
@@ -1740,6 +1740,21 @@ dp_rx_srng_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
 {
 	hal_srng_access_end_unlocked(soc->hal_soc, hal_ring_hdl);
 }
+
+/*
+ * dp_rx_srng_access_end_reap()- End access of a hal ring without updating
+ *				 the ring pointer register
+ * @int_ctx: pointer to DP interrupt context
+ * @dp_soc - DP soc structure pointer
+ * @hal_ring_hdl - HAL ring handle
+ *
+ * Return - None
+ */
+static inline void
+dp_rx_srng_access_end_reap(struct dp_intr *int_ctx, struct dp_soc *soc,
+			   hal_ring_handle_t hal_ring_hdl)
+{
+}
 #else
 static inline int
 dp_rx_srng_access_start(struct dp_intr *int_ctx, struct dp_soc *soc,
@@ -1754,6 +1769,13 @@ dp_rx_srng_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
 {
 	dp_srng_access_end(int_ctx, soc, hal_ring_hdl);
 }
+
+static inline void
+dp_rx_srng_access_end_reap(struct dp_intr *int_ctx, struct dp_soc *soc,
+			   hal_ring_handle_t hal_ring_hdl)
+{
+	dp_hal_srng_access_end_reap(soc->hal_soc, hal_ring_hdl);
+}
 #endif
 
 #endif /* QCA_HOST_MODE_WIFI_DISABLED */
@@ -1966,11 +1988,76 @@ QDF_STATUS dp_rx_desc_nbuf_sanity_check(struct dp_soc *soc,
 
 #ifdef WLAN_DP_FEATURE_SW_LATENCY_MGR
 void dp_rx_update_stats(struct dp_soc *soc, qdf_nbuf_t nbuf);
+
+/**
+ * dp_rx_reo_ring_access_end() - End REO destination ring access, deferring
+ *				 the TP register write if SWLM allows
+ * @int_ctx: pointer to DP interrupt context
+ * @soc: DP soc handle
+ * @hal_ring_hdl: REO destination ring handle
+ * @reo_ring_num: REO destination ring number
+ * @num_reaped: number of ring entries reaped in this access
+ *
+ * Return: None
+ */
+void dp_rx_reo_ring_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
+			       hal_ring_handle_t hal_ring_hdl,
+			       uint8_t reo_ring_num, uint32_t num_reaped);
+
+/**
+ * dp_rx_reo_ring_flush() - Write the REO destination ring TP if a write
+ *			    was deferred by dp_rx_reo_ring_access_end()
+ * @int_ctx: pointer to DP interrupt context
+ * @soc: DP soc handle
+ * @hal_ring_hdl: REO destination ring handle
+ * @reo_ring_num: REO destination ring number
+ *
+ * Return: None
+ */
+void dp_rx_reo_ring_flush(struct dp_intr *int_ctx, struct dp_soc *soc,
+			  hal_ring_handle_t hal_ring_hdl, uint8_t reo_ring_num);
+
+/**
+ * dp_rx_refill_ring_access_end() - End RX refill ring access, deferring
+ *				    the HP register write if SWLM allows
+ * @soc: DP soc handle
+ * @mac_id: mac id of the refill ring
+ * @dp_rxdma_srng: refill ring
+ * @num_used: number of buffers held by the ring after this access
+ * @num_posted: number of buffers posted in this access
+ *
+ * Return: None
+ */
+void dp_rx_refill_ring_access_end(struct dp_soc *soc, uint32_t mac_id,
+				  struct dp_srng *dp_rxdma_srng,
+				  uint32_t num_used, uint32_t num_posted);
 #else
 static inline
 void dp_rx_update_stats(struct dp_soc *soc, qdf_nbuf_t nbuf)
 {
 }
+
+static inline
+void dp_rx_reo_ring_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
+			       hal_ring_handle_t hal_ring_hdl,
+			       uint8_t reo_ring_num, uint32_t num_reaped)
+{
+	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+}
+
+static inline
+void dp_rx_reo_ring_flush(struct dp_intr *int_ctx, struct dp_soc *soc,
+			  hal_ring_handle_t hal_ring_hdl, uint8_t reo_ring_num)
+{
+}
+
+static inline
+void dp_rx_refill_ring_access_end(struct dp_soc *soc, uint32_t mac_id,
+				  struct dp_srng *dp_rxdma_srng,
+				  uint32_t num_used, uint32_t num_posted)
+{
+	hal_srng_access_end(soc->hal_soc, dp_rxdma_srng->hal_srng);
+}
 #endif
 
 /**
@@ -93,6 +93,47 @@ bool dp_rx_buffer_pool_refill(struct dp_soc *soc, qdf_nbuf_t nbuf, u8 mac_id)
 	return consumed;
 }
 
+/**
+ * dp_rx_refill_buff_pool_recycle() - Hand a dropped RX buffer back to the
+ *				      refill pool
+ * @soc: SoC handle
+ * @nbuf: reaped RX buffer owned by the driver
+ * @rx_desc_pool: RX descriptor pool the buffer was allocated for
+ *
+ * Only plain, unshared buffers of the refill pool size are taken, so that
+ * the reset below leaves an nbuf indistinguishable from a fresh allocation.
+ * Page pool backed buffers were only synced for the CPU at reap and are
+ * queued with their DMA mapping intact.
+ *
+ * Return: true if the buffer was taken by the refill pool
+ */
+static bool dp_rx_refill_buff_pool_recycle(struct dp_soc *soc, qdf_nbuf_t nbuf,
+					   struct rx_desc_pool *rx_desc_pool)
+{
+	struct rx_refill_buff_pool *buff_pool = &soc->rx_refill_buff_pool;
+
+	if (!buff_pool->is_initialized ||
+	    rx_desc_pool->buf_size != soc->rx_desc_buf[0].buf_size)
+		return false;
+
+	if (qdf_nbuf_queue_head_qlen(&buff_pool->recycle_q) >=
+	    DP_RX_REFILL_BUFF_POOL_RECYCLE_MAX)
+		return false;
+
+	if (qdf_nbuf_get_users(nbuf) != 1 || qdf_nbuf_is_cloned(nbuf) ||
+	    qdf_nbuf_is_nonlinear(nbuf))
+		return false;
+
+	qdf_nbuf_reset(nbuf, RX_BUFFER_RESERVATION,
+		       rx_desc_pool->buf_alignment);
+	qdf_nbuf_set_next(nbuf, NULL);
+	qdf_nbuf_queue_head_enqueue_tail(&buff_pool->recycle_q, nbuf);
+	DP_STATS_INC(buff_pool->dp_pdev,
+		     rx_refill_buff_pool.num_bufs_recycled, 1);
+
+	return true;
+}
+
 void dp_rx_buffer_pool_nbuf_free(struct dp_soc *soc, qdf_nbuf_t nbuf, u8 mac_id)
 {
 	struct dp_pdev *dp_pdev = dp_get_pdev_for_lmac_id(soc, mac_id);
@@ -107,8 +148,12 @@ void dp_rx_buffer_pool_nbuf_free(struct dp_soc *soc, qdf_nbuf_t nbuf, u8 mac_id)
 
 	if (qdf_likely(qdf_nbuf_queue_head_qlen(&buff_pool->emerg_nbuf_q) >=
 		       DP_RX_BUFFER_POOL_SIZE) ||
-	    !buff_pool->is_initialized)
+	    !buff_pool->is_initialized) {
+		if (dp_rx_refill_buff_pool_recycle(soc, nbuf, rx_desc_pool))
+			return;
+
 		return qdf_nbuf_free(nbuf);
+	}
 
 	qdf_nbuf_reset(nbuf, RX_BUFFER_RESERVATION,
 		       rx_desc_pool->buf_alignment);
@@ -126,6 +171,7 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 	uint16_t num_refill;
 	uint16_t total_num_refill;
 	uint16_t total_count = 0;
+	uint16_t reused = 0;
 	uint16_t head, tail;
 
 	if (!soc)
@@ -153,10 +199,18 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 
 		count = 0;
 		for (i = 0; i < num_refill; i++) {
-			nbuf = qdf_nbuf_alloc(dev, rx_desc_pool->buf_size,
-					      RX_BUFFER_RESERVATION,
-					      rx_desc_pool->buf_alignment,
-					      FALSE);
+			/*
+			 * Buffers recycled from the drop paths are reused
+			 * first; mapping them here keeps both the allocation
+			 * and the DMA map off the replenish path. Page pool
+			 * buffers are still mapped and only get synced.
+			 */
+			nbuf = qdf_nbuf_queue_head_dequeue(&buff_pool->recycle_q);
+			if (nbuf)
+				reused++;
+			else
+				nbuf = dp_rx_refill_buff_pool_nbuf_alloc(
+						soc, buff_pool, rx_desc_pool);
 			if (qdf_unlikely(!nbuf))
 				continue;
 
@@ -183,6 +237,41 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 	DP_STATS_INC(buff_pool->dp_pdev,
 		     rx_refill_buff_pool.num_bufs_refilled,
 		     total_count);
+	DP_STATS_INC(buff_pool->dp_pdev,
+		     rx_refill_buff_pool.num_bufs_reused,
+		     reused);
+}
+
+/**
+ * dp_rx_refill_buff_pool_nbuf_alloc() - Allocate a buffer for the refill pool
+ * @soc: SoC handle
+ * @buff_pool: refill buffer pool
+ * @rx_desc_pool: RX descriptor pool the buffer is allocated for
+ *
+ * Buffers are built on page pool pages when available: whoever frees them,
+ * the network stack included, the page returns to the pool still mapped,
+ * so mapping it again is only a sync for the device.
+ *
+ * Return: nbuf, NULL on allocation failure
+ */
+static qdf_nbuf_t
+dp_rx_refill_buff_pool_nbuf_alloc(struct dp_soc *soc,
+				  struct rx_refill_buff_pool *buff_pool,
+				  struct rx_desc_pool *rx_desc_pool)
+{
+	qdf_nbuf_t nbuf;
+
+	if (qdf_likely(buff_pool->page_pool)) {
+		nbuf = qdf_nbuf_page_pool_alloc(buff_pool->page_pool,
+						RX_BUFFER_RESERVATION,
+						rx_desc_pool->buf_alignment);
+		if (qdf_likely(nbuf))
+			return nbuf;
+	}
+
+	return qdf_nbuf_alloc(soc->osdev, rx_desc_pool->buf_size,
+			      RX_BUFFER_RESERVATION,
+			      rx_desc_pool->buf_alignment, FALSE);
 }
 
 static inline qdf_nbuf_t dp_rx_refill_buff_pool_dequeue_nbuf(struct dp_soc *soc)
@@ -288,11 +377,21 @@ static void dp_rx_refill_buff_pool_init(struct dp_soc *soc, u8 mac_id)
 	buff_pool->max_bufq_len = DP_RX_REFILL_BUFF_POOL_SIZE;
 	buff_pool->dp_pdev = dp_get_pdev_for_lmac_id(soc, 0);
 	buff_pool->tail = 0;
+	qdf_nbuf_queue_head_init(&buff_pool->recycle_q);
+
+	if (!buff_pool->page_pool)
+		buff_pool->page_pool =
+			qdf_nbuf_page_pool_create(soc->osdev,
+						  DP_RX_REFILL_BUFF_POOL_PAGES,
+						  rx_desc_pool->buf_size,
+						  RX_BUFFER_RESERVATION,
+						  rx_desc_pool->buf_alignment);
+	if (!buff_pool->page_pool)
+		dp_info("RX refill buffer pool runs without a page pool");
 
 	for (i = 0; i < (buff_pool->max_bufq_len - 1); i++) {
-		nbuf = qdf_nbuf_alloc(soc->osdev, rx_desc_pool->buf_size,
-				      RX_BUFFER_RESERVATION,
-				      rx_desc_pool->buf_alignment, FALSE);
+		nbuf = dp_rx_refill_buff_pool_nbuf_alloc(soc, buff_pool,
+							 rx_desc_pool);
 		if (!nbuf)
 			continue;
 
@@ -376,6 +475,17 @@ static void dp_rx_refill_buff_pool_deinit(struct dp_soc *soc, u8 mac_id)
 		count, buff_pool->head, buff_pool->tail);
 
 	buff_pool->is_initialized = false;
+
+	/*
+	 * Recycled buffers are either unmapped or page pool backed, in which
+	 * case freeing them hands the page back to the pool.
+	 */
+	while ((nbuf = qdf_nbuf_queue_head_dequeue(&buff_pool->recycle_q)))
+		qdf_nbuf_free(nbuf);
+
+	/* pages still in the rings are released as those nbufs are freed */
+	qdf_nbuf_page_pool_destroy(buff_pool->page_pool);
+	buff_pool->page_pool = NULL;
 }
 
 void dp_rx_buffer_pool_deinit(struct dp_soc *soc, u8 mac_id)
@@ -101,6 +101,8 @@ dp_rx_buffer_pool_nbuf_map(struct dp_soc *soc,
  * buffers in refill pool
  * @soc: SoC handle
  *
+ * The thread is also kicked early when enough recycled buffers are waiting,
+ * so they return to the ring before the pool drains to the threshold.
  */
 static inline void dp_rx_schedule_refill_thread(struct dp_soc *soc)
 {
@@ -118,7 +120,10 @@ static inline void dp_rx_schedule_refill_thread(struct dp_soc *soc)
 		num_refill = (DP_RX_REFILL_BUFF_POOL_SIZE - head + tail - 1);
 
 	if (soc->cdp_soc.ol_ops->dp_rx_sched_refill_thread &&
-	    num_refill >= DP_RX_REFILL_THRD_THRESHOLD)
+	    (num_refill >= DP_RX_REFILL_THRD_THRESHOLD ||
+	     (num_refill >= DP_RX_REFILL_BUFF_POOL_BURST &&
+	      qdf_nbuf_queue_head_qlen(&buff_pool->recycle_q) >=
+	      DP_RX_REFILL_BUFF_POOL_BURST)))
 		soc->cdp_soc.ol_ops->dp_rx_sched_refill_thread(
 						dp_soc_to_cdp_soc_t(soc));
 }
@@ -20,6 +20,7 @@
 #include "dp_peer.h"
 #include "dp_types.h"
 #include "dp_internal.h"
+#include "dp_tx_desc.h"
 #include "htt_stats.h"
 #include "htt_ppdu_stats.h"
 #ifdef QCA_PEER_EXT_STATS
@@ -6650,6 +6651,16 @@ dp_print_pdev_rx_stats(struct dp_pdev *pdev)
 		       pdev->stats.rx_buffer_pool.num_bufs_alloc_success);
 	DP_PRINT_STATS("\tAllocations from the pool during replenish = %llu",
 		       pdev->stats.rx_buffer_pool.num_pool_bufs_replenish);
+
+	DP_PRINT_STATS("RX Refill Buffer Pool Stats:\n");
+	DP_PRINT_STATS("\tBuffers refilled by the refill thread = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_bufs_refilled);
+	DP_PRINT_STATS("\tBuffers taken from the pool on replenish = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_bufs_allocated);
+	DP_PRINT_STATS("\tDropped buffers recycled to the pool = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_bufs_recycled);
+	DP_PRINT_STATS("\tRecycled buffers reused by the refill thread = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_bufs_reused);
 }
 
 void
@@ -6665,7 +6676,7 @@ dp_print_soc_tx_stats(struct dp_soc *soc)
 	     desc_pool_id < wlan_cfg_get_num_tx_desc_pool(soc->wlan_cfg_ctx);
 	     desc_pool_id++)
 		soc->stats.tx.desc_in_use +=
-			soc->tx_desc[desc_pool_id].num_allocated;
+			dp_tx_desc_pool_num_in_use(&soc->tx_desc[desc_pool_id]);
 
 	DP_PRINT_STATS("Tx Descriptors In Use = %u",
 		       soc->stats.tx.desc_in_use);
@@ -6944,6 +6955,72 @@ dp_print_soc_rx_stats(struct dp_soc *soc)
 		       soc->stats.rx.err.rx_invalid_tid_err);
 }
 
+#ifdef DP_TX_DESC_PERCPU_CACHE
+/**
+ * dp_print_tx_desc_cache_pool() - Print per-CPU magazine stats of a pool
+ * @name: pool name
+ * @pool_id: pool id
+ * @cache: per-CPU magazines of the pool
+ *
+ * Return: None
+ */
+static void dp_print_tx_desc_cache_pool(const char *name, uint8_t pool_id,
+					struct dp_tx_desc_cache_pool *cache)
+{
+	uint32_t cached = 0, hit = 0, miss = 0, flush = 0;
+	uint32_t cpu;
+
+	if (!cache->cpu)
+		return;
+
+	for (cpu = 0; cpu < cache->num_cpu; cpu++) {
+		cached += cache->cpu[cpu].count;
+		hit += cache->cpu[cpu].hit;
+		miss += cache->cpu[cpu].miss;
+		flush += cache->cpu[cpu].flush;
+	}
+
+	DP_PRINT_STATS("%s[%u]: cached = %u hit = %u miss = %u flush = %u lock acquired = %u contended = %u",
+		       name, pool_id, cached, hit, miss, flush,
+		       cache->lock_acquired, cache->lock_contended);
+}
+
+void dp_print_soc_tx_desc_cache_stats(struct dp_soc *soc)
+{
+	uint8_t pool_id;
+	uint8_t num_pool = wlan_cfg_get_num_tx_desc_pool(soc->wlan_cfg_ctx);
+
+	DP_PRINT_STATS("SOC Tx Descriptor Cache Stats:");
+	for (pool_id = 0; pool_id < num_pool; pool_id++) {
+		dp_print_tx_desc_cache_pool("Tx desc", pool_id,
+					    &soc->tx_desc[pool_id].cache);
+		dp_print_tx_desc_cache_pool("Tx ext desc", pool_id,
+					    &soc->tx_ext_desc[pool_id].cache);
+		dp_print_tx_desc_cache_pool("Tx tso desc", pool_id,
+					    &soc->tx_tso_desc[pool_id].cache);
+		dp_print_tx_desc_cache_pool("Tx tso num seg", pool_id,
+					    &soc->tx_tso_num_seg[pool_id].cache);
+	}
+}
+#endif /* DP_TX_DESC_PERCPU_CACHE */
+
+void dp_print_soc_hash_lock_stats(struct dp_soc *soc)
+{
+	DP_PRINT_STATS("SOC Hash Lock Stats:");
+	DP_PRINT_STATS("Peer hash lock acquired = %u contended = %u",
+		       soc->stats.peer_hash_lock.acquired,
+		       soc->stats.peer_hash_lock.contended);
+	DP_PRINT_STATS("MEC hash lock acquired = %u contended = %u",
+		       soc->stats.mec_lock.acquired,
+		       soc->stats.mec_lock.contended);
+	DP_PRINT_STATS("AST hash lock acquired = %u contended = %u",
+		       soc->stats.ast_hash_lock.acquired,
+		       soc->stats.ast_hash_lock.contended);
+	DP_PRINT_STATS("AST lock (rx WDS learn) acquired = %u contended = %u",
+		       soc->stats.ast_lock.acquired,
+		       soc->stats.ast_lock.contended);
+}
+
 #ifdef FEATURE_TSO_STATS
 void dp_print_tso_stats(struct dp_soc *soc,
 			enum qdf_stats_verbosity_level level)
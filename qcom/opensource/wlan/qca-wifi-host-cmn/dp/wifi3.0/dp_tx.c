@@ -227,6 +227,24 @@ dp_tx_outstanding_dec(struct dp_pdev *pdev)
 	dp_update_tx_desc_stats(pdev);
 }
 
+/**
+ * dp_tx_outstanding_sub - Subtract a batch of completed tx descs from the
+ *			   outstanding values on pdev and soc
+ * @pdev: DP pdev handle
+ * @count: number of completed tx descs
+ *
+ * Return: void
+ */
+static inline void
+dp_tx_outstanding_sub(struct dp_pdev *pdev, uint32_t count)
+{
+	struct dp_soc *soc = pdev->soc;
+
+	qdf_atomic_sub(count, &pdev->num_tx_outstanding);
+	qdf_atomic_sub(count, &soc->num_tx_outstanding);
+	dp_update_tx_desc_stats(pdev);
+}
+
 #else //QCA_TX_LIMIT_CHECK
 static inline bool
 dp_tx_limit_check(struct dp_vdev *vdev)
@@ -253,6 +271,13 @@ dp_tx_outstanding_dec(struct dp_pdev *pdev)
 	qdf_atomic_dec(&pdev->num_tx_outstanding);
 	dp_update_tx_desc_stats(pdev);
 }
+
+static inline void
+dp_tx_outstanding_sub(struct dp_pdev *pdev, uint32_t count)
+{
+	qdf_atomic_sub(count, &pdev->num_tx_outstanding);
+	dp_update_tx_desc_stats(pdev);
+}
 #endif //QCA_TX_LIMIT_CHECK
 
 #ifdef WLAN_FEATURE_DP_TX_DESC_HISTORY
@@ -1416,6 +1441,8 @@ dp_tx_attempt_coalescing(struct dp_soc *soc, struct dp_vdev *vdev,
 	struct dp_swlm *swlm = &soc->swlm;
 	union swlm_data swlm_query_data;
 	struct dp_swlm_tcl_data tcl_data;
+	struct dp_swlm_wr_stats *wr = &swlm->stats.tcl[ring_id].wr;
+	uint64_t *start_time = &swlm->params.tcl[ring_id].coalesce_start_time;
 	QDF_STATUS status;
 	int ret;
 
@@ -1438,14 +1465,17 @@ dp_tx_attempt_coalescing(struct dp_soc *soc, struct dp_vdev *vdev,
 	if (QDF_IS_STATUS_ERROR(status)) {
 		dp_swlm_tcl_reset_session_data(soc, ring_id);
 		DP_STATS_INC(swlm, tcl[ring_id].coalesce_fail, 1);
+		dp_swlm_wr_issued(wr, start_time);
 		return 0;
 	}
 
 	ret = dp_swlm_query_policy(soc, TCL_DATA, swlm_query_data);
 	if (ret) {
 		DP_STATS_INC(swlm, tcl[ring_id].coalesce_success, 1);
+		dp_swlm_wr_coalesced(wr, start_time);
 	} else {
 		DP_STATS_INC(swlm, tcl[ring_id].coalesce_fail, 1);
+		dp_swlm_wr_issued(wr, start_time);
 	}
 
 	return ret;
@@ -2704,17 +2734,17 @@ dp_tx_per_pkt_vdev_id_check(qdf_nbuf_t nbuf, struct dp_vdev *vdev)
 	    DP_FRAME_IS_BROADCAST((eh)->ether_dhost))
 		return QDF_STATUS_SUCCESS;
 
-	qdf_spin_lock_bh(&vdev->pdev->soc->ast_lock);
+	qdf_rcu_read_lock();
 	dst_ast_entry = dp_peer_ast_hash_find_by_vdevid(vdev->pdev->soc,
 							eh->ether_dhost,
 							vdev->vdev_id);
 
 	/* If there is no ast entry, return failure */
 	if (qdf_unlikely(!dst_ast_entry)) {
-		qdf_spin_unlock_bh(&vdev->pdev->soc->ast_lock);
+		qdf_rcu_read_unlock();
 		return QDF_STATUS_E_FAILURE;
 	}
-	qdf_spin_unlock_bh(&vdev->pdev->soc->ast_lock);
+	qdf_rcu_read_unlock();
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -3016,14 +3046,14 @@ void dp_tx_nawds_handler(struct dp_soc *soc, struct dp_vdev *vdev,
 	qdf_ether_header_t *eh = (qdf_ether_header_t *)qdf_nbuf_data(nbuf);
 
 	if (!soc->ast_offload_support) {
-		qdf_spin_lock_bh(&soc->ast_lock);
+		qdf_rcu_read_lock();
 		ast_entry = dp_peer_ast_hash_find_by_pdevid
 					(soc,
 					(uint8_t *)(eh->ether_shost),
 					vdev->pdev->pdev_id);
 		if (ast_entry)
 			sa_peer_id = ast_entry->peer_id;
-		qdf_spin_unlock_bh(&soc->ast_lock);
+		qdf_rcu_read_unlock();
 	}
 
 	qdf_spin_lock_bh(&vdev->peer_list_lock);
@@ -4382,43 +4412,182 @@ out:
 #if defined(QCA_VDEV_STATS_HW_OFFLOAD_SUPPORT) && \
 	defined(QCA_ENHANCED_STATS_SUPPORT)
 /*
- * dp_tx_update_peer_basic_stats(): Update peer basic stats
+ * dp_tx_update_peer_basic_stats_bulk(): Update peer basic stats for a batch
+ *					  of completions
  * @peer: Datapath peer handle
- * @length: Length of the packet
- * @tx_status: Tx status from TQM/FW
+ * @num: Number of completed packets
+ * @bytes: Total length of the completed packets
+ * @num_failed: Number of completed packets not acked
  * @update: enhanced flag value present in dp_pdev
  *
  * Return: none
  */
-void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
-				   uint8_t tx_status, bool update)
+static inline void
+dp_tx_update_peer_basic_stats_bulk(struct dp_peer *peer, uint32_t num,
+				   uint64_t bytes, uint32_t num_failed,
+				   bool update)
 {
 	if ((!peer->hw_txrx_stats_en) || update) {
-		DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
-		DP_STATS_INCC(peer, tx.tx_failed, 1,
-			      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
+		DP_STATS_INC_PKT(peer, tx.comp_pkt, num, bytes);
+		DP_STATS_INC(peer, tx.tx_failed, num_failed);
 	}
 }
 #elif defined(QCA_VDEV_STATS_HW_OFFLOAD_SUPPORT)
-void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
-				   uint8_t tx_status, bool update)
+static inline void
+dp_tx_update_peer_basic_stats_bulk(struct dp_peer *peer, uint32_t num,
+				   uint64_t bytes, uint32_t num_failed,
+				   bool update)
 {
 	if (!peer->hw_txrx_stats_en) {
-		DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
-		DP_STATS_INCC(peer, tx.tx_failed, 1,
-			      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
+		DP_STATS_INC_PKT(peer, tx.comp_pkt, num, bytes);
+		DP_STATS_INC(peer, tx.tx_failed, num_failed);
 	}
 }
 
 #else
+static inline void
+dp_tx_update_peer_basic_stats_bulk(struct dp_peer *peer, uint32_t num,
+				   uint64_t bytes, uint32_t num_failed,
+				   bool update)
+{
+	DP_STATS_INC_PKT(peer, tx.comp_pkt, num, bytes);
+	DP_STATS_INC(peer, tx.tx_failed, num_failed);
+}
+#endif
+
+/*
+ * dp_tx_update_peer_basic_stats(): Update peer basic stats
+ * @peer: Datapath peer handle
+ * @length: Length of the packet
+ * @tx_status: Tx status from TQM/FW
+ * @update: enhanced flag value present in dp_pdev
+ *
+ * Return: none
+ */
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 				   uint8_t tx_status, bool update)
 {
-	DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
-	DP_STATS_INCC(peer, tx.tx_failed, 1,
-		      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
+	dp_tx_update_peer_basic_stats_bulk(peer, 1, length,
+					   tx_status !=
+					   HAL_TX_TQM_RR_FRAME_ACKED,
+					   update);
+}
+
+/* Max nbufs collected from simple completions before a bulk free */
+#define DP_TX_COMP_NBUF_BULK_MAX 32
+
+/**
+ * struct dp_tx_comp_batch - State batched over a list of simple completions
+ * @peer_num: completions accumulated for the current peer
+ * @peer_bytes: total length of @peer_num completions
+ * @peer_failed: completions of @peer_num that were not acked
+ * @pdev: pdev the @num_outstanding completions belong to
+ * @num_outstanding: completions not yet subtracted from @pdev outstanding
+ * @num_nbufs: nbufs pending in @nbufs
+ * @nbufs: unmapped nbufs waiting for a bulk free
+ */
+struct dp_tx_comp_batch {
+	uint32_t peer_num;
+	uint64_t peer_bytes;
+	uint32_t peer_failed;
+	struct dp_pdev *pdev;
+	uint32_t num_outstanding;
+	uint32_t num_nbufs;
+	qdf_nbuf_t nbufs[DP_TX_COMP_NBUF_BULK_MAX];
+};
+
+/**
+ * dp_tx_comp_batch_flush_peer() - Apply stats batched for the current peer
+ * @batch: completion batch
+ * @peer: peer the stats were accumulated for, may be NULL
+ *
+ * Return: none
+ */
+static inline void
+dp_tx_comp_batch_flush_peer(struct dp_tx_comp_batch *batch,
+			    struct dp_peer *peer)
+{
+	if (batch->peer_num && qdf_likely(peer))
+		dp_tx_update_peer_basic_stats_bulk(peer, batch->peer_num,
+						   batch->peer_bytes,
+						   batch->peer_failed, false);
+
+	batch->peer_num = 0;
+	batch->peer_bytes = 0;
+	batch->peer_failed = 0;
+}
+
+/**
+ * dp_tx_comp_batch_flush_pdev() - Apply the batched outstanding count
+ * @batch: completion batch
+ *
+ * Return: none
+ */
+static inline void dp_tx_comp_batch_flush_pdev(struct dp_tx_comp_batch *batch)
+{
+	if (batch->num_outstanding)
+		dp_tx_outstanding_sub(batch->pdev, batch->num_outstanding);
+
+	batch->num_outstanding = 0;
+}
+
+/**
+ * dp_tx_comp_batch_flush_nbufs() - Bulk free the batched nbufs
+ * @batch: completion batch
+ *
+ * Return: none
+ */
+static inline void dp_tx_comp_batch_flush_nbufs(struct dp_tx_comp_batch *batch)
+{
+	if (batch->num_nbufs)
+		qdf_nbuf_free_bulk(batch->nbufs, batch->num_nbufs);
+
+	batch->num_nbufs = 0;
+}
+
+/**
+ * dp_tx_comp_batch_add() - Account a simple completion in the batch
+ * @batch: completion batch
+ * @desc: completed software descriptor
+ *
+ * Return: none
+ */
+static inline void dp_tx_comp_batch_add(struct dp_tx_comp_batch *batch,
+					struct dp_tx_desc_s *desc)
+{
+	batch->peer_num++;
+	batch->peer_bytes += desc->length;
+	if (desc->tx_status != HAL_TX_TQM_RR_FRAME_ACKED)
+		batch->peer_failed++;
+
+	if (qdf_unlikely(batch->pdev != desc->pdev)) {
+		dp_tx_comp_batch_flush_pdev(batch);
+		batch->pdev = desc->pdev;
+	}
+	batch->num_outstanding++;
+
+	batch->nbufs[batch->num_nbufs++] = desc->nbuf;
+	if (qdf_unlikely(batch->num_nbufs == DP_TX_COMP_NBUF_BULK_MAX))
+		dp_tx_comp_batch_flush_nbufs(batch);
+}
+
+/**
+ * dp_tx_comp_prefetch_next() - Prefetch ahead of the completion being handled
+ * @next: next software descriptor in the completion list
+ *
+ * The reap loop has just linked @next so it is cache hot; warm up the nbuf
+ * it completes and the descriptor after it.
+ *
+ * Return: none
+ */
+static inline void dp_tx_comp_prefetch_next(struct dp_tx_desc_s *next)
+{
+	if (qdf_likely(next)) {
+		qdf_prefetch(next->nbuf);
+		if (next->next)
+			qdf_prefetch(next->next);
+	}
 }
-#endif
 
 /**
  * dp_tx_comp_process_desc_list() - Tx complete software descriptor handler
@@ -4427,7 +4596,10 @@ void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
  * @ring_id: ring number
  *
  * This function will process batch of descriptors reaped by dp_tx_comp_handler
- * and release the software descriptors after processing is complete
+ * and release the software descriptors after processing is complete.
+ * Simple completions are batched: peer basic stats are applied once per run
+ * of completions for the same peer, the outstanding count once per pdev run
+ * and the unmapped nbufs are released through a bulk free.
  *
  * Return: none
  */
@@ -4440,11 +4612,23 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 	struct hal_tx_completion_status ts;
 	struct dp_peer *peer = NULL;
 	uint16_t peer_id = DP_INVALID_PEER;
+	struct dp_tx_comp_batch batch;
+
+	batch.peer_num = 0;
+	batch.peer_bytes = 0;
+	batch.peer_failed = 0;
+	batch.pdev = NULL;
+	batch.num_outstanding = 0;
+	batch.num_nbufs = 0;
 
 	desc = comp_head;
 
 	while (desc) {
+		next = desc->next;
+		dp_tx_comp_prefetch_next(next);
+
 		if (peer_id != desc->peer_id) {
+			dp_tx_comp_batch_flush_peer(&batch, peer);
 			if (peer)
 				dp_peer_unref_delete(peer,
 						     DP_MOD_ID_TX_COMP);
@@ -4454,21 +4638,12 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 		}
 
 		if (qdf_likely(desc->flags & DP_TX_DESC_FLAG_SIMPLE)) {
-			struct dp_pdev *pdev = desc->pdev;
-
-			if (qdf_likely(peer))
-				dp_tx_update_peer_basic_stats(peer,
-							      desc->length,
-							      desc->tx_status,
-							      false);
-			qdf_assert(pdev);
-			dp_tx_outstanding_dec(pdev);
+			qdf_assert(desc->pdev);
 
 			/*
 			 * Calling a QDF WRAPPER here is creating signifcant
 			 * performance impact so avoided the wrapper call here
 			 */
-			next = desc->next;
 			dp_tx_desc_history_add(soc, desc->dma_addr, desc->nbuf,
 					       desc->id, DP_TX_COMP_UNMAP);
 			qdf_nbuf_unmap_nbytes_single_paddr(soc->osdev,
@@ -4476,7 +4651,7 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 							   desc->dma_addr,
 							   QDF_DMA_TO_DEVICE,
 							   desc->length);
-			qdf_nbuf_free(desc->nbuf);
+			dp_tx_comp_batch_add(&batch, desc);
 			dp_tx_desc_free(soc, desc, desc->pool_id);
 			desc = next;
 			continue;
@@ -4487,11 +4662,14 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 
 		dp_tx_comp_process_desc(soc, desc, &ts, peer);
 
-		next = desc->next;
-
 		dp_tx_desc_release(desc, desc->pool_id);
 		desc = next;
 	}
+
+	dp_tx_comp_batch_flush_peer(&batch, peer);
+	dp_tx_comp_batch_flush_pdev(&batch);
+	dp_tx_comp_batch_flush_nbufs(&batch);
+
 	if (peer)
 		dp_peer_unref_delete(peer, DP_MOD_ID_TX_COMP);
 }
@@ -39,6 +39,67 @@ do {                                                                 \
 #define DP_TX_DESC_PAGE_DIVIDER(soc, num_desc_per_page, pool_id) {}
 #endif /* DESC_PARTITION */
 
+#ifdef DP_TX_DESC_PERCPU_CACHE
+/**
+ * dp_tx_desc_cache_pool_init() - Allocate the per-CPU magazines of a pool
+ * @cache: per-CPU magazines of the pool
+ *
+ * A pool whose magazines cannot be allocated keeps serving every
+ * allocation from its freelist, so this never fails the pool init.
+ *
+ * Return: None
+ */
+static void dp_tx_desc_cache_pool_init(struct dp_tx_desc_cache_pool *cache)
+{
+	uint32_t cpu;
+
+	cache->lock_acquired = 0;
+	cache->lock_contended = 0;
+	cache->num_cpu = nr_cpu_ids;
+	cache->cpu = qdf_mem_malloc(cache->num_cpu * sizeof(*cache->cpu));
+	if (!cache->cpu) {
+		dp_err("tx desc cache alloc fail, using pool freelist only");
+		return;
+	}
+
+	for (cpu = 0; cpu < cache->num_cpu; cpu++)
+		qdf_spinlock_create(&cache->cpu[cpu].lock);
+}
+
+/**
+ * dp_tx_desc_cache_pool_deinit() - Free the per-CPU magazines of a pool
+ * @cache: per-CPU magazines of the pool
+ *
+ * Elements still held by the magazines live in the pool pages and are
+ * relinked into the freelist on the next pool init.
+ *
+ * Return: None
+ */
+static void dp_tx_desc_cache_pool_deinit(struct dp_tx_desc_cache_pool *cache)
+{
+	uint32_t cpu;
+
+	if (!cache->cpu)
+		return;
+
+	for (cpu = 0; cpu < cache->num_cpu; cpu++)
+		qdf_spinlock_destroy(&cache->cpu[cpu].lock);
+
+	qdf_mem_free(cache->cpu);
+	cache->cpu = NULL;
+}
+#else
+static inline void
+dp_tx_desc_cache_pool_init(struct dp_tx_desc_cache_pool *cache)
+{
+}
+
+static inline void
+dp_tx_desc_cache_pool_deinit(struct dp_tx_desc_cache_pool *cache)
+{
+}
+#endif /* DP_TX_DESC_PERCPU_CACHE */
+
 /**
  * dp_tx_desc_pool_counter_initialize() - Initialize counters
  * @tx_desc_pool Handle to DP tx_desc_pool structure
@@ -62,6 +123,27 @@ dp_tx_desc_pool_counter_initialize(struct dp_tx_desc_pool_s *tx_desc_pool,
 }
 #endif
 
+/**
+ * dp_tx_desc_pool_cache_init() - Set up per-CPU magazines of a tx pool
+ * @tx_desc_pool: Handle to DP tx_desc_pool structure
+ *
+ * Flow control V2 pools charge magazine held descriptors against
+ * avail_desc, see dp_tx_flow_pool_cache_refill().
+ *
+ * Return: None
+ */
+static void
+dp_tx_desc_pool_cache_init(struct dp_tx_desc_pool_s *tx_desc_pool)
+{
+	dp_tx_desc_cache_pool_init(DP_TX_DESC_POOL_CACHE(tx_desc_pool));
+}
+
+static void
+dp_tx_desc_pool_cache_deinit(struct dp_tx_desc_pool_s *tx_desc_pool)
+{
+	dp_tx_desc_cache_pool_deinit(DP_TX_DESC_POOL_CACHE(tx_desc_pool));
+}
+
 /**
  * dp_tx_desc_pool_alloc() - Allocate Tx Descriptor pool(s)
  * @soc Handle to DP SoC structure
@@ -166,6 +248,7 @@ QDF_STATUS dp_tx_desc_pool_init(struct dp_soc *soc, uint8_t pool_id,
 
 	dp_tx_desc_pool_counter_initialize(tx_desc_pool, num_elem);
 	TX_DESC_LOCK_CREATE(&tx_desc_pool->lock);
+	dp_tx_desc_pool_cache_init(tx_desc_pool);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -182,6 +265,7 @@ void dp_tx_desc_pool_deinit(struct dp_soc *soc, uint8_t pool_id)
 
 	tx_desc_pool = &soc->tx_desc[pool_id];
 	soc->arch_ops.dp_tx_desc_pool_deinit(soc, tx_desc_pool, pool_id);
+	dp_tx_desc_pool_cache_deinit(tx_desc_pool);
 	TX_DESC_POOL_MEMBER_CLEAN(tx_desc_pool);
 	TX_DESC_LOCK_DESTROY(&tx_desc_pool->lock);
 }
@@ -355,6 +439,8 @@ QDF_STATUS dp_tx_ext_desc_pool_init(struct dp_soc *soc, uint8_t num_pool,
 		}
 		dp_tx_ext_desc_pool->num_free = num_elem;
 		qdf_spinlock_create(&dp_tx_ext_desc_pool->lock);
+		dp_tx_desc_cache_pool_init(
+				DP_TX_DESC_POOL_CACHE(dp_tx_ext_desc_pool));
 	}
 	return QDF_STATUS_SUCCESS;
 
@@ -403,6 +489,8 @@ void dp_tx_ext_desc_pool_deinit(struct dp_soc *soc, uint8_t num_pool)
 
 	for (pool_id = 0; pool_id < num_pool; pool_id++) {
 		dp_tx_ext_desc_pool = &((soc)->tx_ext_desc[pool_id]);
+		dp_tx_desc_cache_pool_deinit(
+				DP_TX_DESC_POOL_CACHE(dp_tx_ext_desc_pool));
 		qdf_spinlock_destroy(&dp_tx_ext_desc_pool->lock);
 	}
 }
@@ -507,6 +595,7 @@ QDF_STATUS dp_tx_tso_desc_pool_init(struct dp_soc *soc, uint8_t num_pool,
 			  tso_desc_pool->num_free);
 		tso_desc_pool->pool_size = num_elem;
 		qdf_spinlock_create(&tso_desc_pool->lock);
+		dp_tx_desc_cache_pool_init(DP_TX_DESC_POOL_CACHE(tso_desc_pool));
 	}
 	return QDF_STATUS_SUCCESS;
 }
@@ -524,6 +613,8 @@ void dp_tx_tso_desc_pool_deinit(struct dp_soc *soc, uint8_t num_pool)
 
 	for (pool_id = 0; pool_id < num_pool; pool_id++) {
 		tso_desc_pool = &soc->tx_tso_desc[pool_id];
+		dp_tx_desc_cache_pool_deinit(
+				DP_TX_DESC_POOL_CACHE(tso_desc_pool));
 		qdf_spin_lock_bh(&tso_desc_pool->lock);
 
 		tso_desc_pool->freelist = NULL;
@@ -634,6 +725,8 @@ QDF_STATUS dp_tx_tso_num_seg_pool_init(struct dp_soc *soc, uint8_t num_pool,
 		tso_num_seg_pool->num_seg_pool_size = num_elem;
 
 		qdf_spinlock_create(&tso_num_seg_pool->lock);
+		dp_tx_desc_cache_pool_init(
+				DP_TX_DESC_POOL_CACHE(tso_num_seg_pool));
 	}
 	return QDF_STATUS_SUCCESS;
 }
@@ -655,6 +748,8 @@ void dp_tx_tso_num_seg_pool_deinit(struct dp_soc *soc, uint8_t num_pool)
 
 	for (pool_id = 0; pool_id < num_pool; pool_id++) {
 		tso_num_seg_pool = &soc->tx_tso_num_seg[pool_id];
+		dp_tx_desc_cache_pool_deinit(
+				DP_TX_DESC_POOL_CACHE(tso_num_seg_pool));
 		qdf_spin_lock_bh(&tso_num_seg_pool->lock);
 
 		tso_num_seg_pool->freelist = NULL;
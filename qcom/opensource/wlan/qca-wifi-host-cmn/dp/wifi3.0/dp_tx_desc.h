@@ -106,6 +106,323 @@ static inline void dp_tx_desc_set_magic(struct dp_tx_desc_s *tx_desc,
 }
 #endif
 
+/*
+ * Per-CPU magazines link free elements through their first member, which
+ * must therefore be the freelist link for every pool type they front.
+ */
+QDF_COMPILE_TIME_ASSERT(dp_tx_desc_cache_link,
+			qdf_offsetof(struct dp_tx_desc_s, next) == 0);
+QDF_COMPILE_TIME_ASSERT(dp_tx_ext_desc_cache_link,
+			qdf_offsetof(struct dp_tx_ext_desc_elem_s, next) == 0);
+QDF_COMPILE_TIME_ASSERT(dp_tx_tso_desc_cache_link,
+			qdf_offsetof(struct qdf_tso_seg_elem_t, next) == 0);
+QDF_COMPILE_TIME_ASSERT(dp_tx_tso_num_seg_cache_link,
+			qdf_offsetof(struct qdf_tso_num_seg_elem_t, next) == 0);
+
+/**
+ * dp_tx_desc_cache_chain() - Walk a chain of up to @max free elements
+ * @head: first element of the chain, must not be NULL
+ * @max: maximum number of elements to take
+ * @tail: filled with the last element taken
+ *
+ * Return: number of elements taken
+ */
+static inline uint16_t
+dp_tx_desc_cache_chain(void *head, uint16_t max,
+		       struct dp_tx_desc_cache_elem **tail)
+{
+	struct dp_tx_desc_cache_elem *elem = head;
+	uint16_t num = 1;
+
+	while (num < max && elem->next) {
+		elem = elem->next;
+		num++;
+	}
+	*tail = elem;
+
+	return num;
+}
+
+#ifdef DP_TX_DESC_PERCPU_CACHE
+#define DP_TX_DESC_POOL_CACHE(_pool) (&(_pool)->cache)
+
+/**
+ * dp_tx_desc_pool_lock() - Take a tx pool lock, counting contention
+ * @cache: per-CPU magazines of the pool
+ * @lock: pool lock
+ *
+ * Return: None
+ */
+static inline void dp_tx_desc_pool_lock(struct dp_tx_desc_cache_pool *cache,
+					qdf_spinlock_t *lock)
+{
+	if (!qdf_spin_trylock_bh(lock)) {
+		qdf_spin_lock_bh(lock);
+		cache->lock_contended++;
+	}
+	cache->lock_acquired++;
+}
+
+/**
+ * dp_tx_desc_cache_enabled() - Check if a pool is fronted by magazines
+ * @cache: per-CPU magazines of the pool
+ *
+ * Return: true if the pool has per-CPU magazines
+ */
+static inline bool dp_tx_desc_cache_enabled(struct dp_tx_desc_cache_pool *cache)
+{
+	return qdf_likely(cache->cpu);
+}
+
+/**
+ * dp_tx_desc_cache_get() - Get the magazine of the current CPU
+ * @cache: per-CPU magazines of the pool
+ *
+ * Must be called with bottom halves disabled. Xmit and tx completion are
+ * the only users of a magazine and both run on its CPU, so it needs no
+ * lock for as long as bottom halves stay disabled.
+ *
+ * Return: magazine, NULL if the pool runs without magazines
+ */
+static inline struct dp_tx_desc_cache *
+dp_tx_desc_cache_get(struct dp_tx_desc_cache_pool *cache)
+{
+	if (qdf_unlikely(!cache->cpu))
+		return NULL;
+
+	return &cache->cpu[qdf_get_cpu()];
+}
+
+/**
+ * dp_tx_desc_cache_count() - Number of free elements held by the magazines
+ * @cache: per-CPU magazines of the pool
+ *
+ * The magazines are read without their owners' cooperation, so the sum is
+ * only a snapshot.
+ *
+ * Return: number of elements cached over all CPUs
+ */
+static inline uint32_t
+dp_tx_desc_cache_count(struct dp_tx_desc_cache_pool *cache)
+{
+	uint32_t num = 0;
+	uint32_t cpu;
+
+	if (!cache->cpu)
+		return 0;
+
+	for (cpu = 0; cpu < cache->num_cpu; cpu++)
+		num += cache->cpu[cpu].count;
+
+	return num;
+}
+
+/**
+ * __dp_tx_desc_cache_pop() - Take one free element from a magazine
+ * @cache: magazine of the current CPU, bottom halves disabled
+ *
+ * Return: free element, NULL if the magazine is empty
+ */
+static inline void *__dp_tx_desc_cache_pop(struct dp_tx_desc_cache *cache)
+{
+	struct dp_tx_desc_cache_elem *elem;
+
+	elem = cache->freelist;
+	if (qdf_likely(elem)) {
+		cache->freelist = elem->next;
+		cache->count--;
+		cache->hit++;
+	} else {
+		cache->miss++;
+	}
+
+	return elem;
+}
+
+/**
+ * __dp_tx_desc_cache_fill() - Stash a chain refilled from the pool
+ * @cache: magazine of the current CPU, bottom halves disabled
+ * @head: first element of the chain
+ * @tail: last element of the chain
+ * @num: number of elements in the chain
+ *
+ * Return: None
+ */
+static inline void __dp_tx_desc_cache_fill(struct dp_tx_desc_cache *cache,
+					   void *head,
+					   struct dp_tx_desc_cache_elem *tail,
+					   uint16_t num)
+{
+	tail->next = cache->freelist;
+	cache->freelist = head;
+	cache->count += num;
+}
+
+/**
+ * __dp_tx_desc_cache_push() - Return one free element to a magazine
+ * @cache: magazine of the current CPU, bottom halves disabled
+ * @elem: element being freed
+ * @head: filled with the first element to return to the pool
+ * @tail: filled with the last element to return to the pool
+ *
+ * Once the magazine grows past DP_TX_DESC_CACHE_DEPTH a batch of
+ * DP_TX_DESC_CACHE_BATCH elements is unlinked, which the caller splices
+ * back into the pool under a single pool lock.
+ *
+ * Return: number of elements to return to the pool, 0 if none
+ */
+static inline uint16_t
+__dp_tx_desc_cache_push(struct dp_tx_desc_cache *cache, void *elem,
+			struct dp_tx_desc_cache_elem **head,
+			struct dp_tx_desc_cache_elem **tail)
+{
+	struct dp_tx_desc_cache_elem *c_elem = elem;
+	uint16_t count = cache->count + 1;
+	uint16_t num = 0;
+
+	c_elem->next = cache->freelist;
+	cache->freelist = c_elem;
+	if (qdf_unlikely(count > DP_TX_DESC_CACHE_DEPTH)) {
+		*head = cache->freelist;
+		num = dp_tx_desc_cache_chain(*head, DP_TX_DESC_CACHE_BATCH,
+					     tail);
+		cache->freelist = (*tail)->next;
+		count -= num;
+		cache->flush++;
+	}
+	cache->count = count;
+
+	return num;
+}
+
+/**
+ * dp_tx_desc_cache_pop() - Take one free element from the magazine of the
+ *			    current CPU
+ * @cache_pool: per-CPU magazines of the pool
+ *
+ * Return: free element, NULL if the magazine is empty or the pool runs
+ *	   without magazines
+ */
+static inline void *
+dp_tx_desc_cache_pop(struct dp_tx_desc_cache_pool *cache_pool)
+{
+	struct dp_tx_desc_cache *cache;
+	void *elem = NULL;
+
+	qdf_local_bh_disable();
+	cache = dp_tx_desc_cache_get(cache_pool);
+	if (cache)
+		elem = __dp_tx_desc_cache_pop(cache);
+	qdf_local_bh_enable();
+
+	return elem;
+}
+
+/**
+ * dp_tx_desc_cache_fill() - Stash a chain refilled from the pool in the
+ *			     magazine of the current CPU
+ * @cache_pool: per-CPU magazines of the pool, must be enabled
+ * @head: first element of the chain
+ * @tail: last element of the chain
+ * @num: number of elements in the chain
+ *
+ * Return: None
+ */
+static inline void
+dp_tx_desc_cache_fill(struct dp_tx_desc_cache_pool *cache_pool, void *head,
+		      struct dp_tx_desc_cache_elem *tail, uint16_t num)
+{
+	qdf_local_bh_disable();
+	__dp_tx_desc_cache_fill(dp_tx_desc_cache_get(cache_pool), head, tail,
+				num);
+	qdf_local_bh_enable();
+}
+
+/**
+ * dp_tx_desc_cache_push() - Free one element into the magazine of the
+ *			     current CPU
+ * @cache_pool: per-CPU magazines of the pool
+ * @elem: element being freed
+ * @head: filled with the first element to return to the pool
+ * @tail: filled with the last element to return to the pool
+ *
+ * Return: number of elements to return to the pool, 0 if none. A pool
+ *	   without magazines gets @elem back.
+ */
+static inline uint16_t
+dp_tx_desc_cache_push(struct dp_tx_desc_cache_pool *cache_pool, void *elem,
+		      struct dp_tx_desc_cache_elem **head,
+		      struct dp_tx_desc_cache_elem **tail)
+{
+	struct dp_tx_desc_cache *cache;
+	uint16_t num = 1;
+
+	*head = elem;
+	*tail = elem;
+
+	qdf_local_bh_disable();
+	cache = dp_tx_desc_cache_get(cache_pool);
+	if (cache)
+		num = __dp_tx_desc_cache_push(cache, elem, head, tail);
+	qdf_local_bh_enable();
+
+	return num;
+}
+#else
+#define DP_TX_DESC_POOL_CACHE(_pool) NULL
+
+static inline void dp_tx_desc_pool_lock(struct dp_tx_desc_cache_pool *cache,
+					qdf_spinlock_t *lock)
+{
+	qdf_spin_lock_bh(lock);
+}
+
+static inline bool dp_tx_desc_cache_enabled(struct dp_tx_desc_cache_pool *cache)
+{
+	return false;
+}
+
+static inline struct dp_tx_desc_cache *
+dp_tx_desc_cache_get(struct dp_tx_desc_cache_pool *cache)
+{
+	return NULL;
+}
+
+static inline uint32_t
+dp_tx_desc_cache_count(struct dp_tx_desc_cache_pool *cache)
+{
+	return 0;
+}
+
+static inline void *__dp_tx_desc_cache_pop(struct dp_tx_desc_cache *cache)
+{
+	return NULL;
+}
+
+static inline void *
+dp_tx_desc_cache_pop(struct dp_tx_desc_cache_pool *cache_pool)
+{
+	return NULL;
+}
+
+static inline void
+dp_tx_desc_cache_fill(struct dp_tx_desc_cache_pool *cache_pool, void *head,
+		      struct dp_tx_desc_cache_elem *tail, uint16_t num)
+{
+}
+
+static inline uint16_t
+dp_tx_desc_cache_push(struct dp_tx_desc_cache_pool *cache_pool, void *elem,
+		      struct dp_tx_desc_cache_elem **head,
+		      struct dp_tx_desc_cache_elem **tail)
+{
+	*head = elem;
+	*tail = elem;
+
+	return 1;
+}
+#endif /* DP_TX_DESC_PERCPU_CACHE */
+
 QDF_STATUS dp_tx_desc_pool_alloc(struct dp_soc *soc, uint8_t pool_id,
 				 uint16_t num_elem);
 QDF_STATUS dp_tx_desc_pool_init(struct dp_soc *soc, uint8_t pool_id,
@@ -189,6 +506,252 @@ void dp_tx_put_desc_flow_pool(struct dp_tx_desc_pool_s *pool,
 	pool->avail_desc++;
 }
 
+/**
+ * dp_tx_flow_pool_desc_set_allocated() - Mark a flow pool descriptor in use
+ * @tx_desc: tx descriptor
+ * @desc_pool_id: ID of the flow pool
+ *
+ * Return: None
+ */
+static inline void
+dp_tx_flow_pool_desc_set_allocated(struct dp_tx_desc_s *tx_desc,
+				   uint8_t desc_pool_id)
+{
+	tx_desc->pool_id = desc_pool_id;
+	tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
+	dp_tx_desc_set_magic(tx_desc, DP_TX_MAGIC_PATTERN_INUSE);
+}
+
+/**
+ * dp_tx_flow_pool_desc_set_free() - Reset a flow pool descriptor being freed
+ * @tx_desc: tx descriptor
+ *
+ * Return: None
+ */
+static inline void dp_tx_flow_pool_desc_set_free(struct dp_tx_desc_s *tx_desc)
+{
+	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
+	tx_desc->nbuf = NULL;
+	tx_desc->flags = 0;
+	dp_tx_desc_set_magic(tx_desc, DP_TX_MAGIC_PATTERN_FREE);
+	tx_desc->timestamp = 0;
+}
+
+/**
+ * dp_tx_put_desc_chain_flow_pool() - put a chain of descriptors to a flow
+ *				      pool freelist
+ * @pool: flow pool
+ * @head: first descriptor of the chain
+ * @tail: last descriptor of the chain
+ * @num: number of descriptors in the chain
+ *
+ * Caller needs to take lock and do sanity checks.
+ *
+ * Return: none
+ */
+static inline void
+dp_tx_put_desc_chain_flow_pool(struct dp_tx_desc_pool_s *pool,
+			       struct dp_tx_desc_cache_elem *head,
+			       struct dp_tx_desc_cache_elem *tail,
+			       uint16_t num)
+{
+	tail->next = (struct dp_tx_desc_cache_elem *)pool->freelist;
+	pool->freelist = (struct dp_tx_desc_s *)head;
+	pool->avail_desc += num;
+}
+
+#ifdef QCA_AC_BASED_FLOW_CONTROL
+#define DP_TX_FLOW_POOL_START_TH_MAX(_pool) ((_pool)->start_th[DP_TH_BE_BK])
+#else
+#define DP_TX_FLOW_POOL_START_TH_MAX(_pool) ((_pool)->start_th)
+#endif
+
+#ifdef DP_TX_DESC_PERCPU_CACHE
+/**
+ * dp_tx_flow_pool_cache_pop() - Allocate a flow pool descriptor from the
+ *				 magazine of the current CPU
+ * @pool: flow pool
+ *
+ * Magazine held descriptors were already taken out of avail_desc when
+ * the magazine was refilled, so a hit does not touch the pool.
+ *
+ * Unlike the other tx pools, flow pool magazines keep a lock: the cross
+ * CPU contender is dp_tx_flow_pool_cache_drain(), which empties every
+ * magazine when the pool pauses or is torn down. The lock is only taken
+ * with bottom halves disabled, so it stays uncontended otherwise.
+ *
+ * Return: tx descriptor, NULL on a magazine miss
+ */
+static inline struct dp_tx_desc_s *
+dp_tx_flow_pool_cache_pop(struct dp_tx_desc_pool_s *pool)
+{
+	struct dp_tx_desc_cache *cache;
+	struct dp_tx_desc_s *tx_desc = NULL;
+
+	qdf_local_bh_disable();
+	cache = dp_tx_desc_cache_get(DP_TX_DESC_POOL_CACHE(pool));
+	if (cache) {
+		qdf_spin_lock(&cache->lock);
+		tx_desc = __dp_tx_desc_cache_pop(cache);
+		qdf_spin_unlock(&cache->lock);
+	}
+	qdf_local_bh_enable();
+
+	return tx_desc;
+}
+
+/**
+ * dp_tx_flow_pool_cache_refill() - Move a batch from a flow pool into the
+ *				    magazine of the current CPU
+ * @pool: flow pool, flow_pool_lock held
+ *
+ * The batch is charged against avail_desc. It is only taken while the
+ * pool is unpaused and avail_desc stays above the highest start
+ * threshold afterwards, so no stop threshold is ever stepped over and
+ * the pause decisions are still taken one descriptor at a time.
+ *
+ * Return: None
+ */
+static inline void
+dp_tx_flow_pool_cache_refill(struct dp_tx_desc_pool_s *pool)
+{
+	struct dp_tx_desc_cache *cache;
+	struct dp_tx_desc_cache_elem *tail;
+	struct dp_tx_desc_s *head;
+	uint16_t num;
+
+	if (pool->status != FLOW_POOL_ACTIVE_UNPAUSED ||
+	    pool->avail_desc <= DP_TX_FLOW_POOL_START_TH_MAX(pool) +
+				DP_TX_DESC_CACHE_BATCH)
+		return;
+
+	/* flow_pool_lock keeps bottom halves disabled */
+	cache = dp_tx_desc_cache_get(DP_TX_DESC_POOL_CACHE(pool));
+	if (!cache)
+		return;
+
+	head = pool->freelist;
+	num = dp_tx_desc_cache_chain(head, DP_TX_DESC_CACHE_BATCH, &tail);
+	pool->freelist = (struct dp_tx_desc_s *)tail->next;
+	pool->avail_desc -= num;
+	qdf_spin_lock(&cache->lock);
+	__dp_tx_desc_cache_fill(cache, head, tail, num);
+	qdf_spin_unlock(&cache->lock);
+}
+
+/**
+ * dp_tx_flow_pool_cache_push() - Free a flow pool descriptor into the
+ *				  magazine of the current CPU
+ * @pool: flow pool
+ * @tx_desc: tx descriptor being freed
+ * @head: filled with the first descriptor to return to the pool
+ * @tail: filled with the last descriptor to return to the pool
+ * @num: filled with the number of descriptors to return to the pool
+ *
+ * Only an unpaused pool takes descriptors into magazines, so start_th
+ * resume and the FLOW_POOL_INVALID teardown see every free. The status
+ * is checked under the magazine lock, which dp_tx_flow_pool_cache_drain()
+ * takes after the status change, so no descriptor is stranded.
+ *
+ * Return: true if @tx_desc went into the magazine
+ */
+static inline bool
+dp_tx_flow_pool_cache_push(struct dp_tx_desc_pool_s *pool,
+			   struct dp_tx_desc_s *tx_desc,
+			   struct dp_tx_desc_cache_elem **head,
+			   struct dp_tx_desc_cache_elem **tail,
+			   uint16_t *num)
+{
+	struct dp_tx_desc_cache *cache;
+	bool cached = false;
+
+	*num = 0;
+	qdf_local_bh_disable();
+	cache = dp_tx_desc_cache_get(DP_TX_DESC_POOL_CACHE(pool));
+	if (cache) {
+		qdf_spin_lock(&cache->lock);
+		if (qdf_likely(pool->status == FLOW_POOL_ACTIVE_UNPAUSED)) {
+			*num = __dp_tx_desc_cache_push(cache, tx_desc,
+						       head, tail);
+			cached = true;
+		}
+		qdf_spin_unlock(&cache->lock);
+	}
+	qdf_local_bh_enable();
+
+	return cached;
+}
+
+/**
+ * dp_tx_flow_pool_cache_drain() - Return all magazine held descriptors to
+ *				   a flow pool
+ * @pool: flow pool, flow_pool_lock held
+ *
+ * Called before a pool pauses or is torn down, so that idle CPUs do not
+ * keep descriptors charged against a starving pool.
+ *
+ * Return: number of descriptors returned
+ */
+static inline uint16_t
+dp_tx_flow_pool_cache_drain(struct dp_tx_desc_pool_s *pool)
+{
+	struct dp_tx_desc_cache_pool *cache_pool = DP_TX_DESC_POOL_CACHE(pool);
+	struct dp_tx_desc_cache_elem *head, *tail;
+	struct dp_tx_desc_cache *cache;
+	uint16_t num, total = 0;
+	uint32_t cpu;
+
+	if (!cache_pool->cpu)
+		return 0;
+
+	for (cpu = 0; cpu < cache_pool->num_cpu; cpu++) {
+		cache = &cache_pool->cpu[cpu];
+		qdf_spin_lock_bh(&cache->lock);
+		head = cache->freelist;
+		num = cache->count;
+		cache->freelist = NULL;
+		cache->count = 0;
+		qdf_spin_unlock_bh(&cache->lock);
+		if (!num)
+			continue;
+
+		dp_tx_desc_cache_chain(head, num, &tail);
+		dp_tx_put_desc_chain_flow_pool(pool, head, tail, num);
+		total += num;
+	}
+
+	return total;
+}
+#else
+static inline struct dp_tx_desc_s *
+dp_tx_flow_pool_cache_pop(struct dp_tx_desc_pool_s *pool)
+{
+	return NULL;
+}
+
+static inline void
+dp_tx_flow_pool_cache_refill(struct dp_tx_desc_pool_s *pool)
+{
+}
+
+static inline bool
+dp_tx_flow_pool_cache_push(struct dp_tx_desc_pool_s *pool,
+			   struct dp_tx_desc_s *tx_desc,
+			   struct dp_tx_desc_cache_elem **head,
+			   struct dp_tx_desc_cache_elem **tail,
+			   uint16_t *num)
+{
+	*num = 0;
+	return false;
+}
+
+static inline uint16_t
+dp_tx_flow_pool_cache_drain(struct dp_tx_desc_pool_s *pool)
+{
+	return 0;
+}
+#endif /* DP_TX_DESC_PERCPU_CACHE */
+
 #ifdef QCA_AC_BASED_FLOW_CONTROL
 
 /**
@@ -307,17 +870,27 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 	enum netif_reason_type reason;
 
 	if (qdf_likely(pool)) {
-		qdf_spin_lock_bh(&pool->flow_pool_lock);
+		tx_desc = dp_tx_flow_pool_cache_pop(pool);
+		if (qdf_likely(tx_desc)) {
+			dp_tx_flow_pool_desc_set_allocated(tx_desc,
+							   desc_pool_id);
+			return tx_desc;
+		}
+
+		dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool),
+				     &pool->flow_pool_lock);
 		if (qdf_likely(pool->avail_desc &&
 		    pool->status != FLOW_POOL_INVALID &&
 		    pool->status != FLOW_POOL_INACTIVE)) {
 			tx_desc = dp_tx_get_desc_flow_pool(pool);
-			tx_desc->pool_id = desc_pool_id;
-			tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
-			dp_tx_desc_set_magic(tx_desc,
-					     DP_TX_MAGIC_PATTERN_INUSE);
+			dp_tx_flow_pool_desc_set_allocated(tx_desc,
+							   desc_pool_id);
 			is_pause = dp_tx_is_threshold_reached(pool,
 							      pool->avail_desc);
+			if (qdf_unlikely(is_pause) &&
+			    dp_tx_flow_pool_cache_drain(pool))
+				is_pause = dp_tx_is_threshold_reached(
+						pool, pool->avail_desc);
 
 			if (qdf_unlikely(pool->status ==
 					 FLOW_POOL_ACTIVE_UNPAUSED_REATTACH)) {
@@ -371,6 +944,8 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 						      act,
 						      reason);
 				}
+			} else {
+				dp_tx_flow_pool_cache_refill(pool);
 			}
 		} else {
 			pool->pkt_drop_no_desc++;
@@ -397,17 +972,24 @@ dp_tx_desc_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
 		uint8_t desc_pool_id)
 {
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
-	qdf_time_t unpause_time = qdf_get_system_timestamp(), pause_dur;
+	struct dp_tx_desc_cache_elem *head, *tail;
+	qdf_time_t unpause_time, pause_dur;
 	enum netif_action_type act = WLAN_WAKE_ALL_NETIF_QUEUE;
 	enum netif_reason_type reason;
+	uint16_t num;
 
-	qdf_spin_lock_bh(&pool->flow_pool_lock);
-	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
-	tx_desc->nbuf = NULL;
-	tx_desc->flags = 0;
-	dp_tx_desc_set_magic(tx_desc, DP_TX_MAGIC_PATTERN_FREE);
-	tx_desc->timestamp = 0;
-	dp_tx_put_desc_flow_pool(pool, tx_desc);
+	dp_tx_flow_pool_desc_set_free(tx_desc);
+	if (dp_tx_flow_pool_cache_push(pool, tx_desc, &head, &tail, &num) &&
+	    qdf_likely(!num))
+		return;
+
+	unpause_time = qdf_get_system_timestamp();
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool),
+			     &pool->flow_pool_lock);
+	if (num)
+		dp_tx_put_desc_chain_flow_pool(pool, head, tail, num);
+	else
+		dp_tx_put_desc_flow_pool(pool, tx_desc);
 	switch (pool->status) {
 	case FLOW_POOL_ACTIVE_PAUSED:
 		if (pool->avail_desc > pool->start_th[DP_TH_HI]) {
@@ -513,14 +1095,26 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
 
 	if (pool) {
-		qdf_spin_lock_bh(&pool->flow_pool_lock);
+		tx_desc = dp_tx_flow_pool_cache_pop(pool);
+		if (qdf_likely(tx_desc)) {
+			dp_tx_flow_pool_desc_set_allocated(tx_desc,
+							   desc_pool_id);
+			hif_pm_runtime_get_noresume(
+				soc->hif_handle,
+				RTPM_ID_DP_TX_DESC_ALLOC_FREE);
+			return tx_desc;
+		}
+
+		dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool),
+				     &pool->flow_pool_lock);
 		if (pool->status <= FLOW_POOL_ACTIVE_PAUSED &&
 		    pool->avail_desc) {
 			tx_desc = dp_tx_get_desc_flow_pool(pool);
-			tx_desc->pool_id = desc_pool_id;
-			tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
-			dp_tx_desc_set_magic(tx_desc,
-					     DP_TX_MAGIC_PATTERN_INUSE);
+			dp_tx_flow_pool_desc_set_allocated(tx_desc,
+							   desc_pool_id);
+			if (qdf_unlikely(pool->avail_desc < pool->stop_th))
+				dp_tx_flow_pool_cache_drain(pool);
+
 			if (qdf_unlikely(pool->avail_desc < pool->stop_th)) {
 				pool->status = FLOW_POOL_ACTIVE_PAUSED;
 				qdf_spin_unlock_bh(&pool->flow_pool_lock);
@@ -529,6 +1123,7 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 					       WLAN_STOP_ALL_NETIF_QUEUE,
 					       WLAN_DATA_FLOW_CONTROL);
 			} else {
+				dp_tx_flow_pool_cache_refill(pool);
 				qdf_spin_unlock_bh(&pool->flow_pool_lock);
 			}
 
@@ -568,14 +1163,20 @@ dp_tx_desc_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
 		uint8_t desc_pool_id)
 {
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
-
-	qdf_spin_lock_bh(&pool->flow_pool_lock);
-	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
-	tx_desc->nbuf = NULL;
-	tx_desc->flags = 0;
-	dp_tx_desc_set_magic(tx_desc, DP_TX_MAGIC_PATTERN_FREE);
-	tx_desc->timestamp = 0;
-	dp_tx_put_desc_flow_pool(pool, tx_desc);
+	struct dp_tx_desc_cache_elem *head, *tail;
+	uint16_t num;
+
+	dp_tx_flow_pool_desc_set_free(tx_desc);
+	if (dp_tx_flow_pool_cache_push(pool, tx_desc, &head, &tail, &num) &&
+	    qdf_likely(!num))
+		goto out;
+
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool),
+			     &pool->flow_pool_lock);
+	if (num)
+		dp_tx_put_desc_chain_flow_pool(pool, head, tail, num);
+	else
+		dp_tx_put_desc_flow_pool(pool, tx_desc);
 	switch (pool->status) {
 	case FLOW_POOL_ACTIVE_PAUSED:
 		if (pool->avail_desc > pool->start_th) {
@@ -670,8 +1271,17 @@ static inline struct dp_tx_desc_s *dp_tx_desc_alloc(struct dp_soc *soc,
 {
 	struct dp_tx_desc_s *tx_desc = NULL;
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
+	struct dp_tx_desc_cache_pool *cache = DP_TX_DESC_POOL_CACHE(pool);
+	struct dp_tx_desc_cache_elem *tail = NULL;
+	uint16_t num;
+
+	tx_desc = dp_tx_desc_cache_pop(cache);
+	if (qdf_likely(tx_desc)) {
+		tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
+		return tx_desc;
+	}
 
-	TX_DESC_LOCK_LOCK(&pool->lock);
+	dp_tx_desc_pool_lock(cache, &pool->lock);
 
 	tx_desc = pool->freelist;
 
@@ -681,14 +1291,22 @@ static inline struct dp_tx_desc_s *dp_tx_desc_alloc(struct dp_soc *soc,
 		return NULL;
 	}
 
-	pool->freelist = pool->freelist->next;
-	pool->num_allocated++;
-	pool->num_free--;
-
-	tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
+	/* Refill the magazine along with the descriptor being allocated */
+	num = dp_tx_desc_cache_chain(tx_desc,
+				     dp_tx_desc_cache_enabled(cache) ?
+				     DP_TX_DESC_CACHE_BATCH + 1 : 1,
+				     &tail);
+	pool->freelist = (struct dp_tx_desc_s *)tail->next;
+	pool->num_allocated += num;
+	pool->num_free -= num;
 
 	TX_DESC_LOCK_UNLOCK(&pool->lock);
 
+	if (num > 1)
+		dp_tx_desc_cache_fill(cache, tx_desc->next, tail, num - 1);
+
+	tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
+
 	return tx_desc;
 }
 
@@ -699,7 +1317,10 @@ static inline struct dp_tx_desc_s *dp_tx_desc_alloc(struct dp_soc *soc,
  * @pool_id: pool id should pick up
  * @num_requested: number of required descriptor
  *
- * allocate multiple tx descriptor and make a link
+ * allocate multiple tx descriptor and make a link. The magazine of the
+ * current CPU is used up first and the rest comes from the pool. As in
+ * dp_tx_desc_alloc(), a magazine is only ever taken from by its own CPU,
+ * so descriptors cached on other CPUs do not count as available.
  *
  * Return: h_desc first descriptor pointer
  */
@@ -707,37 +1328,71 @@ static inline struct dp_tx_desc_s *dp_tx_desc_alloc_multiple(
 		struct dp_soc *soc, uint8_t desc_pool_id, uint8_t num_requested)
 {
 	struct dp_tx_desc_s *c_desc = NULL, *h_desc = NULL;
-	uint8_t count;
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
+	struct dp_tx_desc_cache_pool *cache_pool = DP_TX_DESC_POOL_CACHE(pool);
+	struct dp_tx_desc_cache_elem *tail = NULL;
+	struct dp_tx_desc_cache *cache;
+	uint16_t num_cached = 0;
+	uint16_t num = 0;
+	uint8_t count;
+
+	qdf_local_bh_disable();
+	cache = dp_tx_desc_cache_get(cache_pool);
+	if (cache)
+		num_cached = cache->count;
 
-	TX_DESC_LOCK_LOCK(&pool->lock);
+	dp_tx_desc_pool_lock(cache_pool, &pool->lock);
 
 	if ((num_requested == 0) ||
-			(pool->num_free < num_requested)) {
+			(pool->num_free + num_cached < num_requested)) {
 		TX_DESC_LOCK_UNLOCK(&pool->lock);
+		qdf_local_bh_enable();
 		QDF_TRACE(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_ERROR,
-			"%s, No Free Desc: Available(%d) num_requested(%d)",
-			__func__, pool->num_free,
+			"%s, No Free Desc: Available(%d) Cached(%d) num_requested(%d)",
+			__func__, pool->num_free, num_cached,
 			num_requested);
 		return NULL;
 	}
 
-	h_desc = pool->freelist;
+	if (num_cached) {
+		h_desc = (struct dp_tx_desc_s *)cache->freelist;
+		num = dp_tx_desc_cache_chain(h_desc,
+					     qdf_min(num_cached,
+						     (uint16_t)num_requested),
+					     &tail);
+		cache->freelist = tail->next;
+		cache->count = num_cached - num;
+		cache->hit += num;
+	}
 
-	/* h_desc should never be NULL since num_free > requested */
-	qdf_assert_always(h_desc);
+	if (num < num_requested) {
+		c_desc = pool->freelist;
 
-	c_desc = h_desc;
-	for (count = 0; count < (num_requested - 1); count++) {
-		c_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
-		c_desc = c_desc->next;
+		/* c_desc should never be NULL since num_free > requested */
+		qdf_assert_always(c_desc);
+
+		if (tail)
+			tail->next = (struct dp_tx_desc_cache_elem *)c_desc;
+		else
+			h_desc = c_desc;
+
+		for (count = num + 1; count < num_requested; count++)
+			c_desc = c_desc->next;
+
+		pool->num_free -= num_requested - num;
+		pool->num_allocated += num_requested - num;
+		pool->freelist = c_desc->next;
+		c_desc->next = NULL;
+	} else {
+		tail->next = NULL;
 	}
-	pool->num_free -= count;
-	pool->num_allocated += count;
-	pool->freelist = c_desc->next;
-	c_desc->next = NULL;
 
 	TX_DESC_LOCK_UNLOCK(&pool->lock);
+	qdf_local_bh_enable();
+
+	for (c_desc = h_desc; c_desc; c_desc = c_desc->next)
+		c_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
+
 	return h_desc;
 }
 
@@ -753,21 +1408,49 @@ dp_tx_desc_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
 		uint8_t desc_pool_id)
 {
 	struct dp_tx_desc_pool_s *pool = NULL;
+	struct dp_tx_desc_cache_elem *head, *tail;
+	uint16_t num;
+
 	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
 	tx_desc->nbuf = NULL;
 	tx_desc->flags = 0;
 
 	pool = &soc->tx_desc[desc_pool_id];
-	TX_DESC_LOCK_LOCK(&pool->lock);
-	tx_desc->next = pool->freelist;
-	pool->freelist = tx_desc;
-	pool->num_allocated--;
-	pool->num_free++;
+	num = dp_tx_desc_cache_push(DP_TX_DESC_POOL_CACHE(pool), tx_desc,
+				    &head, &tail);
+	if (qdf_likely(!num))
+		return;
+
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool), &pool->lock);
+	tail->next = (struct dp_tx_desc_cache_elem *)pool->freelist;
+	pool->freelist = (struct dp_tx_desc_s *)head;
+	pool->num_allocated -= num;
+	pool->num_free += num;
 	TX_DESC_LOCK_UNLOCK(&pool->lock);
 }
 
 #endif /* QCA_LL_TX_FLOW_CONTROL_V2 */
 
+/**
+ * dp_tx_desc_pool_num_in_use() - Number of descriptors handed out by a pool
+ * @pool: tx descriptor pool
+ *
+ * num_allocated also counts the free descriptors parked in the per-CPU
+ * magazines, which are left out here.
+ *
+ * Return: number of descriptors in use
+ */
+static inline uint32_t
+dp_tx_desc_pool_num_in_use(struct dp_tx_desc_pool_s *pool)
+{
+	uint32_t cached = dp_tx_desc_cache_count(DP_TX_DESC_POOL_CACHE(pool));
+
+	if (pool->num_allocated < cached)
+		return 0;
+
+	return pool->num_allocated - cached;
+}
+
 #ifdef QCA_DP_TX_DESC_ID_CHECK
 /**
  * dp_tx_is_desc_id_valid() - check is the tx desc id valid
@@ -903,18 +1586,33 @@ static inline
 struct dp_tx_ext_desc_elem_s *dp_tx_ext_desc_alloc(struct dp_soc *soc,
 		uint8_t desc_pool_id)
 {
+	struct dp_tx_ext_desc_pool_s *pool = &soc->tx_ext_desc[desc_pool_id];
 	struct dp_tx_ext_desc_elem_s *c_elem;
+	struct dp_tx_desc_cache_pool *cache = DP_TX_DESC_POOL_CACHE(pool);
+	struct dp_tx_desc_cache_elem *tail = NULL;
+	uint16_t num;
+
+	c_elem = dp_tx_desc_cache_pop(cache);
+	if (qdf_likely(c_elem))
+		return c_elem;
 
-	qdf_spin_lock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
-	if (soc->tx_ext_desc[desc_pool_id].num_free <= 0) {
-		qdf_spin_unlock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
+	dp_tx_desc_pool_lock(cache, &pool->lock);
+	if (pool->num_free <= 0) {
+		qdf_spin_unlock_bh(&pool->lock);
 		return NULL;
 	}
-	c_elem = soc->tx_ext_desc[desc_pool_id].freelist;
-	soc->tx_ext_desc[desc_pool_id].freelist =
-		soc->tx_ext_desc[desc_pool_id].freelist->next;
-	soc->tx_ext_desc[desc_pool_id].num_free--;
-	qdf_spin_unlock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
+	c_elem = pool->freelist;
+	num = dp_tx_desc_cache_chain(c_elem,
+				     dp_tx_desc_cache_enabled(cache) ?
+				     DP_TX_DESC_CACHE_BATCH + 1 : 1,
+				     &tail);
+	pool->freelist = (struct dp_tx_ext_desc_elem_s *)tail->next;
+	pool->num_free -= num;
+	qdf_spin_unlock_bh(&pool->lock);
+
+	if (num > 1)
+		dp_tx_desc_cache_fill(cache, c_elem->next, tail, num - 1);
+
 	return c_elem;
 }
 
@@ -929,12 +1627,20 @@ struct dp_tx_ext_desc_elem_s *dp_tx_ext_desc_alloc(struct dp_soc *soc,
 static inline void dp_tx_ext_desc_free(struct dp_soc *soc,
 	struct dp_tx_ext_desc_elem_s *elem, uint8_t desc_pool_id)
 {
-	qdf_spin_lock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
-	elem->next = soc->tx_ext_desc[desc_pool_id].freelist;
-	soc->tx_ext_desc[desc_pool_id].freelist = elem;
-	soc->tx_ext_desc[desc_pool_id].num_free++;
-	qdf_spin_unlock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
-	return;
+	struct dp_tx_ext_desc_pool_s *pool = &soc->tx_ext_desc[desc_pool_id];
+	struct dp_tx_desc_cache_elem *head, *tail;
+	uint16_t num;
+
+	num = dp_tx_desc_cache_push(DP_TX_DESC_POOL_CACHE(pool), elem,
+				    &head, &tail);
+	if (qdf_likely(!num))
+		return;
+
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool), &pool->lock);
+	tail->next = (struct dp_tx_desc_cache_elem *)pool->freelist;
+	pool->freelist = (struct dp_tx_ext_desc_elem_s *)head;
+	pool->num_free += num;
+	qdf_spin_unlock_bh(&pool->lock);
 }
 
 /**
@@ -951,6 +1657,7 @@ static inline void dp_tx_ext_desc_free_multiple(struct dp_soc *soc,
 		struct dp_tx_ext_desc_elem_s *elem, uint8_t desc_pool_id,
 		uint8_t num_free)
 {
+	struct dp_tx_ext_desc_pool_s *pool = &soc->tx_ext_desc[desc_pool_id];
 	struct dp_tx_ext_desc_elem_s *head, *tail, *c_elem;
 	uint8_t freed = num_free;
 
@@ -969,11 +1676,11 @@ static inline void dp_tx_ext_desc_free_multiple(struct dp_soc *soc,
 	/* caller should always guarantee atleast list of num_free nodes */
 	qdf_assert_always(tail);
 
-	qdf_spin_lock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
-	tail->next = soc->tx_ext_desc[desc_pool_id].freelist;
-	soc->tx_ext_desc[desc_pool_id].freelist = head;
-	soc->tx_ext_desc[desc_pool_id].num_free += num_free;
-	qdf_spin_unlock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool), &pool->lock);
+	tail->next = pool->freelist;
+	pool->freelist = head;
+	pool->num_free += num_free;
+	qdf_spin_unlock_bh(&pool->lock);
 
 	return;
 }
@@ -992,16 +1699,30 @@ static inline void dp_tx_ext_desc_free_multiple(struct dp_soc *soc,
 static inline struct qdf_tso_seg_elem_t *dp_tx_tso_desc_alloc(
 		struct dp_soc *soc, uint8_t pool_id)
 {
+	struct dp_tx_tso_seg_pool_s *pool = &soc->tx_tso_desc[pool_id];
 	struct qdf_tso_seg_elem_t *tso_seg = NULL;
-
-	qdf_spin_lock_bh(&soc->tx_tso_desc[pool_id].lock);
-	if (soc->tx_tso_desc[pool_id].freelist) {
-		soc->tx_tso_desc[pool_id].num_free--;
-		tso_seg = soc->tx_tso_desc[pool_id].freelist;
-		soc->tx_tso_desc[pool_id].freelist =
-			soc->tx_tso_desc[pool_id].freelist->next;
+	struct dp_tx_desc_cache_pool *cache = DP_TX_DESC_POOL_CACHE(pool);
+	struct dp_tx_desc_cache_elem *tail = NULL;
+	uint16_t num = 0;
+
+	tso_seg = dp_tx_desc_cache_pop(cache);
+	if (qdf_likely(tso_seg))
+		return tso_seg;
+
+	dp_tx_desc_pool_lock(cache, &pool->lock);
+	if (pool->freelist) {
+		tso_seg = pool->freelist;
+		num = dp_tx_desc_cache_chain(tso_seg,
+					     dp_tx_desc_cache_enabled(cache) ?
+					     DP_TX_DESC_CACHE_BATCH + 1 : 1,
+					     &tail);
+		pool->freelist = (struct qdf_tso_seg_elem_t *)tail->next;
+		pool->num_free -= num;
 	}
-	qdf_spin_unlock_bh(&soc->tx_tso_desc[pool_id].lock);
+	qdf_spin_unlock_bh(&pool->lock);
+
+	if (num > 1)
+		dp_tx_desc_cache_fill(cache, tso_seg->next, tail, num - 1);
 
 	return tso_seg;
 }
@@ -1020,27 +1741,50 @@ static inline struct qdf_tso_seg_elem_t *dp_tx_tso_desc_alloc(
 static inline void dp_tx_tso_desc_free(struct dp_soc *soc,
 		uint8_t pool_id, struct qdf_tso_seg_elem_t *tso_seg)
 {
-	qdf_spin_lock_bh(&soc->tx_tso_desc[pool_id].lock);
-	tso_seg->next = soc->tx_tso_desc[pool_id].freelist;
-	soc->tx_tso_desc[pool_id].freelist = tso_seg;
-	soc->tx_tso_desc[pool_id].num_free++;
-	qdf_spin_unlock_bh(&soc->tx_tso_desc[pool_id].lock);
+	struct dp_tx_tso_seg_pool_s *pool = &soc->tx_tso_desc[pool_id];
+	struct dp_tx_desc_cache_elem *head, *tail;
+	uint16_t num;
+
+	num = dp_tx_desc_cache_push(DP_TX_DESC_POOL_CACHE(pool), tso_seg,
+				    &head, &tail);
+	if (qdf_likely(!num))
+		return;
+
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool), &pool->lock);
+	tail->next = (struct dp_tx_desc_cache_elem *)pool->freelist;
+	pool->freelist = (struct qdf_tso_seg_elem_t *)head;
+	pool->num_free += num;
+	qdf_spin_unlock_bh(&pool->lock);
 }
 
 static inline
 struct qdf_tso_num_seg_elem_t  *dp_tso_num_seg_alloc(struct dp_soc *soc,
 		uint8_t pool_id)
 {
+	struct dp_tx_tso_num_seg_pool_s *pool = &soc->tx_tso_num_seg[pool_id];
 	struct qdf_tso_num_seg_elem_t *tso_num_seg = NULL;
-
-	qdf_spin_lock_bh(&soc->tx_tso_num_seg[pool_id].lock);
-	if (soc->tx_tso_num_seg[pool_id].freelist) {
-		soc->tx_tso_num_seg[pool_id].num_free--;
-		tso_num_seg = soc->tx_tso_num_seg[pool_id].freelist;
-		soc->tx_tso_num_seg[pool_id].freelist =
-			soc->tx_tso_num_seg[pool_id].freelist->next;
+	struct dp_tx_desc_cache_pool *cache = DP_TX_DESC_POOL_CACHE(pool);
+	struct dp_tx_desc_cache_elem *tail = NULL;
+	uint16_t num = 0;
+
+	tso_num_seg = dp_tx_desc_cache_pop(cache);
+	if (qdf_likely(tso_num_seg))
+		return tso_num_seg;
+
+	dp_tx_desc_pool_lock(cache, &pool->lock);
+	if (pool->freelist) {
+		tso_num_seg = pool->freelist;
+		num = dp_tx_desc_cache_chain(tso_num_seg,
+					     dp_tx_desc_cache_enabled(cache) ?
+					     DP_TX_DESC_CACHE_BATCH + 1 : 1,
+					     &tail);
+		pool->freelist = (struct qdf_tso_num_seg_elem_t *)tail->next;
+		pool->num_free -= num;
 	}
-	qdf_spin_unlock_bh(&soc->tx_tso_num_seg[pool_id].lock);
+	qdf_spin_unlock_bh(&pool->lock);
+
+	if (num > 1)
+		dp_tx_desc_cache_fill(cache, tso_num_seg->next, tail, num - 1);
 
 	return tso_num_seg;
 }
@@ -1049,11 +1793,20 @@ static inline
 void dp_tso_num_seg_free(struct dp_soc *soc,
 		uint8_t pool_id, struct qdf_tso_num_seg_elem_t *tso_num_seg)
 {
-	qdf_spin_lock_bh(&soc->tx_tso_num_seg[pool_id].lock);
-	tso_num_seg->next = soc->tx_tso_num_seg[pool_id].freelist;
-	soc->tx_tso_num_seg[pool_id].freelist = tso_num_seg;
-	soc->tx_tso_num_seg[pool_id].num_free++;
-	qdf_spin_unlock_bh(&soc->tx_tso_num_seg[pool_id].lock);
+	struct dp_tx_tso_num_seg_pool_s *pool = &soc->tx_tso_num_seg[pool_id];
+	struct dp_tx_desc_cache_elem *head, *tail;
+	uint16_t num;
+
+	num = dp_tx_desc_cache_push(DP_TX_DESC_POOL_CACHE(pool), tso_num_seg,
+				    &head, &tail);
+	if (qdf_likely(!num))
+		return;
+
+	dp_tx_desc_pool_lock(DP_TX_DESC_POOL_CACHE(pool), &pool->lock);
+	tail->next = (struct dp_tx_desc_cache_elem *)pool->freelist;
+	pool->freelist = (struct qdf_tso_num_seg_elem_t *)head;
+	pool->num_free += num;
+	qdf_spin_unlock_bh(&pool->lock);
 }
 #endif
 
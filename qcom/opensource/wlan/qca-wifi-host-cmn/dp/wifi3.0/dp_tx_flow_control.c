@@ -417,9 +417,11 @@ int dp_tx_delete_flow_pool(struct dp_soc *soc, struct dp_tx_desc_pool_s *pool,
 		return -EAGAIN;
 	}
 
+	pool_status = pool->status;
+	/* Stop magazine frees before pulling magazine held descs back */
+	pool->status = FLOW_POOL_INVALID;
+	dp_tx_flow_pool_cache_drain(pool);
 	if (pool->avail_desc < pool->pool_size) {
-		pool_status = pool->status;
-		pool->status = FLOW_POOL_INVALID;
 		dp_tx_flow_ctrl_reset_subqueues(soc, pool, pool_status);
 
 		qdf_spin_unlock_bh(&pool->flow_pool_lock);
@@ -85,28 +85,30 @@ static void
 dp_peer_age_mec_entries(struct dp_soc *soc)
 {
 	uint32_t index;
-	struct dp_mec_entry *mecentry, *mecentry_next;
+	struct dp_mec_entry *mecentry;
+	struct qdf_hlist_node *mecentry_next;
 
 	TAILQ_HEAD(, dp_mec_entry) free_list;
 	TAILQ_INIT(&free_list);
 
 	for (index = 0; index <= soc->mec_hash.mask; index++) {
-		qdf_spin_lock_bh(&soc->mec_lock);
+		if (qdf_hlist_empty(&soc->mec_hash.bins[index]))
+			continue;
+
+		dp_peer_mec_bucket_lock(soc, index);
 		/*
 		 * Expire MEC entry every n sec.
 		 */
-		if (!TAILQ_EMPTY(&soc->mec_hash.bins[index])) {
-			TAILQ_FOREACH_SAFE(mecentry, &soc->mec_hash.bins[index],
-					   hash_list_elem, mecentry_next) {
-				if (mecentry->is_active) {
-					mecentry->is_active = FALSE;
-					continue;
-				}
-				dp_peer_mec_detach_entry(soc, mecentry,
-							 &free_list);
+		qdf_hlist_for_each_entry_safe(mecentry, mecentry_next,
+					      &soc->mec_hash.bins[index],
+					      hash_list_elem) {
+			if (mecentry->is_active) {
+				mecentry->is_active = FALSE;
+				continue;
 			}
+			dp_peer_mec_detach_entry(soc, mecentry, &free_list);
 		}
-		qdf_spin_unlock_bh(&soc->mec_lock);
+		dp_peer_mec_bucket_unlock(soc, index);
 	}
 
 	dp_peer_mec_free_list(soc, &free_list);
@@ -133,6 +133,194 @@ static inline void dp_wds_ext_peer_learn(struct dp_soc *soc,
 }
 #endif
 
+/**
+ * dp_rx_wds_ast_lock() - take soc->ast_lock from the rx WDS learning path
+ * @soc: core txrx main context
+ *
+ * Return: void
+ */
+static inline void dp_rx_wds_ast_lock(struct dp_soc *soc)
+{
+	if (!qdf_spin_trylock_bh(&soc->ast_lock)) {
+		qdf_spin_lock_bh(&soc->ast_lock);
+		DP_STATS_INC(soc, ast_lock.contended, 1);
+	}
+	DP_STATS_INC(soc, ast_lock.acquired, 1);
+}
+
+/**
+ * dp_rx_wds_ast_exists() - lockless check for an AST entry of a WDS source
+ * @soc: core txrx main context
+ * @pdev: pdev the frame was received on
+ * @wds_src_mac: source mac address of the frame
+ *
+ * dp_peer_add_ast() returns without change for a WDS type entry when an
+ * entry already exists for the mac, so check that under RCU first and
+ * skip taking soc->ast_lock for every frame of a known source.
+ *
+ * Return: true if an AST entry exists for @wds_src_mac
+ */
+static inline bool dp_rx_wds_ast_exists(struct dp_soc *soc,
+					struct dp_pdev *pdev,
+					uint8_t *wds_src_mac)
+{
+	struct dp_ast_entry *ast;
+
+	qdf_rcu_read_lock();
+	if (soc->ast_override_support)
+		ast = dp_peer_ast_hash_find_by_pdevid(soc, wds_src_mac,
+						      pdev->pdev_id);
+	else
+		ast = dp_peer_ast_hash_find_soc(soc, wds_src_mac);
+	qdf_rcu_read_unlock();
+
+	return !!ast;
+}
+
+/**
+ * dp_rx_wds_ast_mark_active() - update the active flag of an AST entry
+ *				 found by HW SA index
+ * @soc: core txrx main context
+ * @ast: AST entry read from soc->ast_table under qdf_rcu_read_lock()
+ * @sa_idx: HW SA index @ast was read from
+ * @is_active: active flag
+ *
+ * Only the lock of the entry's hash bucket is taken. Deleting an entry
+ * unhashes it under the same lock, so an entry still hashed here is live.
+ *
+ * Return: QDF_STATUS_SUCCESS if the flag was updated
+ */
+static inline QDF_STATUS dp_rx_wds_ast_mark_active(struct dp_soc *soc,
+						   struct dp_ast_entry *ast,
+						   uint16_t sa_idx,
+						   bool is_active)
+{
+	QDF_STATUS status = QDF_STATUS_E_FAILURE;
+
+	dp_peer_ast_bucket_lock(soc, ast);
+
+	/*
+	 * Ensure we are updating the right AST entry by
+	 * validating ast_idx.
+	 * There is a possibility we might arrive here without
+	 * AST MAP event , so this check is mandatory
+	 */
+	if (qdf_hlist_unhashed(&ast->hash_list_elem)) {
+		status = QDF_STATUS_E_NULL_VALUE;
+	} else if (!ast->is_mapped) {
+		status = QDF_STATUS_E_INVAL;
+	} else if (ast->ast_idx == sa_idx) {
+		ast->is_active = is_active;
+		status = QDF_STATUS_SUCCESS;
+	}
+
+	dp_peer_ast_bucket_unlock(soc, ast);
+
+	return status;
+}
+
+/**
+ * dp_rx_wds_ast_roam() - handle a WDS source seen behind a different peer
+ * @soc: core txrx main context
+ * @ta_peer: WDS repeater peer
+ * @nbuf: rx pkt
+ * @sa_idx: source-address index for peer
+ * @flags: AST flags
+ *
+ * Moving the entry to @ta_peer changes the per peer AST lists, so this
+ * path still serializes on soc->ast_lock and looks the entry up again.
+ *
+ * Return: void
+ */
+static inline void
+dp_rx_wds_ast_roam(struct dp_soc *soc, struct dp_peer *ta_peer,
+		   qdf_nbuf_t nbuf, uint16_t sa_idx, uint32_t flags)
+{
+	struct dp_peer *sa_peer;
+	struct dp_ast_entry *ast;
+	uint16_t sa_peer_id;
+	uint8_t wds_src_mac[QDF_MAC_ADDR_SIZE];
+
+	dp_rx_wds_ast_lock(soc);
+	ast = soc->ast_table[sa_idx];
+
+	/* the entry went away or was replaced since the lockless lookup */
+	if (!ast || (ast->type == CDP_TXRX_AST_TYPE_WDS_HM) ||
+	    (ast->type == CDP_TXRX_AST_TYPE_WDS_HM_SEC)) {
+		qdf_spin_unlock_bh(&soc->ast_lock);
+		return;
+	}
+
+	if ((ast->type != CDP_TXRX_AST_TYPE_STATIC) &&
+	    (ast->type != CDP_TXRX_AST_TYPE_SELF) &&
+	    (ast->type != CDP_TXRX_AST_TYPE_STA_BSS)) {
+		if (ast->pdev_id != ta_peer->vdev->pdev->pdev_id) {
+			/* This case is when a STA roams from one
+			 * repeater to another repeater, but these
+			 * repeaters are connected to root AP on
+			 * different radios.
+			 * Ex: rptr1 connected to ROOT AP over 5G
+			 * and rptr2 connected to ROOT AP over 2G
+			 * radio
+			 */
+			dp_peer_del_ast(soc, ast);
+		} else {
+			/* this case is when a STA roams from one
+			 * reapter to another repeater, but inside
+			 * same radio.
+			 */
+			/* For HKv2 do not update the AST entry if
+			 * new ta_peer is on STA vap as SRC port
+			 * learning is disable on STA vap
+			 */
+			if (soc->ast_override_support &&
+			    (ta_peer->vdev->opmode == wlan_op_mode_sta)) {
+				dp_peer_del_ast(soc, ast);
+			} else {
+				dp_wds_ext_peer_learn(soc, ta_peer);
+				dp_peer_update_ast(soc, ta_peer, ast, flags);
+			}
+			qdf_spin_unlock_bh(&soc->ast_lock);
+			return;
+		}
+	}
+	/*
+	 * Do not kickout STA if it belongs to a different radio.
+	 * For DBDC repeater, it is possible to arrive here
+	 * for multicast loopback frames originated from connected
+	 * clients and looped back (intrabss) by Root AP
+	 */
+	if (ast->pdev_id != ta_peer->vdev->pdev->pdev_id) {
+		qdf_spin_unlock_bh(&soc->ast_lock);
+		return;
+	}
+
+	sa_peer_id = ast->peer_id;
+	qdf_spin_unlock_bh(&soc->ast_lock);
+	/*
+	 * Kickout, when direct associated peer(SA) roams
+	 * to another AP and reachable via TA peer
+	 */
+	sa_peer = dp_peer_get_ref_by_id(soc, sa_peer_id, DP_MOD_ID_RX);
+	if (!sa_peer)
+		return;
+
+	if ((sa_peer->vdev->opmode == wlan_op_mode_ap) &&
+	    !sa_peer->delete_in_progress) {
+		qdf_mem_copy(wds_src_mac,
+			     (qdf_nbuf_data(nbuf) + QDF_MAC_ADDR_SIZE),
+			     QDF_MAC_ADDR_SIZE);
+		sa_peer->delete_in_progress = true;
+		if (soc->cdp_soc.ol_ops->peer_sta_kickout) {
+			soc->cdp_soc.ol_ops->peer_sta_kickout(
+				soc->ctrl_psoc,
+				sa_peer->vdev->pdev->pdev_id,
+				wds_src_mac);
+		}
+	}
+	dp_peer_unref_delete(sa_peer, DP_MOD_ID_RX);
+}
+
 /**
  * dp_rx_wds_add_or_update_ast() - Add or update the ast entry.
  *
@@ -153,7 +341,6 @@ dp_rx_wds_add_or_update_ast(struct dp_soc *soc, struct dp_peer *ta_peer,
 			    uint8_t is_sa_valid, uint8_t is_chfrag_start,
 			    uint16_t sa_idx, uint16_t sa_sw_peer_id)
 {
-	struct dp_peer *sa_peer;
 	struct dp_ast_entry *ast;
 	uint32_t flags = DP_AST_FLAGS_HM;
 	uint32_t ret = 0;
@@ -189,6 +376,9 @@ dp_rx_wds_add_or_update_ast(struct dp_soc *soc, struct dp_peer *ta_peer,
 			     QDF_MAC_ADDR_SIZE);
 
 		dp_wds_ext_peer_learn(soc, ta_peer);
+		if (dp_rx_wds_ast_exists(soc, pdev, wds_src_mac))
+			return;
+
 		ret = dp_peer_add_ast(soc,
 				      ta_peer,
 				      wds_src_mac,
@@ -197,11 +387,11 @@ dp_rx_wds_add_or_update_ast(struct dp_soc *soc, struct dp_peer *ta_peer,
 		return;
 	}
 
-	qdf_spin_lock_bh(&soc->ast_lock);
+	qdf_rcu_read_lock();
 	ast = soc->ast_table[sa_idx];
 
 	if (!ast) {
-		qdf_spin_unlock_bh(&soc->ast_lock);
+		qdf_rcu_read_unlock();
 		/*
 		 * In HKv1, it is possible that HW retains the AST entry in
 		 * GSE cache on 1 radio , even after the AST entry is deleted
@@ -244,93 +434,15 @@ dp_rx_wds_add_or_update_ast(struct dp_soc *soc, struct dp_peer *ta_peer,
 
 	if ((ast->type == CDP_TXRX_AST_TYPE_WDS_HM) ||
 	    (ast->type == CDP_TXRX_AST_TYPE_WDS_HM_SEC)) {
-		qdf_spin_unlock_bh(&soc->ast_lock);
+		qdf_rcu_read_unlock();
 		return;
 	}
 
-	/*
-	 * Ensure we are updating the right AST entry by
-	 * validating ast_idx.
-	 * There is a possibility we might arrive here without
-	 * AST MAP event , so this check is mandatory
-	 */
-	if (ast->is_mapped && (ast->ast_idx == sa_idx))
-		ast->is_active = TRUE;
-
-	if (sa_sw_peer_id != ta_peer->peer_id) {
-
-		if ((ast->type != CDP_TXRX_AST_TYPE_STATIC) &&
-		    (ast->type != CDP_TXRX_AST_TYPE_SELF) &&
-		    (ast->type != CDP_TXRX_AST_TYPE_STA_BSS)) {
-			if (ast->pdev_id != ta_peer->vdev->pdev->pdev_id) {
-				/* This case is when a STA roams from one
-				 * repeater to another repeater, but these
-				 * repeaters are connected to root AP on
-				 * different radios.
-				 * Ex: rptr1 connected to ROOT AP over 5G
-				 * and rptr2 connected to ROOT AP over 2G
-				 * radio
-				 */
-				dp_peer_del_ast(soc, ast);
-			} else {
-				/* this case is when a STA roams from one
-				 * reapter to another repeater, but inside
-				 * same radio.
-				 */
-				/* For HKv2 do not update the AST entry if
-				 * new ta_peer is on STA vap as SRC port
-				 * learning is disable on STA vap
-				 */
-				if (soc->ast_override_support &&
-				    (ta_peer->vdev->opmode == wlan_op_mode_sta)) {
-					dp_peer_del_ast(soc, ast);
-				} else {
-					dp_wds_ext_peer_learn(soc, ta_peer);
-					dp_peer_update_ast(soc, ta_peer, ast, flags);
-				}
-				qdf_spin_unlock_bh(&soc->ast_lock);
-				return;
-			}
-		}
-		/*
-		 * Do not kickout STA if it belongs to a different radio.
-		 * For DBDC repeater, it is possible to arrive here
-		 * for multicast loopback frames originated from connected
-		 * clients and looped back (intrabss) by Root AP
-		 */
-		if (ast->pdev_id != ta_peer->vdev->pdev->pdev_id) {
-			qdf_spin_unlock_bh(&soc->ast_lock);
-			return;
-		}
-
-		qdf_spin_unlock_bh(&soc->ast_lock);
-		/*
-		 * Kickout, when direct associated peer(SA) roams
-		 * to another AP and reachable via TA peer
-		 */
-		sa_peer = dp_peer_get_ref_by_id(soc, ast->peer_id,
-						DP_MOD_ID_RX);
-		if (!sa_peer)
-			return;
+	dp_rx_wds_ast_mark_active(soc, ast, sa_idx, true);
+	qdf_rcu_read_unlock();
 
-		if ((sa_peer->vdev->opmode == wlan_op_mode_ap) &&
-		    !sa_peer->delete_in_progress) {
-			qdf_mem_copy(wds_src_mac,
-				     (qdf_nbuf_data(nbuf) + QDF_MAC_ADDR_SIZE),
-				     QDF_MAC_ADDR_SIZE);
-			sa_peer->delete_in_progress = true;
-			if (soc->cdp_soc.ol_ops->peer_sta_kickout) {
-				soc->cdp_soc.ol_ops->peer_sta_kickout(
-					soc->ctrl_psoc,
-					sa_peer->vdev->pdev->pdev_id,
-					wds_src_mac);
-			}
-		}
-		dp_peer_unref_delete(sa_peer, DP_MOD_ID_RX);
-		return;
-	}
-
-	qdf_spin_unlock_bh(&soc->ast_lock);
+	if (sa_sw_peer_id != ta_peer->peer_id)
+		dp_rx_wds_ast_roam(soc, ta_peer, nbuf, sa_idx, flags);
 }
 
 /**
@@ -383,33 +495,19 @@ static inline QDF_STATUS dp_rx_ast_set_active(struct dp_soc *soc,
 					      uint16_t sa_idx, bool is_active)
 {
 	struct dp_ast_entry *ast;
+	QDF_STATUS status;
 
-	qdf_spin_lock_bh(&soc->ast_lock);
+	qdf_rcu_read_lock();
 	ast = soc->ast_table[sa_idx];
 
 	if (!ast) {
-		qdf_spin_unlock_bh(&soc->ast_lock);
+		qdf_rcu_read_unlock();
 		return QDF_STATUS_E_NULL_VALUE;
 	}
 
-	if (!ast->is_mapped) {
-		qdf_spin_unlock_bh(&soc->ast_lock);
-		return QDF_STATUS_E_INVAL;
-	}
+	status = dp_rx_wds_ast_mark_active(soc, ast, sa_idx, is_active);
+	qdf_rcu_read_unlock();
 
-	/*
-	 * Ensure we are updating the right AST entry by
-	 * validating ast_idx.
-	 * There is a possibility we might arrive here without
-	 * AST MAP event , so this check is mandatory
-	 */
-	if (ast->ast_idx == sa_idx) {
-		ast->is_active = is_active;
-		qdf_spin_unlock_bh(&soc->ast_lock);
-		return QDF_STATUS_SUCCESS;
-	}
-
-	qdf_spin_unlock_bh(&soc->ast_lock);
-	return QDF_STATUS_E_FAILURE;
+	return status;
 }
 #endif /* DP_TXRX_WDS*/
@@ -27,6 +27,8 @@
 #include <qdf_util.h>
 #include <qdf_list.h>
 #include <qdf_lro.h>
+#include <qdf_rcu.h>
+#include <qdf_debugfs.h>
 #include <queue.h>
 #include <htt_common.h>
 #include <htt.h>
@@ -155,6 +157,8 @@
 #define DP_RX_REFILL_BUFF_POOL_SIZE  2048
 #define DP_RX_REFILL_BUFF_POOL_BURST 64
 #define DP_RX_REFILL_THRD_THRESHOLD  512
+#define DP_RX_REFILL_BUFF_POOL_RECYCLE_MAX 256
+#define DP_RX_REFILL_BUFF_POOL_PAGES 4096
 #endif
 
 #ifdef WLAN_VENDOR_SPECIFIC_BAR_UPDATE
@@ -254,6 +258,13 @@ enum dp_mod_id {
 
 #define DP_MUTEX_TYPE qdf_spinlock_t
 
+/*
+ * Number of writer locks the peer, AST and MEC hash tables are striped over.
+ * Bucket i is protected by lock (i & (DP_HASH_LOCK_STRIPES - 1)); readers
+ * do not take these locks and walk the buckets under RCU instead.
+ */
+#define DP_HASH_LOCK_STRIPES 32
+
 #define DP_FRAME_IS_MULTICAST(_a)  (*(_a) & 0x01)
 #define DP_FRAME_IS_IPV4_MULTICAST(_a)  (*(_a) == 0x01)
 
@@ -503,6 +514,56 @@ struct dp_tx_ext_desc_elem_s {
 	struct qdf_tso_num_seg_elem_t *tso_num_desc;
 };
 
+/* Free elements a CPU magazine may hold before returning a batch */
+#define DP_TX_DESC_CACHE_DEPTH 32
+/* Elements moved between a CPU magazine and its pool per refill/flush */
+#define DP_TX_DESC_CACHE_BATCH 16
+
+/**
+ * struct dp_tx_desc_cache_elem - Generic view of a free tx pool element
+ * @next: next free element; the first member of every tx pool element
+ */
+struct dp_tx_desc_cache_elem {
+	struct dp_tx_desc_cache_elem *next;
+};
+
+/**
+ * struct dp_tx_desc_cache - Per-CPU magazine of free tx pool elements
+ * @lock: magazine lock, flow pools only; taken by the owning CPU with
+ *	  bottom halves disabled and by a flow pool drain from any CPU
+ * @freelist: chain of free elements cached on this CPU
+ * @count: number of elements in @freelist
+ * @hit: allocations served from the magazine
+ * @miss: allocations that had to refill from the pool
+ * @flush: batches returned to the pool on magazine overflow
+ *
+ * A magazine is only used by xmit and tx completion on its own CPU with
+ * bottom halves disabled, so other tx pools access it without a lock.
+ * Magazines are cache line aligned so neighbouring CPUs never share a line.
+ */
+struct dp_tx_desc_cache {
+	qdf_spinlock_t lock;
+	struct dp_tx_desc_cache_elem *freelist;
+	uint16_t count;
+	uint32_t hit;
+	uint32_t miss;
+	uint32_t flush;
+} __attribute__((aligned(QDF_CACHE_LINE_SZ)));
+
+/**
+ * struct dp_tx_desc_cache_pool - Per-CPU magazines fronting one tx pool
+ * @cpu: @num_cpu magazines, NULL if the allocation failed at pool init
+ * @num_cpu: number of magazines, nr_cpu_ids at pool init
+ * @lock_acquired: number of times the pool lock was taken
+ * @lock_contended: number of times the pool lock was found busy
+ */
+struct dp_tx_desc_cache_pool {
+	struct dp_tx_desc_cache *cpu;
+	uint32_t num_cpu;
+	uint32_t lock_acquired;
+	uint32_t lock_contended;
+};
+
 /**
  * struct dp_tx_ext_desc_s - Tx Extension Descriptor Pool
  * @elem_count: Number of descriptors in the pool
@@ -513,6 +574,7 @@ struct dp_tx_ext_desc_elem_s {
  * @link_elem_size: size of the link descriptor in cacheable memory used for
  * 		    chaining the extension descriptors
  * @desc_link_pages: multiple page allocation information for link descriptors
+ * @cache: per-CPU magazines fronting @freelist
  */
 struct dp_tx_ext_desc_pool_s {
 	uint16_t elem_count;
@@ -524,6 +586,9 @@ struct dp_tx_ext_desc_pool_s {
 	struct dp_tx_ext_desc_elem_s *freelist;
 	qdf_spinlock_t lock;
 	qdf_dma_mem_context(memctx);
+#ifdef DP_TX_DESC_PERCPU_CACHE
+	struct dp_tx_desc_cache_pool cache;
+#endif
 };
 
 /**
@@ -623,6 +688,7 @@ enum flow_pool_status {
  * @freelist: first free element pointer
  * @desc_pages: multiple page allocation information for actual descriptors
  * @lock: lock for accessing the pool
+ * @cache: per-CPU magazines fronting @freelist
  */
 struct dp_tx_tso_seg_pool_s {
 	uint16_t pool_size;
@@ -630,6 +696,9 @@ struct dp_tx_tso_seg_pool_s {
 	struct qdf_tso_seg_elem_t *freelist;
 	struct qdf_mem_multi_page_t desc_pages;
 	qdf_spinlock_t lock;
+#ifdef DP_TX_DESC_PERCPU_CACHE
+	struct dp_tx_desc_cache_pool cache;
+#endif
 };
 
 /**
@@ -639,6 +708,7 @@ struct dp_tx_tso_seg_pool_s {
  * @freelist: first free element pointer
  * @desc_pages: multiple page allocation information for actual descriptors
  * @lock: lock for accessing the pool
+ * @cache: per-CPU magazines fronting @freelist
  */
 
 struct dp_tx_tso_num_seg_pool_s {
@@ -648,6 +718,9 @@ struct dp_tx_tso_num_seg_pool_s {
 	struct qdf_mem_multi_page_t desc_pages;
 	/*tso mutex */
 	qdf_spinlock_t lock;
+#ifdef DP_TX_DESC_PERCPU_CACHE
+	struct dp_tx_desc_cache_pool cache;
+#endif
 };
 
 /**
@@ -662,12 +735,17 @@ struct dp_tx_tso_num_seg_pool_s {
  * @flow_pool_array_lock: Lock when operating on flow_pool_array.
  * @flow_pool_array: List of allocated flow pools
  * @lock- Lock for descriptor allocation/free from/to the pool
+ * @cache: per-CPU magazines fronting @freelist; with flow control V2 the
+ *	   descriptors they hold are charged against @avail_desc
  */
 struct dp_tx_desc_pool_s {
 	uint16_t elem_size;
 	uint32_t num_allocated;
 	struct dp_tx_desc_s *freelist;
 	struct qdf_mem_multi_page_t desc_pages;
+#ifdef DP_TX_DESC_PERCPU_CACHE
+	struct dp_tx_desc_cache_pool cache;
+#endif
 #ifdef QCA_LL_TX_FLOW_CONTROL_V2
 	uint16_t pool_size;
 	uint8_t flow_pool_id;
@@ -991,6 +1069,15 @@ struct dp_soc_stats {
 		uint32_t deleted;
 	} mec;
 
+	/*
+	 * Writer side acquisitions of the striped hash table locks, and of
+	 * the AST lock from the rx WDS source port learning path
+	 */
+	struct {
+		uint32_t acquired;
+		uint32_t contended;
+	} peer_hash_lock, mec_lock, ast_hash_lock, ast_lock;
+
 	/* SOC level TX stats */
 	struct {
 		/* Total packets transmitted */
@@ -1231,6 +1318,7 @@ struct dp_ast_free_cb_params {
  * @callback: ast free/unmap callback
  * @cookie: argument to callback
  * @hash_list_elem: node in soc AST hash list (mac address used as hash)
+ * @rcu: head used to defer freeing until lockless readers are done
  */
 struct dp_ast_entry {
 	uint16_t ast_idx;
@@ -1248,7 +1336,8 @@ struct dp_ast_entry {
 	txrx_ast_free_cb callback;
 	void *cookie;
 	TAILQ_ENTRY(dp_ast_entry) ase_list_elem;
-	TAILQ_ENTRY(dp_ast_entry) hash_list_elem;
+	struct qdf_hlist_node hash_list_elem;
+	struct qdf_rcu_head rcu;
 };
 
 /*
@@ -1260,6 +1349,8 @@ struct dp_ast_entry {
  * @pdev_id: pdev ID
  * @vdev_id: vdev ID
  * @hash_list_elem: node in soc MEC hash list (mac address used as hash)
+ * @free_list_elem: node in the local list of entries pending free
+ * @rcu: head used to defer freeing until lockless readers are done
  */
 struct dp_mec_entry {
 	union dp_align_mac_addr mac_addr;
@@ -1267,7 +1358,9 @@ struct dp_mec_entry {
 	uint8_t pdev_id;
 	uint8_t vdev_id;
 
-	TAILQ_ENTRY(dp_mec_entry) hash_list_elem;
+	struct qdf_hlist_node hash_list_elem;
+	TAILQ_ENTRY(dp_mec_entry) free_list_elem;
+	struct qdf_rcu_head rcu;
 };
 
 /* SOC level htt stats */
@@ -1299,12 +1392,27 @@ struct rx_buff_pool {
 	bool is_initialized;
 };
 
+/**
+ * struct rx_refill_buff_pool - RX buffers pre-allocated by the refill thread
+ * @is_initialized: pool initialization status
+ * @head: producer index, advanced by the refill thread
+ * @tail: consumer index, advanced by the replenish path
+ * @dp_pdev: pdev used for stats accounting
+ * @max_bufq_len: number of slots in @buf_elem
+ * @recycle_q: buffers dropped by the driver, waiting to be put back in
+ *	       @buf_elem by the refill thread instead of being freed
+ * @page_pool: DMA mapped pages backing the buffers, NULL if the kernel has
+ *	       no page pool; pages come back still mapped whoever frees them
+ * @buf_elem: ring of allocated and DMA mapped buffers
+ */
 struct rx_refill_buff_pool {
 	bool is_initialized;
 	uint16_t head;
 	uint16_t tail;
 	struct dp_pdev *dp_pdev;
 	uint16_t max_bufq_len;
+	qdf_nbuf_queue_head_t recycle_q;
+	qdf_nbuf_page_pool_t page_pool;
 	qdf_nbuf_t buf_elem[2048];
 };
 
@@ -1482,22 +1590,78 @@ struct dp_swlm_tcl_data {
 	uint32_t pkt_len;
 };
 
+/**
+ * struct dp_swlm_reo_data - params for REO destination ring TP register
+ *			     write coalescing decision making
+ * @ring_id: REO destination ring id
+ * @num_reaped: Num ring entries reaped in the current ring access
+ */
+struct dp_swlm_reo_data {
+	uint8_t ring_id;
+	uint32_t num_reaped;
+};
+
+/**
+ * struct dp_swlm_refill_data - params for RX refill ring HP register
+ *				write coalescing decision making
+ * @ring_id: RX refill ring id (lmac id)
+ * @num_posted: Num buffers posted in the current ring access
+ * @num_used: Num ring entries holding buffers before the current ring
+ *	      access, including the ones not yet made visible to HW
+ */
+struct dp_swlm_refill_data {
+	uint8_t ring_id;
+	uint32_t num_posted;
+	uint32_t num_used;
+};
+
 /**
  * union swlm_data - SWLM query data
  * @tcl_data: data for TCL query in SWLM
+ * @reo_data: data for REO destination ring query in SWLM
+ * @refill_data: data for RX refill ring query in SWLM
  */
 union swlm_data {
 	struct dp_swlm_tcl_data *tcl_data;
+	struct dp_swlm_reo_data *reo_data;
+	struct dp_swlm_refill_data *refill_data;
 };
 
 /**
  * struct dp_swlm_ops - SWLM ops
  * @tcl_wr_coalesce_check: handler to check if the current TCL register
  *			   write can be coalesced or not
+ * @reo_wr_coalesce_check: handler to check if the current REO destination
+ *			   ring TP register write can be coalesced or not
+ * @refill_wr_coalesce_check: handler to check if the current RX refill
+ *			      ring HP register write can be coalesced or not
  */
 struct dp_swlm_ops {
 	int (*tcl_wr_coalesce_check)(struct dp_soc *soc,
 				     struct dp_swlm_tcl_data *tcl_data);
+	int (*reo_wr_coalesce_check)(struct dp_soc *soc,
+				     struct dp_swlm_reo_data *reo_data);
+	int (*refill_wr_coalesce_check)(struct dp_soc *soc,
+					struct dp_swlm_refill_data *data);
+};
+
+/**
+ * struct dp_swlm_wr_stats - Register write stats of a coalesced ring
+ * @issued: Num ring pointer register writes issued
+ * @coalesced: Num ring pointer register writes coalesced
+ * @idle_skipped: Num register writes skipped as the ring pointer did not
+ *		  move
+ * @sessions: Num coalescing sessions ended by a register write
+ * @delay_us_total: Total time the register writes were held back, in us
+ * @delay_us_max: Max time a register write was held back, in us
+ */
+struct dp_swlm_wr_stats {
+	uint32_t issued;
+	uint32_t coalesced;
+	uint32_t idle_skipped;
+	uint32_t sessions;
+	uint64_t delay_us_total;
+	uint32_t delay_us_max;
 };
 
 /**
@@ -1518,6 +1682,21 @@ struct dp_swlm_ops {
  *			   throughput did not meet session threshold
  * @tcl.coalesce_success: Num of TCL HP writes coalesced successfully.
  * @tcl.coalesce_fail: Num of TCL HP writes coalesces failed
+ * @tcl.wr: TCL HP register write stats
+ * @reo.batch_thresh_reached: Num REO TP writes flush after the reaped
+ *			      entries threshold was reached
+ * @reo.time_thresh_reached: Num REO TP writes flush after the coalescing
+ *			     session time expired
+ * @reo.wr: REO destination ring TP register write stats
+ * @refill.low_water_hit: Num refill HP writes flush since HW was left
+ *			  with too few buffers
+ * @refill.batch_thresh_reached: Num refill HP writes flush after the
+ *				 posted buffers threshold was reached
+ * @refill.time_thresh_reached: Num refill HP writes flush after the
+ *				coalescing session time expired
+ * @refill.timer_flush_success: Num refill HP writes from timer context
+ * @refill.timer_flush_fail: Num refill HP write failures from timer context
+ * @refill.wr: RX refill ring HP register write stats
  */
 struct dp_swlm_stats {
 	struct {
@@ -1531,7 +1710,38 @@ struct dp_swlm_stats {
 		uint32_t tput_criteria_fail;
 		uint32_t coalesce_success;
 		uint32_t coalesce_fail;
+		struct dp_swlm_wr_stats wr;
 	} tcl[MAX_TCL_DATA_RINGS];
+	struct {
+		uint32_t batch_thresh_reached;
+		uint32_t time_thresh_reached;
+		struct dp_swlm_wr_stats wr;
+	} reo[MAX_REO_DEST_RINGS];
+	struct {
+		uint32_t low_water_hit;
+		uint32_t batch_thresh_reached;
+		uint32_t time_thresh_reached;
+		uint32_t timer_flush_success;
+		uint32_t timer_flush_fail;
+		struct dp_swlm_wr_stats wr;
+	} refill[MAX_PDEV_CNT];
+};
+
+/**
+ * struct dp_swlm_ring_policy - Register write coalescing policy of a ring
+ * @enabled: Coalescing is enabled for the ring
+ * @batch_thresh: Num ring entries after which the coalesced register
+ *		  write is flushed (REO and refill rings)
+ * @time_flush_thresh: Time threshold in us to flush the coalesced
+ *		       register write
+ * @low_water_thresh: Min num buffers HW must hold for the refill ring
+ *		      register write to be coalesced
+ */
+struct dp_swlm_ring_policy {
+	uint8_t enabled;
+	uint32_t batch_thresh;
+	uint32_t time_flush_thresh;
+	uint32_t low_water_thresh;
 };
 
 /**
@@ -1549,6 +1759,9 @@ struct dp_swlm_stats {
  * @prev_rx_bytes: Previous RX bytes accounted
  * @expire_time: expiry time for sample
  * @tput_pass_cnt: threshold throughput pass counter
+ * @policy: coalescing policy for the ring
+ * @coalesce_start_time: Timestamp of the first coalesced write of the
+ *			 current session, 0 if no write is held back
  */
 struct dp_swlm_tcl_params {
 	struct dp_soc *soc;
@@ -1563,6 +1776,42 @@ struct dp_swlm_tcl_params {
 	uint32_t prev_rx_bytes;
 	uint64_t expire_time;
 	uint32_t tput_pass_cnt;
+	struct dp_swlm_ring_policy policy;
+	uint64_t coalesce_start_time;
+};
+
+/**
+ * struct dp_swlm_reo_params: REO destination ring parameters in the
+ *			      Software latency manager.
+ * @policy: coalescing policy for the ring
+ * @pending: Num reaped entries not yet made visible to HW
+ * @coalesce_start_time: Timestamp of the first coalesced write of the
+ *			 current session, 0 if no write is held back
+ */
+struct dp_swlm_reo_params {
+	struct dp_swlm_ring_policy policy;
+	uint32_t pending;
+	uint64_t coalesce_start_time;
+};
+
+/**
+ * struct dp_swlm_refill_params: RX refill ring parameters in the
+ *				 Software latency manager.
+ * @soc: DP soc reference
+ * @ring_id: RX refill ring id (lmac id)
+ * @flush_timer: Timer for flushing the coalesced refill HP writes
+ * @policy: coalescing policy for the ring
+ * @pending: Num posted buffers not yet made visible to HW
+ * @coalesce_start_time: Timestamp of the first coalesced write of the
+ *			 current session, 0 if no write is held back
+ */
+struct dp_swlm_refill_params {
+	struct dp_soc *soc;
+	uint32_t ring_id;
+	qdf_timer_t flush_timer;
+	struct dp_swlm_ring_policy policy;
+	uint32_t pending;
+	uint64_t coalesce_start_time;
 };
 
 /**
@@ -1580,6 +1829,8 @@ struct dp_swlm_tcl_params {
  * @tx_pkt_thresh: Threshold for TX packet count, to begin TCL register
  *		       write coalescing
  * @tcl: TCL ring specific params
+ * @reo: REO destination ring specific params
+ * @refill: RX refill ring specific params
  */
 
 struct dp_swlm_params {
@@ -1590,6 +1841,8 @@ struct dp_swlm_params {
 	uint32_t tx_thresh_multiplier;
 	uint32_t tx_pkt_thresh;
 	struct dp_swlm_tcl_params tcl[MAX_TCL_DATA_RINGS];
+	struct dp_swlm_reo_params reo[MAX_REO_DEST_RINGS];
+	struct dp_swlm_refill_params refill[MAX_PDEV_CNT];
 };
 
 /**
@@ -2002,7 +2255,7 @@ struct dp_soc {
 	struct {
 		unsigned mask;
 		unsigned idx_bits;
-		TAILQ_HEAD(, dp_peer) * bins;
+		struct qdf_hlist_head *bins;
 	} peer_hash;
 
 	/* rx defrag state – TBD: do we need this per radio? */
@@ -2038,8 +2291,8 @@ struct dp_soc {
 		qdf_dma_mem_context(memctx);
 	} me_buf;
 
-	/* Protect peer hash table */
-	DP_MUTEX_TYPE peer_hash_lock;
+	/* Protect peer hash table writers, striped by bucket index */
+	DP_MUTEX_TYPE peer_hash_lock[DP_HASH_LOCK_STRIPES];
 	/* Protect peer_id_to_objmap */
 	DP_MUTEX_TYPE peer_map_lock;
 
@@ -2072,7 +2325,7 @@ struct dp_soc {
 	struct {
 		unsigned mask;
 		unsigned idx_bits;
-		TAILQ_HEAD(, dp_ast_entry) * bins;
+		struct qdf_hlist_head *bins;
 	} ast_hash;
 
 #ifdef DP_TX_HW_DESC_HISTORY
@@ -2092,6 +2345,8 @@ struct dp_soc {
 #endif
 
 	qdf_spinlock_t ast_lock;
+	/* Protect AST hash buckets and rx entry state, striped by bucket */
+	qdf_spinlock_t ast_hash_lock[DP_HASH_LOCK_STRIPES];
 	/*Timer for AST entry ageout maintainance */
 	qdf_timer_t ast_aging_timer;
 
@@ -2256,8 +2511,8 @@ struct dp_soc {
 	qdf_nbuf_queue_t invalid_buf_queue;
 
 #ifdef FEATURE_MEC
-	/** @mec_lock: spinlock for MEC table */
-	qdf_spinlock_t mec_lock;
+	/** @mec_lock: MEC table writer locks, striped by bucket index */
+	qdf_spinlock_t mec_lock[DP_HASH_LOCK_STRIPES];
 	/** @mec_cnt: number of active mec entries */
 	qdf_atomic_t mec_cnt;
 	struct {
@@ -2266,7 +2521,7 @@ struct dp_soc {
 		/** @idx_bits: index to shift bits */
 		uint32_t idx_bits;
 		/** @bins: MEC table */
-		TAILQ_HEAD(, dp_mec_entry) * bins;
+		struct qdf_hlist_head *bins;
 	} mec_hash;
 #endif
 
@@ -3377,8 +3632,12 @@ struct dp_peer {
 
 	/* node in the vdev's list of peers */
 	TAILQ_ENTRY(dp_peer) peer_list_elem;
-	/* node in the hash table bin's list of peers */
+	/* node in the MLD hash table bin's list of peers */
 	TAILQ_ENTRY(dp_peer) hash_list_elem;
+	/* node in the soc link peer hash table bin's list of peers */
+	struct qdf_hlist_node hash_node;
+	/* defers freeing until lockless hash readers are done */
+	struct qdf_rcu_head rcu;
 
 	/* TID structures pointer */
 	struct dp_rx_tid *rx_tid;
@@ -3601,6 +3860,29 @@ enum fisa_aggr_ret {
 	FISA_FLUSH_FLOW
 };
 
+/**
+ * enum dp_fisa_flush_reason - Reason a FISA aggregate was delivered
+ * @DP_FISA_FLUSH_NEW_AGGR: HW started a new aggregation for the flow
+ * @DP_FISA_FLUSH_LEN_CHANGE: MSDU length differs from the ongoing aggregate
+ * @DP_FISA_FLUSH_ADAPTIVE: adaptive per-flow aggregation limit reached
+ * @DP_FISA_FLUSH_NAPI_END: end of the NAPI poll of the REO ring
+ * @DP_FISA_FLUSH_FORCED: vdev flush, flow eviction or fragmented MSDU
+ * @DP_FISA_FLUSH_INVALID: HW aggregation TLVs were inconsistent
+ * @DP_FISA_FLUSH_REASON_MAX: number of flush reasons
+ */
+enum dp_fisa_flush_reason {
+	DP_FISA_FLUSH_NEW_AGGR,
+	DP_FISA_FLUSH_LEN_CHANGE,
+	DP_FISA_FLUSH_ADAPTIVE,
+	DP_FISA_FLUSH_NAPI_END,
+	DP_FISA_FLUSH_FORCED,
+	DP_FISA_FLUSH_INVALID,
+	DP_FISA_FLUSH_REASON_MAX
+};
+
+/* Aggregate hold latency buckets: <100, <250, <500, <1000, <2000, >=2000 us */
+#define DP_FISA_FLUSH_LAT_HIST_MAX 6
+
 /**
  * struct fisa_pkt_hist - FISA Packet history structure
  * @tlv_hist: array of TLV history
@@ -3614,6 +3896,12 @@ struct fisa_pkt_hist {
 };
 
 struct dp_fisa_rx_sw_ft {
+	/*
+	 * Write side of the flow identity (is_populated, tuple, metadata,
+	 * napi_id, flow ids) so lookups can run without locks. Must stay the
+	 * first member, flow deletion clears everything after it.
+	 */
+	qdf_seqcount_t seq;
 	/* HAL Rx Flow Search Entry which matches HW definition */
 	void *hw_fse;
 	/* hash value */
@@ -3660,6 +3948,15 @@ struct dp_fisa_rx_sw_ft {
 	uint32_t reo_dest_indication;
 	qdf_time_t flow_init_ts;
 	qdf_time_t last_accessed_ts;
+	/* Adaptive aggregation: last packet/head skb time, EWMA of the
+	 * inter-packet gap and the resulting per-flow aggregation limit
+	 */
+	uint64_t last_pkt_ts;
+	uint64_t head_skb_ts;
+	uint32_t avg_ipg_us;
+	uint16_t aggr_limit;
+	uint32_t flush_reason_cnt[DP_FISA_FLUSH_REASON_MAX];
+	uint32_t flush_lat_hist[DP_FISA_FLUSH_LAT_HIST_MAX];
 #ifdef WLAN_SUPPORT_RX_FISA_HIST
 	struct fisa_pkt_hist pkt_hist;
 #endif
@@ -3719,6 +4016,9 @@ struct dp_rx_fst {
 	bool flow_deletion_supported;
 	bool fst_in_cmem;
 	bool pm_suspended;
+	/* debugfs per-flow stats table */
+	qdf_dentry_t debugfs_dir;
+	struct qdf_debugfs_fops flow_stats_fops;
 };
 
 #endif /* WLAN_SUPPORT_RX_FISA */
@@ -411,6 +411,8 @@ typedef struct hal_ring_handle *hal_ring_handle_t;
  * @work_scheduled_time: work scheduled time (qdf_log_timestamp)
  * @dequeue_time: dequeue time (qdf_log_timestamp)
  * @cpu_id: record cpuid when schedule work
+ * @coalesce_base: srng coalesce count at the time of enqueue
+ * @num_updates: srng updates folded into this register write
  */
 struct hal_reg_write_q_elem {
 	struct hal_srng *srng;
@@ -422,6 +424,8 @@ struct hal_reg_write_q_elem {
 	qdf_time_t work_scheduled_time;
 	qdf_time_t dequeue_time;
 	int cpu_id;
+	uint32_t coalesce_base;
+	uint32_t num_updates;
 };
 
 /**
@@ -456,6 +460,22 @@ enum hal_reg_sched_delay {
 	REG_WRITE_SCHED_DELAY_HIST_MAX,
 };
 
+/**
+ * enum hal_reg_write_coalesce - ENUM for srng updates per register write
+ * @REG_WRITE_COALESCE_1: index for writes carrying a single update
+ * @REG_WRITE_COALESCE_SUB_5: index for writes carrying 2 - 4 updates
+ * @REG_WRITE_COALESCE_SUB_17: index for writes carrying 5 - 16 updates
+ * @REG_WRITE_COALESCE_GT_16: index for writes carrying more than 16 updates
+ * @REG_WRITE_COALESCE_HIST_MAX: Max value (size of histogram array)
+ */
+enum hal_reg_write_coalesce {
+	REG_WRITE_COALESCE_1,
+	REG_WRITE_COALESCE_SUB_5,
+	REG_WRITE_COALESCE_SUB_17,
+	REG_WRITE_COALESCE_GT_16,
+	REG_WRITE_COALESCE_HIST_MAX,
+};
+
 /**
  * struct hal_reg_write_soc_stats - soc stats to keep track of register writes
  * @enqueues: writes enqueued to delayed work
@@ -466,6 +486,8 @@ enum hal_reg_sched_delay {
  * @q_depth: current queue depth in delayed register write queue
  * @max_q_depth: maximum queue for delayed register write queue
  * @sched_delay: = kernel work sched delay + bus wakeup delay, histogram
+ * @write_latency: enqueue to register write completion, histogram
+ * @coalesce_ratio: srng updates carried per register write, histogram
  * @dequeue_delay: dequeue operation be delayed
  */
 struct hal_reg_write_soc_stats {
@@ -477,6 +499,8 @@ struct hal_reg_write_soc_stats {
 	qdf_atomic_t q_depth;
 	uint32_t max_q_depth;
 	uint32_t sched_delay[REG_WRITE_SCHED_DELAY_HIST_MAX];
+	uint32_t write_latency[REG_WRITE_SCHED_DELAY_HIST_MAX];
+	uint32_t coalesce_ratio[REG_WRITE_COALESCE_HIST_MAX];
 	uint32_t dequeue_delay;
 };
 #endif
@@ -564,10 +564,12 @@ void hal_dump_reg_write_srng_stats(hal_soc_handle_t hal_soc_hdl)
 
 void hal_dump_reg_write_stats(hal_soc_handle_t hal_soc_hdl)
 {
-	uint32_t *hist;
+	uint32_t *hist, *lat, *coal;
 	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
 
 	hist = hal->stats.wstats.sched_delay;
+	lat = hal->stats.wstats.write_latency;
+	coal = hal->stats.wstats.coalesce_ratio;
 	hal_debug("wstats: enq %u deq %u coal %u direct %u q_depth %u max_q %u sched-delay hist %u %u %u %u",
 		  qdf_atomic_read(&hal->stats.wstats.enqueues),
 		  hal->stats.wstats.dequeues,
@@ -579,6 +581,15 @@ void hal_dump_reg_write_stats(hal_soc_handle_t hal_soc_hdl)
 		  hist[REG_WRITE_SCHED_DELAY_SUB_1000us],
 		  hist[REG_WRITE_SCHED_DELAY_SUB_5000us],
 		  hist[REG_WRITE_SCHED_DELAY_GT_5000us]);
+	hal_debug("wstats: write-latency hist %u %u %u %u updates-per-write hist %u %u %u %u",
+		  lat[REG_WRITE_SCHED_DELAY_SUB_100us],
+		  lat[REG_WRITE_SCHED_DELAY_SUB_1000us],
+		  lat[REG_WRITE_SCHED_DELAY_SUB_5000us],
+		  lat[REG_WRITE_SCHED_DELAY_GT_5000us],
+		  coal[REG_WRITE_COALESCE_1],
+		  coal[REG_WRITE_COALESCE_SUB_5],
+		  coal[REG_WRITE_COALESCE_SUB_17],
+		  coal[REG_WRITE_COALESCE_GT_16]);
 }
 
 int hal_get_reg_write_pending_work(void *hal_soc)
@@ -634,6 +645,8 @@ hal_process_reg_write_q_elem(struct hal_soc *hal,
 		write_val = srng->u.dst_ring.tp;
 	}
 
+	q_elem->num_updates = srng->wstats.coalesces -
+			      q_elem->coalesce_base + 1;
 	q_elem->valid = 0;
 	srng->last_dequeue_time = q_elem->dequeue_time;
 	SRNG_UNLOCK(&srng->lock);
@@ -642,27 +655,80 @@ hal_process_reg_write_q_elem(struct hal_soc *hal,
 }
 
 /**
- * hal_reg_write_fill_sched_delay_hist() - fill reg write delay histogram in hal
+ * hal_reg_write_delay_hist_idx() - reg write delay histogram bucket
+ * @delay_us: delay in us
+ *
+ * Return: enum hal_reg_sched_delay index of @delay_us
+ */
+static inline enum hal_reg_sched_delay
+hal_reg_write_delay_hist_idx(uint64_t delay_us)
+{
+	if (delay_us < 100)
+		return REG_WRITE_SCHED_DELAY_SUB_100us;
+	else if (delay_us < 1000)
+		return REG_WRITE_SCHED_DELAY_SUB_1000us;
+	else if (delay_us < 5000)
+		return REG_WRITE_SCHED_DELAY_SUB_5000us;
+	else
+		return REG_WRITE_SCHED_DELAY_GT_5000us;
+}
+
+/**
+ * hal_reg_write_fill_sched_delay_hist() - fill reg write delay histograms
+ * in hal
  * @hal: hal_soc pointer
- * @delay: delay in us
+ * @delay_us: enqueue to dequeue delay in us
+ * @latency_us: enqueue to register write completion delay in us
+ * @num_updates: srng updates carried by the register write
  *
  * Return: None
  */
 static inline void hal_reg_write_fill_sched_delay_hist(struct hal_soc *hal,
-						       uint64_t delay_us)
+						       uint64_t delay_us,
+						       uint64_t latency_us,
+						       uint32_t num_updates)
 {
-	uint32_t *hist;
+	struct hal_reg_write_soc_stats *wstats = &hal->stats.wstats;
 
-	hist = hal->stats.wstats.sched_delay;
+	wstats->sched_delay[hal_reg_write_delay_hist_idx(delay_us)]++;
+	wstats->write_latency[hal_reg_write_delay_hist_idx(latency_us)]++;
 
-	if (delay_us < 100)
-		hist[REG_WRITE_SCHED_DELAY_SUB_100us]++;
-	else if (delay_us < 1000)
-		hist[REG_WRITE_SCHED_DELAY_SUB_1000us]++;
-	else if (delay_us < 5000)
-		hist[REG_WRITE_SCHED_DELAY_SUB_5000us]++;
+	if (num_updates <= 1)
+		wstats->coalesce_ratio[REG_WRITE_COALESCE_1]++;
+	else if (num_updates < 5)
+		wstats->coalesce_ratio[REG_WRITE_COALESCE_SUB_5]++;
+	else if (num_updates < 17)
+		wstats->coalesce_ratio[REG_WRITE_COALESCE_SUB_17]++;
 	else
-		hist[REG_WRITE_SCHED_DELAY_GT_5000us]++;
+		wstats->coalesce_ratio[REG_WRITE_COALESCE_GT_16]++;
+}
+
+/**
+ * hal_reg_write_sort_batch() - order a batch of delayed writes by ring
+ * @hal: hal_soc pointer
+ * @batch: queue indices of the valid elements to write
+ * @num: number of entries in @batch
+ *
+ * A srng has at most one element queued, so writing the batch in ring id
+ * order keeps the writes to neighbouring HP/TP registers back to back
+ * without reordering the updates of any single ring.
+ *
+ * Return: None
+ */
+static void hal_reg_write_sort_batch(struct hal_soc *hal, uint8_t *batch,
+				     uint32_t num)
+{
+	struct hal_reg_write_q_elem *queue = hal->reg_write_queue;
+	uint32_t i, j;
+	uint8_t idx;
+
+	for (i = 1; i < num; i++) {
+		idx = batch[i];
+		for (j = i; j > 0 && queue[batch[j - 1]].srng->ring_id >
+				      queue[idx].srng->ring_id; j--)
+			batch[j] = batch[j - 1];
+		batch[j] = idx;
+	}
 }
 
 #ifdef SHADOW_WRITE_DELAY
@@ -734,10 +800,12 @@ static void hal_reg_write_work(void *arg)
 	int32_t q_depth, write_val;
 	struct hal_soc *hal = arg;
 	struct hal_reg_write_q_elem *q_elem;
-	uint64_t delta_us;
+	uint64_t delta_us, latency_us;
 	uint8_t ring_id;
 	uint32_t *addr;
 	uint32_t num_processed = 0;
+	uint8_t batch[HAL_REG_WRITE_QUEUE_LEN];
+	uint32_t num_batch, i, idx;
 
 	q_elem = &hal->reg_write_queue[(hal->read_idx)];
 	q_elem->work_scheduled_time = qdf_get_log_timestamp();
@@ -758,37 +826,61 @@ static void hal_reg_write_work(void *arg)
 	}
 
 	while (true) {
-		qdf_rmb();
-		if (!q_elem->valid)
+		/* Collect everything queued so far and write it ring by ring */
+		num_batch = 0;
+		idx = hal->read_idx;
+		while (num_batch < HAL_REG_WRITE_QUEUE_LEN) {
+			q_elem = &hal->reg_write_queue[idx];
+			qdf_rmb();
+			if (!q_elem->valid)
+				break;
+
+			batch[num_batch++] = idx;
+			idx = (idx + 1) & (HAL_REG_WRITE_QUEUE_LEN - 1);
+		}
+
+		if (!num_batch)
 			break;
 
-		q_elem->dequeue_time = qdf_get_log_timestamp();
-		ring_id = q_elem->srng->ring_id;
-		addr = q_elem->addr;
-		delta_us = qdf_log_timestamp_to_usecs(q_elem->dequeue_time -
-						      q_elem->enqueue_time);
-		hal_reg_write_fill_sched_delay_hist(hal, delta_us);
-
-		hal->stats.wstats.dequeues++;
-		qdf_atomic_dec(&hal->stats.wstats.q_depth);
-
-		if (hal_reg_write_need_delay(q_elem))
-			hal_verbose_debug("Delay reg writer for srng 0x%x, addr 0x%pK",
-					  q_elem->srng->ring_id, q_elem->addr);
-
-		write_val = hal_process_reg_write_q_elem(hal, q_elem);
-		hal_verbose_debug("read_idx %u srng 0x%x, addr 0x%pK dequeue_val %u sched delay %llu us",
-				  hal->read_idx, ring_id, addr, write_val, delta_us);
-
-		qdf_trace_dp_del_reg_write(ring_id, q_elem->enqueue_val,
-					   q_elem->dequeue_val,
-					   q_elem->enqueue_time,
-					   q_elem->dequeue_time);
-
-		num_processed++;
-		hal->read_idx = (hal->read_idx + 1) &
-					(HAL_REG_WRITE_QUEUE_LEN - 1);
-		q_elem = &hal->reg_write_queue[(hal->read_idx)];
+		hal_reg_write_sort_batch(hal, batch, num_batch);
+
+		for (i = 0; i < num_batch; i++) {
+			q_elem = &hal->reg_write_queue[batch[i]];
+			q_elem->dequeue_time = qdf_get_log_timestamp();
+			ring_id = q_elem->srng->ring_id;
+			addr = q_elem->addr;
+			delta_us = qdf_log_timestamp_to_usecs(
+					q_elem->dequeue_time -
+					q_elem->enqueue_time);
+
+			hal->stats.wstats.dequeues++;
+			qdf_atomic_dec(&hal->stats.wstats.q_depth);
+
+			if (hal_reg_write_need_delay(q_elem))
+				hal_verbose_debug("Delay reg writer for srng 0x%x, addr 0x%pK",
+						  q_elem->srng->ring_id,
+						  q_elem->addr);
+
+			write_val = hal_process_reg_write_q_elem(hal, q_elem);
+			latency_us = qdf_log_timestamp_to_usecs(
+					qdf_get_log_timestamp() -
+					q_elem->enqueue_time);
+			hal_reg_write_fill_sched_delay_hist(
+					hal, delta_us, latency_us,
+					q_elem->num_updates);
+			hal_verbose_debug("read_idx %u srng 0x%x, addr 0x%pK dequeue_val %u sched delay %llu us",
+					  batch[i], ring_id, addr, write_val,
+					  delta_us);
+
+			qdf_trace_dp_del_reg_write(ring_id,
+						   q_elem->enqueue_val,
+						   q_elem->dequeue_val,
+						   q_elem->enqueue_time,
+						   q_elem->dequeue_time);
+		}
+
+		num_processed += num_batch;
+		hal->read_idx = idx;
 	}
 
 	hif_allow_link_low_power_states(hal->hif_handle);
@@ -863,6 +955,7 @@ static void hal_reg_write_enqueue(struct hal_soc *hal_soc,
 	q_elem->addr = addr;
 	q_elem->enqueue_val = value;
 	q_elem->enqueue_time = qdf_get_log_timestamp();
+	q_elem->coalesce_base = srng->wstats.coalesces;
 
 	/*
 	 * Before the valid flag is set to true, all the other
@@ -985,6 +985,27 @@ static inline bool hif_exec_should_yield(struct hif_opaque_softc *hif_ctx,
 }
 #endif
 
+#if defined(WLAN_FEATURE_RX_SOFTIRQ_TIME_LIMIT) && \
+	defined(HIF_EXEC_ADAPTIVE_BUDGET)
+/**
+ * hif_exec_update_backlog() - report the ring backlog seen by a napi poll
+ * @hif_ctx - HIF opaque context
+ * @grp_id - grp_id of the napi doing the poll
+ * @num_pending - ring entries still pending after the poll reaped the ring
+ *
+ * The backlog is one of the inputs of the adaptive NAPI budget controller.
+ *
+ * Return: None
+ */
+void hif_exec_update_backlog(struct hif_opaque_softc *hif_ctx, uint grp_id,
+			     uint32_t num_pending);
+#else
+static inline void hif_exec_update_backlog(struct hif_opaque_softc *hif_ctx,
+					   uint grp_id, uint32_t num_pending)
+{
+}
+#endif
+
 void hif_disable_isr(struct hif_opaque_softc *hif_ctx);
 void hif_reset_soc(struct hif_opaque_softc *hif_ctx);
 void hif_save_htc_htt_config_endpoint(struct hif_opaque_softc *hif_ctx,
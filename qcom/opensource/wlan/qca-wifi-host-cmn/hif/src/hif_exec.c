@@ -328,6 +328,229 @@ void hif_exec_fill_poll_time_histogram(struct hif_exec_context *hif_ext_group)
 	++napi_stat->poll_time_buckets[bucket];
 }
 
+#ifdef HIF_EXEC_ADAPTIVE_BUDGET
+/* weight of a new sample in the poll time averages, 1/8 */
+#define HIF_EXEC_BUDGET_AVG_SHIFT 3
+
+/**
+ * hif_exec_get_yield_duration() - time slice of a NAPI poll
+ * @hif_ext_group: hif_ext_group of type NAPI
+ * @cfg: hif config
+ *
+ * Return: poll duration in nanoseconds after which the NAPI should yield
+ */
+static inline unsigned long long
+hif_exec_get_yield_duration(struct hif_exec_context *hif_ext_group,
+			    struct hif_config_info *cfg)
+{
+	if (hif_ext_group->budget_ctrl.yield_ns)
+		return hif_ext_group->budget_ctrl.yield_ns;
+
+	return cfg->rx_softirq_max_yield_duration_ns;
+}
+
+/**
+ * hif_exec_get_poll_budget() - internal budget handed to a NAPI poll
+ * @hif_ext_group: hif_ext_group of type NAPI
+ * @normalized_budget: internal budget granted by the NAPI budget
+ *
+ * Return: internal budget for the poll, never above @normalized_budget
+ */
+static inline int
+hif_exec_get_poll_budget(struct hif_exec_context *hif_ext_group,
+			 int normalized_budget)
+{
+	return hif_exec_budget_ctrl_get(&hif_ext_group->budget_ctrl,
+					normalized_budget);
+}
+
+int hif_exec_budget_ctrl_get(struct hif_exec_budget_ctrl *ctrl,
+			     int normalized_budget)
+{
+	if (normalized_budget <= 0)
+		return normalized_budget;
+
+	if (!ctrl->budget || ctrl->budget > (uint32_t)normalized_budget)
+		ctrl->budget = normalized_budget;
+
+	return ctrl->budget;
+}
+
+qdf_export_symbol(hif_exec_budget_ctrl_get);
+
+void hif_exec_update_backlog(struct hif_opaque_softc *hif_ctx, uint grp_id,
+			     uint32_t num_pending)
+{
+	struct hif_softc *scn = HIF_GET_SOFTC(hif_ctx);
+	struct HIF_CE_state *hif_state = HIF_GET_CE_STATE(scn);
+	struct hif_exec_context *hif_ext_group;
+
+	if (!(grp_id < hif_state->hif_num_extgroup) ||
+	    !(grp_id < HIF_MAX_GROUP))
+		return;
+
+	hif_ext_group = hif_state->hif_ext_group[grp_id];
+	if (num_pending > hif_ext_group->budget_ctrl.backlog)
+		hif_ext_group->budget_ctrl.backlog = num_pending;
+}
+
+qdf_export_symbol(hif_exec_update_backlog);
+
+void hif_exec_budget_ctrl_update(struct hif_exec_budget_ctrl *ctrl,
+				 unsigned long long limit_ns,
+				 unsigned long long ts,
+				 unsigned long long poll_ns, bool force_break,
+				 int work_done, int poll_budget,
+				 int normalized_budget)
+{
+	struct hif_exec_budget_decision *rec;
+	unsigned long long overrun_ns, yield_ns;
+	uint32_t budget = ctrl->budget;
+	uint8_t action = HIF_EXEC_BUDGET_SHRINK;
+
+	if (poll_budget <= 0)
+		return;
+
+	yield_ns = ctrl->yield_ns ? ctrl->yield_ns : limit_ns;
+	overrun_ns = (force_break && poll_ns > yield_ns) ?
+		     poll_ns - yield_ns : 0;
+
+	ctrl->avg_poll_ns += (poll_ns >> HIF_EXEC_BUDGET_AVG_SHIFT) -
+			     (ctrl->avg_poll_ns >> HIF_EXEC_BUDGET_AVG_SHIFT);
+	ctrl->avg_overrun_ns += (overrun_ns >> HIF_EXEC_BUDGET_AVG_SHIFT) -
+				(ctrl->avg_overrun_ns >>
+				 HIF_EXEC_BUDGET_AVG_SHIFT);
+
+	if (ctrl->avg_overrun_ns < limit_ns - (limit_ns >> 2))
+		ctrl->yield_ns = limit_ns - ctrl->avg_overrun_ns;
+	else
+		ctrl->yield_ns = limit_ns >> 2;
+
+	if (force_break || ctrl->avg_poll_ns > limit_ns) {
+		budget -= budget >> 2;
+		if (budget < HIF_EXEC_MIN_BUDGET)
+			budget = qdf_min(HIF_EXEC_MIN_BUDGET,
+					 normalized_budget);
+		action = HIF_EXEC_BUDGET_SHRINK;
+	} else if ((work_done >= poll_budget || ctrl->backlog) &&
+		   ctrl->avg_poll_ns < (limit_ns >> 1)) {
+		budget += (normalized_budget >> 3) + 1;
+		if (budget > (uint32_t)normalized_budget)
+			budget = normalized_budget;
+		action = HIF_EXEC_BUDGET_GROW;
+	}
+
+	if (budget != ctrl->budget) {
+		if (action == HIF_EXEC_BUDGET_GROW)
+			ctrl->grows++;
+		else
+			ctrl->shrinks++;
+
+		rec = &ctrl->hist[ctrl->hist_idx++ &
+				  (HIF_EXEC_BUDGET_HIST_SIZE - 1)];
+		rec->ts = ts;
+		rec->poll_us = qdf_do_div(poll_ns, 1000);
+		rec->work_done = work_done;
+		rec->backlog = ctrl->backlog;
+		rec->budget = budget;
+		rec->yield_us = qdf_do_div(ctrl->yield_ns, 1000);
+		rec->action = action;
+		ctrl->budget = budget;
+	}
+
+	ctrl->backlog = 0;
+}
+
+qdf_export_symbol(hif_exec_budget_ctrl_update);
+
+/**
+ * hif_exec_update_poll_budget() - run the budget controller after a poll
+ * @hif_ext_group: hif_ext_group of type NAPI
+ * @work_done: work done by the poll
+ * @poll_budget: internal budget the poll ran with
+ * @normalized_budget: internal budget granted by the NAPI budget
+ *
+ * Return: None
+ */
+static void hif_exec_update_poll_budget(struct hif_exec_context *hif_ext_group,
+					int work_done, int poll_budget,
+					int normalized_budget)
+{
+	struct hif_softc *scn = HIF_GET_SOFTC(hif_ext_group->hif);
+	unsigned long long limit_ns, poll_ns;
+
+	limit_ns = scn->hif_config.rx_softirq_max_yield_duration_ns;
+	poll_ns = qdf_time_sched_clock() - hif_ext_group->poll_start_time;
+	hif_exec_budget_ctrl_update(&hif_ext_group->budget_ctrl, limit_ns,
+				    hif_ext_group->poll_start_time, poll_ns,
+				    hif_ext_group->force_break, work_done,
+				    poll_budget, normalized_budget);
+}
+
+/**
+ * hif_exec_print_budget_stats() - print the budget controller state
+ * @grp_id: exec context index
+ * @hif_ext_group: hif_ext_group of type NAPI
+ *
+ * Return: None
+ */
+static void hif_exec_print_budget_stats(int grp_id,
+					struct hif_exec_context *hif_ext_group)
+{
+	struct hif_exec_budget_ctrl *ctrl = &hif_ext_group->budget_ctrl;
+	struct hif_exec_budget_decision *rec;
+	uint32_t i, num;
+
+	if (!ctrl->budget)
+		return;
+
+	QDF_TRACE(QDF_MODULE_ID_HIF, QDF_TRACE_LEVEL_INFO_HIGH,
+		  "NAPI[%d] budget %u yield(us) %llu avg poll(us) %llu grows %u shrinks %u",
+		  grp_id, ctrl->budget, qdf_do_div(ctrl->yield_ns, 1000),
+		  qdf_do_div(ctrl->avg_poll_ns, 1000),
+		  ctrl->grows, ctrl->shrinks);
+
+	num = qdf_min(ctrl->hist_idx, (uint32_t)HIF_EXEC_BUDGET_HIST_SIZE);
+	for (i = ctrl->hist_idx - num; i != ctrl->hist_idx; i++) {
+		rec = &ctrl->hist[i & (HIF_EXEC_BUDGET_HIST_SIZE - 1)];
+		QDF_TRACE(QDF_MODULE_ID_HIF, QDF_TRACE_LEVEL_INFO_HIGH,
+			  "NAPI[%d] %llu %s poll(us) %u work %u backlog %u -> budget %u yield(us) %u",
+			  grp_id, rec->ts,
+			  rec->action == HIF_EXEC_BUDGET_GROW ?
+			  "grow" : "shrink",
+			  rec->poll_us, rec->work_done, rec->backlog,
+			  rec->budget, rec->yield_us);
+	}
+}
+#else
+static inline unsigned long long
+hif_exec_get_yield_duration(struct hif_exec_context *hif_ext_group,
+			    struct hif_config_info *cfg)
+{
+	return cfg->rx_softirq_max_yield_duration_ns;
+}
+
+static inline int
+hif_exec_get_poll_budget(struct hif_exec_context *hif_ext_group,
+			 int normalized_budget)
+{
+	return normalized_budget;
+}
+
+static inline
+void hif_exec_update_poll_budget(struct hif_exec_context *hif_ext_group,
+				 int work_done, int poll_budget,
+				 int normalized_budget)
+{
+}
+
+static inline
+void hif_exec_print_budget_stats(int grp_id,
+				 struct hif_exec_context *hif_ext_group)
+{
+}
+#endif /* HIF_EXEC_ADAPTIVE_BUDGET */
+
 /**
  * hif_exec_poll_should_yield() - Local function deciding if NAPI should yield
  * @hif_ext_group: hif_ext_group of type NAPI
@@ -344,7 +567,8 @@ static bool hif_exec_poll_should_yield(struct hif_exec_context *hif_ext_group)
 
 	poll_time_ns = qdf_time_sched_clock() - hif_ext_group->poll_start_time;
 	time_limit_reached =
-		poll_time_ns > cfg->rx_softirq_max_yield_duration_ns ? 1 : 0;
+		poll_time_ns > hif_exec_get_yield_duration(hif_ext_group, cfg) ?
+		1 : 0;
 
 	if (time_limit_reached) {
 		hif_ext_group->stats[cpu_id].time_limit_reached++;
@@ -430,6 +654,8 @@ void hif_print_napi_stats(struct hif_opaque_softc *hif_ctx)
 					     1000),
 				  hist_str);
 		}
+
+		hif_exec_print_budget_stats(i, hif_ext_group);
 	}
 
 	hif_print_napi_latency_stats(hif_state);
@@ -455,6 +681,20 @@ void hif_exec_fill_poll_time_histogram(struct hif_exec_context *hif_ext_group)
 {
 }
 
+static inline int
+hif_exec_get_poll_budget(struct hif_exec_context *hif_ext_group,
+			 int normalized_budget)
+{
+	return normalized_budget;
+}
+
+static inline
+void hif_exec_update_poll_budget(struct hif_exec_context *hif_ext_group,
+				 int work_done, int poll_budget,
+				 int normalized_budget)
+{
+}
+
 void hif_print_napi_stats(struct hif_opaque_softc *hif_ctx)
 {
 	struct HIF_CE_state *hif_state = HIF_GET_CE_STATE(hif_ctx);
@@ -613,6 +853,7 @@ static int hif_exec_poll(struct napi_struct *napi, int budget)
 	struct hif_softc *scn = HIF_GET_SOFTC(hif_ext_group->hif);
 	int work_done;
 	int normalized_budget = 0;
+	int poll_budget;
 	int actual_dones;
 	int shift = hif_ext_group->scale_bin_shift;
 	int cpu = smp_processor_id();
@@ -627,21 +868,24 @@ static int hif_exec_poll(struct napi_struct *napi, int budget)
 	if (budget)
 		normalized_budget = NAPI_BUDGET_TO_INTERNAL_BUDGET(budget, shift);
 
+	poll_budget = hif_exec_get_poll_budget(hif_ext_group,
+					       normalized_budget);
+
 	hif_latency_profile_measure(hif_ext_group);
 
 	work_done = hif_ext_group->handler(hif_ext_group->context,
-					   normalized_budget);
+					   poll_budget);
 
 	actual_dones = work_done;
 
 	if (hif_is_force_napi_complete_required(hif_ext_group)) {
 		force_complete = true;
-		if (work_done >= normalized_budget)
-			work_done = normalized_budget - 1;
+		if (work_done >= poll_budget)
+			work_done = poll_budget - 1;
 	}
 
 	if (qdf_unlikely(force_complete) ||
-	    (!hif_ext_group->force_break && work_done < normalized_budget)) {
+	    (!hif_ext_group->force_break && work_done < poll_budget)) {
 		hif_record_event(hif_ext_group->hif, hif_ext_group->grp_id,
 				 0, 0, 0, HIF_EVENT_BH_COMPLETE);
 		napi_complete(napi);
@@ -664,6 +908,8 @@ static int hif_exec_poll(struct napi_struct *napi, int budget)
 		work_done = INTERNAL_BUDGET_TO_NAPI_BUDGET(work_done, shift);
 
 	hif_exec_fill_poll_time_histogram(hif_ext_group);
+	hif_exec_update_poll_budget(hif_ext_group, actual_dones, poll_budget,
+				    normalized_budget);
 
 	return work_done;
 }
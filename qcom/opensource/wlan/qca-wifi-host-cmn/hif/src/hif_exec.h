@@ -41,6 +41,106 @@
 /*Buckets for latency between 250 to 500 ms*/
 #define HIF_SCHED_LATENCY_BUCKET_251_500 500
 
+#ifdef HIF_EXEC_ADAPTIVE_BUDGET
+/* number of budget controller decisions kept per exec context */
+#define HIF_EXEC_BUDGET_HIST_SIZE 8
+/* smallest internal budget the controller hands to a poll */
+#define HIF_EXEC_MIN_BUDGET 16
+
+/**
+ * enum hif_exec_budget_action - budget controller decision
+ * @HIF_EXEC_BUDGET_GROW: budget was increased
+ * @HIF_EXEC_BUDGET_SHRINK: budget was decreased
+ */
+enum hif_exec_budget_action {
+	HIF_EXEC_BUDGET_GROW,
+	HIF_EXEC_BUDGET_SHRINK,
+};
+
+/**
+ * struct hif_exec_budget_decision - record of a budget controller decision
+ * @ts: time of the decision in nanoseconds
+ * @poll_us: duration of the poll which triggered the decision
+ * @work_done: work done by the poll
+ * @backlog: ring backlog reported during the poll
+ * @budget: internal budget after the decision
+ * @yield_us: time slice after the decision
+ * @action: enum hif_exec_budget_action
+ */
+struct hif_exec_budget_decision {
+	unsigned long long ts;
+	uint32_t poll_us;
+	uint32_t work_done;
+	uint32_t backlog;
+	uint32_t budget;
+	uint32_t yield_us;
+	uint8_t action;
+};
+
+/**
+ * struct hif_exec_budget_ctrl - closed loop NAPI budget controller
+ * @budget: internal budget handed to the next poll, 0 until the first poll
+ * @yield_ns: time slice after which the poll yields, 0 until the first poll
+ * @avg_poll_ns: moving average of the poll time
+ * @avg_overrun_ns: moving average of the poll time past the time slice
+ * @backlog: largest ring backlog reported during the current poll
+ * @grows: number of budget increases
+ * @shrinks: number of budget decreases
+ * @hist_idx: free running index in @hist
+ * @hist: last budget decisions
+ */
+struct hif_exec_budget_ctrl {
+	uint32_t budget;
+	unsigned long long yield_ns;
+	unsigned long long avg_poll_ns;
+	unsigned long long avg_overrun_ns;
+	uint32_t backlog;
+	uint32_t grows;
+	uint32_t shrinks;
+	uint32_t hist_idx;
+	struct hif_exec_budget_decision hist[HIF_EXEC_BUDGET_HIST_SIZE];
+};
+
+/**
+ * hif_exec_budget_ctrl_get() - internal budget handed to the next poll
+ * @ctrl: budget controller of the exec context
+ * @normalized_budget: internal budget granted by the NAPI budget
+ *
+ * Return: internal budget for the poll, never above @normalized_budget
+ */
+int hif_exec_budget_ctrl_get(struct hif_exec_budget_ctrl *ctrl,
+			     int normalized_budget);
+
+/**
+ * hif_exec_budget_ctrl_update() - run the budget controller after a poll
+ * @ctrl: budget controller of the exec context
+ * @limit_ns: rx_softirq_max_yield_duration_ns
+ * @ts: start time of the poll in nanoseconds
+ * @poll_ns: duration of the poll
+ * @force_break: the poll yielded with work left
+ * @work_done: work done by the poll
+ * @poll_budget: internal budget the poll ran with
+ * @normalized_budget: internal budget granted by the NAPI budget
+ *
+ * The goal is to keep every poll within @limit_ns. The yield check only runs
+ * between ring reaps, so the time slice is pulled in by the average overrun
+ * past it. The budget is cut by a quarter when a poll had to yield or polls
+ * run long on average. It grows by an eighth of the granted budget while the
+ * budget is used up or the rings still hold a backlog, as long as polls stay
+ * under half of the time limit. The budget never leaves
+ * [HIF_EXEC_MIN_BUDGET, @normalized_budget], the floor being lowered to
+ * @normalized_budget when less is granted.
+ *
+ * Return: None
+ */
+void hif_exec_budget_ctrl_update(struct hif_exec_budget_ctrl *ctrl,
+				 unsigned long long limit_ns,
+				 unsigned long long ts,
+				 unsigned long long poll_ns, bool force_break,
+				 int work_done, int poll_budget,
+				 int normalized_budget);
+#endif
+
 struct hif_exec_context;
 
 struct hif_execution_ops {
@@ -77,6 +177,7 @@ struct hif_execution_ops {
  *		 to HIF. This means there is more work to be done. Hence do not
  *		 call napi_complete.
  * @force_napi_complete: do a force napi_complete when this flag is set to -1
+ * @budget_ctrl: adaptive NAPI budget and time slice controller
  */
 struct hif_exec_context {
 	struct hif_execution_ops *sched_ops;
@@ -116,6 +217,9 @@ struct hif_exec_context {
 #ifdef FEATURE_IRQ_AFFINITY
 	qdf_atomic_t force_napi_complete;
 #endif
+#ifdef HIF_EXEC_ADAPTIVE_BUDGET
+	struct hif_exec_budget_ctrl budget_ctrl;
+#endif
 };
 
 /**
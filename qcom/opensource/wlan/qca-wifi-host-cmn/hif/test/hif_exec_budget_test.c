@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_trace.h"
+#include "qdf_util.h"
+#include "hif_exec.h"
+#include "hif_exec_budget_test.h"
+
+/* rx_softirq_max_yield_duration_ns the synthetic polls run against */
+#define hif_exec_ut_limit_ns 500000ULL
+#define hif_exec_ut_budget 256
+#define hif_exec_ut_polls 256
+/* polls after which a steady load must have settled the budget */
+#define hif_exec_ut_settle 64
+#define hif_exec_ut_random_polls 4096
+#define hif_exec_ut_unbounded 0xffffffff
+
+/**
+ * struct hif_exec_ut_load - synthetic load offered to the polls
+ * @name: name of the load in failure messages
+ * @cost_ns: poll time per unit of work
+ * @offered: units of work pending at the start of each poll
+ * @normalized_budget: internal budget granted by the NAPI budget
+ * @expected: budget the controller must settle on, 0 if any budget whose
+ *	polls fit in the time limit is fine
+ */
+struct hif_exec_ut_load {
+	const char *name;
+	uint32_t cost_ns;
+	uint32_t offered;
+	int normalized_budget;
+	uint32_t expected;
+};
+
+static const struct hif_exec_ut_load hif_exec_ut_loads[] = {
+	{ "cheap", 100, hif_exec_ut_unbounded, hif_exec_ut_budget,
+	  hif_exec_ut_budget },
+	{ "moderate", 2000, hif_exec_ut_unbounded, hif_exec_ut_budget, 0 },
+	{ "heavy", 10000, hif_exec_ut_unbounded, hif_exec_ut_budget, 0 },
+	{ "overload", 100000, hif_exec_ut_unbounded, hif_exec_ut_budget,
+	  HIF_EXEC_MIN_BUDGET },
+	{ "idle", 10000, 8, hif_exec_ut_budget, hif_exec_ut_budget },
+	{ "small grant", 100000, hif_exec_ut_unbounded, 8, 8 },
+};
+
+#define hif_exec_ut_cheap (&hif_exec_ut_loads[0])
+#define hif_exec_ut_heavy (&hif_exec_ut_loads[2])
+
+/**
+ * hif_exec_ut_poll() - run one synthetic poll through the budget controller
+ * @ctrl: budget controller under test
+ * @cost_ns: poll time per unit of work
+ * @offered: units of work pending at the start of the poll
+ * @normalized_budget: internal budget granted by the NAPI budget
+ * @seq: poll sequence number, used as the poll start time
+ *
+ * The poll reaps min(budget, @offered) units of work and has to yield if
+ * that ran past the time slice of the controller, like the ring reap loop.
+ *
+ * Return: number of failed checks
+ */
+static uint32_t hif_exec_ut_poll(struct hif_exec_budget_ctrl *ctrl,
+				 uint32_t cost_ns, uint32_t offered,
+				 int normalized_budget, uint32_t seq)
+{
+	unsigned long long yield_ns, poll_ns;
+	int poll_budget, min_budget;
+	uint32_t work_done;
+	bool force_break;
+
+	poll_budget = hif_exec_budget_ctrl_get(ctrl, normalized_budget);
+	work_done = qdf_min((uint32_t)poll_budget, offered);
+	yield_ns = ctrl->yield_ns ? ctrl->yield_ns : hif_exec_ut_limit_ns;
+	poll_ns = (unsigned long long)work_done * cost_ns;
+	force_break = poll_ns > yield_ns;
+	ctrl->backlog = offered - work_done;
+
+	hif_exec_budget_ctrl_update(ctrl, hif_exec_ut_limit_ns, seq, poll_ns,
+				    force_break, work_done, poll_budget,
+				    normalized_budget);
+
+	min_budget = qdf_min(HIF_EXEC_MIN_BUDGET, normalized_budget);
+	if (poll_budget > normalized_budget ||
+	    (int)ctrl->budget < min_budget ||
+	    (int)ctrl->budget > normalized_budget) {
+		qdf_nofl_alert("FAIL: poll %u budget %d -> %u outside [%d, %d]",
+			       seq, poll_budget, ctrl->budget, min_budget,
+			       normalized_budget);
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * hif_exec_ut_converge() - drive a steady load through the controller
+ * @ctrl: budget controller under test, kept across loads
+ * @load: load offered to every poll
+ *
+ * Return: number of failed checks
+ */
+static uint32_t hif_exec_ut_converge(struct hif_exec_budget_ctrl *ctrl,
+				     const struct hif_exec_ut_load *load)
+{
+	unsigned long long poll_ns;
+	uint32_t errors = 0;
+	uint32_t settled = 0;
+	uint32_t i;
+
+	for (i = 0; i < hif_exec_ut_polls; i++) {
+		errors += hif_exec_ut_poll(ctrl, load->cost_ns, load->offered,
+					   load->normalized_budget, i);
+		if (i + 1 < hif_exec_ut_settle)
+			continue;
+
+		if (i + 1 == hif_exec_ut_settle) {
+			settled = ctrl->budget;
+		} else if (ctrl->budget != settled) {
+			qdf_nofl_alert("FAIL: %s budget moved from %u to %u after %u polls",
+				       load->name, settled, ctrl->budget, i);
+			return errors + 1;
+		}
+	}
+
+	if (load->expected && settled != load->expected) {
+		qdf_nofl_alert("FAIL: %s budget settled at %u, expected %u",
+			       load->name, settled, load->expected);
+		errors++;
+	}
+
+	/* once settled, polls fit in the time limit unless the floor can't */
+	poll_ns = (unsigned long long)qdf_min(settled, load->offered) *
+		  load->cost_ns;
+	if (settled > HIF_EXEC_MIN_BUDGET && poll_ns > hif_exec_ut_limit_ns) {
+		qdf_nofl_alert("FAIL: %s budget settled at %u, polls run %llu ns",
+			       load->name, settled, poll_ns);
+		errors++;
+	}
+
+	return errors;
+}
+
+static uint32_t hif_exec_ut_steady(void)
+{
+	struct hif_exec_budget_ctrl ctrl;
+	uint32_t errors = 0;
+	uint32_t i;
+
+	for (i = 0; i < QDF_ARRAY_SIZE(hif_exec_ut_loads); i++) {
+		qdf_mem_zero(&ctrl, sizeof(ctrl));
+		errors += hif_exec_ut_converge(&ctrl, &hif_exec_ut_loads[i]);
+	}
+
+	return errors;
+}
+
+static uint32_t hif_exec_ut_load_change(void)
+{
+	struct hif_exec_budget_ctrl ctrl;
+	uint32_t errors = 0;
+
+	/* back off under a heavy load and recover once it is gone */
+	qdf_mem_zero(&ctrl, sizeof(ctrl));
+	errors += hif_exec_ut_converge(&ctrl, hif_exec_ut_cheap);
+	errors += hif_exec_ut_converge(&ctrl, hif_exec_ut_heavy);
+	errors += hif_exec_ut_converge(&ctrl, hif_exec_ut_cheap);
+
+	return errors;
+}
+
+static uint32_t hif_exec_ut_random(void)
+{
+	static const int grants[] = { 8, 64, hif_exec_ut_budget };
+	struct hif_exec_budget_ctrl ctrl;
+	uint32_t errors = 0;
+	uint32_t seed = 1;
+	uint32_t cost_ns, offered, i;
+	int grant = hif_exec_ut_budget;
+
+	qdf_mem_zero(&ctrl, sizeof(ctrl));
+	for (i = 0; i < hif_exec_ut_random_polls; i++) {
+		seed = seed * 1103515245 + 12345;
+		cost_ns = 100 + (seed >> 8) % 200000;
+		offered = (seed >> 4) % (2 * hif_exec_ut_budget);
+		/* the NAPI budget changes now and then */
+		if (!(i % 128))
+			grant = grants[(seed >> 16) % QDF_ARRAY_SIZE(grants)];
+
+		errors += hif_exec_ut_poll(&ctrl, cost_ns, offered, grant, i);
+	}
+
+	return errors;
+}
+
+uint32_t hif_exec_budget_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += hif_exec_ut_steady();
+	errors += hif_exec_ut_load_change();
+	errors += hif_exec_ut_random();
+
+	return errors;
+}
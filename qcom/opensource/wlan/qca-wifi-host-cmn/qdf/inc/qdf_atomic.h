@@ -165,6 +165,22 @@ static inline int32_t qdf_atomic_inc_not_zero(qdf_atomic_t *v)
 	return __qdf_atomic_inc_not_zero(v);
 }
 
+/**
+ * qdf_atomic_cmpxchg() - exchange the value of an atomic variable if it
+ *			  holds an expected value
+ * @v: A pointer to an opaque atomic variable
+ * @old: expected value
+ * @new: value to store if @v holds @old
+ *
+ * Return: value of @v before the operation, the exchange took place if it
+ *	   equals @old
+ */
+static inline int32_t qdf_atomic_cmpxchg(qdf_atomic_t *v, int32_t old,
+					 int32_t new)
+{
+	return __qdf_atomic_cmpxchg(v, old, new);
+}
+
 /**
  * qdf_atomic_set_bit - Atomically set a bit in memory
  * @nr: bit to set
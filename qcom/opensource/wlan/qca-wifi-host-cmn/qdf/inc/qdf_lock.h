@@ -353,6 +353,31 @@ static inline void qdf_spin_unlock_bh(qdf_spinlock_t *lock)
 	__qdf_spin_unlock_bh(&lock->lock);
 }
 
+/**
+ * qdf_local_bh_disable() - disable bottom halves on the local CPU
+ *
+ * The caller stays on the current CPU until qdf_local_bh_enable(), so
+ * per-CPU data only touched by softirqs and by such sections on that CPU
+ * needs no lock. Nests, and costs no atomic when bottom halves are
+ * already disabled.
+ *
+ * Return: none
+ */
+static inline void qdf_local_bh_disable(void)
+{
+	__qdf_local_bh_disable();
+}
+
+/**
+ * qdf_local_bh_enable() - enable bottom halves on the local CPU
+ *
+ * Return: none
+ */
+static inline void qdf_local_bh_enable(void)
+{
+	__qdf_local_bh_enable();
+}
+
 /**
  * qdf_spinlock_irq_exec - Execute the input function with spinlock held
  * and interrupt disabled.
@@ -940,11 +940,43 @@ struct qdf_nbuf_track_t {
 
 typedef struct qdf_nbuf_track_t QDF_NBUF_TRACK;
 
+/**
+ * struct qdf_nbuf_pkt_meta - packet header summary filled in one pass
+ * @ether_type: ether type after any 802.1Q/802.1AD tag, network order
+ * @ip_offset: offset of the IPv4/IPv6 header from the start of the frame
+ * @l4_proto: IPv4 protocol or IPv6 next header, 0 for non IP packets
+ * @pkt_type: QDF_NBUF_CB_PACKET_TYPE_* of the packet, 0 if none applies
+ * @src_port: TCP/UDP source port, network order
+ * @dst_port: TCP/UDP destination port, network order
+ * @is_bcast: destination address is broadcast
+ * @is_mcast: destination address is multicast
+ * @is_ipv4: packet is IPv4
+ * @is_ipv6: packet is IPv6
+ */
+struct qdf_nbuf_pkt_meta {
+	uint16_t ether_type;
+	uint8_t ip_offset;
+	uint8_t l4_proto;
+	uint8_t pkt_type;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t is_bcast:1,
+		is_mcast:1,
+		is_ipv4:1,
+		is_ipv6:1;
+};
+
 /**
  * typedef qdf_nbuf_queue_head_t - Platform indepedent nbuf queue head
  */
 typedef __qdf_nbuf_queue_head_t qdf_nbuf_queue_head_t;
 
+/**
+ * typedef qdf_nbuf_page_pool_t - Platform independent pool of DMA mapped
+ *				  pages backing nbuf data
+ */
+typedef __qdf_nbuf_page_pool_t qdf_nbuf_page_pool_t;
+
 /**
  * @qdf_dma_map_cb_t - Dma map callback prototype
  */
@@ -1144,7 +1176,7 @@ qdf_nbuf_unmap_nbytes_single_paddr(qdf_device_t osdev, qdf_nbuf_t buf,
 				   qdf_dma_addr_t phy_addr, qdf_dma_dir_t dir,
 				   int nbytes)
 {
-	__qdf_mem_unmap_nbytes_single(osdev, phy_addr, dir, nbytes);
+	__qdf_nbuf_unmap_nbytes_single_paddr(osdev, buf, phy_addr, dir, nbytes);
 }
 #endif /* NBUF_MAP_UNMAP_DEBUG */
 
@@ -1846,11 +1878,41 @@ qdf_nbuf_t qdf_nbuf_alloc_debug(qdf_device_t osdev, qdf_size_t size,
 qdf_nbuf_t qdf_nbuf_alloc_no_recycler_debug(size_t size, int reserve, int align,
 					    const char *func, uint32_t line);
 
+/**
+ * qdf_nbuf_page_pool_alloc() - Allocate an nbuf on a page pool page
+ * @pp: page pool created with qdf_nbuf_page_pool_create()
+ * @reserve: Reserved headroom size
+ * @align: Align
+ *
+ * Return: Allocated nbuf pointer, NULL if the pool has no page
+ */
+#define qdf_nbuf_page_pool_alloc(pp, r, a) \
+	qdf_nbuf_page_pool_alloc_debug(pp, r, a, __func__, __LINE__)
+
+qdf_nbuf_t qdf_nbuf_page_pool_alloc_debug(qdf_nbuf_page_pool_t pp,
+					  int reserve, int align,
+					  const char *func, uint32_t line);
+
 #define qdf_nbuf_free(d) \
 	qdf_nbuf_free_debug(d, __func__, __LINE__)
 
 void qdf_nbuf_free_debug(qdf_nbuf_t nbuf, const char *func, uint32_t line);
 
+#define qdf_nbuf_free_bulk(bufs, num) \
+	qdf_nbuf_free_bulk_debug(bufs, num, __func__, __LINE__)
+
+/**
+ * qdf_nbuf_free_bulk_debug() - free an array of nbufs
+ * @bufs: nbufs to free, NULL entries are skipped
+ * @num: number of entries in @bufs
+ * @func: caller function name
+ * @line: caller line number
+ *
+ * Return: none
+ */
+void qdf_nbuf_free_bulk_debug(qdf_nbuf_t *bufs, uint32_t num,
+			      const char *func, uint32_t line);
+
 #define qdf_nbuf_clone(buf)     \
 	qdf_nbuf_clone_debug(buf, __func__, __LINE__)
 
@@ -1987,12 +2049,38 @@ qdf_nbuf_alloc_no_recycler_fl(size_t size, int reserve, int align,
 	return __qdf_nbuf_alloc_no_recycler(size, reserve, align, func, line);
 }
 
+/**
+ * qdf_nbuf_page_pool_alloc() - Allocate an nbuf on a page pool page
+ * @pp: page pool created with qdf_nbuf_page_pool_create()
+ * @reserve: Reserved headroom size
+ * @align: Align
+ *
+ * Return: Allocated nbuf pointer, NULL if the pool has no page
+ */
+static inline qdf_nbuf_t
+qdf_nbuf_page_pool_alloc(qdf_nbuf_page_pool_t pp, int reserve, int align)
+{
+	return __qdf_nbuf_page_pool_alloc(pp, reserve, align);
+}
+
 static inline void qdf_nbuf_free(qdf_nbuf_t buf)
 {
 	if (qdf_likely(buf))
 		__qdf_nbuf_free(buf);
 }
 
+/**
+ * qdf_nbuf_free_bulk() - free an array of nbufs
+ * @bufs: nbufs to free, NULL entries are skipped
+ * @num: number of entries in @bufs
+ *
+ * Return: none
+ */
+static inline void qdf_nbuf_free_bulk(qdf_nbuf_t *bufs, uint32_t num)
+{
+	__qdf_nbuf_free_bulk(bufs, num);
+}
+
 /**
  * qdf_nbuf_clone() - clone the nbuf (copy is readonly)
  * @buf: Pointer to network buffer
@@ -2042,6 +2130,54 @@ static inline qdf_nbuf_t qdf_nbuf_unshare(qdf_nbuf_t buf)
 }
 #endif /* NBUF_MEMORY_DEBUG */
 
+/**
+ * qdf_nbuf_page_pool_create() - Create a pool of DMA mapped pages for nbufs
+ * @osdev: Device handle the pages are mapped for
+ * @pool_size: Number of pages the pool recycles
+ * @size: Data size of each nbuf
+ * @reserve: Reserved headroom size
+ * @align: Align
+ *
+ * Nbufs allocated with qdf_nbuf_page_pool_alloc() return their page to the
+ * pool when freed by any owner, network stack included, without being
+ * unmapped. qdf_nbuf_map_nbytes_single()/qdf_nbuf_unmap_nbytes_single()
+ * only sync such nbufs for the device/CPU.
+ *
+ * Return: page pool, NULL if not supported, @size does not fit a page or
+ *	   on failure
+ */
+static inline qdf_nbuf_page_pool_t
+qdf_nbuf_page_pool_create(qdf_device_t osdev, uint32_t pool_size,
+			  size_t size, int reserve, int align)
+{
+	return __qdf_nbuf_page_pool_create(osdev, pool_size, size, reserve,
+					   align);
+}
+
+/**
+ * qdf_nbuf_page_pool_destroy() - Destroy a page pool
+ * @pp: page pool, may be NULL
+ *
+ * Return: none
+ */
+static inline void qdf_nbuf_page_pool_destroy(qdf_nbuf_page_pool_t pp)
+{
+	__qdf_nbuf_page_pool_destroy(pp);
+}
+
+/**
+ * qdf_nbuf_is_page_pool() - check if nbuf data is on a page pool page
+ *			     mapped for a device
+ * @osdev: device the nbuf is mapped for
+ * @buf: Network buffer
+ *
+ * Return: true if the nbuf keeps its DMA mapping for @osdev across free
+ */
+static inline bool qdf_nbuf_is_page_pool(qdf_device_t osdev, qdf_nbuf_t buf)
+{
+	return __qdf_nbuf_is_page_pool(osdev, buf);
+}
+
 /**
  * qdf_nbuf_copy_expand_fraglist() - copy and expand nbuf and
  * get reference of the fraglist.
@@ -3045,6 +3181,22 @@ bool qdf_nbuf_is_ipv4_wapi_pkt(qdf_nbuf_t buf)
 	return __qdf_nbuf_is_ipv4_wapi_pkt(buf);
 }
 
+/**
+ * qdf_nbuf_parse_pkt_meta() - parse the L2/L3/L4 headers of a packet once
+ * @buf: buffer
+ * @meta: header summary to fill
+ *
+ * Consumers that need several of the qdf_nbuf_is_*() answers for the same
+ * packet should parse it once with this API and read @meta instead.
+ *
+ * Return: none
+ */
+static inline
+void qdf_nbuf_parse_pkt_meta(qdf_nbuf_t buf, struct qdf_nbuf_pkt_meta *meta)
+{
+	__qdf_nbuf_parse_pkt_meta(buf, meta);
+}
+
 /**
  * qdf_nbuf_is_ipv4_tdls_pkt() - check if packet is a tdls packet or not
  * @buf:  buffer
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_rcu.h - Public APIs for read-copy-update protected lists
+ *
+ * Readers walk a list between qdf_rcu_read_lock() and qdf_rcu_read_unlock()
+ * without taking the writer lock. Writers serialize among themselves with
+ * their own lock and must not free a removed entry until a grace period has
+ * elapsed, either by calling qdf_synchronize_rcu() or qdf_call_rcu().
+ */
+
+#ifndef __QDF_RCU_H
+#define __QDF_RCU_H
+
+#include "i_qdf_rcu.h"
+
+/**
+ * struct qdf_rcu_head - opaque callback head for deferred frees
+ */
+#define qdf_rcu_head __qdf_rcu_head
+
+/**
+ * struct qdf_hlist_head - opaque head of a singly linked hash bucket list
+ */
+#define qdf_hlist_head __qdf_hlist_head
+
+/**
+ * struct qdf_hlist_node - opaque entry for membership in a qdf_hlist_head
+ */
+#define qdf_hlist_node __qdf_hlist_node
+
+/**
+ * qdf_rcu_read_lock() - enter an RCU read side critical section
+ *
+ * Return: none
+ */
+#define qdf_rcu_read_lock() __qdf_rcu_read_lock()
+
+/**
+ * qdf_rcu_read_unlock() - leave an RCU read side critical section
+ *
+ * Return: none
+ */
+#define qdf_rcu_read_unlock() __qdf_rcu_read_unlock()
+
+/**
+ * qdf_synchronize_rcu() - wait for all pre-existing readers to finish
+ *
+ * May sleep; must not be called from atomic context.
+ *
+ * Return: none
+ */
+#define qdf_synchronize_rcu() __qdf_synchronize_rcu()
+
+/**
+ * qdf_rcu_barrier() - wait for all queued qdf_call_rcu() callbacks to run
+ *
+ * Return: none
+ */
+#define qdf_rcu_barrier() __qdf_rcu_barrier()
+
+/**
+ * qdf_call_rcu() - invoke @func once all pre-existing readers have finished
+ * @head: pointer to a qdf_rcu_head embedded in the object to be released
+ * @func: callback taking @head as its only argument
+ *
+ * Safe to call from atomic context.
+ *
+ * Return: none
+ */
+#define qdf_call_rcu(head, func) __qdf_call_rcu(head, func)
+
+/**
+ * qdf_init_hlist_head() - initialize an empty bucket list
+ * @head: pointer to the qdf_hlist_head to initialize
+ *
+ * Return: none
+ */
+#define qdf_init_hlist_head(head) __qdf_init_hlist_head(head)
+
+/**
+ * qdf_init_hlist_node() - initialize a list entry as not linked
+ * @node: pointer to the qdf_hlist_node to initialize
+ *
+ * Return: none
+ */
+#define qdf_init_hlist_node(node) __qdf_init_hlist_node(node)
+
+/**
+ * qdf_hlist_empty() - check if a bucket list has any entries
+ * @head: pointer to the qdf_hlist_head to check
+ *
+ * Return: true if the list is empty
+ */
+#define qdf_hlist_empty(head) __qdf_hlist_empty(head)
+
+/**
+ * qdf_hlist_unhashed() - check if an entry is linked into a list
+ * @node: pointer to the qdf_hlist_node to check
+ *
+ * Return: true if the entry is not on any list
+ */
+#define qdf_hlist_unhashed(node) __qdf_hlist_unhashed(node)
+
+/**
+ * qdf_hlist_add_tail_rcu() - publish an entry at the tail of a list
+ * @node: pointer to the qdf_hlist_node to add
+ * @head: pointer to the qdf_hlist_head to add @node to
+ *
+ * Caller must hold the writer lock of @head.
+ *
+ * Return: none
+ */
+#define qdf_hlist_add_tail_rcu(node, head) __qdf_hlist_add_tail_rcu(node, head)
+
+/**
+ * qdf_hlist_del_init_rcu() - unlink an entry, leaving it safe for readers
+ * @node: pointer to the qdf_hlist_node to remove
+ *
+ * Caller must hold the writer lock of the list. Concurrent readers may still
+ * see the entry until a grace period has elapsed.
+ *
+ * Return: none
+ */
+#define qdf_hlist_del_init_rcu(node) __qdf_hlist_del_init_rcu(node)
+
+/**
+ * qdf_hlist_for_each_entry_rcu() - iterate a list under qdf_rcu_read_lock()
+ * @cursor: container struct pointer populated with each iteration
+ * @head: pointer to the qdf_hlist_head to iterate
+ * @field: name of the qdf_hlist_node field in the container struct
+ */
+#define qdf_hlist_for_each_entry_rcu(cursor, head, field) \
+	__qdf_hlist_for_each_entry_rcu(cursor, head, field)
+
+/**
+ * qdf_hlist_for_each_entry_safe() - iterate a list safe against removal
+ * @cursor: container struct pointer populated with each iteration
+ * @tmp: a &struct qdf_hlist_node pointer used for temporary storage
+ * @head: pointer to the qdf_hlist_head to iterate
+ * @field: name of the qdf_hlist_node field in the container struct
+ *
+ * Caller must hold the writer lock of @head.
+ */
+#define qdf_hlist_for_each_entry_safe(cursor, tmp, head, field) \
+	__qdf_hlist_for_each_entry_safe(cursor, tmp, head, field)
+
+/*
+ * Sequence counters cover read-mostly data updated in place: readers copy
+ * or compare the data and retry if a writer ran concurrently. Writers must
+ * be serialized by the caller and run with bottom halves disabled.
+ */
+typedef __qdf_seqcount_t qdf_seqcount_t;
+
+/**
+ * qdf_seqcount_init() - initialize a sequence counter
+ * @s: pointer to the qdf_seqcount_t
+ */
+#define qdf_seqcount_init(s) __qdf_seqcount_init(s)
+
+/**
+ * qdf_read_seqcount_begin() - start a sequence counter read section
+ * @s: pointer to the qdf_seqcount_t
+ *
+ * Return: count to be passed to qdf_read_seqcount_retry()
+ */
+#define qdf_read_seqcount_begin(s) __qdf_read_seqcount_begin(s)
+
+/**
+ * qdf_read_seqcount_retry() - end a sequence counter read section
+ * @s: pointer to the qdf_seqcount_t
+ * @start: count returned by qdf_read_seqcount_begin()
+ *
+ * Return: true if a writer ran and the read section must be retried
+ */
+#define qdf_read_seqcount_retry(s, start) __qdf_read_seqcount_retry(s, start)
+
+/**
+ * qdf_write_seqcount_begin() - start a sequence counter write section
+ * @s: pointer to the qdf_seqcount_t
+ */
+#define qdf_write_seqcount_begin(s) __qdf_write_seqcount_begin(s)
+
+/**
+ * qdf_write_seqcount_end() - end a sequence counter write section
+ * @s: pointer to the qdf_seqcount_t
+ */
+#define qdf_write_seqcount_end(s) __qdf_write_seqcount_end(s)
+
+#endif /* __QDF_RCU_H */
@@ -114,6 +114,11 @@ typedef int (qdf_abstract_print)(void *priv, const char *fmt, ...);
 #define MAX_QDF_TRACE_RECORDS 4000
 #endif
 
+/* MTRACE records kept per CPU, must be a power of two */
+#ifndef QDF_TRACE_PERCPU_RECORDS
+#define QDF_TRACE_PERCPU_RECORDS 1024
+#endif
+
 #define QDF_TRACE_DEFAULT_PDEV_ID 0xff
 #define INVALID_QDF_TRACE_ADDR 0xffffffff
 #define DEFAULT_QDF_TRACE_DUMP_COUNT 0
@@ -180,6 +185,28 @@ typedef struct s_qdf_trace_data {
 	uint16_t dump_count;
 } t_qdf_trace_data;
 
+#ifdef QDF_TRACE_PERCPU_RING
+/**
+ * struct qdf_trace_ring_slot - one record of a per-CPU MTRACE ring
+ * @seq: write index of @rec plus one, 0 while @rec is being written
+ * @rec: trace record, @rec.time is only filled in while dumping
+ */
+struct qdf_trace_ring_slot {
+	uint32_t seq;
+	qdf_trace_record_t rec;
+};
+
+/**
+ * struct qdf_trace_ring - MTRACE ring written only by its own CPU
+ * @widx: free running write index
+ * @slot: ring storage
+ */
+struct qdf_trace_ring {
+	qdf_atomic_t widx;
+	struct qdf_trace_ring_slot slot[QDF_TRACE_PERCPU_RECORDS];
+};
+#endif
+
 #define CASE_RETURN_STRING(str) case ((str)): return (uint8_t *)(# str);
 
 #ifndef MAX_QDF_DP_TRACE_RECORDS
@@ -569,6 +596,58 @@ void qdf_trace(uint8_t module, uint16_t code, uint16_t session, uint32_t data);
 void qdf_trace_enable(uint32_t, uint8_t enable);
 void qdf_trace_dump_all(void *, uint8_t, uint8_t, uint32_t, uint32_t);
 QDF_STATUS qdf_trace_spin_lock_init(void);
+
+#ifdef QDF_TRACE_PERCPU_RING
+/**
+ * qdf_trace_ring_record() - puts a record in to the ring of the local CPU
+ * @rings: per-CPU rings, indexed by CPU id
+ * @module: module id of the record
+ * @code: code to be recorded
+ * @session: session id of the record
+ * @data: record payload
+ *
+ * Return: None
+ */
+void qdf_trace_ring_record(struct qdf_trace_ring *rings, uint8_t module,
+			   uint16_t code, uint16_t session, uint32_t data);
+
+/**
+ * qdf_trace_ring_snapshot() - copy the records of one per-CPU ring
+ * @ring: ring to copy
+ * @out: destination with room for QDF_TRACE_PERCPU_RECORDS records
+ *
+ * Return: number of complete records copied, oldest first
+ */
+uint32_t qdf_trace_ring_snapshot(struct qdf_trace_ring *ring,
+				 qdf_trace_record_t *out);
+
+/**
+ * qdf_trace_fill_time() - format the wall clock time of a record
+ * @rec: trace record
+ * @now_us: current log timestamp in microseconds
+ * @now_tod_us: current time of the day in microseconds
+ *
+ * Return: None
+ */
+void qdf_trace_fill_time(qdf_trace_record_t *rec, uint64_t now_us,
+			 uint64_t now_tod_us);
+
+/**
+ * qdf_trace_ring_dump() - dump a set of per-CPU rings in timestamp order
+ * @rings: per-CPU rings, indexed by CPU id
+ * @nr_rings: number of rings in @rings
+ * @cb_table: dump call back of each module, indexed by module id
+ * @p_mac: context handed to the call backs
+ * @code: only dump records with this code, 0 for all of them
+ * @count: number of newest records to consider, 0 for all of them
+ * @bitmask_of_module: modules to dump, 0 for all of them
+ *
+ * Return: None
+ */
+void qdf_trace_ring_dump(struct qdf_trace_ring *rings, uint32_t nr_rings,
+			 tp_qdf_trace_cb *cb_table, void *p_mac, uint8_t code,
+			 uint32_t count, uint32_t bitmask_of_module);
+#endif
 #else
 #ifndef QDF_TRACE_PRINT_ENABLE
 static inline
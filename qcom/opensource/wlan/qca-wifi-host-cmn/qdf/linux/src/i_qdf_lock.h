@@ -316,6 +316,26 @@ static inline void __qdf_spin_unlock_bh(__qdf_spinlock_t *lock)
 		spin_unlock(&lock->spinlock);
 }
 
+/**
+ * __qdf_local_bh_disable() - Disable bottom halves on the local CPU
+ *
+ * Return: none
+ */
+static inline void __qdf_local_bh_disable(void)
+{
+	local_bh_disable();
+}
+
+/**
+ * __qdf_local_bh_enable() - Enable bottom halves on the local CPU
+ *
+ * Return: none
+ */
+static inline void __qdf_local_bh_enable(void)
+{
+	local_bh_enable();
+}
+
 /**
  * __qdf_spinlock_irq_exec - Execute the input function with spinlock held and interrupt disabled.
  * @hdl: OS handle
@@ -67,6 +67,81 @@ typedef struct sk_buff *__qdf_nbuf_t;
  */
 typedef struct sk_buff_head __qdf_nbuf_queue_head_t;
 
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(6, 6, 0))
+#include <net/page_pool/helpers.h>
+#elif (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 15, 0))
+#include <net/page_pool.h>
+#endif
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 15, 0))
+
+/**
+ * typedef __qdf_nbuf_page_pool_t - abstraction for a linux page_pool
+ *
+ * Nbufs built on page pool pages keep their DMA mapping when freed, the
+ * page returns to the pool still mapped.
+ */
+typedef struct page_pool *__qdf_nbuf_page_pool_t;
+
+#ifdef PP_MAGIC_MASK
+#define __QDF_NBUF_PP_MAGIC_MASK PP_MAGIC_MASK
+#else
+#define __QDF_NBUF_PP_MAGIC_MASK (~0x3UL)
+#endif
+
+/**
+ * __qdf_nbuf_is_page_pool() - check if nbuf data is on a page pool page
+ *			       mapped for a device
+ * @osdev: device the nbuf is mapped for
+ * @skb: Pointer to network buffer
+ *
+ * skb->pp_recycle only tells that some page of the nbuf may return to a
+ * page pool, the head can still be a kmalloc buffer, and a bridged nbuf
+ * may come from the page pool of another device. The head page itself
+ * must carry the page pool signature and its pool must map for @osdev.
+ *
+ * Return: true if skb->head is on a page pool page mapped for @osdev
+ */
+static inline bool __qdf_nbuf_is_page_pool(qdf_device_t osdev,
+					   struct sk_buff *skb)
+{
+	struct page *page;
+
+	if (qdf_likely(!skb->pp_recycle))
+		return false;
+
+	page = virt_to_head_page(skb->head);
+
+	return (page->pp_magic & __QDF_NBUF_PP_MAGIC_MASK) == PP_SIGNATURE &&
+	       page->pp->p.dev == osdev->dev;
+}
+
+/**
+ * __qdf_nbuf_page_pool_paddr() - DMA address of the data of a page pool nbuf
+ * @skb: Pointer to network buffer built on a page pool page
+ *
+ * Return: DMA address of skb->data
+ */
+static inline dma_addr_t __qdf_nbuf_page_pool_paddr(struct sk_buff *skb)
+{
+	return page_pool_get_dma_addr(virt_to_head_page(skb->head)) +
+	       (skb->data - skb->head);
+}
+#else
+typedef void *__qdf_nbuf_page_pool_t;
+
+static inline bool __qdf_nbuf_is_page_pool(qdf_device_t osdev,
+					   struct sk_buff *skb)
+{
+	return false;
+}
+
+static inline dma_addr_t __qdf_nbuf_page_pool_paddr(struct sk_buff *skb)
+{
+	return 0;
+}
+#endif
+
 #define QDF_NBUF_CB_TX_MAX_OS_FRAGS 1
 
 #define QDF_SHINFO_SIZE    SKB_DATA_ALIGN(sizeof(struct skb_shared_info))
@@ -815,6 +890,66 @@ __qdf_nbuf_alloc(__qdf_device_t osdev, size_t size, int reserve, int align,
 __qdf_nbuf_t __qdf_nbuf_alloc_no_recycler(size_t size, int reserve, int align,
 					  const char *func, uint32_t line);
 
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 15, 0))
+/**
+ * __qdf_nbuf_page_pool_create() - Create a page pool for nbuf data
+ * @osdev: Device handle the pages are mapped for
+ * @pool_size: Number of pages the pool recycles
+ * @size: Data size of each nbuf
+ * @reserve: Reserve headroom size
+ * @align: Align data
+ *
+ * Every page is DMA mapped once when it enters the pool and stays mapped
+ * while it is recycled.
+ *
+ * Return: page pool, NULL if @size does not fit in a page or on failure
+ */
+__qdf_nbuf_page_pool_t
+__qdf_nbuf_page_pool_create(__qdf_device_t osdev, uint32_t pool_size,
+			    size_t size, int reserve, int align);
+
+/**
+ * __qdf_nbuf_page_pool_destroy() - Destroy a page pool
+ * @pp: page pool, may be NULL
+ *
+ * Pages still held by nbufs are released once those nbufs are freed.
+ *
+ * Return: none
+ */
+void __qdf_nbuf_page_pool_destroy(__qdf_nbuf_page_pool_t pp);
+
+/**
+ * __qdf_nbuf_page_pool_alloc() - Allocate an nbuf on a page pool page
+ * @pp: page pool
+ * @reserve: Reserve headroom size
+ * @align: Align data
+ *
+ * Pages are taken from the pool without locking, so a pool must only be
+ * allocated from by one context at a time.
+ *
+ * Return: nbuf or %NULL if no memory
+ */
+__qdf_nbuf_t __qdf_nbuf_page_pool_alloc(__qdf_nbuf_page_pool_t pp,
+					int reserve, int align);
+#else
+static inline __qdf_nbuf_page_pool_t
+__qdf_nbuf_page_pool_create(__qdf_device_t osdev, uint32_t pool_size,
+			    size_t size, int reserve, int align)
+{
+	return NULL;
+}
+
+static inline void __qdf_nbuf_page_pool_destroy(__qdf_nbuf_page_pool_t pp)
+{
+}
+
+static inline __qdf_nbuf_t
+__qdf_nbuf_page_pool_alloc(__qdf_nbuf_page_pool_t pp, int reserve, int align)
+{
+	return NULL;
+}
+#endif
+
 /**
  * __qdf_nbuf_clone() - clone the nbuf (copy is readonly)
  * @skb: Pointer to network buffer
@@ -830,6 +965,7 @@ __qdf_nbuf_t __qdf_nbuf_alloc_no_recycler(size_t size, int reserve, int align,
 __qdf_nbuf_t __qdf_nbuf_clone(__qdf_nbuf_t nbuf);
 
 void __qdf_nbuf_free(struct sk_buff *skb);
+void __qdf_nbuf_free_bulk(struct sk_buff **skbs, uint32_t num);
 QDF_STATUS __qdf_nbuf_map(__qdf_device_t osdev,
 			struct sk_buff *skb, qdf_dma_dir_t dir);
 void __qdf_nbuf_unmap(__qdf_device_t osdev,
@@ -860,6 +996,10 @@ QDF_STATUS __qdf_nbuf_frag_map(
 	int offset, qdf_dma_dir_t dir, int cur_frag);
 void qdf_nbuf_classify_pkt(struct sk_buff *skb);
 
+struct qdf_nbuf_pkt_meta;
+void __qdf_nbuf_parse_pkt_meta(struct sk_buff *skb,
+			       struct qdf_nbuf_pkt_meta *meta);
+
 bool __qdf_nbuf_is_ipv4_wapi_pkt(struct sk_buff *skb);
 bool __qdf_nbuf_is_ipv4_tdls_pkt(struct sk_buff *skb);
 bool __qdf_nbuf_data_is_ipv4_pkt(uint8_t *data);
@@ -2358,6 +2498,15 @@ static inline QDF_STATUS __qdf_nbuf_map_nbytes_single(
 	qdf_dma_addr_t paddr;
 	QDF_STATUS ret;
 
+	/* page pool pages stay mapped, only hand the data to the device */
+	if (__qdf_nbuf_is_page_pool(osdev, buf)) {
+		QDF_NBUF_CB_PADDR(buf) = paddr =
+			__qdf_nbuf_page_pool_paddr(buf);
+		dma_sync_single_for_device(osdev->dev, paddr, nbytes,
+					   __qdf_dma_dir_to_os(dir));
+		return QDF_STATUS_SUCCESS;
+	}
+
 	/* assume that the OS only provides a single fragment */
 	QDF_NBUF_CB_PADDR(buf) = paddr =
 		dma_map_single(osdev->dev, buf->data,
@@ -2393,6 +2542,13 @@ __qdf_nbuf_unmap_nbytes_single(qdf_device_t osdev, struct sk_buff *buf,
 {
 	qdf_dma_addr_t paddr = QDF_NBUF_CB_PADDR(buf);
 
+	/* the page pool owns the mapping, only hand the data to the CPU */
+	if (__qdf_nbuf_is_page_pool(osdev, buf)) {
+		dma_sync_single_for_cpu(osdev->dev, paddr, nbytes,
+					__qdf_dma_dir_to_os(dir));
+		return;
+	}
+
 	if (qdf_likely(paddr)) {
 		__qdf_record_nbuf_nbytes(
 			__qdf_nbuf_get_end_offset(buf), dir, false);
@@ -2403,6 +2559,31 @@ __qdf_nbuf_unmap_nbytes_single(qdf_device_t osdev, struct sk_buff *buf,
 }
 #endif
 
+/**
+ * __qdf_nbuf_unmap_nbytes_single_paddr() - unmap nbytes at a saved address
+ * @osdev: os device
+ * @buf: buffer
+ * @phy_addr: DMA address returned when @buf was mapped
+ * @dir: direction
+ * @nbytes: number of bytes
+ *
+ * Return: none
+ */
+static inline void
+__qdf_nbuf_unmap_nbytes_single_paddr(qdf_device_t osdev, struct sk_buff *buf,
+				     qdf_dma_addr_t phy_addr,
+				     qdf_dma_dir_t dir, int nbytes)
+{
+	/* the page pool owns the mapping, only hand the data to the CPU */
+	if (__qdf_nbuf_is_page_pool(osdev, buf)) {
+		dma_sync_single_for_cpu(osdev->dev, phy_addr, nbytes,
+					__qdf_dma_dir_to_os(dir));
+		return;
+	}
+
+	__qdf_mem_unmap_nbytes_single(osdev, phy_addr, dir, nbytes);
+}
+
 static inline struct sk_buff *
 __qdf_nbuf_queue_head_dequeue(struct sk_buff_head *skb_queue_head)
 {
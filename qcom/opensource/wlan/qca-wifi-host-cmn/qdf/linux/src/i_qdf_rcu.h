@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef __I_QDF_RCU_H
+#define __I_QDF_RCU_H
+
+#include <linux/rcupdate.h>
+#include <linux/rculist.h>
+#include <linux/seqlock.h>
+
+#define __qdf_rcu_head rcu_head
+#define __qdf_hlist_head hlist_head
+#define __qdf_hlist_node hlist_node
+
+#define __qdf_rcu_read_lock() rcu_read_lock()
+#define __qdf_rcu_read_unlock() rcu_read_unlock()
+#define __qdf_synchronize_rcu() synchronize_rcu()
+#define __qdf_rcu_barrier() rcu_barrier()
+#define __qdf_call_rcu(head, func) call_rcu(head, func)
+
+#define __qdf_init_hlist_head(head) INIT_HLIST_HEAD(head)
+#define __qdf_init_hlist_node(node) INIT_HLIST_NODE(node)
+#define __qdf_hlist_empty(head) hlist_empty(head)
+#define __qdf_hlist_unhashed(node) hlist_unhashed(node)
+#define __qdf_hlist_add_tail_rcu(node, head) hlist_add_tail_rcu(node, head)
+#define __qdf_hlist_del_init_rcu(node) hlist_del_init_rcu(node)
+
+#define __qdf_hlist_for_each_entry_rcu(cursor, head, field) \
+	hlist_for_each_entry_rcu(cursor, head, field)
+
+#define __qdf_hlist_for_each_entry_safe(cursor, tmp, head, field) \
+	hlist_for_each_entry_safe(cursor, tmp, head, field)
+
+typedef seqcount_t __qdf_seqcount_t;
+
+#define __qdf_seqcount_init(s) seqcount_init(s)
+#define __qdf_read_seqcount_begin(s) read_seqcount_begin(s)
+#define __qdf_read_seqcount_retry(s, start) read_seqcount_retry(s, start)
+#define __qdf_write_seqcount_begin(s) write_seqcount_begin(s)
+#define __qdf_write_seqcount_end(s) write_seqcount_end(s)
+
+#endif /* __I_QDF_RCU_H */
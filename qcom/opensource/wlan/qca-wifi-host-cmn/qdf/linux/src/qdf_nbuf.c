@@ -704,6 +704,80 @@ ret_nbuf:
 
 qdf_export_symbol(__qdf_nbuf_alloc_no_recycler);
 
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 15, 0))
+__qdf_nbuf_page_pool_t
+__qdf_nbuf_page_pool_create(__qdf_device_t osdev, uint32_t pool_size,
+			    size_t size, int reserve, int align)
+{
+	struct page_pool_params pp_params = {0};
+	struct page_pool *pp;
+
+	if (SKB_DATA_ALIGN(size + reserve + align) >
+	    SKB_WITH_OVERHEAD(PAGE_SIZE))
+		return NULL;
+
+	/*
+	 * Bidirectional so that rx nbufs forwarded back to the tx path can
+	 * be synced for the device without a second mapping.
+	 */
+	pp_params.flags = PP_FLAG_DMA_MAP;
+	pp_params.order = 0;
+	pp_params.pool_size = pool_size;
+	pp_params.nid = NUMA_NO_NODE;
+	pp_params.dev = osdev->dev;
+	pp_params.dma_dir = DMA_BIDIRECTIONAL;
+
+	pp = page_pool_create(&pp_params);
+	if (IS_ERR(pp))
+		return NULL;
+
+	return pp;
+}
+
+qdf_export_symbol(__qdf_nbuf_page_pool_create);
+
+void __qdf_nbuf_page_pool_destroy(__qdf_nbuf_page_pool_t pp)
+{
+	page_pool_destroy(pp);
+}
+
+qdf_export_symbol(__qdf_nbuf_page_pool_destroy);
+
+__qdf_nbuf_t __qdf_nbuf_page_pool_alloc(__qdf_nbuf_page_pool_t pp,
+					int reserve, int align)
+{
+	struct sk_buff *skb;
+	struct page *page;
+	unsigned long offset;
+
+	/* the page pool alloc cache is only safe with BH disabled */
+	local_bh_disable();
+	page = page_pool_dev_alloc_pages(pp);
+	local_bh_enable();
+	if (!page)
+		return NULL;
+
+	skb = build_skb(page_address(page), PAGE_SIZE);
+	if (!skb) {
+		page_pool_put_full_page(pp, page, false);
+		return NULL;
+	}
+	skb_mark_for_recycle(skb);
+
+	if (align) {
+		offset = ((unsigned long)skb->data) % align;
+		if (offset)
+			skb_reserve(skb, align - offset);
+	}
+	skb_reserve(skb, reserve);
+	qdf_nbuf_count_inc(skb);
+
+	return skb;
+}
+
+qdf_export_symbol(__qdf_nbuf_page_pool_alloc);
+#endif
+
 /**
  * __qdf_nbuf_free() - free the nbuf its interrupt safe
  * @skb: Pointer to network buffer
@@ -727,6 +801,49 @@ void __qdf_nbuf_free(struct sk_buff *skb)
 
 qdf_export_symbol(__qdf_nbuf_free);
 
+/**
+ * __qdf_nbuf_free_bulk() - free an array of nbufs
+ * @skbs: nbufs to free, NULL entries are skipped
+ * @num: number of entries in @skbs
+ *
+ * When called from softirq the skb heads are handed to the per-CPU NAPI
+ * skb cache, which returns them to the slab with kmem_cache_free_bulk()
+ * instead of one kmem_cache_free() per nbuf.
+ *
+ * Return: none
+ */
+void __qdf_nbuf_free_bulk(struct sk_buff **skbs, uint32_t num)
+{
+	struct sk_buff *skb;
+	uint32_t i;
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 5, 0)
+	if (!nbuf_free_cb && in_serving_softirq()) {
+		for (i = 0; i < num; i++) {
+			skb = skbs[i];
+			if (qdf_unlikely(!skb))
+				continue;
+
+			if (pld_nbuf_pre_alloc_free(skb))
+				continue;
+
+			qdf_nbuf_frag_count_dec(skb);
+			qdf_nbuf_count_dec(skb);
+			napi_consume_skb(skb, 1);
+		}
+		return;
+	}
+#endif
+
+	for (i = 0; i < num; i++) {
+		skb = skbs[i];
+		if (qdf_likely(skb))
+			__qdf_nbuf_free(skb);
+	}
+}
+
+qdf_export_symbol(__qdf_nbuf_free_bulk);
+
 __qdf_nbuf_t __qdf_nbuf_clone(__qdf_nbuf_t skb)
 {
 	qdf_nbuf_t skb_new = NULL;
@@ -1017,7 +1134,7 @@ void qdf_nbuf_unmap_nbytes_single_paddr_debug(qdf_device_t osdev,
 					      const char *func, uint32_t line)
 {
 	qdf_nbuf_untrack_map(buf, func, line);
-	__qdf_mem_unmap_nbytes_single(osdev, phy_addr, dir, nbytes);
+	__qdf_nbuf_unmap_nbytes_single_paddr(osdev, buf, phy_addr, dir, nbytes);
 	qdf_net_buf_debug_update_unmap_node(buf, func, line);
 }
 
@@ -3071,21 +3188,51 @@ qdf_nbuf_t qdf_nbuf_alloc_no_recycler_debug(size_t size, int reserve, int align,
 
 qdf_export_symbol(qdf_nbuf_alloc_no_recycler_debug);
 
-void qdf_nbuf_free_debug(qdf_nbuf_t nbuf, const char *func, uint32_t line)
+qdf_nbuf_t qdf_nbuf_page_pool_alloc_debug(qdf_nbuf_page_pool_t pp,
+					  int reserve, int align,
+					  const char *func, uint32_t line)
+{
+	qdf_nbuf_t nbuf;
+
+	if (is_initial_mem_debug_disabled)
+		return __qdf_nbuf_page_pool_alloc(pp, reserve, align);
+
+	nbuf = __qdf_nbuf_page_pool_alloc(pp, reserve, align);
+
+	/* Store SKB in internal QDF tracking table */
+	if (qdf_likely(nbuf)) {
+		qdf_net_buf_debug_add_node(nbuf, PAGE_SIZE, func, line);
+		qdf_nbuf_history_add(nbuf, func, line, QDF_NBUF_ALLOC);
+	} else {
+		qdf_nbuf_history_add(nbuf, func, line, QDF_NBUF_ALLOC_FAILURE);
+	}
+
+	return nbuf;
+}
+
+qdf_export_symbol(qdf_nbuf_page_pool_alloc_debug);
+
+/**
+ * qdf_nbuf_free_debug_untrack() - drop the debug tracking of an nbuf
+ * @nbuf: nbuf about to be freed
+ * @func: caller function name
+ * @line: caller line number
+ *
+ * Return: none
+ */
+static void qdf_nbuf_free_debug_untrack(qdf_nbuf_t nbuf, const char *func,
+					uint32_t line)
 {
 	qdf_nbuf_t ext_list;
 	qdf_frag_t p_frag;
 	uint32_t num_nr_frags;
 	uint32_t idx = 0;
 
-	if (qdf_unlikely(!nbuf))
-		return;
-
 	if (is_initial_mem_debug_disabled)
-		goto free_buf;
+		return;
 
 	if (qdf_nbuf_get_users(nbuf) > 1)
-		goto free_buf;
+		return;
 
 	/* Remove SKB from internal QDF tracking table */
 	qdf_nbuf_panic_on_free_if_mapped(nbuf, func, line);
@@ -3127,12 +3274,32 @@ void qdf_nbuf_free_debug(qdf_nbuf_t nbuf, const char *func, uint32_t line)
 
 		ext_list = qdf_nbuf_queue_next(ext_list);
 	}
+}
 
-free_buf:
+void qdf_nbuf_free_debug(qdf_nbuf_t nbuf, const char *func, uint32_t line)
+{
+	if (qdf_unlikely(!nbuf))
+		return;
+
+	qdf_nbuf_free_debug_untrack(nbuf, func, line);
 	__qdf_nbuf_free(nbuf);
 }
 qdf_export_symbol(qdf_nbuf_free_debug);
 
+void qdf_nbuf_free_bulk_debug(qdf_nbuf_t *bufs, uint32_t num,
+			      const char *func, uint32_t line)
+{
+	uint32_t i;
+
+	for (i = 0; i < num; i++) {
+		if (qdf_likely(bufs[i]))
+			qdf_nbuf_free_debug_untrack(bufs[i], func, line);
+	}
+
+	__qdf_nbuf_free_bulk(bufs, num);
+}
+qdf_export_symbol(qdf_nbuf_free_bulk_debug);
+
 qdf_nbuf_t qdf_nbuf_clone_debug(qdf_nbuf_t buf, const char *func, uint32_t line)
 {
 	uint32_t num_nr_frags;
@@ -5156,6 +5323,76 @@ void __qdf_nbuf_reg_free_cb(qdf_nbuf_free_t cb_func_ptr)
 
 qdf_export_symbol(__qdf_nbuf_reg_free_cb);
 
+/**
+ * __qdf_nbuf_parse_pkt_meta() - parse the L2/L3/L4 headers of a packet once
+ * @skb: sk buff
+ * @meta: header summary to fill
+ *
+ * Return: none
+ */
+void __qdf_nbuf_parse_pkt_meta(struct sk_buff *skb,
+			       struct qdf_nbuf_pkt_meta *meta)
+{
+	uint8_t *data = skb->data;
+	uint8_t *l4_hdr = NULL;
+	struct iphdr *iphdr;
+	struct ipv6hdr *ipv6hdr;
+
+	qdf_mem_zero(meta, sizeof(*meta));
+
+	/* check destination mac address is broadcast/multicast */
+	if (is_broadcast_ether_addr(data))
+		meta->is_bcast = 1;
+	else if (is_multicast_ether_addr(data))
+		meta->is_mcast = 1;
+
+	meta->ether_type = __qdf_nbuf_get_ether_type(data);
+	meta->ip_offset = __qdf_nbuf_get_ip_offset(data);
+
+	if (meta->ether_type == QDF_SWAP_U16(QDF_NBUF_TRAC_ARP_ETH_TYPE)) {
+		meta->pkt_type = QDF_NBUF_CB_PACKET_TYPE_ARP;
+	} else if (meta->ether_type ==
+		   QDF_SWAP_U16(QDF_NBUF_TRAC_EAPOL_ETH_TYPE)) {
+		meta->pkt_type = QDF_NBUF_CB_PACKET_TYPE_EAPOL;
+	} else if (meta->ether_type ==
+		   QDF_SWAP_U16(QDF_NBUF_TRAC_WAPI_ETH_TYPE)) {
+		meta->pkt_type = QDF_NBUF_CB_PACKET_TYPE_WAPI;
+	} else if (meta->ether_type ==
+		   QDF_SWAP_U16(QDF_NBUF_TRAC_IPV4_ETH_TYPE)) {
+		meta->is_ipv4 = 1;
+		iphdr = (struct iphdr *)(data + meta->ip_offset);
+		meta->l4_proto = iphdr->protocol;
+		l4_hdr = data + meta->ip_offset +
+			 iphdr->ihl * QDF_NBUF_IPV4_HDR_SIZE_UNIT;
+		if (meta->l4_proto == QDF_NBUF_TRAC_ICMP_TYPE)
+			meta->pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMP;
+	} else if (meta->ether_type ==
+		   QDF_SWAP_U16(QDF_NBUF_TRAC_IPV6_ETH_TYPE)) {
+		meta->is_ipv6 = 1;
+		ipv6hdr = (struct ipv6hdr *)(data + meta->ip_offset);
+		meta->l4_proto = ipv6hdr->nexthdr;
+		l4_hdr = data + meta->ip_offset +
+			 QDF_NBUF_TRAC_IPV6_HEADER_SIZE;
+		if (meta->l4_proto == QDF_NBUF_TRAC_ICMPV6_TYPE)
+			meta->pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMPv6;
+	}
+
+	if (!l4_hdr || (meta->l4_proto != QDF_NBUF_TRAC_TCP_TYPE &&
+			meta->l4_proto != QDF_NBUF_TRAC_UDP_TYPE))
+		return;
+
+	meta->src_port = *(uint16_t *)l4_hdr;
+	meta->dst_port = *(uint16_t *)(l4_hdr + sizeof(uint16_t));
+
+	if (meta->is_ipv4 && meta->l4_proto == QDF_NBUF_TRAC_UDP_TYPE &&
+	    (((meta->src_port == QDF_SWAP_U16(QDF_NBUF_TRAC_DHCP_SRV_PORT)) &&
+	      (meta->dst_port == QDF_SWAP_U16(QDF_NBUF_TRAC_DHCP_CLI_PORT))) ||
+	     ((meta->src_port == QDF_SWAP_U16(QDF_NBUF_TRAC_DHCP_CLI_PORT)) &&
+	      (meta->dst_port == QDF_SWAP_U16(QDF_NBUF_TRAC_DHCP_SRV_PORT)))))
+		meta->pkt_type = QDF_NBUF_CB_PACKET_TYPE_DHCP;
+}
+qdf_export_symbol(__qdf_nbuf_parse_pkt_meta);
+
 /**
  * qdf_nbuf_classify_pkt() - classify packet
  * @skb - sk buff
@@ -5164,26 +5401,26 @@ qdf_export_symbol(__qdf_nbuf_reg_free_cb);
  */
 void qdf_nbuf_classify_pkt(struct sk_buff *skb)
 {
-	struct ethhdr *eh = (struct ethhdr *)skb->data;
+	struct qdf_nbuf_pkt_meta meta;
+
+	__qdf_nbuf_parse_pkt_meta(skb, &meta);
 
 	/* check destination mac address is broadcast/multicast */
-	if (is_broadcast_ether_addr((uint8_t *)eh))
+	if (meta.is_bcast)
 		QDF_NBUF_CB_SET_BCAST(skb);
-	else if (is_multicast_ether_addr((uint8_t *)eh))
+	else if (meta.is_mcast)
 		QDF_NBUF_CB_SET_MCAST(skb);
 
-	if (qdf_nbuf_is_ipv4_arp_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_ARP;
-	else if (qdf_nbuf_is_ipv4_dhcp_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_DHCP;
-	else if (qdf_nbuf_is_ipv4_eapol_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_EAPOL;
-	else if (qdf_nbuf_is_ipv4_wapi_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_WAPI;
+	switch (meta.pkt_type) {
+	case QDF_NBUF_CB_PACKET_TYPE_ARP:
+	case QDF_NBUF_CB_PACKET_TYPE_DHCP:
+	case QDF_NBUF_CB_PACKET_TYPE_EAPOL:
+	case QDF_NBUF_CB_PACKET_TYPE_WAPI:
+		QDF_NBUF_CB_GET_PACKET_TYPE(skb) = meta.pkt_type;
+		break;
+	default:
+		break;
+	}
 }
 qdf_export_symbol(qdf_nbuf_classify_pkt);
 
@@ -76,7 +76,22 @@ static t_qdf_trace_data g_qdf_trace_data;
 static tp_qdf_trace_cb qdf_trace_cb_table[QDF_MODULE_ID_MAX];
 static tp_qdf_trace_cb qdf_trace_restore_cb_table[QDF_MODULE_ID_MAX];
 
-#ifdef WLAN_LOGGING_BUFFERS_DYNAMICALLY
+#ifdef QDF_TRACE_PERCPU_RING
+#define QDF_TRACE_PERCPU_RING_MASK (QDF_TRACE_PERCPU_RECORDS - 1)
+
+/**
+ * struct qdf_trace_ring_cursor - merge position in a per-CPU snapshot
+ * @pos: next record to merge
+ * @end: end of the records copied from the CPU ring
+ */
+struct qdf_trace_ring_cursor {
+	uint32_t pos;
+	uint32_t end;
+};
+
+/* one ring per possible CPU, indexed by CPU id */
+static struct qdf_trace_ring *g_qdf_trace_rings;
+#elif defined(WLAN_LOGGING_BUFFERS_DYNAMICALLY)
 static qdf_trace_record_t *g_qdf_trace_tbl;
 #else
 static qdf_trace_record_t g_qdf_trace_tbl[MAX_QDF_TRACE_RECORDS];
@@ -238,7 +253,21 @@ qdf_export_symbol(qdf_trace_hex_ascii_dump);
 
 #ifdef TRACE_RECORD
 
-#ifdef WLAN_LOGGING_BUFFERS_DYNAMICALLY
+#ifdef QDF_TRACE_PERCPU_RING
+static inline QDF_STATUS allocate_g_qdf_trace_tbl_buffer(void)
+{
+	g_qdf_trace_rings = qdf_mem_valloc(nr_cpu_ids *
+					   sizeof(*g_qdf_trace_rings));
+	QDF_BUG(g_qdf_trace_rings);
+	return g_qdf_trace_rings ? QDF_STATUS_SUCCESS : QDF_STATUS_E_NOMEM;
+}
+
+static inline void free_g_qdf_trace_tbl_buffer(void)
+{
+	qdf_mem_vfree(g_qdf_trace_rings);
+	g_qdf_trace_rings = NULL;
+}
+#elif defined(WLAN_LOGGING_BUFFERS_DYNAMICALLY)
 static inline QDF_STATUS allocate_g_qdf_trace_tbl_buffer(void)
 {
 	g_qdf_trace_tbl = qdf_mem_valloc(MAX_QDF_TRACE_RECORDS *
@@ -367,6 +396,67 @@ void qdf_trace_deinit(void)
 
 qdf_export_symbol(qdf_trace_deinit);
 
+#ifdef QDF_TRACE_PERCPU_RING
+/**
+ * qdf_trace_ring_record() - puts a record in to the ring of the local CPU
+ * @rings: per-CPU rings, indexed by CPU id
+ * @module: Enum of module, basically module id.
+ * @code: Code to be recorded
+ * @session: Session ID of the log
+ * @data: Actual message contents
+ *
+ * Return: None
+ */
+void qdf_trace_ring_record(struct qdf_trace_ring *rings, uint8_t module,
+			   uint16_t code, uint16_t session, uint32_t data)
+{
+	struct qdf_trace_ring *ring;
+	struct qdf_trace_ring_slot *slot;
+	uint32_t idx;
+
+	/* the atomic index gives a nested interrupt writer its own slot */
+	ring = &rings[get_cpu()];
+	idx = qdf_atomic_inc_return(&ring->widx) - 1;
+	slot = &ring->slot[idx & QDF_TRACE_PERCPU_RING_MASK];
+
+	WRITE_ONCE(slot->seq, 0);
+	qdf_wmb();
+	slot->rec.code = code;
+	slot->rec.session = session;
+	slot->rec.data = data;
+	slot->rec.qtime = qdf_get_log_timestamp();
+	slot->rec.module = module;
+	slot->rec.pid = (in_interrupt() ? 0 : current->pid);
+	qdf_wmb();
+	WRITE_ONCE(slot->seq, idx + 1);
+	put_cpu();
+}
+qdf_export_symbol(qdf_trace_ring_record);
+
+/**
+ * qdf_trace() - puts the messages in to the ring-buffer of the local CPU
+ * @module: Enum of module, basically module id.
+ * @code: Code to be recorded
+ * @session: Session ID of the log
+ * @data: Actual message contents
+ *
+ * Only the raw log timestamp is recorded here, the wall clock string is
+ * derived from it by qdf_trace_dump_all().
+ *
+ * Return: None
+ */
+void qdf_trace(uint8_t module, uint16_t code, uint16_t session, uint32_t data)
+{
+	if (!g_qdf_trace_data.enable)
+		return;
+
+	/* if module is not registered, don't record for that module */
+	if (!qdf_trace_cb_table[module])
+		return;
+
+	qdf_trace_ring_record(g_qdf_trace_rings, module, code, session, data);
+}
+#else
 /**
  * qdf_trace() - puts the messages in to ring-buffer
  * @module: Enum of module, basically module id.
@@ -434,6 +524,7 @@ void qdf_trace(uint8_t module, uint16_t code, uint16_t session, uint32_t data)
 	g_qdf_trace_data.num_since_last_dump++;
 	spin_unlock_irqrestore(&ltrace_lock, flags);
 }
+#endif
 qdf_export_symbol(qdf_trace);
 
 #ifdef ENABLE_MTRACE_LOG
@@ -498,6 +589,178 @@ void qdf_trace_register(QDF_MODULE_ID module_id,
 }
 qdf_export_symbol(qdf_trace_register);
 
+#ifdef QDF_TRACE_PERCPU_RING
+/**
+ * qdf_trace_ring_snapshot() - copy the records of one per-CPU ring
+ * @ring: ring to copy
+ * @out: destination with room for QDF_TRACE_PERCPU_RECORDS records
+ *
+ * Records the owning CPU overwrites while they are copied are dropped, as
+ * are the slots of a ring that has not wrapped yet.
+ *
+ * Return: number of records copied, oldest first
+ */
+uint32_t qdf_trace_ring_snapshot(struct qdf_trace_ring *ring,
+				 qdf_trace_record_t *out)
+{
+	struct qdf_trace_ring_slot *slot;
+	uint32_t widx, idx, seq;
+	uint32_t num = 0;
+
+	widx = qdf_atomic_read(&ring->widx);
+	for (idx = widx - QDF_TRACE_PERCPU_RECORDS; idx != widx; idx++) {
+		slot = &ring->slot[idx & QDF_TRACE_PERCPU_RING_MASK];
+		seq = READ_ONCE(slot->seq);
+		qdf_rmb();
+		out[num] = slot->rec;
+		qdf_rmb();
+		if (!seq || seq != idx + 1 || READ_ONCE(slot->seq) != seq)
+			continue;
+		num++;
+	}
+
+	return num;
+}
+qdf_export_symbol(qdf_trace_ring_snapshot);
+
+/**
+ * qdf_trace_fill_time() - format the wall clock time of a record
+ * @rec: trace record
+ * @now_us: current log timestamp in microseconds
+ * @now_tod_us: current time of the day in microseconds
+ *
+ * Return: None
+ */
+void qdf_trace_fill_time(qdf_trace_record_t *rec, uint64_t now_us,
+			 uint64_t now_tod_us)
+{
+	uint64_t age_us = now_us - qdf_log_timestamp_to_usecs(rec->qtime);
+	uint32_t sec, usec, age_sec, age_usec;
+
+	sec = qdf_do_div(now_tod_us, 1000000);
+	usec = qdf_do_div_rem(now_tod_us, 1000000);
+	age_sec = qdf_do_div_rem(qdf_do_div(age_us, 1000000), 86400);
+	age_usec = qdf_do_div_rem(age_us, 1000000);
+
+	sec += 86400 - age_sec;
+	if (usec < age_usec) {
+		usec += 1000000;
+		sec--;
+	}
+	usec -= age_usec;
+	sec %= 86400;
+
+	scnprintf(rec->time, sizeof(rec->time), "[%02u:%02u:%02u.%06u]",
+		  sec / 3600, (sec / 60) % 60, sec % 60, usec);
+}
+qdf_export_symbol(qdf_trace_fill_time);
+
+/**
+ * qdf_trace_ring_dump() - Dump data from a set of per-CPU ring buffers
+ * @rings: per-CPU rings, indexed by CPU id
+ * @nr_rings: number of rings in @rings
+ * @cb_table: dump call back of each module, indexed by module id
+ * @p_mac: Context of particular module
+ * @code: Reason code
+ * @count: Number of lines to dump starting from tail to head
+ * @bitmask_of_module: modules to dump, 0 for all of them
+ *
+ * The rings are copied, merged in timestamp order and the wall clock
+ * string of each record is formatted before it is handed to the module
+ * call back.
+ *
+ * Return: None
+ */
+void qdf_trace_ring_dump(struct qdf_trace_ring *rings, uint32_t nr_rings,
+			 tp_qdf_trace_cb *cb_table, void *p_mac, uint8_t code,
+			 uint32_t count, uint32_t bitmask_of_module)
+{
+	struct qdf_trace_ring_cursor *cursor;
+	qdf_trace_record_t *snap, *rec;
+	uint64_t now_us, now_tod_us;
+	uint32_t i, cpu, min_cpu, total = 0;
+
+	cursor = qdf_mem_valloc(nr_rings * sizeof(*cursor));
+	snap = qdf_mem_valloc(nr_rings * QDF_TRACE_PERCPU_RECORDS *
+			      sizeof(*snap));
+	if (!cursor || !snap)
+		goto free;
+
+	for (cpu = 0; cpu < nr_rings; cpu++) {
+		cursor[cpu].pos = cpu * QDF_TRACE_PERCPU_RECORDS;
+		cursor[cpu].end = cursor[cpu].pos +
+			qdf_trace_ring_snapshot(&rings[cpu],
+						&snap[cursor[cpu].pos]);
+		total += cursor[cpu].end - cursor[cpu].pos;
+	}
+
+	/* taken after the copy so that no record is newer than now */
+	now_us = qdf_log_timestamp_to_usecs(qdf_get_log_timestamp());
+	now_tod_us = qdf_get_time_of_the_day_us();
+
+	QDF_TRACE(QDF_MODULE_ID_SYS, QDF_TRACE_LEVEL_INFO,
+		  "DPT: Total Records: %d, CPUs: %d", total, nr_rings);
+
+	if (!count || count > total)
+		count = total;
+
+	for (i = 0; i < total; i++) {
+		rec = NULL;
+		min_cpu = 0;
+		for (cpu = 0; cpu < nr_rings; cpu++) {
+			if (cursor[cpu].pos == cursor[cpu].end)
+				continue;
+			if (!rec || snap[cursor[cpu].pos].qtime < rec->qtime) {
+				rec = &snap[cursor[cpu].pos];
+				min_cpu = cpu;
+			}
+		}
+		cursor[min_cpu].pos++;
+
+		if (i < total - count)
+			continue;
+		if (code && code != rec->code)
+			continue;
+		if (!cb_table[rec->module])
+			continue;
+		if (bitmask_of_module &&
+		    !(bitmask_of_module & (1 << rec->module)))
+			continue;
+
+		qdf_trace_fill_time(rec, now_us, now_tod_us);
+		cb_table[rec->module](p_mac, rec, (uint16_t)i);
+	}
+
+free:
+	qdf_mem_vfree(snap);
+	qdf_mem_vfree(cursor);
+}
+qdf_export_symbol(qdf_trace_ring_dump);
+
+/**
+ * qdf_trace_dump_all() - Dump data from the per-CPU ring buffers via call
+ * back functions registered with QDF
+ * @p_mac: Context of particular module
+ * @code: Reason code
+ * @session: Session id of log
+ * @count: Number of lines to dump starting from tail to head
+ * @bitmask_of_module: modules to dump, 0 for all of them
+ *
+ * Return: None
+ */
+void qdf_trace_dump_all(void *p_mac, uint8_t code, uint8_t session,
+	uint32_t count, uint32_t bitmask_of_module)
+{
+	if (!g_qdf_trace_data.enable || !g_qdf_trace_rings) {
+		QDF_TRACE(QDF_MODULE_ID_SYS,
+			  QDF_TRACE_LEVEL_ERROR, "Tracing Disabled");
+		return;
+	}
+
+	qdf_trace_ring_dump(g_qdf_trace_rings, nr_cpu_ids, qdf_trace_cb_table,
+			    p_mac, code, count, bitmask_of_module);
+}
+#else
 /**
  * qdf_trace_dump_all() - Dump data from ring buffer via call back functions
  * registered with QDF
@@ -599,6 +862,7 @@ void qdf_trace_dump_all(void *p_mac, uint8_t code, uint8_t session,
 		spin_unlock(&ltrace_lock);
 	}
 }
+#endif
 qdf_export_symbol(qdf_trace_dump_all);
 #endif
 
@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_nbuf.h"
+#include "qdf_nbuf_classify_test.h"
+#include "qdf_net_types.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "qdf_util.h"
+
+#define qdf_nbuf_classify_ut_frame_len 96
+#define qdf_nbuf_classify_ut_vlan_id 100
+#define qdf_nbuf_classify_ut_bench_iter 10000
+
+/**
+ * enum qdf_nbuf_classify_ut_change - intended legacy vs. single pass delta
+ * @QDF_NBUF_CLASSIFY_UT_SAME: both classifiers must agree
+ * @QDF_NBUF_CLASSIFY_UT_VLAN: the frame is 802.1Q tagged and only the single
+ *	pass parser looks past the tag for this frame
+ * @QDF_NBUF_CLASSIFY_UT_DHCP_UDP: DHCP ports on a non UDP datagram are no
+ *	longer reported as DHCP
+ */
+enum qdf_nbuf_classify_ut_change {
+	QDF_NBUF_CLASSIFY_UT_SAME,
+	QDF_NBUF_CLASSIFY_UT_VLAN,
+	QDF_NBUF_CLASSIFY_UT_DHCP_UDP,
+};
+
+/**
+ * struct qdf_nbuf_classify_ut_case - one synthetic frame of the corpus
+ * @name: case name printed on failure
+ * @dst: destination mac address
+ * @vlan: insert an 802.1Q tag before @ether_type
+ * @ether_type: ether type, host order
+ * @l4_proto: IPv4 protocol or IPv6 next header
+ * @src_port: TCP/UDP source port, host order
+ * @dst_port: TCP/UDP destination port, host order
+ * @pkt_type: expected QDF_NBUF_CB_PACKET_TYPE_* from the single pass parser
+ * @change: expected difference from the legacy predicate chain
+ */
+struct qdf_nbuf_classify_ut_case {
+	const char *name;
+	const uint8_t *dst;
+	bool vlan;
+	uint16_t ether_type;
+	uint8_t l4_proto;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t pkt_type;
+	enum qdf_nbuf_classify_ut_change change;
+};
+
+/**
+ * struct qdf_nbuf_classify_ut_result - what a classifier reported for a frame
+ * @pkt_type: QDF_NBUF_CB_PACKET_TYPE_* value
+ * @l4_proto: ICMP/TCP/UDP as seen by the connectivity stats, 0 otherwise
+ * @is_bcast: destination is broadcast
+ * @is_mcast: destination is multicast
+ */
+struct qdf_nbuf_classify_ut_result {
+	uint8_t pkt_type;
+	uint8_t l4_proto;
+	bool is_bcast;
+	bool is_mcast;
+};
+
+static const uint8_t qdf_nbuf_classify_ut_bcast[QDF_MAC_ADDR_SIZE] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t qdf_nbuf_classify_ut_ucast[QDF_MAC_ADDR_SIZE] = {
+	0x00, 0x03, 0x7f, 0x12, 0x34, 0x56
+};
+
+static const uint8_t qdf_nbuf_classify_ut_mcast[QDF_MAC_ADDR_SIZE] = {
+	0x33, 0x33, 0x00, 0x00, 0x00, 0x01
+};
+
+static const uint8_t qdf_nbuf_classify_ut_src[QDF_MAC_ADDR_SIZE] = {
+	0x00, 0x03, 0x7f, 0x65, 0x43, 0x21
+};
+
+static const struct qdf_nbuf_classify_ut_case qdf_nbuf_classify_ut_cases[] = {
+	{ .name = "arp", .dst = qdf_nbuf_classify_ut_bcast,
+	  .ether_type = QDF_NBUF_TRAC_ARP_ETH_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_ARP },
+	{ .name = "vlan arp", .dst = qdf_nbuf_classify_ut_bcast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_ARP_ETH_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_ARP },
+	{ .name = "dhcp discover", .dst = qdf_nbuf_classify_ut_bcast,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_UDP_TYPE,
+	  .src_port = QDF_NBUF_TRAC_DHCP_CLI_PORT,
+	  .dst_port = QDF_NBUF_TRAC_DHCP_SRV_PORT,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_DHCP },
+	{ .name = "dhcp offer", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_UDP_TYPE,
+	  .src_port = QDF_NBUF_TRAC_DHCP_SRV_PORT,
+	  .dst_port = QDF_NBUF_TRAC_DHCP_CLI_PORT,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_DHCP },
+	{ .name = "vlan dhcp", .dst = qdf_nbuf_classify_ut_bcast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_UDP_TYPE,
+	  .src_port = QDF_NBUF_TRAC_DHCP_CLI_PORT,
+	  .dst_port = QDF_NBUF_TRAC_DHCP_SRV_PORT,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_DHCP,
+	  .change = QDF_NBUF_CLASSIFY_UT_VLAN },
+	{ .name = "tcp on dhcp ports", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_TCP_TYPE,
+	  .src_port = QDF_NBUF_TRAC_DHCP_CLI_PORT,
+	  .dst_port = QDF_NBUF_TRAC_DHCP_SRV_PORT,
+	  .change = QDF_NBUF_CLASSIFY_UT_DHCP_UDP },
+	{ .name = "eapol", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_EAPOL_ETH_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_EAPOL },
+	{ .name = "vlan eapol", .dst = qdf_nbuf_classify_ut_ucast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_EAPOL_ETH_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_EAPOL },
+	{ .name = "wapi", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_WAPI_ETH_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_WAPI },
+	{ .name = "vlan wapi", .dst = qdf_nbuf_classify_ut_ucast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_WAPI_ETH_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_WAPI,
+	  .change = QDF_NBUF_CLASSIFY_UT_VLAN },
+	{ .name = "icmp", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_ICMP_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMP },
+	{ .name = "vlan icmp", .dst = qdf_nbuf_classify_ut_ucast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_ICMP_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMP,
+	  .change = QDF_NBUF_CLASSIFY_UT_VLAN },
+	{ .name = "tcp", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_TCP_TYPE,
+	  .src_port = 49152, .dst_port = 80 },
+	{ .name = "vlan tcp", .dst = qdf_nbuf_classify_ut_ucast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_TCP_TYPE,
+	  .src_port = 49152, .dst_port = 80,
+	  .change = QDF_NBUF_CLASSIFY_UT_VLAN },
+	{ .name = "udp", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_UDP_TYPE,
+	  .src_port = 49152, .dst_port = 53 },
+	{ .name = "vlan udp", .dst = qdf_nbuf_classify_ut_ucast, .vlan = true,
+	  .ether_type = QDF_NBUF_TRAC_IPV4_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_UDP_TYPE,
+	  .src_port = 49152, .dst_port = 53,
+	  .change = QDF_NBUF_CLASSIFY_UT_VLAN },
+	{ .name = "icmpv6", .dst = qdf_nbuf_classify_ut_mcast,
+	  .ether_type = QDF_NBUF_TRAC_IPV6_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_ICMPV6_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMPv6 },
+	{ .name = "vlan icmpv6", .dst = qdf_nbuf_classify_ut_mcast,
+	  .vlan = true, .ether_type = QDF_NBUF_TRAC_IPV6_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_ICMPV6_TYPE,
+	  .pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMPv6,
+	  .change = QDF_NBUF_CLASSIFY_UT_VLAN },
+	{ .name = "dhcpv6", .dst = qdf_nbuf_classify_ut_mcast,
+	  .ether_type = QDF_NBUF_TRAC_IPV6_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_UDP_TYPE,
+	  .src_port = QDF_NBUF_TRAC_DHCP6_CLI_PORT,
+	  .dst_port = QDF_NBUF_TRAC_DHCP6_SRV_PORT },
+	{ .name = "tcpv6", .dst = qdf_nbuf_classify_ut_ucast,
+	  .ether_type = QDF_NBUF_TRAC_IPV6_ETH_TYPE,
+	  .l4_proto = QDF_NBUF_TRAC_TCP_TYPE,
+	  .src_port = 49152, .dst_port = 443 },
+};
+
+static void qdf_nbuf_classify_ut_put_be16(uint8_t *buf, uint16_t val)
+{
+	buf[0] = val >> 8;
+	buf[1] = val & 0xff;
+}
+
+/**
+ * qdf_nbuf_classify_ut_build() - build the frame described by a test case
+ * @tc: test case
+ *
+ * Return: nbuf holding the frame, NULL on allocation failure
+ */
+static qdf_nbuf_t
+qdf_nbuf_classify_ut_build(const struct qdf_nbuf_classify_ut_case *tc)
+{
+	uint8_t frame[qdf_nbuf_classify_ut_frame_len];
+	uint8_t *l3;
+	uint8_t *l4 = NULL;
+	qdf_nbuf_t nbuf;
+
+	qdf_mem_zero(frame, sizeof(frame));
+	qdf_mem_copy(frame, tc->dst, QDF_MAC_ADDR_SIZE);
+	qdf_mem_copy(frame + QDF_MAC_ADDR_SIZE, qdf_nbuf_classify_ut_src,
+		     QDF_MAC_ADDR_SIZE);
+
+	l3 = frame + QDF_NBUF_TRAC_ETH_TYPE_OFFSET;
+	if (tc->vlan) {
+		qdf_nbuf_classify_ut_put_be16(l3, QDF_ETH_TYPE_8021Q);
+		qdf_nbuf_classify_ut_put_be16(l3 + 2,
+					      qdf_nbuf_classify_ut_vlan_id);
+		l3 += 4;
+	}
+	qdf_nbuf_classify_ut_put_be16(l3, tc->ether_type);
+	l3 += 2;
+
+	if (tc->ether_type == QDF_NBUF_TRAC_IPV4_ETH_TYPE) {
+		/* version 4, 5 word header, ttl 64 */
+		l3[0] = 0x45;
+		l3[8] = 64;
+		l3[9] = tc->l4_proto;
+		l4 = l3 + 5 * QDF_NBUF_IPV4_HDR_SIZE_UNIT;
+	} else if (tc->ether_type == QDF_NBUF_TRAC_IPV6_ETH_TYPE) {
+		/* version 6, hop limit 64 */
+		l3[0] = 0x60;
+		l3[6] = tc->l4_proto;
+		l3[7] = 64;
+		l4 = l3 + QDF_NBUF_TRAC_IPV6_HEADER_SIZE;
+	}
+
+	if (l4) {
+		qdf_nbuf_classify_ut_put_be16(l4, tc->src_port);
+		qdf_nbuf_classify_ut_put_be16(l4 + 2, tc->dst_port);
+	}
+
+	nbuf = qdf_nbuf_alloc(NULL, sizeof(frame), 0, 4, false);
+	if (!nbuf)
+		return NULL;
+
+	qdf_mem_copy(qdf_nbuf_put_tail(nbuf, sizeof(frame)), frame,
+		     sizeof(frame));
+
+	return nbuf;
+}
+
+/**
+ * qdf_nbuf_classify_ut_legacy() - classify a frame the way the TX path and
+ *	the connectivity stats did before qdf_nbuf_parse_pkt_meta(), one
+ *	qdf_nbuf_is_*() predicate at a time
+ * @nbuf: frame to classify
+ * @res: classification result
+ *
+ * Return: none
+ */
+static void qdf_nbuf_classify_ut_legacy(qdf_nbuf_t nbuf,
+					struct qdf_nbuf_classify_ut_result *res)
+{
+	struct qdf_mac_addr *dst = (struct qdf_mac_addr *)qdf_nbuf_data(nbuf);
+
+	qdf_mem_zero(res, sizeof(*res));
+
+	if (qdf_is_macaddr_broadcast(dst))
+		res->is_bcast = true;
+	else if (qdf_is_macaddr_group(dst))
+		res->is_mcast = true;
+
+	if (qdf_nbuf_is_ipv4_arp_pkt(nbuf))
+		res->pkt_type = QDF_NBUF_CB_PACKET_TYPE_ARP;
+	else if (qdf_nbuf_is_ipv4_dhcp_pkt(nbuf))
+		res->pkt_type = QDF_NBUF_CB_PACKET_TYPE_DHCP;
+	else if (qdf_nbuf_is_ipv4_eapol_pkt(nbuf))
+		res->pkt_type = QDF_NBUF_CB_PACKET_TYPE_EAPOL;
+	else if (qdf_nbuf_is_ipv4_wapi_pkt(nbuf))
+		res->pkt_type = QDF_NBUF_CB_PACKET_TYPE_WAPI;
+	else if (qdf_nbuf_is_icmp_pkt(nbuf))
+		res->pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMP;
+	else if (qdf_nbuf_is_icmpv6_pkt(nbuf))
+		res->pkt_type = QDF_NBUF_CB_PACKET_TYPE_ICMPv6;
+
+	if (qdf_nbuf_is_icmp_pkt(nbuf))
+		res->l4_proto = QDF_NBUF_TRAC_ICMP_TYPE;
+	else if (qdf_nbuf_is_ipv4_tcp_pkt(nbuf))
+		res->l4_proto = QDF_NBUF_TRAC_TCP_TYPE;
+	else if (qdf_nbuf_is_ipv4_udp_pkt(nbuf))
+		res->l4_proto = QDF_NBUF_TRAC_UDP_TYPE;
+}
+
+/**
+ * qdf_nbuf_classify_ut_single() - classify a frame with one
+ *	qdf_nbuf_parse_pkt_meta() pass
+ * @nbuf: frame to classify
+ * @res: classification result
+ *
+ * Return: none
+ */
+static void qdf_nbuf_classify_ut_single(qdf_nbuf_t nbuf,
+					struct qdf_nbuf_classify_ut_result *res)
+{
+	struct qdf_nbuf_pkt_meta meta;
+
+	qdf_nbuf_parse_pkt_meta(nbuf, &meta);
+
+	qdf_mem_zero(res, sizeof(*res));
+	res->pkt_type = meta.pkt_type;
+	res->is_bcast = meta.is_bcast;
+	res->is_mcast = meta.is_mcast;
+
+	if (meta.is_ipv4 && (meta.l4_proto == QDF_NBUF_TRAC_ICMP_TYPE ||
+			     meta.l4_proto == QDF_NBUF_TRAC_TCP_TYPE ||
+			     meta.l4_proto == QDF_NBUF_TRAC_UDP_TYPE))
+		res->l4_proto = meta.l4_proto;
+}
+
+static uint32_t
+qdf_nbuf_classify_ut_case(const struct qdf_nbuf_classify_ut_case *tc,
+			  qdf_nbuf_t nbuf)
+{
+	struct qdf_nbuf_classify_ut_result legacy;
+	struct qdf_nbuf_classify_ut_result single;
+	uint8_t l4_proto = 0;
+	bool same;
+	uint32_t errors = 0;
+
+	qdf_nbuf_classify_ut_legacy(nbuf, &legacy);
+	qdf_nbuf_classify_ut_single(nbuf, &single);
+
+	if (tc->ether_type == QDF_NBUF_TRAC_IPV4_ETH_TYPE)
+		l4_proto = tc->l4_proto;
+
+	if (single.pkt_type != tc->pkt_type ||
+	    single.l4_proto != l4_proto) {
+		qdf_nofl_alert("FAIL: %s: pkt_type %u l4 %u, expected %u l4 %u",
+			       tc->name, single.pkt_type, single.l4_proto,
+			       tc->pkt_type, l4_proto);
+		errors++;
+	}
+
+	if (single.is_bcast != legacy.is_bcast ||
+	    single.is_mcast != legacy.is_mcast) {
+		qdf_nofl_alert("FAIL: %s: bcast/mcast %u/%u, legacy %u/%u",
+			       tc->name, single.is_bcast, single.is_mcast,
+			       legacy.is_bcast, legacy.is_mcast);
+		errors++;
+	}
+
+	/* the classifiers may only disagree where the change is intended */
+	same = single.pkt_type == legacy.pkt_type &&
+	       single.l4_proto == legacy.l4_proto;
+	if (same != (tc->change == QDF_NBUF_CLASSIFY_UT_SAME)) {
+		qdf_nofl_alert("FAIL: %s: pkt_type %u l4 %u, legacy %u l4 %u, change %u",
+			       tc->name, single.pkt_type, single.l4_proto,
+			       legacy.pkt_type, legacy.l4_proto, tc->change);
+		errors++;
+	}
+
+	return errors;
+}
+
+/**
+ * qdf_nbuf_classify_ut_bench() - time the legacy predicate chain against the
+ *	single pass parser over the corpus
+ * @nbufs: corpus frames
+ * @count: number of frames in @nbufs
+ *
+ * Return: none
+ */
+static void qdf_nbuf_classify_ut_bench(qdf_nbuf_t *nbufs, uint32_t count)
+{
+	struct qdf_nbuf_classify_ut_result res;
+	uint64_t legacy_ns;
+	uint64_t single_ns;
+	uint32_t frames;
+	int64_t start;
+	uint32_t iter;
+	uint32_t i;
+
+	start = qdf_ktime_to_ns(qdf_ktime_get());
+	for (iter = 0; iter < qdf_nbuf_classify_ut_bench_iter; iter++)
+		for (i = 0; i < count; i++)
+			qdf_nbuf_classify_ut_legacy(nbufs[i], &res);
+	legacy_ns = qdf_ktime_to_ns(qdf_ktime_get()) - start;
+
+	start = qdf_ktime_to_ns(qdf_ktime_get());
+	for (iter = 0; iter < qdf_nbuf_classify_ut_bench_iter; iter++)
+		for (i = 0; i < count; i++)
+			qdf_nbuf_classify_ut_single(nbufs[i], &res);
+	single_ns = qdf_ktime_to_ns(qdf_ktime_get()) - start;
+
+	frames = qdf_nbuf_classify_ut_bench_iter * count;
+	qdf_nofl_info("nbuf classify: legacy %llu ns, single pass %llu ns per frame",
+		      qdf_do_div(legacy_ns, frames),
+		      qdf_do_div(single_ns, frames));
+}
+
+uint32_t qdf_nbuf_classify_unit_test(void)
+{
+	qdf_nbuf_t nbufs[QDF_ARRAY_SIZE(qdf_nbuf_classify_ut_cases)];
+	uint32_t count = QDF_ARRAY_SIZE(qdf_nbuf_classify_ut_cases);
+	uint32_t errors = 0;
+	uint32_t i;
+
+	for (i = 0; i < count; i++) {
+		nbufs[i] = qdf_nbuf_classify_ut_build(
+					&qdf_nbuf_classify_ut_cases[i]);
+		if (!nbufs[i]) {
+			qdf_nofl_alert("FAIL: %s: nbuf alloc failed",
+				       qdf_nbuf_classify_ut_cases[i].name);
+			errors++;
+			count = i;
+			goto free;
+		}
+	}
+
+	for (i = 0; i < count; i++)
+		errors += qdf_nbuf_classify_ut_case(
+					&qdf_nbuf_classify_ut_cases[i],
+					nbufs[i]);
+
+	qdf_nbuf_classify_ut_bench(nbufs, count);
+
+free:
+	for (i = 0; i < count; i++)
+		qdf_nbuf_free(nbufs[i]);
+
+	return errors;
+}
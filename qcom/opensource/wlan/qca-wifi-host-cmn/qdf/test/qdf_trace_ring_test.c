@@ -0,0 +1,562 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_atomic.h"
+#include "qdf_dev.h"
+#include "qdf_lock.h"
+#include "qdf_mc_timer.h"
+#include "qdf_mem.h"
+#include "qdf_str.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "qdf_trace_ring_test.h"
+#include "qdf_util.h"
+
+#define qdf_trace_ring_ut_module QDF_MODULE_ID_QDF
+#define qdf_trace_ring_ut_flood_records (1 << 17)
+#define qdf_trace_ring_ut_dump_count 100
+#define qdf_trace_ring_ut_usecs_per_day 86400000000ULL
+
+/* one full wrap plus a partial lap, so that the oldest records are gone */
+#define qdf_trace_ring_ut_wrap_records (QDF_TRACE_PERCPU_RECORDS + 100)
+
+static tp_qdf_trace_cb qdf_trace_ring_ut_cb_table[QDF_MODULE_ID_MAX];
+
+/**
+ * struct qdf_trace_ring_ut_shared - the single MTRACE ring qdf_trace() used
+ *	before QDF_TRACE_PERCPU_RING, kept here as the flood baseline
+ * @lock: serializes all writers
+ * @data: ring head, tail and record count
+ * @tbl: MAX_QDF_TRACE_RECORDS records
+ */
+struct qdf_trace_ring_ut_shared {
+	qdf_spinlock_t lock;
+	t_qdf_trace_data data;
+	qdf_trace_record_t *tbl;
+};
+
+struct qdf_trace_ring_ut_ctx;
+
+struct qdf_trace_ring_ut_writer {
+	struct qdf_trace_ring_ut_ctx *ctx;
+	uint16_t id;
+	qdf_thread_t *thread;
+};
+
+/**
+ * struct qdf_trace_ring_ut_ctx - flood test context
+ * @rings: per-CPU rings written by the new path
+ * @nr_rings: number of rings in @rings
+ * @shared: shared ring written by the old path, NULL to flood @rings
+ * @writer: one writer thread per online CPU
+ * @nr_writers: number of writers in @writer
+ * @start: set once all the writers are pinned to their CPU
+ * @done: number of writers which recorded all of their records
+ */
+struct qdf_trace_ring_ut_ctx {
+	struct qdf_trace_ring *rings;
+	uint32_t nr_rings;
+	struct qdf_trace_ring_ut_shared *shared;
+	struct qdf_trace_ring_ut_writer *writer;
+	uint32_t nr_writers;
+	qdf_atomic_t start;
+	qdf_atomic_t done;
+};
+
+/**
+ * struct qdf_trace_ring_ut_dump - dump call back state
+ * @nr_writers: number of writers which filled the rings
+ * @next_seq: next sequence number expected from each writer
+ * @last_qtime: timestamp of the previous record
+ * @num: number of records dumped
+ * @errors: number of bad records seen
+ */
+struct qdf_trace_ring_ut_dump {
+	uint32_t nr_writers;
+	uint32_t *next_seq;
+	uint64_t last_qtime;
+	uint32_t num;
+	uint32_t errors;
+};
+
+/**
+ * qdf_trace_ring_ut_fill() - publish records straight into a ring slot by
+ *	slot, the way qdf_trace_ring_record() does on its owning CPU
+ * @ring: ring to fill
+ * @num: number of records to add
+ *
+ * Return: None
+ */
+static void qdf_trace_ring_ut_fill(struct qdf_trace_ring *ring, uint32_t num)
+{
+	struct qdf_trace_ring_slot *slot;
+	uint32_t idx;
+
+	while (num--) {
+		idx = qdf_atomic_inc_return(&ring->widx) - 1;
+		slot = &ring->slot[idx % QDF_TRACE_PERCPU_RECORDS];
+		slot->rec.qtime = idx;
+		slot->rec.module = qdf_trace_ring_ut_module;
+		slot->rec.code = (uint16_t)idx;
+		slot->rec.data = idx;
+		slot->seq = idx + 1;
+	}
+}
+
+static uint32_t qdf_trace_ring_ut_check_snapshot(qdf_trace_record_t *snap,
+						 uint32_t num,
+						 uint32_t first,
+						 uint32_t expected)
+{
+	uint32_t i;
+
+	if (num != expected) {
+		qdf_nofl_alert("FAIL: snapshot copied %u records, expected %u",
+			       num, expected);
+		return 1;
+	}
+
+	/* oldest first, strictly increasing and never torn */
+	for (i = 0; i < num; i++) {
+		if (snap[i].data < first ||
+		    (i && snap[i].data <= snap[i - 1].data) ||
+		    snap[i].code != (uint16_t)snap[i].data) {
+			qdf_nofl_alert("FAIL: snapshot record %u: data %u code %u",
+				       i, snap[i].data, snap[i].code);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static uint32_t qdf_trace_ring_ut_snapshot(void)
+{
+	struct qdf_trace_ring *ring;
+	struct qdf_trace_ring_slot *slot;
+	qdf_trace_record_t *snap;
+	uint32_t errors = 0;
+	uint32_t widx;
+	uint32_t num;
+
+	ring = qdf_mem_valloc(sizeof(*ring));
+	snap = qdf_mem_valloc(QDF_TRACE_PERCPU_RECORDS * sizeof(*snap));
+	if (!ring || !snap) {
+		errors++;
+		goto free;
+	}
+
+	/* a new ring has nothing to copy ... */
+	num = qdf_trace_ring_snapshot(ring, snap);
+	errors += qdf_trace_ring_ut_check_snapshot(snap, num, 0, 0);
+
+	/* ... a partially filled one only the records written so far ... */
+	qdf_trace_ring_ut_fill(ring, 10);
+	num = qdf_trace_ring_snapshot(ring, snap);
+	errors += qdf_trace_ring_ut_check_snapshot(snap, num, 0, 10);
+
+	/* ... and a wrapped one only the newest QDF_TRACE_PERCPU_RECORDS */
+	qdf_trace_ring_ut_fill(ring, qdf_trace_ring_ut_wrap_records - 10);
+	num = qdf_trace_ring_snapshot(ring, snap);
+	errors += qdf_trace_ring_ut_check_snapshot(
+			snap, num,
+			qdf_trace_ring_ut_wrap_records -
+			QDF_TRACE_PERCPU_RECORDS,
+			QDF_TRACE_PERCPU_RECORDS);
+
+	/* a slot caught half written by its CPU is dropped, not torn ... */
+	widx = qdf_atomic_read(&ring->widx);
+	slot = &ring->slot[(widx - 10) % QDF_TRACE_PERCPU_RECORDS];
+	slot->seq = 0;
+	slot->rec.code = 0xdead;
+
+	/* ... and so is a slot the CPU lapped after widx was sampled */
+	slot = &ring->slot[(widx - 20) % QDF_TRACE_PERCPU_RECORDS];
+	slot->seq += QDF_TRACE_PERCPU_RECORDS;
+	slot->rec.data += QDF_TRACE_PERCPU_RECORDS;
+
+	num = qdf_trace_ring_snapshot(ring, snap);
+	errors += qdf_trace_ring_ut_check_snapshot(
+			snap, num,
+			qdf_trace_ring_ut_wrap_records -
+			QDF_TRACE_PERCPU_RECORDS,
+			QDF_TRACE_PERCPU_RECORDS - 2);
+
+free:
+	qdf_mem_vfree(snap);
+	qdf_mem_vfree(ring);
+
+	return errors;
+}
+
+static uint32_t qdf_trace_ring_ut_time(uint64_t now_tod_us, uint64_t age_us,
+				       const char *expected)
+{
+	qdf_trace_record_t rec = {0};
+	uint64_t now_us;
+
+	rec.qtime = qdf_get_log_timestamp();
+	now_us = qdf_log_timestamp_to_usecs(rec.qtime) + age_us;
+
+	qdf_trace_fill_time(&rec, now_us, now_tod_us);
+	if (qdf_str_cmp(rec.time, expected)) {
+		qdf_nofl_alert("FAIL: time of day %llu us, age %llu us: %s, expected %s",
+			       now_tod_us, age_us, rec.time, expected);
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint32_t qdf_trace_ring_ut_fill_time(void)
+{
+	uint64_t noon = 12ULL * 3600 * 1000000;
+	uint32_t errors = 0;
+
+	errors += qdf_trace_ring_ut_time(noon + 500000, 0,
+					 "[12:00:00.500000]");
+	errors += qdf_trace_ring_ut_time(noon + 500000, 1500000,
+					 "[11:59:59.000000]");
+	/* a record from before midnight */
+	errors += qdf_trace_ring_ut_time(1000000, 2250000,
+					 "[23:59:58.750000]");
+	/* a record older than a day */
+	errors += qdf_trace_ring_ut_time(noon + 500000,
+					 qdf_trace_ring_ut_usecs_per_day +
+					 1000000,
+					 "[11:59:59.500000]");
+
+	return errors;
+}
+
+static void qdf_trace_ring_ut_dump_cb(void *p_mac, tp_qdf_trace_record rec,
+				      uint16_t index)
+{
+	struct qdf_trace_ring_ut_dump *dump = p_mac;
+
+	dump->num++;
+
+	/* a torn record mixes the fields of two writes */
+	if (rec->module != qdf_trace_ring_ut_module ||
+	    rec->session >= dump->nr_writers ||
+	    rec->code != (uint16_t)rec->data) {
+		qdf_nofl_alert("FAIL: torn record module %u session %u code %u data %u",
+			       rec->module, rec->session, rec->code,
+			       rec->data);
+		dump->errors++;
+		return;
+	}
+
+	if (rec->qtime < dump->last_qtime ||
+	    rec->data < dump->next_seq[rec->session] ||
+	    rec->time[0] != '[') {
+		qdf_nofl_alert("FAIL: record %u of writer %u out of order",
+			       rec->data, rec->session);
+		dump->errors++;
+	}
+
+	dump->last_qtime = rec->qtime;
+	dump->next_seq[rec->session] = rec->data + 1;
+}
+
+/**
+ * qdf_trace_ring_ut_dump() - dump the rings and check the output
+ * @ctx: flood test context
+ * @count: number of newest records to dump, 0 for all of them
+ * @expected: number of records the dump must return, 0 for don't care
+ *
+ * Return: number of errors found
+ */
+static uint32_t qdf_trace_ring_ut_dump(struct qdf_trace_ring_ut_ctx *ctx,
+				       uint32_t count, uint32_t expected)
+{
+	struct qdf_trace_ring_ut_dump dump = {0};
+
+	dump.nr_writers = ctx->nr_writers;
+	dump.next_seq = qdf_mem_malloc(ctx->nr_writers *
+				       sizeof(*dump.next_seq));
+	if (!dump.next_seq)
+		return 1;
+
+	qdf_trace_ring_dump(ctx->rings, ctx->nr_rings,
+			    qdf_trace_ring_ut_cb_table, &dump, 0, count, 0);
+
+	if (expected && dump.num != expected) {
+		qdf_nofl_alert("FAIL: dumped %u records, expected %u",
+			       dump.num, expected);
+		dump.errors++;
+	}
+
+	qdf_mem_free(dump.next_seq);
+
+	return dump.errors;
+}
+
+/**
+ * qdf_trace_ring_ut_shared_record() - the qdf_trace() body used before
+ *	QDF_TRACE_PERCPU_RING: format the time of day and take the shared
+ *	ring lock with interrupts disabled for every record
+ * @shared: shared ring
+ * @module: module id of the record
+ * @code: code to be recorded
+ * @session: session id of the record
+ * @data: record payload
+ *
+ * Return: None
+ */
+static void
+qdf_trace_ring_ut_shared_record(struct qdf_trace_ring_ut_shared *shared,
+				uint8_t module, uint16_t code,
+				uint16_t session, uint32_t data)
+{
+	t_qdf_trace_data *trace = &shared->data;
+	qdf_trace_record_t *rec;
+	char time[18];
+
+	qdf_get_time_of_the_day_in_hr_min_sec_usec(time, sizeof(time));
+	qdf_spin_lock_irqsave(&shared->lock);
+
+	trace->num++;
+	if (trace->num > MAX_QDF_TRACE_RECORDS)
+		trace->num = MAX_QDF_TRACE_RECORDS;
+
+	if (trace->head == INVALID_QDF_TRACE_ADDR) {
+		trace->head = 0;
+		trace->tail = 0;
+	} else {
+		uint32_t tail = trace->tail + 1;
+
+		if (tail == MAX_QDF_TRACE_RECORDS)
+			tail = 0;
+
+		if (trace->head == tail) {
+			if (++trace->head == MAX_QDF_TRACE_RECORDS)
+				trace->head = 0;
+		}
+		trace->tail = tail;
+	}
+
+	rec = &shared->tbl[trace->tail];
+	rec->code = code;
+	rec->session = session;
+	rec->data = data;
+	rec->qtime = qdf_get_log_timestamp();
+	scnprintf(rec->time, sizeof(rec->time), "%s", time);
+	rec->module = module;
+	rec->pid = qdf_get_current_pid();
+	trace->num_since_last_dump++;
+
+	qdf_spin_unlock_irqrestore(&shared->lock);
+}
+
+static QDF_STATUS qdf_trace_ring_ut_write(void *context)
+{
+	struct qdf_trace_ring_ut_writer *writer = context;
+	struct qdf_trace_ring_ut_ctx *ctx = writer->ctx;
+	uint8_t module = qdf_trace_ring_ut_module;
+	uint32_t seq;
+
+	while (!qdf_atomic_read(&ctx->start)) {
+		if (qdf_thread_should_stop())
+			return QDF_STATUS_E_ABORTED;
+		schedule();
+	}
+
+	for (seq = 0; seq < qdf_trace_ring_ut_flood_records; seq++) {
+		if (ctx->shared)
+			qdf_trace_ring_ut_shared_record(ctx->shared, module,
+							(uint16_t)seq,
+							writer->id, seq);
+		else
+			qdf_trace_ring_record(ctx->rings, module,
+					      (uint16_t)seq, writer->id, seq);
+	}
+
+	qdf_atomic_inc(&ctx->done);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * qdf_trace_ring_ut_flood() - record from one pinned writer per online CPU
+ * @ctx: flood test context
+ * @dump: dump the rings while the writers are running
+ * @rate: records per second recorded by all the writers together
+ *
+ * Return: number of errors found
+ */
+static uint32_t qdf_trace_ring_ut_flood(struct qdf_trace_ring_ut_ctx *ctx,
+					bool dump, uint64_t *rate)
+{
+	struct qdf_trace_ring_ut_writer *writer;
+	qdf_cpu_mask mask;
+	uint32_t errors = 0;
+	uint64_t elapsed_us;
+	int64_t start;
+	uint32_t i;
+	int cpu;
+
+	qdf_atomic_init(&ctx->start);
+	qdf_atomic_init(&ctx->done);
+	ctx->nr_writers = 0;
+
+	qdf_for_each_online_cpu(cpu) {
+		writer = &ctx->writer[ctx->nr_writers];
+		writer->ctx = ctx;
+		writer->id = ctx->nr_writers;
+		writer->thread = qdf_thread_run(qdf_trace_ring_ut_write,
+						writer);
+		if (!writer->thread) {
+			errors++;
+			break;
+		}
+
+		qdf_cpumask_clear(&mask);
+		qdf_cpumask_set_cpu(cpu, &mask);
+		qdf_thread_set_cpus_allowed_mask(writer->thread, &mask);
+		ctx->nr_writers++;
+	}
+
+	start = qdf_ktime_to_ns(qdf_ktime_get());
+	qdf_atomic_set(&ctx->start, 1);
+
+	while (!errors && qdf_atomic_read(&ctx->done) < ctx->nr_writers) {
+		if (dump)
+			errors += qdf_trace_ring_ut_dump(ctx, 0, 0);
+		else
+			schedule();
+	}
+
+	elapsed_us = qdf_do_div(qdf_ktime_to_ns(qdf_ktime_get()) - start,
+				1000);
+
+	for (i = 0; i < ctx->nr_writers; i++)
+		qdf_thread_join(ctx->writer[i].thread);
+
+	*rate = qdf_do_div((uint64_t)ctx->nr_writers *
+			   qdf_trace_ring_ut_flood_records * 1000000,
+			   elapsed_us ? (uint32_t)elapsed_us : 1);
+
+	return errors;
+}
+
+static void qdf_trace_ring_ut_reset(struct qdf_trace_ring_ut_ctx *ctx)
+{
+	qdf_mem_zero(ctx->rings, ctx->nr_rings * sizeof(*ctx->rings));
+
+	if (!ctx->shared)
+		return;
+
+	qdf_mem_zero(ctx->shared->tbl,
+		     MAX_QDF_TRACE_RECORDS * sizeof(*ctx->shared->tbl));
+	qdf_mem_zero(&ctx->shared->data, sizeof(ctx->shared->data));
+	ctx->shared->data.head = INVALID_QDF_TRACE_ADDR;
+	ctx->shared->data.tail = INVALID_QDF_TRACE_ADDR;
+}
+
+static uint32_t qdf_trace_ring_ut_floods(struct qdf_trace_ring_ut_ctx *ctx)
+{
+	struct qdf_trace_ring_ut_shared *shared;
+	uint64_t shared_rate = 0;
+	uint64_t percpu_rate = 0;
+	uint32_t errors = 0;
+	uint32_t expected = 0;
+	uint32_t i, widx;
+
+	shared = qdf_mem_malloc(sizeof(*shared));
+	if (!shared)
+		return 1;
+
+	shared->tbl = qdf_mem_valloc(MAX_QDF_TRACE_RECORDS *
+				     sizeof(*shared->tbl));
+	if (!shared->tbl) {
+		qdf_mem_free(shared);
+		return 1;
+	}
+	qdf_spinlock_create(&shared->lock);
+
+	/* the old shared ring ... */
+	ctx->shared = shared;
+	qdf_trace_ring_ut_reset(ctx);
+	errors += qdf_trace_ring_ut_flood(ctx, false, &shared_rate);
+	ctx->shared = NULL;
+
+	/* ... against the per-CPU rings */
+	qdf_trace_ring_ut_reset(ctx);
+	errors += qdf_trace_ring_ut_flood(ctx, false, &percpu_rate);
+
+	qdf_nofl_info("qdf trace: %u CPUs, shared ring %llu records/s, per-CPU rings %llu records/s",
+		      ctx->nr_writers, shared_rate, percpu_rate);
+
+	/* dumps taken while the writers overwrite the rings stay ordered */
+	qdf_trace_ring_ut_reset(ctx);
+	errors += qdf_trace_ring_ut_flood(ctx, true, &percpu_rate);
+
+	/* once quiet, each ring holds its newest records and no torn ones */
+	for (i = 0; i < ctx->nr_rings; i++) {
+		widx = qdf_atomic_read(&ctx->rings[i].widx);
+		expected += qdf_min(widx, (uint32_t)QDF_TRACE_PERCPU_RECORDS);
+	}
+	errors += qdf_trace_ring_ut_dump(ctx, 0, expected);
+	errors += qdf_trace_ring_ut_dump(ctx, qdf_trace_ring_ut_dump_count,
+					 qdf_trace_ring_ut_dump_count);
+
+	qdf_spinlock_destroy(&shared->lock);
+	qdf_mem_vfree(shared->tbl);
+	qdf_mem_free(shared);
+
+	return errors;
+}
+
+uint32_t qdf_trace_ring_unit_test(void)
+{
+	struct qdf_trace_ring_ut_ctx *ctx;
+	uint32_t errors = 0;
+	int cpu;
+
+	errors += qdf_trace_ring_ut_snapshot();
+	errors += qdf_trace_ring_ut_fill_time();
+
+	ctx = qdf_mem_malloc(sizeof(*ctx));
+	if (!ctx)
+		return errors + 1;
+
+	/* rings are indexed by CPU id, so size them for every possible CPU */
+	qdf_for_each_possible_cpu(cpu)
+		ctx->nr_rings = cpu + 1;
+
+	ctx->rings = qdf_mem_valloc(ctx->nr_rings * sizeof(*ctx->rings));
+	ctx->writer = qdf_mem_malloc(ctx->nr_rings * sizeof(*ctx->writer));
+	if (!ctx->rings || !ctx->writer) {
+		errors++;
+		goto free;
+	}
+
+	qdf_trace_ring_ut_cb_table[qdf_trace_ring_ut_module] =
+		qdf_trace_ring_ut_dump_cb;
+	errors += qdf_trace_ring_ut_floods(ctx);
+	qdf_trace_ring_ut_cb_table[qdf_trace_ring_ut_module] = NULL;
+
+free:
+	qdf_mem_free(ctx->writer);
+	qdf_mem_vfree(ctx->rings);
+	qdf_mem_free(ctx);
+
+	return errors;
+}
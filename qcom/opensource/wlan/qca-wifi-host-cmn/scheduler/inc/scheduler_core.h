@@ -65,16 +65,73 @@
 #define sched_enter() sched_debug("Enter")
 #define sched_exit() sched_debug("Exit")
 
+#ifdef WLAN_SCHED_MPSC_QUEUE
+#ifndef WLAN_SCHED_MPSC_RING_SIZE
+#define WLAN_SCHED_MPSC_RING_SIZE 128
+#endif
+#define SCHEDULER_MQ_HIGH_RING_SIZE 16
+
+/**
+ * enum scheduler_mq_lane - priority lanes of a scheduler message queue
+ * @SCHEDULER_MQ_LANE_HIGH: high priority messages, drained first
+ * @SCHEDULER_MQ_LANE_NORMAL: normal priority messages
+ * @SCHEDULER_MQ_LANE_MAX: number of lanes
+ */
+enum scheduler_mq_lane {
+	SCHEDULER_MQ_LANE_HIGH,
+	SCHEDULER_MQ_LANE_NORMAL,
+	SCHEDULER_MQ_LANE_MAX,
+};
+
+/**
+ * struct scheduler_mq_slot - preallocated scheduler message slot
+ * @seq: ticket the slot is free for, or ticket + 1 once the message is ready
+ * @msg: the queued message
+ */
+struct scheduler_mq_slot {
+	qdf_atomic_t seq;
+	struct scheduler_msg msg;
+};
+
+/**
+ * struct scheduler_mq_ring - lock-free multi producer single consumer ring
+ * @slots: preallocated message slots
+ * @size: number of slots, a power of 2
+ * @tail: next ticket to be handed out to a producer
+ * @count: number of slots reserved by producers and not yet released
+ * @head: next ticket to be consumed, only used by the scheduler thread
+ * @overflow: messages which did not fit in the ring, protected by mq_lock
+ * @overflow_cnt: number of messages in @overflow
+ * @overflowed: number of messages ever queued to @overflow
+ */
+struct scheduler_mq_ring {
+	struct scheduler_mq_slot *slots;
+	uint32_t size;
+	qdf_atomic_t tail;
+	qdf_atomic_t count;
+	uint32_t head;
+	qdf_list_t overflow;
+	qdf_atomic_t overflow_cnt;
+	uint32_t overflowed;
+};
+#endif
+
 /**
  * struct scheduler_mq_type -  scheduler message queue
  * @mq_lock: message queue lock
  * @mq_list: message queue list
  * @qid: queue id
+ * @ring: per priority lane message rings
+ * @ring_lane: lane of the message being processed, if it is a ring message
  */
 struct scheduler_mq_type {
 	qdf_spinlock_t mq_lock;
 	qdf_list_t mq_list;
 	QDF_MODULE_ID qid;
+#ifdef WLAN_SCHED_MPSC_QUEUE
+	struct scheduler_mq_ring ring[SCHEDULER_MQ_LANE_MAX];
+	uint8_t ring_lane;
+#endif
 };
 
 /**
@@ -182,6 +239,22 @@ QDF_STATUS scheduler_create_ctx(void);
  */
 QDF_STATUS scheduler_destroy_ctx(void);
 
+/**
+ * scheduler_mq_init() - initialize a message queue
+ * @msg_q: Pointer to the message queue
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS scheduler_mq_init(struct scheduler_mq_type *msg_q);
+
+/**
+ * scheduler_mq_deinit() - deinitialize a message queue
+ * @msg_q: Pointer to the message queue
+ *
+ * Return: none
+ */
+void scheduler_mq_deinit(struct scheduler_mq_type *msg_q);
+
 /**
  * scheduler_mq_put() - put message in the back of queue
  * @msg_q: Pointer to the message queue
@@ -216,6 +289,49 @@ void scheduler_mq_put_front(struct scheduler_mq_type *msg_q,
  */
 struct scheduler_msg *scheduler_mq_get(struct scheduler_mq_type *msg_q);
 
+/**
+ * scheduler_mq_post() - queue a copy of the message to the message queue
+ * @msg_q: Pointer to the message queue
+ * @msg: the message to enqueue
+ * @is_high_priority: queue the message ahead of normal priority messages
+ *
+ * Return: QDF_STATUS_E_NOMEM if the message could not be queued
+ */
+QDF_STATUS scheduler_mq_post(struct scheduler_mq_type *msg_q,
+			     struct scheduler_msg *msg,
+			     bool is_high_priority);
+
+/**
+ * scheduler_mq_dequeue() - get the next message to be processed
+ * @msg_q: Pointer to the message queue
+ *
+ * Must only be called from the scheduler thread context, and each message
+ * must be released with scheduler_mq_release() before the next one is
+ * dequeued from the same queue.
+ *
+ * Return: message to be processed or NULL if the queue is empty
+ */
+struct scheduler_msg *scheduler_mq_dequeue(struct scheduler_mq_type *msg_q);
+
+/**
+ * scheduler_mq_release() - release a message returned by
+ * scheduler_mq_dequeue()
+ * @msg_q: Pointer to the message queue
+ * @msg: the processed message
+ *
+ * Return: none
+ */
+void scheduler_mq_release(struct scheduler_mq_type *msg_q,
+			  struct scheduler_msg *msg);
+
+/**
+ * scheduler_mq_size() - number of messages queued in the message queue
+ * @msg_q: Pointer to the message queue
+ *
+ * Return: number of queued messages
+ */
+uint32_t scheduler_mq_size(struct scheduler_mq_type *msg_q);
+
 /**
  * scheduler_queues_init() - to initialize all the modules' queues
  * @sched_ctx: pointer to scheduler context
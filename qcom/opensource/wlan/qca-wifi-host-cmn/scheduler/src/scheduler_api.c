@@ -237,8 +237,8 @@ QDF_STATUS scheduler_post_msg_by_priority(uint32_t qid,
 {
 	uint8_t qidx;
 	struct scheduler_mq_type *target_mq;
-	struct scheduler_msg *queue_msg;
 	struct scheduler_ctx *sched_ctx;
+	QDF_STATUS status;
 	uint16_t src_id;
 	uint16_t dest_id;
 	uint16_t que_id;
@@ -302,14 +302,9 @@ QDF_STATUS scheduler_post_msg_by_priority(uint32_t qid,
 
 	target_mq = &(sched_ctx->queue_ctx.sch_msg_q[qidx]);
 
-	queue_msg = scheduler_core_msg_dup(msg);
-	if (!queue_msg)
-		return QDF_STATUS_E_NOMEM;
-
-	if (is_high_priority)
-		scheduler_mq_put_front(target_mq, queue_msg);
-	else
-		scheduler_mq_put(target_mq, queue_msg);
+	status = scheduler_mq_post(target_mq, msg, is_high_priority);
+	if (QDF_IS_STATUS_ERROR(status))
+		return status;
 
 	qdf_atomic_set_bit(MC_POST_EVENT_MASK, &sched_ctx->sch_event_flag);
 	qdf_wake_up_interruptible(&sched_ctx->sch_wait_queue);
@@ -764,7 +759,7 @@ QDF_STATUS scheduler_get_queue_size(QDF_MODULE_ID qid, uint32_t *size)
 
 	target_mq = &(sched_ctx->queue_ctx.sch_msg_q[qidx]);
 
-	*size = qdf_list_size(&target_mq->mq_list);
+	*size = scheduler_mq_size(target_mq);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -19,6 +19,7 @@
 
 #include <scheduler_core.h>
 #include <qdf_atomic.h>
+#include <qdf_util.h>
 #include "qdf_flex_mem.h"
 
 static struct scheduler_ctx g_sched_ctx;
@@ -38,6 +39,12 @@ DEFINE_QDF_FLEX_MEM_POOL(sched_pool, sizeof(struct scheduler_msg),
 			       "--------------------------------------" \
 			       "--------------------------------------"
 
+#define SCHEDULER_LATENCY_HIST_HEADER "|Queue"			      \
+				      "|    <10us|   <100us|     <1ms"  \
+				      "|    <10ms|   <100ms|  >=100ms|"
+
+#define SCHED_LATENCY_HIST_BUCKETS 6
+
 /**
  * struct sched_history_item - metrics for a scheduler message
  * @callback: the message's execution callback
@@ -63,15 +70,33 @@ struct sched_history_item {
 static struct sched_history_item sched_history[WLAN_SCHED_HISTORY_SIZE];
 static uint32_t sched_history_index;
 
+/* per queue histogram of the time messages spent queued */
+static uint32_t
+sched_latency_hist[SCHEDULER_NUMBER_OF_MSG_QUEUE][SCHED_LATENCY_HIST_BUCKETS];
+
 static void sched_history_queue(struct scheduler_mq_type *queue,
 				struct scheduler_msg *msg)
 {
 	msg->queue_id = queue->qid;
-	msg->queue_depth = qdf_list_size(&queue->mq_list);
+	msg->queue_depth = scheduler_mq_size(queue);
 	msg->queued_at_us = qdf_get_log_timestamp_usecs();
 }
 
-static void sched_history_start(struct scheduler_msg *msg)
+static void sched_latency_hist_update(uint8_t qidx, uint32_t duration_us)
+{
+	uint8_t bucket = 0;
+	uint32_t thresh_us = 10;
+
+	while (bucket < SCHED_LATENCY_HIST_BUCKETS - 1 &&
+	       duration_us >= thresh_us) {
+		bucket++;
+		thresh_us *= 10;
+	}
+
+	sched_latency_hist[qidx][bucket]++;
+}
+
+static void sched_history_start(struct scheduler_msg *msg, uint8_t qidx)
 {
 	uint64_t started_at_us = qdf_get_log_timestamp_usecs();
 	struct sched_history_item hist = {
@@ -84,6 +109,7 @@ static void sched_history_start(struct scheduler_msg *msg)
 	};
 
 	sched_history[sched_history_index] = hist;
+	sched_latency_hist_update(qidx, hist.queue_duration_us);
 }
 
 static void sched_history_stop(void)
@@ -135,12 +161,24 @@ void sched_history_print(void)
 	sched_nofl_fatal(SCHEDULER_HISTORY_LINE);
 
 	qdf_mem_free(history);
+
+	sched_nofl_fatal(SCHEDULER_LATENCY_HIST_HEADER);
+	for (idx = 0; idx < SCHEDULER_NUMBER_OF_MSG_QUEUE; idx++)
+		sched_nofl_fatal("|%5u|%9u|%9u|%9u|%9u|%9u|%9u|", idx,
+				 sched_latency_hist[idx][0],
+				 sched_latency_hist[idx][1],
+				 sched_latency_hist[idx][2],
+				 sched_latency_hist[idx][3],
+				 sched_latency_hist[idx][4],
+				 sched_latency_hist[idx][5]);
+	sched_nofl_fatal(SCHEDULER_HISTORY_LINE);
 }
 #else /* WLAN_SCHED_HISTORY_SIZE */
 
 static inline void sched_history_queue(struct scheduler_mq_type *queue,
 				       struct scheduler_msg *msg) { }
-static inline void sched_history_start(struct scheduler_msg *msg) { }
+static inline void sched_history_start(struct scheduler_msg *msg,
+				       uint8_t qidx) { }
 static inline void sched_history_stop(void) { }
 void sched_history_print(void) { }
 
@@ -169,22 +207,105 @@ struct scheduler_ctx *scheduler_get_context(void)
 	return gp_sched_ctx;
 }
 
-static QDF_STATUS scheduler_mq_init(struct scheduler_mq_type *msg_q)
+#ifdef WLAN_SCHED_MPSC_QUEUE
+static QDF_STATUS scheduler_mq_ring_init(struct scheduler_mq_ring *ring,
+					 uint32_t size)
+{
+	uint32_t i;
+
+	QDF_BUG(size && !(size & (size - 1)));
+
+	ring->slots = qdf_mem_malloc(size * sizeof(*ring->slots));
+	if (!ring->slots)
+		return QDF_STATUS_E_NOMEM;
+
+	/* slot i is free for ticket i */
+	for (i = 0; i < size; i++)
+		qdf_atomic_set(&ring->slots[i].seq, i);
+
+	ring->size = size;
+	ring->head = 0;
+	ring->overflowed = 0;
+	qdf_atomic_set(&ring->tail, 0);
+	qdf_atomic_set(&ring->count, 0);
+	qdf_atomic_set(&ring->overflow_cnt, 0);
+	qdf_list_create(&ring->overflow, SCHEDULER_CORE_MAX_MESSAGES);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static void scheduler_mq_ring_deinit(struct scheduler_mq_ring *ring)
+{
+	if (!ring->slots)
+		return;
+
+	qdf_list_destroy(&ring->overflow);
+	qdf_mem_free(ring->slots);
+	ring->slots = NULL;
+}
+
+static QDF_STATUS scheduler_mq_rings_init(struct scheduler_mq_type *msg_q)
+{
+	QDF_STATUS status;
+
+	msg_q->ring_lane = SCHEDULER_MQ_LANE_MAX;
+
+	status = scheduler_mq_ring_init(&msg_q->ring[SCHEDULER_MQ_LANE_HIGH],
+					SCHEDULER_MQ_HIGH_RING_SIZE);
+	if (QDF_IS_STATUS_ERROR(status))
+		return status;
+
+	status = scheduler_mq_ring_init(&msg_q->ring[SCHEDULER_MQ_LANE_NORMAL],
+					WLAN_SCHED_MPSC_RING_SIZE);
+	if (QDF_IS_STATUS_ERROR(status))
+		scheduler_mq_ring_deinit(&msg_q->ring[SCHEDULER_MQ_LANE_HIGH]);
+
+	return status;
+}
+
+static void scheduler_mq_rings_deinit(struct scheduler_mq_type *msg_q)
+{
+	int i;
+
+	for (i = 0; i < SCHEDULER_MQ_LANE_MAX; i++) {
+		if (msg_q->ring[i].overflowed)
+			sched_debug("Qid[%d] lane %d overflowed %u msgs",
+				    msg_q->qid, i, msg_q->ring[i].overflowed);
+		scheduler_mq_ring_deinit(&msg_q->ring[i]);
+	}
+}
+#else
+static inline QDF_STATUS
+scheduler_mq_rings_init(struct scheduler_mq_type *msg_q)
+{
+	return QDF_STATUS_SUCCESS;
+}
+
+static inline void scheduler_mq_rings_deinit(struct scheduler_mq_type *msg_q)
+{
+}
+#endif
+
+QDF_STATUS scheduler_mq_init(struct scheduler_mq_type *msg_q)
 {
+	QDF_STATUS status;
+
 	sched_enter();
 
 	qdf_spinlock_create(&msg_q->mq_lock);
 	qdf_list_create(&msg_q->mq_list, SCHEDULER_CORE_MAX_MESSAGES);
+	status = scheduler_mq_rings_init(msg_q);
 
 	sched_exit();
 
-	return QDF_STATUS_SUCCESS;
+	return status;
 }
 
-static void scheduler_mq_deinit(struct scheduler_mq_type *msg_q)
+void scheduler_mq_deinit(struct scheduler_mq_type *msg_q)
 {
 	sched_enter();
 
+	scheduler_mq_rings_deinit(msg_q);
 	qdf_list_destroy(&msg_q->mq_list);
 	qdf_spinlock_destroy(&msg_q->mq_lock);
 
@@ -348,12 +469,217 @@ void scheduler_core_msg_free(struct scheduler_msg *msg)
 	qdf_atomic_dec(&__sched_queue_depth);
 }
 
+#ifdef WLAN_SCHED_MPSC_QUEUE
+/**
+ * scheduler_mq_ring_put() - copy the message into a free ring slot
+ * @msg_q: message queue the ring belongs to
+ * @ring: ring of the message priority lane
+ * @msg: the message to enqueue
+ *
+ * A producer first reserves room in the ring and then takes a ticket, so a
+ * ticket is only handed out once the consumer released the slot it maps to.
+ * Producers never wait on each other or on the consumer.
+ *
+ * Return: true if the message was queued, false if the ring is full
+ */
+static bool scheduler_mq_ring_put(struct scheduler_mq_type *msg_q,
+				  struct scheduler_mq_ring *ring,
+				  struct scheduler_msg *msg)
+{
+	struct scheduler_mq_slot *slot;
+	uint32_t pos;
+
+	if ((uint32_t)qdf_atomic_inc_return(&ring->count) > ring->size) {
+		qdf_atomic_dec(&ring->count);
+		return false;
+	}
+
+	pos = (uint32_t)qdf_atomic_inc_return(&ring->tail) - 1;
+	slot = &ring->slots[pos & (ring->size - 1)];
+
+	qdf_mem_copy(&slot->msg, msg, sizeof(slot->msg));
+	sched_history_queue(msg_q, &slot->msg);
+
+	/* publish the message only once it is completely written */
+	qdf_wmb();
+	qdf_atomic_set(&slot->seq, pos + 1);
+
+	return true;
+}
+
+/**
+ * scheduler_mq_ring_get() - get the message at the head of the ring
+ * @ring: ring of a message priority lane
+ *
+ * Return: message at the head of the ring or NULL if it is not yet ready
+ */
+static struct scheduler_msg *
+scheduler_mq_ring_get(struct scheduler_mq_ring *ring)
+{
+	struct scheduler_mq_slot *slot;
+
+	slot = &ring->slots[ring->head & (ring->size - 1)];
+	if ((uint32_t)qdf_atomic_read(&slot->seq) != ring->head + 1)
+		return NULL;
+
+	qdf_rmb();
+
+	return &slot->msg;
+}
+
+/**
+ * scheduler_mq_ring_release() - release the slot at the head of the ring
+ * @ring: ring of a message priority lane
+ *
+ * Return: none
+ */
+static void scheduler_mq_ring_release(struct scheduler_mq_ring *ring)
+{
+	struct scheduler_mq_slot *slot;
+
+	slot = &ring->slots[ring->head & (ring->size - 1)];
+
+	/* the slot is free for the ticket one lap ahead */
+	qdf_mb();
+	qdf_atomic_set(&slot->seq, ring->head + ring->size);
+	ring->head++;
+
+	/* producers must see the released slot before the freed room */
+	qdf_mb();
+	qdf_atomic_dec(&ring->count);
+}
+
+QDF_STATUS scheduler_mq_post(struct scheduler_mq_type *msg_q,
+			     struct scheduler_msg *msg,
+			     bool is_high_priority)
+{
+	struct scheduler_mq_ring *ring;
+	struct scheduler_msg *queue_msg;
+
+	ring = &msg_q->ring[is_high_priority ? SCHEDULER_MQ_LANE_HIGH :
+					       SCHEDULER_MQ_LANE_NORMAL];
+
+	/* stay behind messages of the lane already spilled to the overflow */
+	if (!qdf_atomic_read(&ring->overflow_cnt) &&
+	    scheduler_mq_ring_put(msg_q, ring, msg))
+		return QDF_STATUS_SUCCESS;
+
+	queue_msg = scheduler_core_msg_dup(msg);
+	if (!queue_msg)
+		return QDF_STATUS_E_NOMEM;
+
+	qdf_spin_lock_irqsave(&msg_q->mq_lock);
+	sched_history_queue(msg_q, queue_msg);
+	qdf_list_insert_back(&ring->overflow, &queue_msg->node);
+	qdf_atomic_inc(&ring->overflow_cnt);
+	ring->overflowed++;
+	qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+struct scheduler_msg *scheduler_mq_dequeue(struct scheduler_mq_type *msg_q)
+{
+	struct scheduler_mq_ring *ring;
+	struct scheduler_msg *msg;
+	qdf_list_node_t *node;
+	QDF_STATUS status;
+	uint8_t lane;
+
+	for (lane = 0; lane < SCHEDULER_MQ_LANE_MAX; lane++) {
+		ring = &msg_q->ring[lane];
+
+		msg = scheduler_mq_ring_get(ring);
+		if (msg) {
+			msg_q->ring_lane = lane;
+			return msg;
+		}
+
+		if (!qdf_atomic_read(&ring->overflow_cnt))
+			continue;
+
+		qdf_spin_lock_irqsave(&msg_q->mq_lock);
+		status = qdf_list_remove_front(&ring->overflow, &node);
+		if (QDF_IS_STATUS_SUCCESS(status))
+			qdf_atomic_dec(&ring->overflow_cnt);
+		qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+
+		if (QDF_IS_STATUS_SUCCESS(status)) {
+			msg_q->ring_lane = SCHEDULER_MQ_LANE_MAX;
+			return qdf_container_of(node, struct scheduler_msg,
+						node);
+		}
+	}
+
+	return NULL;
+}
+
+void scheduler_mq_release(struct scheduler_mq_type *msg_q,
+			  struct scheduler_msg *msg)
+{
+	if (msg_q->ring_lane < SCHEDULER_MQ_LANE_MAX) {
+		scheduler_mq_ring_release(&msg_q->ring[msg_q->ring_lane]);
+		msg_q->ring_lane = SCHEDULER_MQ_LANE_MAX;
+		return;
+	}
+
+	scheduler_core_msg_free(msg);
+}
+
+uint32_t scheduler_mq_size(struct scheduler_mq_type *msg_q)
+{
+	uint32_t size = 0;
+	int i;
+
+	for (i = 0; i < SCHEDULER_MQ_LANE_MAX; i++)
+		size += qdf_atomic_read(&msg_q->ring[i].count) +
+			qdf_atomic_read(&msg_q->ring[i].overflow_cnt);
+
+	return size;
+}
+#else
+QDF_STATUS scheduler_mq_post(struct scheduler_mq_type *msg_q,
+			     struct scheduler_msg *msg,
+			     bool is_high_priority)
+{
+	struct scheduler_msg *queue_msg;
+
+	queue_msg = scheduler_core_msg_dup(msg);
+	if (!queue_msg)
+		return QDF_STATUS_E_NOMEM;
+
+	if (is_high_priority)
+		scheduler_mq_put_front(msg_q, queue_msg);
+	else
+		scheduler_mq_put(msg_q, queue_msg);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+struct scheduler_msg *scheduler_mq_dequeue(struct scheduler_mq_type *msg_q)
+{
+	return scheduler_mq_get(msg_q);
+}
+
+void scheduler_mq_release(struct scheduler_mq_type *msg_q,
+			  struct scheduler_msg *msg)
+{
+	scheduler_core_msg_free(msg);
+}
+
+uint32_t scheduler_mq_size(struct scheduler_mq_type *msg_q)
+{
+	return qdf_list_size(&msg_q->mq_list);
+}
+#endif
+
 static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 					    bool *shutdown)
 {
 	int i;
 	QDF_STATUS status;
 	struct scheduler_msg *msg;
+	struct scheduler_mq_type *msg_q;
 
 	if (!sch_ctx) {
 		QDF_DEBUG_PANIC("sch_ctx is null");
@@ -380,7 +706,8 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 			break;
 		}
 
-		msg = scheduler_mq_get(&sch_ctx->queue_ctx.sch_msg_q[i]);
+		msg_q = &sch_ctx->queue_ctx.sch_msg_q[i];
+		msg = scheduler_mq_dequeue(msg_q);
 		if (!msg) {
 			/* check next queue */
 			i++;
@@ -391,7 +718,7 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 			sch_ctx->watchdog_msg_type = msg->type;
 			sch_ctx->watchdog_callback = msg->callback;
 
-			sched_history_start(msg);
+			sched_history_start(msg, i);
 			qdf_timer_start(&sch_ctx->watchdog_timer,
 					sch_ctx->timeout);
 			status = sch_ctx->queue_ctx.
@@ -401,9 +728,9 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 
 			if (QDF_IS_STATUS_ERROR(status))
 				sched_err("Failed processing Qid[%d] message",
-					  sch_ctx->queue_ctx.sch_msg_q[i].qid);
+					  msg_q->qid);
 
-			scheduler_core_msg_free(msg);
+			scheduler_mq_release(msg_q, msg);
 		}
 
 		/* start again with highest priority queue at index 0 */
@@ -473,7 +800,7 @@ static void scheduler_flush_single_queue(struct scheduler_mq_type *mq)
 	struct scheduler_msg *msg;
 	QDF_STATUS (*flush_cb)(struct scheduler_msg *);
 
-	while ((msg = scheduler_mq_get(mq))) {
+	while ((msg = scheduler_mq_dequeue(mq))) {
 		if (msg->flush_callback) {
 			sched_debug("Calling flush callback; type: %x",
 				    msg->type);
@@ -485,7 +812,7 @@ static void scheduler_flush_single_queue(struct scheduler_mq_type *mq)
 			qdf_mem_free(msg->bodyptr);
 		}
 
-		scheduler_core_msg_free(msg);
+		scheduler_mq_release(mq, msg);
 	}
 }
 
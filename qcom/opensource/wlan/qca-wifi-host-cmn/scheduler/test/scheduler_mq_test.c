@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "scheduler_core.h"
+#include "scheduler_mq_test.h"
+
+#define sched_mq_ut_producers 4
+#define sched_mq_ut_msgs 512
+#define sched_mq_ut_high_period 8
+#define sched_mq_ut_timeout_ms 10000
+
+#ifdef WLAN_SCHED_MPSC_QUEUE
+#define sched_mq_ut_is_high(seq) (!((seq) % sched_mq_ut_high_period))
+#define sched_mq_ut_fifo_msgs \
+	(WLAN_SCHED_MPSC_RING_SIZE + sched_mq_ut_msgs / 8)
+
+static bool sched_mq_ut_overflowed(struct scheduler_mq_type *msg_q)
+{
+	struct scheduler_mq_ring *ring = &msg_q->ring[SCHEDULER_MQ_LANE_NORMAL];
+
+	return qdf_atomic_read(&ring->overflow_cnt);
+}
+#else
+/* the legacy queue puts high priority messages in front, so not FIFO */
+#define sched_mq_ut_is_high(seq) false
+#define sched_mq_ut_fifo_msgs sched_mq_ut_msgs
+
+static bool sched_mq_ut_overflowed(struct scheduler_mq_type *msg_q)
+{
+	return false;
+}
+#endif
+
+struct sched_mq_ut_ctx;
+
+struct sched_mq_ut_producer {
+	struct sched_mq_ut_ctx *ctx;
+	uint16_t id;
+	qdf_thread_t *thread;
+};
+
+/**
+ * struct sched_mq_ut_ctx - multi producer test context
+ * @msg_q: message queue under test
+ * @producer: producer threads
+ * @done: number of producers which posted all of their messages
+ * @next_seq: next sequence number expected per producer and priority
+ * @count: number of messages received per producer
+ */
+struct sched_mq_ut_ctx {
+	struct scheduler_mq_type msg_q;
+	struct sched_mq_ut_producer producer[sched_mq_ut_producers];
+	qdf_atomic_t done;
+	uint32_t next_seq[sched_mq_ut_producers][2];
+	uint32_t count[sched_mq_ut_producers];
+};
+
+static void sched_mq_ut_drain(struct scheduler_mq_type *msg_q)
+{
+	struct scheduler_msg *msg;
+
+	while ((msg = scheduler_mq_dequeue(msg_q)))
+		scheduler_mq_release(msg_q, msg);
+}
+
+static uint32_t sched_mq_ut_single_producer_fifo(void)
+{
+	struct scheduler_mq_type *msg_q;
+	struct scheduler_msg msg = {0};
+	struct scheduler_msg *cur;
+	uint32_t errors = 0;
+	uint32_t seq;
+
+	msg_q = qdf_mem_malloc(sizeof(*msg_q));
+	if (!msg_q)
+		return 1;
+
+	QDF_BUG(QDF_IS_STATUS_SUCCESS(scheduler_mq_init(msg_q)));
+
+	/* queue more messages than the ring holds, without consuming */
+	for (seq = 0; seq < sched_mq_ut_fifo_msgs; seq++) {
+		msg.bodyval = seq;
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(scheduler_mq_post(msg_q, &msg,
+								false)));
+	}
+	QDF_BUG(scheduler_mq_size(msg_q) == sched_mq_ut_fifo_msgs);
+
+	/* the ring and overflow messages come out in posting order */
+	for (seq = 0; seq < sched_mq_ut_fifo_msgs; seq++) {
+		cur = scheduler_mq_dequeue(msg_q);
+		if (!cur) {
+			errors++;
+			break;
+		}
+
+		if (cur->bodyval != seq)
+			errors++;
+		scheduler_mq_release(msg_q, cur);
+	}
+
+	QDF_BUG(!scheduler_mq_dequeue(msg_q));
+	QDF_BUG(!scheduler_mq_size(msg_q));
+	QDF_BUG(!errors);
+
+	sched_mq_ut_drain(msg_q);
+	scheduler_mq_deinit(msg_q);
+	qdf_mem_free(msg_q);
+
+	return errors;
+}
+
+static QDF_STATUS sched_mq_ut_produce(void *context)
+{
+	struct sched_mq_ut_producer *producer = context;
+	struct scheduler_mq_type *msg_q = &producer->ctx->msg_q;
+	struct scheduler_msg msg = {0};
+	uint32_t seq;
+
+	msg.type = producer->id;
+	for (seq = 0; seq < sched_mq_ut_msgs; seq++) {
+		msg.bodyval = seq;
+		/* a failed post did not queue anything, so just retry */
+		while (QDF_IS_STATUS_ERROR(scheduler_mq_post(msg_q, &msg,
+					   sched_mq_ut_is_high(seq)))) {
+			if (qdf_thread_should_stop())
+				return QDF_STATUS_E_ABORTED;
+			schedule();
+		}
+	}
+
+	qdf_atomic_inc(&producer->ctx->done);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint32_t sched_mq_ut_check(struct sched_mq_ut_ctx *ctx,
+				  struct scheduler_msg *msg)
+{
+	uint32_t *next_seq;
+
+	if (msg->type >= sched_mq_ut_producers ||
+	    msg->bodyval >= sched_mq_ut_msgs)
+		return 1;
+
+	/* each producer's messages are FIFO within a priority lane */
+	next_seq = ctx->next_seq[msg->type];
+	next_seq += sched_mq_ut_is_high(msg->bodyval);
+	if (msg->bodyval < *next_seq)
+		return 1;
+
+	*next_seq = msg->bodyval + 1;
+	ctx->count[msg->type]++;
+
+	return 0;
+}
+
+static uint32_t sched_mq_ut_multi_producer(void)
+{
+	struct sched_mq_ut_ctx *ctx;
+	struct scheduler_msg *msg;
+	uint32_t total = sched_mq_ut_producers * sched_mq_ut_msgs;
+	uint32_t received = 0;
+	uint32_t errors = 0;
+	qdf_time_t deadline;
+	int i;
+
+	ctx = qdf_mem_malloc(sizeof(*ctx));
+	if (!ctx)
+		return 1;
+
+	QDF_BUG(QDF_IS_STATUS_SUCCESS(scheduler_mq_init(&ctx->msg_q)));
+	qdf_atomic_init(&ctx->done);
+
+	for (i = 0; i < sched_mq_ut_producers; i++) {
+		ctx->producer[i].ctx = ctx;
+		ctx->producer[i].id = i;
+		ctx->producer[i].thread = qdf_thread_run(sched_mq_ut_produce,
+							 &ctx->producer[i]);
+		QDF_BUG(ctx->producer[i].thread);
+	}
+
+	deadline = qdf_system_ticks() +
+		   qdf_system_msecs_to_ticks(sched_mq_ut_timeout_ms);
+
+	/* let the producers overrun the ring before consuming anything */
+	while (!sched_mq_ut_overflowed(&ctx->msg_q) &&
+	       qdf_atomic_read(&ctx->done) < sched_mq_ut_producers &&
+	       !qdf_system_time_after(qdf_system_ticks(), deadline))
+		schedule();
+
+	while (received < total) {
+		msg = scheduler_mq_dequeue(&ctx->msg_q);
+		if (!msg) {
+			if (qdf_system_time_after(qdf_system_ticks(), deadline))
+				break;
+			schedule();
+			continue;
+		}
+
+		errors += sched_mq_ut_check(ctx, msg);
+		received++;
+		scheduler_mq_release(&ctx->msg_q, msg);
+	}
+
+	for (i = 0; i < sched_mq_ut_producers; i++) {
+		if (ctx->producer[i].thread)
+			qdf_thread_join(ctx->producer[i].thread);
+	}
+
+	/* nothing lost ... */
+	QDF_BUG(received == total);
+	for (i = 0; i < sched_mq_ut_producers; i++) {
+		if (ctx->count[i] != sched_mq_ut_msgs)
+			errors++;
+	}
+
+	/* ... and nothing duplicated */
+	QDF_BUG(!scheduler_mq_dequeue(&ctx->msg_q));
+	QDF_BUG(!errors);
+
+#ifdef WLAN_SCHED_MPSC_QUEUE
+	/* the run has to cross a ring overflow to be meaningful */
+	QDF_BUG(ctx->msg_q.ring[SCHEDULER_MQ_LANE_NORMAL].overflowed);
+#endif
+
+	sched_mq_ut_drain(&ctx->msg_q);
+	scheduler_mq_deinit(&ctx->msg_q);
+	qdf_mem_free(ctx);
+
+	return errors;
+}
+
+uint32_t scheduler_mq_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += sched_mq_ut_single_producer_fifo();
+	errors += sched_mq_ut_multi_producer();
+
+	return errors;
+}
@@ -220,6 +220,108 @@ void scm_filter_rnr_flag_pno(struct wlan_objmgr_vdev *vdev,
 }
 #endif
 
+/**
+ * scm_get_ssid_hash() - get the ssid index bucket of an ssid
+ * @ssid: ssid
+ *
+ * Return: ssid hash index
+ */
+static uint8_t scm_get_ssid_hash(struct wlan_ssid *ssid)
+{
+	uint32_t hash = 0;
+	uint8_t i;
+
+	if (util_scan_is_null_ssid(ssid))
+		return SCAN_HIDDEN_SSID_HASH;
+
+	for (i = 0; i < ssid->length && i < WLAN_SSID_MAX_LEN; i++)
+		hash = hash * 31 + ssid->ssid[i];
+
+	return hash % SCAN_HASH_SIZE;
+}
+
+/**
+ * scm_get_entry_ssid_hash() - get the ssid index bucket of a scan entry
+ * @entry: scan entry
+ *
+ * Hidden APs can match a filter through the ssid learnt from the probe
+ * response or through the OWE transition check, so they are always indexed
+ * in the hidden ssid bucket.
+ *
+ * Return: ssid hash index
+ */
+static uint8_t scm_get_entry_ssid_hash(struct scan_cache_entry *entry)
+{
+	if (util_scan_entry_is_hidden_ap(entry))
+		return SCAN_HIDDEN_SSID_HASH;
+
+	return scm_get_ssid_hash(&entry->ssid);
+}
+
+/**
+ * scm_get_index_list() - get the hash list of a scan db index
+ * @scan_db: scan database
+ * @index: scan db index
+ * @hash_idx: hash index
+ *
+ * Return: hash list
+ */
+static qdf_list_t *scm_get_index_list(struct scan_dbs *scan_db,
+				      enum scm_db_index index,
+				      uint8_t hash_idx)
+{
+	switch (index) {
+	case SCM_DB_INDEX_SSID:
+		return &scan_db->ssid_hash_tbl[hash_idx];
+	case SCM_DB_INDEX_FREQ:
+		return &scan_db->freq_hash_tbl[hash_idx];
+	default:
+		return &scan_db->scan_hash_tbl[hash_idx];
+	}
+}
+
+/**
+ * scm_get_index_node() - get the list node of a scan node for an index
+ * @scan_node: scan node
+ * @index: scan db index
+ *
+ * Return: list node
+ */
+static qdf_list_node_t *scm_get_index_node(struct scan_cache_node *scan_node,
+					   enum scm_db_index index)
+{
+	switch (index) {
+	case SCM_DB_INDEX_SSID:
+		return &scan_node->ssid_node;
+	case SCM_DB_INDEX_FREQ:
+		return &scan_node->freq_node;
+	default:
+		return &scan_node->node;
+	}
+}
+
+/**
+ * scm_get_scan_node() - get the scan node from the list node of an index
+ * @node: list node
+ * @index: scan db index
+ *
+ * Return: scan node
+ */
+static struct scan_cache_node *scm_get_scan_node(qdf_list_node_t *node,
+						 enum scm_db_index index)
+{
+	switch (index) {
+	case SCM_DB_INDEX_SSID:
+		return qdf_container_of(node, struct scan_cache_node,
+					ssid_node);
+	case SCM_DB_INDEX_FREQ:
+		return qdf_container_of(node, struct scan_cache_node,
+					freq_node);
+	default:
+		return qdf_container_of(node, struct scan_cache_node, node);
+	}
+}
+
 /**
  * scm_del_scan_node() - API to remove scan node from the list
  * @list: hash list
@@ -260,6 +362,13 @@ static QDF_STATUS scm_del_scan_node_from_db(struct scan_dbs *scan_db,
 	if (!scan_node)
 		return QDF_STATUS_E_INVAL;
 
+	hash_idx = scm_get_entry_ssid_hash(scan_node->entry);
+	qdf_list_remove_node(&scan_db->ssid_hash_tbl[hash_idx],
+			     &scan_node->ssid_node);
+	hash_idx = SCAN_GET_FREQ_HASH(scan_node->entry->channel.chan_freq);
+	qdf_list_remove_node(&scan_db->freq_hash_tbl[hash_idx],
+			     &scan_node->freq_node);
+
 	hash_idx = SCAN_GET_HASH(scan_node->entry->bssid.bytes);
 	scm_del_scan_node(&scan_db->scan_hash_tbl[hash_idx], scan_node);
 	scan_db->num_entries--;
@@ -383,6 +492,13 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
 		qdf_list_insert_before(&scan_db->scan_hash_tbl[hash_idx],
 				       &scan_node->node, &dup_node->node);
 
+	hash_idx = scm_get_entry_ssid_hash(scan_node->entry);
+	qdf_list_insert_back(&scan_db->ssid_hash_tbl[hash_idx],
+			     &scan_node->ssid_node);
+	hash_idx = SCAN_GET_FREQ_HASH(scan_node->entry->channel.chan_freq);
+	qdf_list_insert_back(&scan_db->freq_hash_tbl[hash_idx],
+			     &scan_node->freq_node);
+
 	scan_db->num_entries++;
 }
 
@@ -392,6 +508,7 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
  * the list
  * @list: hash list
  * @cur_node: current node pointer
+ * @index: scan db index the list belongs to
  *
  * API to get next active node from the list. If cur_node is NULL
  * it will return first node of the list.
@@ -401,7 +518,7 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
  */
 static qdf_list_node_t *
 scm_get_next_valid_node(qdf_list_t *list,
-	qdf_list_node_t *cur_node)
+	qdf_list_node_t *cur_node, enum scm_db_index index)
 {
 	qdf_list_node_t *next_node = NULL;
 	qdf_list_node_t *temp_node = NULL;
@@ -413,8 +530,7 @@ scm_get_next_valid_node(qdf_list_t *list,
 		qdf_list_peek_front(list, &next_node);
 
 	while (next_node) {
-		scan_node = qdf_container_of(next_node,
-			struct scan_cache_node, node);
+		scan_node = scm_get_scan_node(next_node, index);
 		if (scan_node->cookie == SCAN_NODE_ACTIVE_COOKIE)
 			return next_node;
 		/*
@@ -430,9 +546,10 @@ scm_get_next_valid_node(qdf_list_t *list,
 }
 
 /**
- * scm_get_next_node() - API get the next scan node from
- * the list
+ * scm_get_next_index_node() - API get the next scan node from
+ * the list of a scan db index
  * @scan_db: scan data base
+ * @index: scan db index the list belongs to
  * @list: hash list
  * @cur_node: current node pointer
  *
@@ -442,25 +559,25 @@ scm_get_next_valid_node(qdf_list_t *list,
  * Return: next scan cache node
  */
 static struct scan_cache_node *
-scm_get_next_node(struct scan_dbs *scan_db,
-	qdf_list_t *list, struct scan_cache_node *cur_node)
+scm_get_next_index_node(struct scan_dbs *scan_db, enum scm_db_index index,
+			qdf_list_t *list, struct scan_cache_node *cur_node)
 {
 	struct scan_cache_node *next_node = NULL;
 	qdf_list_node_t *next_list = NULL;
 
 	qdf_spin_lock_bh(&scan_db->scan_db_lock);
 	if (cur_node) {
-		next_list = scm_get_next_valid_node(list, &cur_node->node);
+		next_list = scm_get_next_valid_node(list,
+				scm_get_index_node(cur_node, index), index);
 		/* Decrement the ref count of the previous node */
 		scm_scan_entry_put_ref(scan_db,
 			cur_node, false);
 	} else {
-		next_list = scm_get_next_valid_node(list, NULL);
+		next_list = scm_get_next_valid_node(list, NULL, index);
 	}
 	/* Increase the ref count of the obtained node */
 	if (next_list) {
-		next_node = qdf_container_of(next_list,
-			struct scan_cache_node, node);
+		next_node = scm_get_scan_node(next_list, index);
 		scm_scan_entry_get_ref(next_node);
 	}
 	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
@@ -468,6 +585,26 @@ scm_get_next_node(struct scan_dbs *scan_db,
 	return next_node;
 }
 
+/**
+ * scm_get_next_node() - API get the next scan node from
+ * the list
+ * @scan_db: scan data base
+ * @list: bssid hash list
+ * @cur_node: current node pointer
+ *
+ * API get the next node from the list. If cur_node is NULL
+ * it will return first node of the list
+ *
+ * Return: next scan cache node
+ */
+static struct scan_cache_node *
+scm_get_next_node(struct scan_dbs *scan_db,
+	qdf_list_t *list, struct scan_cache_node *cur_node)
+{
+	return scm_get_next_index_node(scan_db, SCM_DB_INDEX_BSSID,
+				       list, cur_node);
+}
+
 /**
  * scm_check_and_age_out() - check and age out the old entries
  * @scan_db: scan db
@@ -1293,37 +1430,157 @@ scm_scan_apply_filter_get_entry(struct wlan_objmgr_psoc *psoc,
 	return QDF_STATUS_SUCCESS;
 }
 
+/**
+ * scm_scan_apply_filter_get_ref() - apply filter and get a read only
+ * reference to the scan entry
+ * @psoc: psoc pointer
+ * @db_node: scan db node
+ * @filter: filter to be applied
+ * @scan_list: scan list to which reference is added
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS
+scm_scan_apply_filter_get_ref(struct wlan_objmgr_psoc *psoc,
+			      struct scan_cache_node *db_node,
+			      struct scan_filter *filter,
+			      qdf_list_t *scan_list)
+{
+	struct scan_cache_ref_node *ref_node;
+	struct security_info security = {0};
+	bool match;
+
+	if (!filter)
+		match = true;
+	else
+		match = scm_filter_match(psoc, db_node->entry,
+					 filter, &security);
+
+	if (!match)
+		return QDF_STATUS_SUCCESS;
+
+	ref_node = qdf_mem_malloc_atomic(sizeof(*ref_node));
+	if (!ref_node)
+		return QDF_STATUS_E_NOMEM;
+
+	/* db walk already holds a reference, so the node can't go away */
+	scm_scan_entry_get_ref(db_node);
+	ref_node->db_node = db_node;
+	ref_node->entry = db_node->entry;
+	qdf_mem_copy(&ref_node->neg_sec_info, &security,
+		     sizeof(ref_node->neg_sec_info));
+
+	qdf_list_insert_front(scan_list, &ref_node->node);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * scm_get_filter_index() - select the scan db index to look up a filter
+ * @filter: filter to be applied
+ * @buckets: bitmap of the hash buckets to be looked up
+ *
+ * A filter on bssids, ssids or channel frequencies only has to look at the
+ * buckets of the matching index, every other filter walks the whole db.
+ *
+ * Return: scan db index
+ */
+static enum scm_db_index
+scm_get_filter_index(struct scan_filter *filter, uint64_t *buckets)
+{
+	uint16_t i;
+
+	*buckets = 0;
+	if (!filter)
+		goto walk_all;
+
+	if (filter->num_of_bssid) {
+		for (i = 0; i < filter->num_of_bssid; i++) {
+			/* zero or broadcast bssid matches every bssid */
+			if (qdf_is_macaddr_zero(&filter->bssid_list[i]) ||
+			    qdf_is_macaddr_broadcast(&filter->bssid_list[i]))
+				goto walk_all;
+			*buckets |= 1ULL <<
+				SCAN_GET_HASH(filter->bssid_list[i].bytes);
+		}
+		return SCM_DB_INDEX_BSSID;
+	}
+
+	if (filter->num_of_ssid) {
+		*buckets = 1ULL << SCAN_HIDDEN_SSID_HASH;
+		for (i = 0; i < filter->num_of_ssid; i++)
+			*buckets |= 1ULL <<
+				scm_get_ssid_hash(&filter->ssid_list[i]);
+		return SCM_DB_INDEX_SSID;
+	}
+
+	if (filter->num_of_channels) {
+		for (i = 0; i < filter->num_of_channels; i++) {
+			/* 0 frequency matches every channel */
+			if (!filter->chan_freq_list[i])
+				goto walk_all;
+			*buckets |= 1ULL <<
+				SCAN_GET_FREQ_HASH(filter->chan_freq_list[i]);
+		}
+		return SCM_DB_INDEX_FREQ;
+	}
+
+walk_all:
+	*buckets = ~0ULL;
+
+	return SCM_DB_INDEX_BSSID;
+}
+
 /**
  * scm_get_results() - Iterate and get scan results
  * @psoc: psoc ptr
  * @scan_db: scan db
  * @filter: filter to be applied
  * @scan_list: scan list to which entry is added
+ * @get_ref: add read only references instead of copies of the entries
  *
- * Return: void
+ * Return: QDF_STATUS_E_NOMEM if a matching entry could not be referenced
  */
-static void scm_get_results(struct wlan_objmgr_psoc *psoc,
+static QDF_STATUS scm_get_results(struct wlan_objmgr_psoc *psoc,
 	struct scan_dbs *scan_db, struct scan_filter *filter,
-	qdf_list_t *scan_list)
+	qdf_list_t *scan_list, bool get_ref)
 {
+	QDF_STATUS status = QDF_STATUS_SUCCESS;
 	int i, count;
 	struct scan_cache_node *cur_node;
 	struct scan_cache_node *next_node = NULL;
+	enum scm_db_index index;
+	uint64_t buckets;
+	qdf_list_t *list;
+
+	index = scm_get_filter_index(filter, &buckets);
 
 	for (i = 0 ; i < SCAN_HASH_SIZE; i++) {
-		cur_node = scm_get_next_node(scan_db,
-			   &scan_db->scan_hash_tbl[i], NULL);
-		count = qdf_list_size(&scan_db->scan_hash_tbl[i]);
+		if (!(buckets & (1ULL << i)))
+			continue;
+		list = scm_get_index_list(scan_db, index, i);
+		count = qdf_list_size(list);
 		if (!count)
 			continue;
+		cur_node = scm_get_next_index_node(scan_db, index, list, NULL);
 		while (cur_node) {
-			scm_scan_apply_filter_get_entry(psoc,
-				cur_node->entry, filter, scan_list);
-			next_node = scm_get_next_node(scan_db,
-				&scan_db->scan_hash_tbl[i], cur_node);
+			if (get_ref) {
+				if (QDF_IS_STATUS_ERROR(
+					scm_scan_apply_filter_get_ref(
+						psoc, cur_node, filter,
+						scan_list)))
+					status = QDF_STATUS_E_NOMEM;
+			} else {
+				scm_scan_apply_filter_get_entry(psoc,
+					cur_node->entry, filter, scan_list);
+			}
+			next_node = scm_get_next_index_node(scan_db, index,
+							    list, cur_node);
 			cur_node = next_node;
 		}
 	}
+
+	return status;
 }
 
 QDF_STATUS scm_purge_scan_results(qdf_list_t *scan_list)
@@ -1392,11 +1649,96 @@ qdf_list_t *scm_get_scan_result(struct wlan_objmgr_pdev *pdev,
 	qdf_list_create(tmp_list,
 			MAX_SCAN_CACHE_SIZE);
 	scm_age_out_entries(psoc, scan_db);
-	scm_get_results(psoc, scan_db, filter, tmp_list);
+	scm_get_results(psoc, scan_db, filter, tmp_list, false);
 
 	return tmp_list;
 }
 
+struct scan_cache_snapshot *
+scm_get_scan_result_snapshot(struct wlan_objmgr_pdev *pdev,
+			     struct scan_filter *filter)
+{
+	struct wlan_objmgr_psoc *psoc;
+	struct scan_dbs *scan_db;
+	struct scan_cache_snapshot *snapshot;
+
+	if (!pdev) {
+		scm_err("pdev is NULL");
+		return NULL;
+	}
+
+	psoc = wlan_pdev_get_psoc(pdev);
+	if (!psoc) {
+		scm_err("psoc is NULL");
+		return NULL;
+	}
+
+	scan_db = wlan_pdev_get_scan_db(psoc, pdev);
+	if (!scan_db) {
+		scm_err("scan_db is NULL");
+		return NULL;
+	}
+
+	snapshot = qdf_mem_malloc_atomic(sizeof(*snapshot));
+	if (!snapshot) {
+		scm_err("failed to allocate scan result snapshot");
+		return NULL;
+	}
+
+	qdf_atomic_init(&snapshot->ref_cnt);
+	qdf_atomic_inc(&snapshot->ref_cnt);
+	snapshot->scan_db = scan_db;
+	qdf_list_create(&snapshot->list, MAX_SCAN_CACHE_SIZE);
+	scm_age_out_entries(psoc, scan_db);
+	if (QDF_IS_STATUS_ERROR(scm_get_results(psoc, scan_db, filter,
+						&snapshot->list, true))) {
+		/* a snapshot missing matching entries would mislead readers */
+		scm_err("failed to reference all scan results");
+		scm_scan_snapshot_put_ref(snapshot);
+		return NULL;
+	}
+
+	return snapshot;
+}
+
+void scm_scan_snapshot_get_ref(struct scan_cache_snapshot *snapshot)
+{
+	if (!snapshot) {
+		scm_err("snapshot is NULL");
+		QDF_ASSERT(0);
+		return;
+	}
+
+	qdf_atomic_inc(&snapshot->ref_cnt);
+}
+
+void scm_scan_snapshot_put_ref(struct scan_cache_snapshot *snapshot)
+{
+	struct scan_cache_ref_node *ref_node;
+	qdf_list_node_t *cur_lst = NULL;
+
+	if (!snapshot) {
+		scm_err("snapshot is NULL");
+		QDF_ASSERT(0);
+		return;
+	}
+
+	if (!qdf_atomic_dec_and_test(&snapshot->ref_cnt))
+		return;
+
+	while (QDF_IS_STATUS_SUCCESS(qdf_list_remove_front(&snapshot->list,
+							   &cur_lst))) {
+		ref_node = qdf_container_of(cur_lst,
+					    struct scan_cache_ref_node, node);
+		scm_scan_entry_put_ref(snapshot->scan_db, ref_node->db_node,
+				       true);
+		qdf_mem_free(ref_node);
+	}
+
+	qdf_list_destroy(&snapshot->list);
+	qdf_mem_free(snapshot);
+}
+
 /**
  * scm_iterate_db_and_call_func() - iterate and call the func
  * @scan_db: scan db
@@ -1683,9 +2025,14 @@ QDF_STATUS scm_db_init(struct wlan_objmgr_psoc *psoc)
 		}
 		scan_db->num_entries = 0;
 		qdf_spinlock_create(&scan_db->scan_db_lock);
-		for (j = 0; j < SCAN_HASH_SIZE; j++)
+		for (j = 0; j < SCAN_HASH_SIZE; j++) {
 			qdf_list_create(&scan_db->scan_hash_tbl[j],
 				MAX_SCAN_CACHE_SIZE);
+			qdf_list_create(&scan_db->ssid_hash_tbl[j],
+					MAX_SCAN_CACHE_SIZE);
+			qdf_list_create(&scan_db->freq_hash_tbl[j],
+					MAX_SCAN_CACHE_SIZE);
+		}
 	}
 	return QDF_STATUS_SUCCESS;
 }
@@ -1709,8 +2056,11 @@ QDF_STATUS scm_db_deinit(struct wlan_objmgr_psoc *psoc)
 		}
 
 		scm_flush_scan_entries(psoc, scan_db, NULL);
-		for (j = 0; j < SCAN_HASH_SIZE; j++)
+		for (j = 0; j < SCAN_HASH_SIZE; j++) {
 			qdf_list_destroy(&scan_db->scan_hash_tbl[j]);
+			qdf_list_destroy(&scan_db->ssid_hash_tbl[j]);
+			qdf_list_destroy(&scan_db->freq_hash_tbl[j]);
+		}
 		qdf_spinlock_destroy(&scan_db->scan_db_lock);
 	}
 
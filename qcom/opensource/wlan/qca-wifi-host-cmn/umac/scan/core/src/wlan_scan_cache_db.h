@@ -30,21 +30,42 @@
 #include <wlan_objmgr_vdev_obj.h>
 #include <wlan_scan_public_structs.h>
 
+/* Bucket selection for filtered lookups uses a 64 bit bucket mask */
 #define SCAN_HASH_SIZE 64
 #define SCAN_GET_HASH(addr) \
 	(((const uint8_t *)(addr))[QDF_MAC_ADDR_SIZE - 1] % SCAN_HASH_SIZE)
+/* Channel center frequencies are 5 MHz apart */
+#define SCAN_GET_FREQ_HASH(freq) (((freq) / 5) % SCAN_HASH_SIZE)
+/* Hidden and NULL ssid entries are indexed in a bucket of their own */
+#define SCAN_HIDDEN_SSID_HASH 0
 
 #define ADJACENT_CHANNEL_RSSI_THRESHOLD -80
 
+/**
+ * enum scm_db_index - scan cache data base index
+ * @SCM_DB_INDEX_BSSID: entries hashed by bssid
+ * @SCM_DB_INDEX_SSID: entries hashed by ssid
+ * @SCM_DB_INDEX_FREQ: entries hashed by channel frequency
+ */
+enum scm_db_index {
+	SCM_DB_INDEX_BSSID,
+	SCM_DB_INDEX_SSID,
+	SCM_DB_INDEX_FREQ,
+};
+
 /**
  * struct scan_dbs - scan cache data base definition
  * @num_entries: number of scan entries
  * @scan_hash_tbl: link list of bssid hashed scan cache entries for a pdev
+ * @ssid_hash_tbl: link list of ssid hashed scan cache entries for a pdev
+ * @freq_hash_tbl: link list of frequency hashed scan cache entries for a pdev
  */
 struct scan_dbs {
 	uint32_t num_entries;
 	qdf_spinlock_t scan_db_lock;
 	qdf_list_t scan_hash_tbl[SCAN_HASH_SIZE];
+	qdf_list_t ssid_hash_tbl[SCAN_HASH_SIZE];
+	qdf_list_t freq_hash_tbl[SCAN_HASH_SIZE];
 };
 
 /**
@@ -105,6 +126,43 @@ void scm_age_out_entries(struct wlan_objmgr_psoc *psoc,
 qdf_list_t *scm_get_scan_result(struct wlan_objmgr_pdev *pdev,
 	struct scan_filter *filter);
 
+/**
+ * scm_get_scan_result_snapshot() - fetches scan result snapshot
+ * @pdev: pdev info
+ * @filter: Filters
+ *
+ * This function fetches read only references to the scan entries matching
+ * the filter instead of copying them. The snapshot keeps the entries alive
+ * till it is released with scm_scan_snapshot_put_ref(), which must happen
+ * before the scan db is deinitialized.
+ *
+ * Return: scan result snapshot, NULL if not every matching entry could be
+ *	   referenced
+ */
+struct scan_cache_snapshot *
+scm_get_scan_result_snapshot(struct wlan_objmgr_pdev *pdev,
+			     struct scan_filter *filter);
+
+/**
+ * scm_scan_snapshot_get_ref() - take a reference on the scan result snapshot
+ * @snapshot: scan result snapshot
+ *
+ * Return: void
+ */
+void scm_scan_snapshot_get_ref(struct scan_cache_snapshot *snapshot);
+
+/**
+ * scm_scan_snapshot_put_ref() - release a reference on the scan result
+ * snapshot
+ * @snapshot: scan result snapshot
+ *
+ * The referenced scan entries are released once the last reference is
+ * dropped.
+ *
+ * Return: void
+ */
+void scm_scan_snapshot_put_ref(struct scan_cache_snapshot *snapshot);
+
 /**
  * scm_purge_scan_results() - purge the scan list
  * @scan_result: scan list to be purged
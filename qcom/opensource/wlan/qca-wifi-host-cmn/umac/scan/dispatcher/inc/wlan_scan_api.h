@@ -322,6 +322,51 @@ static inline qdf_list_t *wlan_scan_get_result(struct wlan_objmgr_pdev *pdev,
 	return scm_get_scan_result(pdev, filter);
 }
 
+/**
+ * wlan_scan_get_result_snapshot() - The Public API to get a read only scan
+ * result snapshot
+ * @pdev: pdev info
+ * @filter: Filters
+ *
+ * This function fetches references to the scan entries matching the filter
+ * instead of copies, for callers which only read the entries.
+ *
+ * Return: scan result snapshot, to be released with
+ * wlan_scan_snapshot_put_ref(), NULL if not every matching entry could be
+ * referenced
+ */
+static inline struct scan_cache_snapshot *
+wlan_scan_get_result_snapshot(struct wlan_objmgr_pdev *pdev,
+			      struct scan_filter *filter)
+{
+	return scm_get_scan_result_snapshot(pdev, filter);
+}
+
+/**
+ * wlan_scan_snapshot_get_ref() - take a reference on a scan result snapshot
+ * @snapshot: scan result snapshot
+ *
+ * Return: void
+ */
+static inline void
+wlan_scan_snapshot_get_ref(struct scan_cache_snapshot *snapshot)
+{
+	scm_scan_snapshot_get_ref(snapshot);
+}
+
+/**
+ * wlan_scan_snapshot_put_ref() - release a reference on a scan result
+ * snapshot
+ * @snapshot: scan result snapshot
+ *
+ * Return: void
+ */
+static inline void
+wlan_scan_snapshot_put_ref(struct scan_cache_snapshot *snapshot)
+{
+	scm_scan_snapshot_put_ref(snapshot);
+}
+
 /**
  * wlan_scan_update_mlme_by_bssinfo() - The Public API to update mlme
  * info in the scan entry
@@ -312,12 +312,16 @@ struct bss_info {
  * @ref_cnt: ref count if in use
  * @cookie: cookie to check if entry is logically active
  * @entry: scan entry pointer
+ * @ssid_node: node pointers of the scan db ssid index
+ * @freq_node: node pointers of the scan db frequency index
  */
 struct scan_cache_node {
 	qdf_list_node_t node;
 	qdf_atomic_t ref_cnt;
 	uint32_t cookie;
 	struct scan_cache_entry *entry;
+	qdf_list_node_t ssid_node;
+	qdf_list_node_t freq_node;
 };
 
 /**
@@ -338,6 +342,34 @@ struct security_info {
 	uint16_t rsn_caps;
 };
 
+struct scan_dbs;
+
+/**
+ * struct scan_cache_ref_node - Read only reference to a scan cache entry
+ * @node: node pointers
+ * @db_node: scan db node of the entry, held till the snapshot is released
+ * @entry: scan entry owned by the scan db, must not be modified
+ * @neg_sec_info: negotiated security info of the entry for the filter
+ */
+struct scan_cache_ref_node {
+	qdf_list_node_t node;
+	struct scan_cache_node *db_node;
+	struct scan_cache_entry *entry;
+	struct security_info neg_sec_info;
+};
+
+/**
+ * struct scan_cache_snapshot - Ref counted scan result snapshot
+ * @ref_cnt: snapshot ref count, entries are released once it drops to 0
+ * @scan_db: scan db the entries are referenced from
+ * @list: list of struct scan_cache_ref_node
+ */
+struct scan_cache_snapshot {
+	qdf_atomic_t ref_cnt;
+	struct scan_dbs *scan_db;
+	qdf_list_t list;
+};
+
 /**
  * struct scan_mbssid_info - Scan mbssid information
  * @profile_num: profile number
@@ -404,6 +404,30 @@ qdf_list_t *ucfg_scan_get_result(struct wlan_objmgr_pdev *pdev,
  */
 QDF_STATUS ucfg_scan_purge_results(qdf_list_t *scan_list);
 
+/**
+ * ucfg_scan_get_result_snapshot() - The Public API to get a read only scan
+ * result snapshot
+ * @pdev: pdev info
+ * @filter: Filters
+ *
+ * This function fetches references to the scan entries matching the filter
+ * instead of copies. The entries must not be modified.
+ *
+ * Return: scan result snapshot, to be released with
+ * ucfg_scan_snapshot_put_ref()
+ */
+struct scan_cache_snapshot *
+ucfg_scan_get_result_snapshot(struct wlan_objmgr_pdev *pdev,
+			      struct scan_filter *filter);
+
+/**
+ * ucfg_scan_snapshot_put_ref() - release the scan result snapshot
+ * @snapshot: scan result snapshot
+ *
+ * Return: void
+ */
+void ucfg_scan_snapshot_put_ref(struct scan_cache_snapshot *snapshot);
+
 /**
  * ucfg_scan_flush_results() - The Public API to flush scan result
  * @pdev: pdev object
@@ -65,6 +65,18 @@ QDF_STATUS ucfg_scan_purge_results(qdf_list_t *scan_list)
 	return scm_purge_scan_results(scan_list);
 }
 
+struct scan_cache_snapshot *
+ucfg_scan_get_result_snapshot(struct wlan_objmgr_pdev *pdev,
+			      struct scan_filter *filter)
+{
+	return scm_get_scan_result_snapshot(pdev, filter);
+}
+
+void ucfg_scan_snapshot_put_ref(struct scan_cache_snapshot *snapshot)
+{
+	scm_scan_snapshot_put_ref(snapshot);
+}
+
 QDF_STATUS ucfg_scan_flush_results(struct wlan_objmgr_pdev *pdev,
 	struct scan_filter *filter)
 {
@@ -43,6 +43,11 @@
 #ifdef WLAN_FEATURE_CONNECTIVITY_LOGGING
 #include <wlan_connectivity_logging.h>
 #endif
+#ifdef WLAN_LOGGING_MMAP_RING
+#include <linux/mm.h>
+#include <linux/proc_fs.h>
+#include <linux/rcupdate.h>
+#endif
 
 #ifdef CNSS_GENL
 #ifdef CONFIG_CNSS_OUT_OF_TREE
@@ -132,6 +137,101 @@ DEFINE_RATELIMIT_STATE(panic_wifilog_ratelimit,
 
 #define FLUSH_LOG_COMPLETION_TIMEOUT 3000
 
+#ifdef WLAN_LOGGING_PERCPU_BUFFERS
+/* Size of the per-CPU staging ring, must be a power of two */
+#define WLAN_LOG_PERCPU_BUF_SIZE 8192
+#define WLAN_LOG_PERCPU_BUF_MASK (WLAN_LOG_PERCPU_BUF_SIZE - 1)
+#define WLAN_LOG_PERCPU_REC_ALIGN 16
+
+/**
+ * struct wlan_log_rec_hdr - header of a log line in a per-CPU ring
+ * @ts: log timestamp of the line, used to merge the per-CPU rings
+ * @len: length of the line following the header, 0 for a padding record
+ *	 which skips the rest of the ring up to the wrap around
+ * @reserved: pads the header to WLAN_LOG_PERCPU_REC_ALIGN
+ */
+struct wlan_log_rec_hdr {
+	uint64_t ts;
+	uint32_t len;
+	uint32_t reserved;
+};
+
+/**
+ * struct wlan_log_percpu_buf - per-CPU staging ring for host log lines
+ * @head: free running write offset, only advanced by the owning CPU
+ * @tail: free running read offset, only advanced by the log merger
+ * @drop_count: log lines dropped because the ring was full
+ * @reported_drops: part of @drop_count already reported by the logger
+ * @data: ring storage
+ */
+struct wlan_log_percpu_buf {
+	unsigned int head;
+	unsigned int tail;
+	unsigned int drop_count;
+	unsigned int reported_drops;
+	char data[WLAN_LOG_PERCPU_BUF_SIZE];
+};
+#endif
+
+#ifdef WLAN_LOGGING_MMAP_RING
+#define WLAN_LOG_MMAP_PROC_NAME "wlan_host_logs"
+#define WLAN_LOG_MMAP_PROC_PERM 0400
+#define WLAN_LOG_MMAP_RING_VERSION 1
+/* Number of log nodes in the mmap ring, must be a power of two */
+#define WLAN_LOG_MMAP_RING_ENTRIES 64
+#define WLAN_LOG_MMAP_RING_OFFSET PAGE_SIZE
+#define WLAN_LOG_MMAP_ENTRY_OFFSET SMP_CACHE_BYTES
+#define WLAN_LOG_MMAP_RING_SIZE \
+	PAGE_ALIGN(WLAN_LOG_MMAP_RING_OFFSET + WLAN_LOG_MMAP_ENTRY_OFFSET + \
+		   WLAN_LOG_MMAP_RING_ENTRIES * \
+		   sizeof(struct wlan_log_mmap_entry))
+
+/**
+ * struct wlan_log_mmap_hdr - first page of the mmap-able host log ring
+ * @version: layout version, WLAN_LOG_MMAP_RING_VERSION
+ * @nr_entries: number of entries in the ring, a power of two
+ * @entry_size: size of one struct wlan_log_mmap_entry
+ * @ring_offset: offset of struct wlan_log_mmap_ring in the mapping
+ * @entry_offset: offset of the first entry from the start of the ring
+ */
+struct wlan_log_mmap_hdr {
+	uint32_t version;
+	uint32_t nr_entries;
+	uint32_t entry_size;
+	uint32_t ring_offset;
+	uint32_t entry_offset;
+};
+
+/**
+ * struct wlan_log_mmap_ring - indexes of the mmap-able host log ring
+ * @head: free running producer index, only written by the logger thread
+ * @tail: free running consumer index, only written by userspace
+ * @drop_count: log nodes dropped because the ring was full
+ *
+ * The indexes share the first cache line of the ring, the entries start
+ * at wlan_log_mmap_hdr.entry_offset.
+ */
+struct wlan_log_mmap_ring {
+	uint32_t head;
+	uint32_t tail;
+	uint32_t drop_count;
+};
+
+/**
+ * struct wlan_log_mmap_entry - log node published in the mmap ring
+ * @seq: producer index the entry was written at
+ * @radio: radio index of the log node
+ * @len: number of valid bytes in @logbuf
+ * @logbuf: tAniHdr followed by the log lines, as sent over netlink
+ */
+struct wlan_log_mmap_entry {
+	uint32_t seq;
+	uint32_t radio;
+	uint32_t len;
+	char logbuf[MAX_LOGMSG_LENGTH];
+};
+#endif
+
 struct log_msg {
 	struct list_head node;
 	unsigned int radio;
@@ -217,6 +317,10 @@ struct wlan_logging {
 	qdf_spinlock_t flush_timer_lock;
 
 	qdf_event_t flush_log_completion;
+#ifdef WLAN_LOGGING_PERCPU_BUFFERS
+	/* Per-CPU rings the log lines are staged in before the merge */
+	struct wlan_log_percpu_buf __percpu *percpu_buf;
+#endif
 };
 
 /* This global variable is intentionally not marked static because it
@@ -294,6 +398,251 @@ static int wlan_queue_logmsg_for_app(void)
 	return ret;
 }
 
+#ifdef WLAN_LOGGING_PERCPU_BUFFERS
+static inline QDF_STATUS allocate_log_percpu_buffer(void)
+{
+	gwlan_logging.percpu_buf = alloc_percpu(struct wlan_log_percpu_buf);
+
+	return gwlan_logging.percpu_buf ? QDF_STATUS_SUCCESS :
+					  QDF_STATUS_E_NOMEM;
+}
+
+static inline void free_log_percpu_buffer(void)
+{
+	struct wlan_log_percpu_buf __percpu *percpu_buf;
+
+	percpu_buf = gwlan_logging.percpu_buf;
+	if (!percpu_buf)
+		return;
+
+	/* Writers run with interrupts disabled, wait for them to finish */
+	WRITE_ONCE(gwlan_logging.percpu_buf, NULL);
+	synchronize_rcu();
+	free_percpu(percpu_buf);
+}
+
+/**
+ * wlan_log_append() - append a log line to the local CPU ring
+ * @ts: log timestamp of the line
+ * @tbuf: context and timestamp prefix of the line
+ * @tlen: length of @tbuf
+ * @msg: log message
+ * @length: length of @msg
+ *
+ * Only the local CPU writes its ring and interrupts are disabled while it
+ * does, so no lock is shared with the other CPUs.
+ *
+ * Return: 0 on success, -EIO if logging is not initialized and -ENOBUFS
+ *	   if the line was dropped
+ */
+static int wlan_log_append(uint64_t ts, const char *tbuf, int tlen,
+			   const char *msg, int length)
+{
+	struct wlan_log_percpu_buf __percpu *percpu_buf;
+	struct wlan_log_percpu_buf *buf;
+	struct wlan_log_rec_hdr *hdr;
+	unsigned int rec_len, off, contig, used, need;
+	bool wake_up_thread = false;
+	unsigned long flags;
+	char *ptr;
+	int ret = 0;
+
+	if (unlikely(MAX_LOGMSG_LENGTH <
+		     (sizeof(tAniNlHdr) + length + tlen + 1 + 1))) {
+		/* the overflow part of an oversized log is discarded */
+		length = MAX_LOGMSG_LENGTH - sizeof(tAniNlHdr) - tlen - 2;
+		QDF_ASSERT(0);
+	}
+
+	rec_len = ALIGN(sizeof(*hdr) + tlen + length + 1,
+			WLAN_LOG_PERCPU_REC_ALIGN);
+
+	local_irq_save(flags);
+	percpu_buf = READ_ONCE(gwlan_logging.percpu_buf);
+	if (!percpu_buf) {
+		ret = -EIO;
+		goto out;
+	}
+
+	buf = this_cpu_ptr(percpu_buf);
+	used = buf->head - smp_load_acquire(&buf->tail);
+	off = buf->head & WLAN_LOG_PERCPU_BUF_MASK;
+	contig = WLAN_LOG_PERCPU_BUF_SIZE - off;
+	need = rec_len + (contig < rec_len ? contig : 0);
+
+	if (WLAN_LOG_PERCPU_BUF_SIZE - used < need) {
+		buf->drop_count++;
+		wake_up_thread = true;
+		ret = -ENOBUFS;
+		goto out;
+	}
+
+	if (contig < rec_len) {
+		/* records never wrap, pad up to the end of the ring */
+		hdr = (struct wlan_log_rec_hdr *)&buf->data[off];
+		hdr->len = 0;
+		buf->head += contig;
+		off = 0;
+	}
+
+	hdr = (struct wlan_log_rec_hdr *)&buf->data[off];
+	hdr->ts = ts;
+	hdr->len = tlen + length + 1;
+	ptr = (char *)(hdr + 1);
+	memcpy(ptr, tbuf, tlen);
+	memcpy(ptr + tlen, msg, length);
+	ptr[tlen + length] = '\n';
+	smp_store_release(&buf->head, buf->head + rec_len);
+
+	/* let the logger merge once the ring is half full */
+	if (used < WLAN_LOG_PERCPU_BUF_SIZE / 2 &&
+	    used + need >= WLAN_LOG_PERCPU_BUF_SIZE / 2)
+		wake_up_thread = true;
+out:
+	local_irq_restore(flags);
+
+	if (wake_up_thread) {
+		set_bit(HOST_LOG_DRIVER_MSG, &gwlan_logging.eventFlag);
+		wake_up_interruptible(&gwlan_logging.wait_queue);
+	}
+
+	return ret;
+}
+
+/**
+ * wlan_log_percpu_peek() - get the oldest log line of a per-CPU ring
+ * @buf: per-CPU ring
+ *
+ * Return: header of the oldest log line, NULL if the ring is empty
+ */
+static struct wlan_log_rec_hdr *
+wlan_log_percpu_peek(struct wlan_log_percpu_buf *buf)
+{
+	unsigned int head = smp_load_acquire(&buf->head);
+	struct wlan_log_rec_hdr *hdr;
+	unsigned int off;
+
+	while (buf->tail != head) {
+		off = buf->tail & WLAN_LOG_PERCPU_BUF_MASK;
+		hdr = (struct wlan_log_rec_hdr *)&buf->data[off];
+		if (hdr->len)
+			return hdr;
+
+		/* padding record, the next line is at the start */
+		smp_store_release(&buf->tail, buf->tail +
+				  WLAN_LOG_PERCPU_BUF_SIZE - off);
+	}
+
+	return NULL;
+}
+
+/* Need to call this with spin_lock acquired */
+static void wlan_log_fill_cur_node(const char *line, unsigned int len)
+{
+	unsigned int *pfilled_length;
+	char *ptr;
+
+	pfilled_length = &gwlan_logging.pcur_node->filled_length;
+	/* 1 indicates '\0' */
+	if ((MAX_LOGMSG_LENGTH - (*pfilled_length +
+			sizeof(tAniNlHdr))) < len + 1) {
+		wlan_queue_logmsg_for_app();
+		pfilled_length = &gwlan_logging.pcur_node->filled_length;
+	}
+
+	ptr = &gwlan_logging.pcur_node->logbuf[sizeof(tAniHdr)];
+	memcpy(&ptr[*pfilled_length], line, len);
+	*pfilled_length += len;
+}
+
+/**
+ * wlan_logging_merge_percpu_logs() - move the per-CPU log lines to log_msg
+ *
+ * The per-CPU rings are merged in timestamp order into the current log_msg
+ * node, filled nodes are queued for the app as usual.
+ * Need to call this with spin_lock acquired.
+ *
+ * Return: None
+ */
+static void wlan_logging_merge_percpu_logs(void)
+{
+	struct wlan_log_percpu_buf __percpu *percpu_buf;
+	struct wlan_log_percpu_buf *buf, *min_buf;
+	struct wlan_log_rec_hdr *hdr, *min_hdr;
+	int cpu;
+
+	percpu_buf = READ_ONCE(gwlan_logging.percpu_buf);
+	if (!percpu_buf || !gwlan_logging.pcur_node)
+		return;
+
+	for (;;) {
+		min_buf = NULL;
+		min_hdr = NULL;
+		for_each_possible_cpu(cpu) {
+			buf = per_cpu_ptr(percpu_buf, cpu);
+			hdr = wlan_log_percpu_peek(buf);
+			if (hdr && (!min_hdr || hdr->ts < min_hdr->ts)) {
+				min_buf = buf;
+				min_hdr = hdr;
+			}
+		}
+
+		if (!min_hdr)
+			break;
+
+		wlan_log_fill_cur_node((char *)(min_hdr + 1), min_hdr->len);
+		smp_store_release(&min_buf->tail, min_buf->tail +
+				  ALIGN(sizeof(*min_hdr) + min_hdr->len,
+					WLAN_LOG_PERCPU_REC_ALIGN));
+	}
+}
+
+/**
+ * wlan_logging_report_percpu_drops() - report log lines dropped per CPU
+ *
+ * Return: None
+ */
+static void wlan_logging_report_percpu_drops(void)
+{
+	struct wlan_log_percpu_buf __percpu *percpu_buf;
+	struct wlan_log_percpu_buf *buf;
+	unsigned int drop_count;
+	int cpu;
+
+	percpu_buf = READ_ONCE(gwlan_logging.percpu_buf);
+	if (!percpu_buf)
+		return;
+
+	for_each_possible_cpu(cpu) {
+		buf = per_cpu_ptr(percpu_buf, cpu);
+		drop_count = READ_ONCE(buf->drop_count);
+		if (drop_count == buf->reported_drops)
+			continue;
+
+		qdf_err("cpu %d dropped %u host logs, total %u", cpu,
+			drop_count - buf->reported_drops, drop_count);
+		buf->reported_drops = drop_count;
+	}
+}
+#else
+static inline QDF_STATUS allocate_log_percpu_buffer(void)
+{
+	return QDF_STATUS_SUCCESS;
+}
+
+static inline void free_log_percpu_buffer(void)
+{
+}
+
+static inline void wlan_logging_merge_percpu_logs(void)
+{
+}
+
+static inline void wlan_logging_report_percpu_drops(void)
+{
+}
+#endif
+
 static const char *current_process_name(void)
 {
 	if (in_irq())
@@ -390,26 +739,25 @@ log_to_console(QDF_TRACE_LEVEL level, const char *timestamp, const char *msg)
 }
 #endif
 
-int wlan_log_to_user(QDF_TRACE_LEVEL log_level, char *to_be_sent, int length)
+#ifndef WLAN_LOGGING_PERCPU_BUFFERS
+/**
+ * wlan_log_append() - append a log line to the current log_msg node
+ * @ts: log timestamp of the line
+ * @tbuf: context and timestamp prefix of the line
+ * @tlen: length of @tbuf
+ * @to_be_sent: log message
+ * @length: length of @to_be_sent
+ *
+ * Return: 0 on success, -EIO if logging is not initialized
+ */
+static int wlan_log_append(uint64_t ts, const char *tbuf, int tlen,
+			   const char *to_be_sent, int length)
 {
 	char *ptr;
-	char tbuf[60];
-	int tlen;
 	int total_log_len;
 	unsigned int *pfilled_length;
 	bool wake_up_thread = false;
 	unsigned long flags;
-	uint64_t ts;
-
-	/* Add the current time stamp */
-	ts = qdf_get_log_timestamp();
-	tlen = wlan_add_user_log_time_stamp(tbuf, sizeof(tbuf), ts);
-
-	/* if logging isn't up yet, just dump to dmesg */
-	if (!gwlan_logging.is_active) {
-		log_to_console(log_level, tbuf, to_be_sent);
-		return 0;
-	}
 
 	/* 1+1 indicate '\n'+'\0' */
 	total_log_len = length + tlen + 1 + 1;
@@ -463,6 +811,29 @@ int wlan_log_to_user(QDF_TRACE_LEVEL log_level, char *to_be_sent, int length)
 		wake_up_interruptible(&gwlan_logging.wait_queue);
 	}
 
+	return 0;
+}
+#endif
+
+int wlan_log_to_user(QDF_TRACE_LEVEL log_level, char *to_be_sent, int length)
+{
+	char tbuf[60];
+	int tlen;
+	uint64_t ts;
+
+	/* Add the current time stamp */
+	ts = qdf_get_log_timestamp();
+	tlen = wlan_add_user_log_time_stamp(tbuf, sizeof(tbuf), ts);
+
+	/* if logging isn't up yet, just dump to dmesg */
+	if (!gwlan_logging.is_active) {
+		log_to_console(log_level, tbuf, to_be_sent);
+		return 0;
+	}
+
+	if (wlan_log_append(ts, tbuf, tlen, to_be_sent, length) == -EIO)
+		return -EIO;
+
 	if (gwlan_logging.console_log_levels & BIT(log_level))
 		log_to_console(log_level, tbuf, to_be_sent);
 
@@ -656,6 +1027,188 @@ int pktlog_send_per_pkt_stats_to_user(void)
 }
 #endif
 
+#ifdef WLAN_LOGGING_MMAP_RING
+/* Host log ring shared with userspace, only set while the proc file is open */
+static void __rcu *wlan_log_mmap_buf;
+static unsigned int wlan_log_mmap_open_count;
+static DEFINE_MUTEX(wlan_log_mmap_lock);
+static struct proc_dir_entry *wlan_log_mmap_pde;
+
+static int wlan_log_mmap_open(struct inode *inode, struct file *file)
+{
+	struct wlan_log_mmap_hdr *hdr;
+	void *buf;
+
+	mutex_lock(&wlan_log_mmap_lock);
+	if (!wlan_log_mmap_open_count) {
+		buf = vmalloc_user(WLAN_LOG_MMAP_RING_SIZE);
+		if (!buf) {
+			mutex_unlock(&wlan_log_mmap_lock);
+			return -ENOMEM;
+		}
+
+		hdr = buf;
+		hdr->version = WLAN_LOG_MMAP_RING_VERSION;
+		hdr->nr_entries = WLAN_LOG_MMAP_RING_ENTRIES;
+		hdr->entry_size = sizeof(struct wlan_log_mmap_entry);
+		hdr->ring_offset = WLAN_LOG_MMAP_RING_OFFSET;
+		hdr->entry_offset = WLAN_LOG_MMAP_ENTRY_OFFSET;
+		rcu_assign_pointer(wlan_log_mmap_buf, buf);
+	}
+	wlan_log_mmap_open_count++;
+	mutex_unlock(&wlan_log_mmap_lock);
+
+	return 0;
+}
+
+static int wlan_log_mmap_release(struct inode *inode, struct file *file)
+{
+	void *buf = NULL;
+
+	mutex_lock(&wlan_log_mmap_lock);
+	if (wlan_log_mmap_open_count && !--wlan_log_mmap_open_count) {
+		buf = rcu_dereference_protected(wlan_log_mmap_buf,
+					lockdep_is_held(&wlan_log_mmap_lock));
+		RCU_INIT_POINTER(wlan_log_mmap_buf, NULL);
+	}
+	mutex_unlock(&wlan_log_mmap_lock);
+
+	if (buf) {
+		/* Wait for the logger thread to stop writing the ring */
+		synchronize_rcu();
+		vfree(buf);
+	}
+
+	return 0;
+}
+
+static int wlan_log_mmap_mmap(struct file *file, struct vm_area_struct *vma)
+{
+	void *buf;
+
+	if (vma->vm_end - vma->vm_start > WLAN_LOG_MMAP_RING_SIZE)
+		return -EINVAL;
+
+	/* The ring stays allocated as long as the file is open */
+	buf = rcu_dereference_protected(wlan_log_mmap_buf, 1);
+	if (!buf)
+		return -ENODEV;
+
+	return remap_vmalloc_range(vma, buf, vma->vm_pgoff);
+}
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0))
+static const struct proc_ops wlan_log_mmap_fops = {
+	.proc_open = wlan_log_mmap_open,
+	.proc_release = wlan_log_mmap_release,
+	.proc_mmap = wlan_log_mmap_mmap,
+};
+#else
+static const struct file_operations wlan_log_mmap_fops = {
+	.open = wlan_log_mmap_open,
+	.release = wlan_log_mmap_release,
+	.mmap = wlan_log_mmap_mmap,
+};
+#endif
+
+/**
+ * send_filled_buffers_to_mmap_ring() - publish the filled log nodes in the
+ *	mmap-able host log ring
+ *
+ * Each node is copied to the entry at the producer index and the index is
+ * released to userspace, which advances the consumer index once it has read
+ * the entry. A node is dropped and counted if the consumer fell behind by a
+ * whole ring.
+ *
+ * Return: 0 if the filled nodes were consumed, -ENODEV if no consumer has
+ *	   the ring open and the nodes are left for netlink
+ */
+static int send_filled_buffers_to_mmap_ring(void)
+{
+	struct wlan_log_mmap_entry *entries, *entry;
+	struct wlan_log_mmap_ring *ring;
+	struct log_msg *plog_msg;
+	unsigned long flags;
+	uint32_t head;
+	char *buf;
+
+	rcu_read_lock();
+	buf = rcu_dereference(wlan_log_mmap_buf);
+	if (!buf) {
+		rcu_read_unlock();
+		return -ENODEV;
+	}
+
+	ring = (struct wlan_log_mmap_ring *)(buf + WLAN_LOG_MMAP_RING_OFFSET);
+	entries = (struct wlan_log_mmap_entry *)
+		  ((char *)ring + WLAN_LOG_MMAP_ENTRY_OFFSET);
+
+	while (!list_empty(&gwlan_logging.filled_list)
+	       && !gwlan_logging.exit) {
+		spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+		plog_msg = (struct log_msg *)
+			   (gwlan_logging.filled_list.next);
+		list_del_init(gwlan_logging.filled_list.next);
+		spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+
+		head = ring->head;
+		if (head - smp_load_acquire(&ring->tail) >=
+		    WLAN_LOG_MMAP_RING_ENTRIES) {
+			WRITE_ONCE(ring->drop_count, ring->drop_count + 1);
+			++gwlan_logging.drop_count;
+		} else {
+			entry = &entries[head &
+					 (WLAN_LOG_MMAP_RING_ENTRIES - 1)];
+			entry->seq = head;
+			entry->radio = plog_msg->radio;
+			entry->len = plog_msg->filled_length + sizeof(tAniHdr);
+			memcpy(entry->logbuf, plog_msg->logbuf, entry->len);
+			smp_store_release(&ring->head, head + 1);
+		}
+
+		spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+		list_add_tail(&plog_msg->node, &gwlan_logging.free_list);
+		spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+	}
+	rcu_read_unlock();
+
+	return 0;
+}
+
+static void wlan_log_mmap_ring_init(void)
+{
+	wlan_log_mmap_pde = proc_create_data(WLAN_LOG_MMAP_PROC_NAME,
+					     WLAN_LOG_MMAP_PROC_PERM, NULL,
+					     &wlan_log_mmap_fops, NULL);
+	if (!wlan_log_mmap_pde)
+		qdf_err("Could not create /proc/%s, host logs use netlink",
+			WLAN_LOG_MMAP_PROC_NAME);
+}
+
+static void wlan_log_mmap_ring_deinit(void)
+{
+	if (!wlan_log_mmap_pde)
+		return;
+
+	/* Releases the ring of the consumers still holding the file open */
+	proc_remove(wlan_log_mmap_pde);
+	wlan_log_mmap_pde = NULL;
+}
+#else
+static inline int send_filled_buffers_to_mmap_ring(void)
+{
+	return -ENODEV;
+}
+
+static inline void wlan_log_mmap_ring_init(void)
+{
+}
+
+static inline void wlan_log_mmap_ring_deinit(void)
+{
+}
+#endif
+
 static int send_filled_buffers_to_user(void)
 {
 	int ret = -1;
@@ -670,6 +1223,10 @@ static int send_filled_buffers_to_user(void)
 	static int rate_limit;
 	void *out;
 
+	/* Netlink is only the fallback when nobody maps the host log ring */
+	if (!send_filled_buffers_to_mmap_ring())
+		return 0;
+
 	while (!list_empty(&gwlan_logging.filled_list)
 	       && !gwlan_logging.exit) {
 
@@ -880,6 +1437,10 @@ static int wlan_logging_thread(void *Arg)
 
 		if (test_and_clear_bit(HOST_LOG_DRIVER_MSG,
 					&gwlan_logging.eventFlag)) {
+			spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+			wlan_logging_merge_percpu_logs();
+			spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+			wlan_logging_report_percpu_drops();
 			ret = send_filled_buffers_to_user();
 			if (-ENOMEM == ret)
 				msleep(200);
@@ -918,6 +1479,7 @@ static int wlan_logging_thread(void *Arg)
 				/* Flush all current host logs*/
 				spin_lock_irqsave(&gwlan_logging.spin_lock,
 					flags);
+				wlan_logging_merge_percpu_logs();
 				wlan_queue_logmsg_for_app();
 				spin_unlock_irqrestore(&gwlan_logging.spin_lock,
 					flags);
@@ -1049,6 +1611,7 @@ static int wlan_logging_panic_handler(struct notifier_block *this,
 	unsigned long flags;
 
 	spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+	wlan_logging_merge_percpu_logs();
 	/* Iterate over nodes queued for app */
 	while (!list_empty(&gwlan_logging.filled_list)) {
 		plog_msg = (struct log_msg *)
@@ -1165,6 +1728,11 @@ int wlan_logging_sock_init_svc(void)
 	list_del_init(gwlan_logging.free_list.next);
 	spin_unlock_irqrestore(&gwlan_logging.spin_lock, irq_flag);
 
+	if (allocate_log_percpu_buffer() != QDF_STATUS_SUCCESS) {
+		qdf_err("Could not allocate memory for per-CPU logs");
+		goto err0;
+	}
+
 	flush_timer_init();
 
 	/* Initialize the pktStats data structure here */
@@ -1228,6 +1796,8 @@ int wlan_logging_sock_init_svc(void)
 		goto err3;
 	}
 
+	wlan_log_mmap_ring_init();
+
 	return 0;
 
 err3:
@@ -1243,6 +1813,8 @@ err2:
 	gpkt_stats_buffers = NULL;
 err1:
 	flush_timer_deinit();
+	free_log_percpu_buffer();
+err0:
 	spin_lock_irqsave(&gwlan_logging.spin_lock, irq_flag);
 	gwlan_logging.pcur_node = NULL;
 	spin_unlock_irqrestore(&gwlan_logging.spin_lock, irq_flag);
@@ -1259,6 +1831,8 @@ int wlan_logging_sock_deinit_svc(void)
 	if (!gwlan_logging.pcur_node)
 		return 0;
 
+	wlan_log_mmap_ring_deinit();
+
 	qdf_event_destroy(&gwlan_logging.flush_log_completion);
 
 	INIT_COMPLETION(gwlan_logging.shutdown_comp);
@@ -1290,6 +1864,8 @@ int wlan_logging_sock_deinit_svc(void)
 	/* Delete the Flush timer then mark pcur_node NULL */
 	flush_timer_deinit();
 
+	free_log_percpu_buffer();
+
 	spin_lock_irqsave(&gwlan_logging.spin_lock, irq_flag);
 	gwlan_logging.pcur_node = NULL;
 	spin_unlock_irqrestore(&gwlan_logging.spin_lock, irq_flag);
@@ -1359,6 +1935,7 @@ void wlan_flush_host_logs_for_fatal(void)
 	if (gwlan_logging.flush_timer_period == 0)
 		qdf_info("Flush all host logs Setting HOST_LOG_POST_MAS");
 	spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+	wlan_logging_merge_percpu_logs();
 	wlan_queue_logmsg_for_app();
 	spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
 	set_bit(HOST_LOG_DRIVER_MSG, &gwlan_logging.eventFlag);
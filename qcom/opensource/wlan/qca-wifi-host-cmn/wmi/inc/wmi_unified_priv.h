@@ -387,6 +387,46 @@ struct wmi_wq_dbg_info {
 	qdf_thread_t *task;
 };
 
+/*
+ * Number of param_tlvs entries __wmi_control_rx() keeps on the stack, events
+ * with more TLVs get their param_tlvs container allocated.
+ */
+#define WMI_EVT_PARAM_TLVS_ON_STACK 16
+
+/**
+ * wmitlv_check_and_pad_event_tlvs_buf() - validate and pad(if necessary)
+ * incoming WMI Event TLVs into a caller provided param_tlvs container
+ * @os_handle: os context handle
+ * @param_struc_ptr: pointer to tlv structure
+ * @param_buf_len: length of tlv parameter
+ * @wmi_cmd_event_id: event id
+ * @wmi_cmd_struct_ptr: returns the param_tlvs container of the event
+ * @param_tlvs_buf: param_tlvs container used if the event fits in it
+ * @param_tlvs_buf_len: size of @param_tlvs_buf
+ *
+ * Return: 0 if success. Return < 0 if failure.
+ */
+int
+wmitlv_check_and_pad_event_tlvs_buf(void *os_handle, void *param_struc_ptr,
+				    uint32_t param_buf_len,
+				    uint32_t wmi_cmd_event_id,
+				    void **wmi_cmd_struct_ptr,
+				    void *param_tlvs_buf,
+				    uint32_t param_tlvs_buf_len);
+
+/**
+ * wmitlv_free_allocated_event_tlvs_buf() - free the buffers allocated by
+ * wmitlv_check_and_pad_event_tlvs_buf()
+ * @cmd_event_id: event id
+ * @wmi_cmd_struct_ptr: param_tlvs container of the event
+ * @param_tlvs_buf: caller provided param_tlvs container, not freed
+ *
+ * Return: none
+ */
+void wmitlv_free_allocated_event_tlvs_buf(uint32_t cmd_event_id,
+					  void **wmi_cmd_struct_ptr,
+					  void *param_tlvs_buf);
+
 struct wmi_ops {
 #ifdef WLAN_FEATURE_ROAM_OFFLOAD
 QDF_STATUS
@@ -2378,11 +2418,14 @@ void (*wmi_pdev_id_conversion_enable)(wmi_unified_t wmi_handle,
 				      uint8_t size);
 void (*send_time_stamp_sync_cmd)(wmi_unified_t wmi_handle);
 void (*wmi_free_allocated_event)(uint32_t cmd_event_id,
-				void **wmi_cmd_struct_ptr);
+				void **wmi_cmd_struct_ptr,
+				void *param_tlvs_buf);
 int (*wmi_check_and_pad_event)(void *os_handle, void *param_struc_ptr,
 				uint32_t param_buf_len,
 				uint32_t wmi_cmd_event_id,
-				void **wmi_cmd_struct_ptr);
+				void **wmi_cmd_struct_ptr,
+				void *param_tlvs_buf,
+				uint32_t param_tlvs_buf_len);
 int (*wmi_check_command_params)(void *os_handle, void *param_struc_ptr,
 				uint32_t param_buf_len,
 				uint32_t wmi_cmd_event_id);
@@ -54,6 +54,31 @@ uint32_t evt_attr_list[] = {
 	WMITLV_ALL_EVT_LIST(WMITLV_GET_CMD_EVT_ATTRB_LIST)
 };
 
+#ifdef WMI_TLV_COMPILED_SCHEMA
+/*
+ * Offset of the attribute block of every command/event in cmd_attr_list
+ * and evt_attr_list, computed at build time from the same WMITLV tables.
+ * Each block is one ATTRB0 word followed by one word per TLV, so the
+ * next block starts right after wmitlv_attr_last_##id.
+ */
+#define WMITLV_ATTR_LIST_OFFSET(id) \
+	wmitlv_attr_offset_##id, \
+	wmitlv_attr_last_##id = wmitlv_attr_offset_##id + \
+				WMITLV_GET_TAG_NUM_TLV_ATTRIB(id),
+
+enum wmitlv_cmd_attr_offset {
+	WMITLV_ALL_CMD_LIST(WMITLV_ATTR_LIST_OFFSET)
+};
+
+enum wmitlv_evt_attr_offset {
+	WMITLV_ALL_EVT_LIST(WMITLV_ATTR_LIST_OFFSET)
+};
+
+#define WMITLV_ATTR_LIST_CASE(id) \
+	case id: \
+		return &attr_list[wmitlv_attr_offset_##id];
+#endif
+
 #ifdef NO_DYNAMIC_MEM_ALLOC
 static wmitlv_cmd_param_info *g_wmi_static_cmd_param_info_buf;
 uint32_t g_wmi_static_max_cmd_param_tlvs;
@@ -88,25 +113,52 @@ wmitlv_set_static_param_tlv_buf(void *param_tlv_buf,
 #endif
 }
 
+#ifdef WMI_TLV_COMPILED_SCHEMA
 /**
- * wmitlv_get_attributes() - tlv helper function
+ * wmitlv_find_attr_list() - find the attribute block of a command/event
  * @is_cmd_id: boolean for command attribute
  * @cmd_event_id: command event id
- * @curr_tlv_order: tlv order
- * @tlv_attr_ptr: pointer to tlv attribute
  *
+ * Resolve the attribute block through a switch generated from the
+ * WMITLV command/event lists instead of walking the attribute tables.
  *
- * WMI TLV Helper functions to find the attributes of the
- * Command/Event TLVs.
+ * Return: pointer to the ATTRB0 word of the block, NULL if not found
+ */
+static const uint32_t *wmitlv_find_attr_list(uint32_t is_cmd_id,
+					     uint32_t cmd_event_id)
+{
+	const uint32_t *attr_list;
+
+	if (is_cmd_id) {
+		attr_list = &cmd_attr_list[0];
+		switch (WMITLV_GET_CMDID(cmd_event_id)) {
+			WMITLV_ALL_CMD_LIST(WMITLV_ATTR_LIST_CASE);
+		default:
+			break;
+		}
+	} else {
+		attr_list = &evt_attr_list[0];
+		switch (WMITLV_GET_CMDID(cmd_event_id)) {
+			WMITLV_ALL_EVT_LIST(WMITLV_ATTR_LIST_CASE);
+		default:
+			break;
+		}
+	}
+
+	return NULL;
+}
+#else
+/**
+ * wmitlv_find_attr_list() - find the attribute block of a command/event
+ * @is_cmd_id: boolean for command attribute
+ * @cmd_event_id: command event id
  *
- * Return: 0 if success. Return >=1 if failure.
+ * Return: pointer to the ATTRB0 word of the block, NULL if not found
  */
-static
-uint32_t wmitlv_get_attributes(uint32_t is_cmd_id, uint32_t cmd_event_id,
-			       uint32_t curr_tlv_order,
-			       wmitlv_attributes_struc *tlv_attr_ptr)
+static const uint32_t *wmitlv_find_attr_list(uint32_t is_cmd_id,
+					     uint32_t cmd_event_id)
 {
-	uint32_t i, base_index, num_tlvs, num_entries;
+	uint32_t i, num_entries;
 	uint32_t *pAttrArrayList;
 
 	if (is_cmd_id) {
@@ -118,61 +170,94 @@ uint32_t wmitlv_get_attributes(uint32_t is_cmd_id, uint32_t cmd_event_id,
 	}
 
 	for (i = 0; i < num_entries; i++) {
-		num_tlvs = WMITLV_GET_NUM_TLVS(pAttrArrayList[i]);
 		if (WMITLV_GET_CMDID(cmd_event_id) ==
-		    WMITLV_GET_CMDID(pAttrArrayList[i])) {
-			tlv_attr_ptr->cmd_num_tlv = num_tlvs;
-			/* Return success from here when only number of TLVS for
-			 * this command/event is required */
-			if (curr_tlv_order == WMITLV_GET_ATTRIB_NUM_TLVS) {
-				wmi_tlv_print_verbose
-					("%s: WMI TLV attribute definitions for %s:0x%x found; num_of_tlvs:%d\n",
-					__func__, (is_cmd_id ? "Cmd" : "Evt"),
-					cmd_event_id, num_tlvs);
-				return 0;
-			}
+		    WMITLV_GET_CMDID(pAttrArrayList[i]))
+			return &pAttrArrayList[i];
 
-			/* Return failure if tlv_order is more than the expected
-			 * number of TLVs */
-			if (curr_tlv_order >= num_tlvs) {
-				wmi_tlv_print_error
-					("%s: ERROR: TLV order %d greater than num_of_tlvs:%d for %s:0x%x\n",
-					__func__, curr_tlv_order, num_tlvs,
-					(is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
-				return 1;
-			}
+		i += WMITLV_GET_NUM_TLVS(pAttrArrayList[i]);
+	}
 
-			base_index = i + 1;     /* index to first TLV attributes */
-			wmi_tlv_print_verbose
-				("%s: WMI TLV attributes for %s:0x%x tlv[%d]:0x%x\n",
-				__func__, (is_cmd_id ? "Cmd" : "Evt"),
-				cmd_event_id, curr_tlv_order,
-				pAttrArrayList[(base_index + curr_tlv_order)]);
-			tlv_attr_ptr->tag_order = curr_tlv_order;
-			tlv_attr_ptr->tag_id =
-				WMITLV_GET_TAGID(pAttrArrayList
-						 [(base_index + curr_tlv_order)]);
-			tlv_attr_ptr->tag_struct_size =
-				WMITLV_GET_TAG_STRUCT_SIZE(pAttrArrayList
-							   [(base_index +
-							     curr_tlv_order)]);
-			tlv_attr_ptr->tag_varied_size =
-				WMITLV_GET_TAG_VARIED(pAttrArrayList
-						      [(base_index +
-							curr_tlv_order)]);
-			tlv_attr_ptr->tag_array_size =
-				WMITLV_GET_TAG_ARRAY_SIZE(pAttrArrayList
-							  [(base_index +
-							    curr_tlv_order)]);
-			return 0;
-		}
-		i += num_tlvs;
+	return NULL;
+}
+#endif
+
+/**
+ * wmitlv_decode_attributes() - tlv helper function
+ * @attr_list: attribute block returned by wmitlv_find_attr_list()
+ * @is_cmd_id: boolean for command attribute
+ * @cmd_event_id: command event id
+ * @curr_tlv_order: tlv order
+ * @tlv_attr_ptr: pointer to tlv attribute
+ *
+ * Decode the attributes of the TLV at @curr_tlv_order from an already
+ * resolved attribute block, so that callers walking all the TLVs of a
+ * command/event only pay for the lookup once.
+ *
+ * Return: 0 if success. Return >=1 if failure.
+ */
+static
+uint32_t wmitlv_decode_attributes(const uint32_t *attr_list,
+				  uint32_t is_cmd_id, uint32_t cmd_event_id,
+				  uint32_t curr_tlv_order,
+				  wmitlv_attributes_struc *tlv_attr_ptr)
+{
+	uint32_t num_tlvs = WMITLV_GET_NUM_TLVS(attr_list[0]);
+	uint32_t attr;
+
+	tlv_attr_ptr->cmd_num_tlv = num_tlvs;
+	/* Return success from here when only number of TLVS for
+	 * this command/event is required */
+	if (curr_tlv_order == WMITLV_GET_ATTRIB_NUM_TLVS) {
+		wmi_tlv_print_verbose
+			("%s: WMI TLV attribute definitions for %s:0x%x found; num_of_tlvs:%d\n",
+			__func__, (is_cmd_id ? "Cmd" : "Evt"),
+			cmd_event_id, num_tlvs);
+		return 0;
 	}
 
-	wmi_tlv_print_error
-		("%s: ERROR: Didn't found WMI TLV attribute definitions for %s:0x%x\n",
-		__func__, (is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
-	return 1;
+	/* Return failure if tlv_order is more than the expected
+	 * number of TLVs */
+	if (curr_tlv_order >= num_tlvs) {
+		wmi_tlv_print_error
+			("%s: ERROR: TLV order %d greater than num_of_tlvs:%d for %s:0x%x\n",
+			__func__, curr_tlv_order, num_tlvs,
+			(is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
+		return 1;
+	}
+
+	/* first TLV attributes follow the ATTRB0 word */
+	attr = attr_list[1 + curr_tlv_order];
+	wmi_tlv_print_verbose
+		("%s: WMI TLV attributes for %s:0x%x tlv[%d]:0x%x\n",
+		__func__, (is_cmd_id ? "Cmd" : "Evt"),
+		cmd_event_id, curr_tlv_order, attr);
+	tlv_attr_ptr->tag_order = curr_tlv_order;
+	tlv_attr_ptr->tag_id = WMITLV_GET_TAGID(attr);
+	tlv_attr_ptr->tag_struct_size = WMITLV_GET_TAG_STRUCT_SIZE(attr);
+	tlv_attr_ptr->tag_varied_size = WMITLV_GET_TAG_VARIED(attr);
+	tlv_attr_ptr->tag_array_size = WMITLV_GET_TAG_ARRAY_SIZE(attr);
+	return 0;
+}
+
+/**
+ * wmitlv_get_attr_list() - tlv helper function
+ * @is_cmd_id: boolean for command attribute
+ * @cmd_event_id: command event id
+ *
+ * Return: attribute block of the command/event, NULL if not found
+ */
+static const uint32_t *wmitlv_get_attr_list(uint32_t is_cmd_id,
+					    uint32_t cmd_event_id)
+{
+	const uint32_t *attr_list;
+
+	attr_list = wmitlv_find_attr_list(is_cmd_id, cmd_event_id);
+	if (!attr_list)
+		wmi_tlv_print_error
+			("%s: ERROR: Didn't found WMI TLV attribute definitions for %s:0x%x\n",
+			__func__, (is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
+
+	return attr_list;
 }
 
 /**
@@ -198,12 +283,17 @@ wmitlv_check_tlv_params(void *os_handle, void *param_struc_ptr,
 	uint32_t tlv_index = 0;
 	uint8_t *buf_ptr = (unsigned char *)param_struc_ptr;
 	uint32_t expected_num_tlvs, expected_tlv_len;
+	const uint32_t *attr_list;
 	int32_t error = -1;
 
+	attr_list = wmitlv_get_attr_list(is_cmd_id, wmi_cmd_event_id);
+	if (!attr_list)
+		goto Error_wmitlv_check_tlv_params;
+
 	/* Get the number of TLVs for this command/event */
-	if (wmitlv_get_attributes
-		    (is_cmd_id, wmi_cmd_event_id, WMITLV_GET_ATTRIB_NUM_TLVS,
-		    &attr_struct_ptr) != 0) {
+	if (wmitlv_decode_attributes
+		    (attr_list, is_cmd_id, wmi_cmd_event_id,
+		    WMITLV_GET_ATTRIB_NUM_TLVS, &attr_struct_ptr) != 0) {
 		wmi_tlv_print_error
 			("%s: ERROR: Couldn't get expected number of TLVs for Cmd=%d\n",
 			__func__, wmi_cmd_event_id);
@@ -231,8 +321,8 @@ wmitlv_check_tlv_params(void *os_handle, void *param_struc_ptr,
 		/* Get the attributes of the TLV with the given order in "tlv_index" */
 		wmi_tlv_OS_MEMZERO(&attr_struct_ptr,
 				   sizeof(wmitlv_attributes_struc));
-		if (wmitlv_get_attributes
-			    (is_cmd_id, wmi_cmd_event_id, tlv_index,
+		if (wmitlv_decode_attributes
+			    (attr_list, is_cmd_id, wmi_cmd_event_id, tlv_index,
 			    &attr_struct_ptr) != 0) {
 			wmi_tlv_print_error
 				("%s: ERROR: No TLV attributes found for Cmd=%d Tag_order=%d\n",
@@ -471,509 +561,717 @@ wmitlv_check_command_tlv_params(void *os_handle, void *param_struc_ptr,
 qdf_export_symbol(wmitlv_check_command_tlv_params);
 
 /**
- * wmitlv_check_and_pad_tlvs() - tlv helper function
+ * struct wmitlv_pad_ctx - state of the TLV walk of one command/event
  * @os_handle: os context handle
- * @param_buf_len: length of tlv parameter
- * @param_struc_ptr: pointer to tlv structure
- * @is_cmd_id: boolean for command attribute
+ * @buf_ptr: next TLV to be validated
+ * @buf_idx: offset of @buf_ptr in the command/event buffer
+ * @param_buf_len: length of the command/event buffer
  * @wmi_cmd_event_id: command event id
- * @wmi_cmd_struct_ptr: wmi command structure
- *
+ * @param_tlvs: param_tlvs container being filled
+ * @tlv_index: order of the next TLV
+ * @num_tlvs: number of TLVs defined for the command/event
+ */
+struct wmitlv_pad_ctx {
+	void *os_handle;
+	uint8_t *buf_ptr;
+	uint32_t buf_idx;
+	uint32_t param_buf_len;
+	uint32_t wmi_cmd_event_id;
+	wmitlv_cmd_param_info *param_tlvs;
+	uint32_t tlv_index;
+	uint32_t num_tlvs;
+};
+
+/**
+ * wmitlv_pad_tlv() - validate and pad one TLV
+ * @ctx: TLV walk state, advanced past the TLV on success
+ * @tlv_attr: host definition of the TLV
  *
- * vaidate the TLV's coming for an event/command and
- * also pads data to TLV's if necessary
+ * The caller has checked that a TLV header is left in the buffer.
  *
  * Return: 0 if success. Return < 0 if failure.
  */
-static int
-wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
-			  uint32_t param_buf_len, uint32_t is_cmd_id,
-			  uint32_t wmi_cmd_event_id, void **wmi_cmd_struct_ptr)
+static int wmitlv_pad_tlv(struct wmitlv_pad_ctx *ctx,
+			  const wmitlv_attributes_struc *tlv_attr)
 {
-	wmitlv_attributes_struc attr_struct_ptr;
-	uint32_t buf_idx = 0;
-	uint32_t tlv_index = 0;
+	uint8_t *buf_ptr = ctx->buf_ptr;
+	uint32_t buf_idx = ctx->buf_idx;
+	uint32_t param_buf_len = ctx->param_buf_len;
+	uint32_t wmi_cmd_event_id = ctx->wmi_cmd_event_id;
+	wmitlv_cmd_param_info *cmd_param_tlvs_ptr = ctx->param_tlvs;
+	uint32_t tlv_index = ctx->tlv_index;
+	uint32_t curr_tlv_tag = WMITLV_GET_TLVTAG(WMITLV_GET_HDR(buf_ptr));
+	uint32_t curr_tlv_len = WMITLV_GET_TLVLEN(WMITLV_GET_HDR(buf_ptr));
 	uint32_t num_of_elems = 0;
-	int tlv_size_diff = 0;
-	uint8_t *buf_ptr = (unsigned char *)param_struc_ptr;
-	wmitlv_cmd_param_info *cmd_param_tlvs_ptr = NULL;
-	uint32_t remaining_expected_tlvs = 0xFFFFFFFF;
-	uint32_t len_wmi_cmd_struct_buf;
 	uint32_t free_buf_len;
-	int32_t error = -1;
+	int tlv_size_diff = 0;
+	int num_padding_bytes = 0;
 
-	/* Get the number of TLVs for this command/event */
-	if (wmitlv_get_attributes
-		    (is_cmd_id, wmi_cmd_event_id, WMITLV_GET_ATTRIB_NUM_TLVS,
-		    &attr_struct_ptr) != 0) {
-		wmi_tlv_print_error
-			("%s: ERROR: Couldn't get expected number of TLVs for Cmd=%d\n",
-			__func__, wmi_cmd_event_id);
-		return error;
+	free_buf_len = param_buf_len - (buf_idx + WMI_TLV_HDR_SIZE);
+	if (curr_tlv_len > free_buf_len) {
+		wmi_tlv_print_error("%s: TLV length overflow",
+				    __func__);
+		return -1;
 	}
-	/* NOTE: the returned number of TLVs is in "attr_struct_ptr.cmd_num_tlv" */
 
-	if (param_buf_len < WMI_TLV_HDR_SIZE) {
-		wmi_tlv_print_error
-			("%s: ERROR: Incorrect param buf length passed\n",
-			__func__);
-		return error;
-	}
+	/* Found the TLV that we wanted */
+	wmi_tlv_print_verbose("%s: [tlv %d]: tag=%d, len=%d\n",
+			      __func__, tlv_index, curr_tlv_tag,
+			      curr_tlv_len);
 
-	/* Create base structure of format wmi_cmd_event_id##_param_tlvs */
-	len_wmi_cmd_struct_buf =
-		attr_struct_ptr.cmd_num_tlv * sizeof(wmitlv_cmd_param_info);
-#ifndef NO_DYNAMIC_MEM_ALLOC
-	/* Dynamic memory allocation supported */
-	wmi_tlv_os_mem_alloc(os_handle, *wmi_cmd_struct_ptr,
-			     len_wmi_cmd_struct_buf);
-#else
-	/* Dynamic memory allocation is not supported. Use the buffer
-	 * g_wmi_static_cmd_param_info_buf, which should be set using
-	 * wmi_tlv_set_static_param_tlv_buf(),
-	 * for base structure of format wmi_cmd_event_id##_param_tlvs */
-	*wmi_cmd_struct_ptr = g_wmi_static_cmd_param_info_buf;
-	if (attr_struct_ptr.cmd_num_tlv > g_wmi_static_max_cmd_param_tlvs) {
-		/* Error: Expecting more TLVs that accommodated for static structure  */
-		wmi_tlv_print_error
-			("%s: Error: Expecting more TLVs that accommodated for static structure. Expected:%d Accomodated:%d\n",
-			__func__, attr_struct_ptr.cmd_num_tlv,
-			g_wmi_static_max_cmd_param_tlvs);
-		return error;
-	}
-#endif
-	if (!*wmi_cmd_struct_ptr) {
-		/* Error: unable to alloc memory */
+	/* Validating Tag order */
+	if (curr_tlv_tag != tlv_attr->tag_id) {
 		wmi_tlv_print_error
-			("%s: Error: unable to alloc memory (size=%d) for TLV\n",
-			__func__, len_wmi_cmd_struct_buf);
-		return error;
+			("%s: ERROR: TLV has wrong tag in order for Cmd=0x%x. Given=%d, Expected=%d, total_tlv=%d, remaining tlv=%d.\n",
+			__func__, wmi_cmd_event_id, curr_tlv_tag,
+			tlv_attr->tag_id,
+			ctx->num_tlvs, ctx->num_tlvs - tlv_index);
+		return -1;
 	}
 
-	cmd_param_tlvs_ptr = (wmitlv_cmd_param_info *) *wmi_cmd_struct_ptr;
-	wmi_tlv_OS_MEMZERO(cmd_param_tlvs_ptr, len_wmi_cmd_struct_buf);
-	remaining_expected_tlvs = attr_struct_ptr.cmd_num_tlv;
-
-	while (((buf_idx + WMI_TLV_HDR_SIZE) <= param_buf_len)
-	       && (remaining_expected_tlvs)) {
-		uint32_t curr_tlv_tag =
-			WMITLV_GET_TLVTAG(WMITLV_GET_HDR(buf_ptr));
-		uint32_t curr_tlv_len =
-			WMITLV_GET_TLVLEN(WMITLV_GET_HDR(buf_ptr));
-		int num_padding_bytes = 0;
+	if ((curr_tlv_tag >= WMITLV_TAG_FIRST_ARRAY_ENUM)
+	    && (curr_tlv_tag <= WMITLV_TAG_LAST_ARRAY_ENUM)) {
+		/* Current Tag is an array of some kind. */
+		/* Skip the TLV header of this array */
+		buf_ptr += WMI_TLV_HDR_SIZE;
+		buf_idx += WMI_TLV_HDR_SIZE;
+	} else {
+		/* Non-array TLV. */
+		curr_tlv_len += WMI_TLV_HDR_SIZE;
+	}
 
-		free_buf_len = param_buf_len - (buf_idx + WMI_TLV_HDR_SIZE);
-		if (curr_tlv_len > free_buf_len) {
-			wmi_tlv_print_error("%s: TLV length overflow",
-					    __func__);
-			goto Error_wmitlv_check_and_pad_tlvs;
+	if (tlv_attr->tag_varied_size == WMITLV_SIZE_FIX) {
+		/* This TLV is fixed length */
+		if (WMITLV_ARR_SIZE_INVALID ==
+		    tlv_attr->tag_array_size) {
+			tlv_size_diff =
+				curr_tlv_len -
+				tlv_attr->tag_struct_size;
+			num_of_elems =
+				(curr_tlv_len > WMI_TLV_HDR_SIZE) ? 1 : 0;
+		} else {
+			tlv_size_diff =
+				curr_tlv_len -
+				(tlv_attr->tag_struct_size *
+				 tlv_attr->tag_array_size);
+			num_of_elems = tlv_attr->tag_array_size;
 		}
-
-		/* Get the attributes of the TLV with the given order in "tlv_index" */
-		wmi_tlv_OS_MEMZERO(&attr_struct_ptr,
-				   sizeof(wmitlv_attributes_struc));
-		if (wmitlv_get_attributes
-			    (is_cmd_id, wmi_cmd_event_id, tlv_index,
-			    &attr_struct_ptr) != 0) {
+	} else {
+		/* This TLV has a variable number of elements */
+		if (WMITLV_TAG_ARRAY_STRUC == tlv_attr->tag_id) {
+			uint32_t in_tlv_len = 0;
+
+			if (curr_tlv_len != 0) {
+				in_tlv_len =
+					WMITLV_GET_TLVLEN(WMITLV_GET_HDR
+								  (buf_ptr));
+				in_tlv_len += WMI_TLV_HDR_SIZE;
+				if (in_tlv_len > curr_tlv_len) {
+					wmi_tlv_print_error("%s: Invalid in_tlv_len=%d",
+							    __func__,
+							    in_tlv_len);
+					return -1;
+				}
+				tlv_size_diff =
+					in_tlv_len -
+					tlv_attr->tag_struct_size;
+				num_of_elems =
+					curr_tlv_len / in_tlv_len;
+				wmi_tlv_print_verbose
+					("%s: WARN: TLV array of structures in_tlv_len=%d struct_size:%d diff:%d num_of_elems=%d \n",
+					__func__, in_tlv_len,
+					tlv_attr->tag_struct_size,
+					tlv_size_diff, num_of_elems);
+			} else {
+				tlv_size_diff = 0;
+				num_of_elems = 0;
+			}
+		} else
+		if ((WMITLV_TAG_ARRAY_UINT32 ==
+		     tlv_attr->tag_id)
+		    || (WMITLV_TAG_ARRAY_BYTE ==
+			tlv_attr->tag_id)
+		    || (WMITLV_TAG_ARRAY_FIXED_STRUC ==
+			tlv_attr->tag_id)) {
+			tlv_size_diff = 0;
+			num_of_elems =
+				curr_tlv_len /
+				tlv_attr->tag_struct_size;
+		} else {
 			wmi_tlv_print_error
-				("%s: ERROR: No TLV attributes found for Cmd=%d Tag_order=%d\n",
-				__func__, wmi_cmd_event_id, tlv_index);
-			goto Error_wmitlv_check_and_pad_tlvs;
+				("%s ERROR Need to handle this tag ID for variable length %d\n",
+				__func__, tlv_attr->tag_id);
+			return -1;
 		}
+	}
 
-		/* Found the TLV that we wanted */
-		wmi_tlv_print_verbose("%s: [tlv %d]: tag=%d, len=%d\n",
-				      __func__, tlv_index, curr_tlv_tag,
-				      curr_tlv_len);
-
-		/* Validating Tag order */
-		if (curr_tlv_tag != attr_struct_ptr.tag_id) {
+	if ((WMITLV_TAG_ARRAY_STRUC == tlv_attr->tag_id) &&
+	    (tlv_size_diff != 0)) {
+		void *new_tlv_buf = NULL;
+		uint8_t *tlv_buf_ptr = NULL;
+		uint32_t in_tlv_len;
+		uint32_t i;
+
+		if (tlv_attr->tag_varied_size == WMITLV_SIZE_FIX) {
+			/* This is not allowed. The tag WMITLV_TAG_ARRAY_STRUC can
+			 * only be used with variable-length structure array
+			 * should not have a fixed number of elements (contradicting).
+			 * Use WMITLV_TAG_ARRAY_FIXED_STRUC tag for fixed size
+			 * structure array(where structure never change without
+			 * breaking compatibility) */
 			wmi_tlv_print_error
-				("%s: ERROR: TLV has wrong tag in order for Cmd=0x%x. Given=%d, Expected=%d, total_tlv=%d, remaining tlv=%d.\n",
-				__func__, wmi_cmd_event_id, curr_tlv_tag,
-				attr_struct_ptr.tag_id,
-				attr_struct_ptr.cmd_num_tlv,
-				remaining_expected_tlvs);
-			goto Error_wmitlv_check_and_pad_tlvs;
+				("%s: ERROR: TLV (tag=%d) should be variable-length and not fixed length\n",
+				__func__, curr_tlv_tag);
+			return -1;
 		}
 
-		if ((curr_tlv_tag >= WMITLV_TAG_FIRST_ARRAY_ENUM)
-		    && (curr_tlv_tag <= WMITLV_TAG_LAST_ARRAY_ENUM)) {
-			/* Current Tag is an array of some kind. */
-			/* Skip the TLV header of this array */
-			buf_ptr += WMI_TLV_HDR_SIZE;
-			buf_idx += WMI_TLV_HDR_SIZE;
-		} else {
-			/* Non-array TLV. */
-			curr_tlv_len += WMI_TLV_HDR_SIZE;
+		/* Warning: Needs to allocate a larger structure and pad with zeros */
+		wmi_tlv_print_verbose
+			("%s: WARN: TLV array of structures needs padding. tlv_size_diff=%d\n",
+			__func__, tlv_size_diff);
+
+		/* incoming structure length */
+		in_tlv_len =
+			WMITLV_GET_TLVLEN(WMITLV_GET_HDR(buf_ptr)) +
+			WMI_TLV_HDR_SIZE;
+#ifndef NO_DYNAMIC_MEM_ALLOC
+		wmi_tlv_os_mem_alloc(ctx->os_handle, new_tlv_buf,
+				     (num_of_elems *
+				      tlv_attr->tag_struct_size));
+		if (!new_tlv_buf) {
+			/* Error: unable to alloc memory */
+			wmi_tlv_print_error
+				("%s: Error: unable to alloc memory (size=%d) for padding the TLV array %d\n",
+				__func__,
+				(num_of_elems *
+				 tlv_attr->tag_struct_size),
+				curr_tlv_tag);
+			return -1;
 		}
 
-		if (attr_struct_ptr.tag_varied_size == WMITLV_SIZE_FIX) {
-			/* This TLV is fixed length */
-			if (WMITLV_ARR_SIZE_INVALID ==
-			    attr_struct_ptr.tag_array_size) {
-				tlv_size_diff =
-					curr_tlv_len -
-					attr_struct_ptr.tag_struct_size;
-				num_of_elems =
-					(curr_tlv_len > WMI_TLV_HDR_SIZE) ? 1 : 0;
+		wmi_tlv_OS_MEMZERO(new_tlv_buf,
+				   (num_of_elems *
+				    tlv_attr->tag_struct_size));
+		tlv_buf_ptr = (uint8_t *) new_tlv_buf;
+		for (i = 0; i < num_of_elems; i++) {
+			if (tlv_size_diff > 0) {
+				/* Incoming structure size is greater than expected
+				 * structure size. so copy the number of bytes equal
+				 * to expected structure size */
+				wmi_tlv_OS_MEMCPY(tlv_buf_ptr,
+						  (void *)(buf_ptr +
+							   i *
+							   in_tlv_len),
+						  tlv_attr->
+						  tag_struct_size);
 			} else {
-				tlv_size_diff =
-					curr_tlv_len -
-					(attr_struct_ptr.tag_struct_size *
-					 attr_struct_ptr.tag_array_size);
-				num_of_elems = attr_struct_ptr.tag_array_size;
+				/* Incoming structure size is smaller than expected
+				 * structure size. so copy the number of bytes equal
+				 * to incoming structure size */
+				wmi_tlv_OS_MEMCPY(tlv_buf_ptr,
+						  (void *)(buf_ptr +
+							   i *
+							   in_tlv_len),
+						  in_tlv_len);
 			}
-		} else {
-			/* This TLV has a variable number of elements */
-			if (WMITLV_TAG_ARRAY_STRUC == attr_struct_ptr.tag_id) {
-				uint32_t in_tlv_len = 0;
+			tlv_buf_ptr += tlv_attr->tag_struct_size;
+		}
+#else
+		{
+			uint8_t *src_addr;
+			uint8_t *dst_addr;
+			uint32_t buf_mov_len;
+
+			if (tlv_size_diff < 0) {
+				/* Incoming structure size is smaller than expected size
+				 * then this needs padding for each element in the array */
+
+				/* Find amount of bytes to be padded for one element */
+				num_padding_bytes = tlv_size_diff * -1;
+
+				/* Move subsequent TLVs by number of bytes to be padded
+				 * for all elements */
+				if ((free_buf_len <
+				    tlv_attr->tag_struct_size *
+				    num_of_elems) ||
+				    (param_buf_len <
+				    buf_idx + curr_tlv_len +
+				    num_padding_bytes * num_of_elems)) {
+					wmi_tlv_print_error("%s: Insufficent buffer\n",
+							    __func__);
+					return -1;
+				} else {
+					src_addr =
+						buf_ptr + curr_tlv_len;
+					dst_addr =
+						buf_ptr + curr_tlv_len +
+						(num_padding_bytes *
+						 num_of_elems);
+					buf_mov_len =
+						param_buf_len - (buf_idx +
+								 curr_tlv_len);
+
+					wmi_tlv_OS_MEMMOVE(dst_addr,
+							   src_addr,
+							   buf_mov_len);
+				}
 
-				if (curr_tlv_len != 0) {
-					in_tlv_len =
-						WMITLV_GET_TLVLEN(WMITLV_GET_HDR
-									  (buf_ptr));
-					in_tlv_len += WMI_TLV_HDR_SIZE;
-					if (in_tlv_len > curr_tlv_len) {
-						wmi_tlv_print_error("%s: Invalid in_tlv_len=%d",
-								    __func__,
-								    in_tlv_len);
-						goto
-						Error_wmitlv_check_and_pad_tlvs;
+				/* Move subsequent elements of array down by number of
+				 * bytes to be padded for one element and alse set
+				 * padding bytes to zero */
+				tlv_buf_ptr = buf_ptr;
+				for (i = 0; i < num_of_elems - 1; i++) {
+					src_addr =
+						tlv_buf_ptr + in_tlv_len;
+					if (i != (num_of_elems - 1)) {
+						dst_addr =
+							tlv_buf_ptr +
+							in_tlv_len +
+							num_padding_bytes;
+						buf_mov_len =
+							curr_tlv_len -
+							((i +
+							  1) * in_tlv_len);
+
+						wmi_tlv_OS_MEMMOVE
+							(dst_addr, src_addr,
+							buf_mov_len);
 					}
-					tlv_size_diff =
-						in_tlv_len -
-						attr_struct_ptr.tag_struct_size;
-					num_of_elems =
-						curr_tlv_len / in_tlv_len;
-					wmi_tlv_print_verbose
-						("%s: WARN: TLV array of structures in_tlv_len=%d struct_size:%d diff:%d num_of_elems=%d \n",
-						__func__, in_tlv_len,
-						attr_struct_ptr.tag_struct_size,
-						tlv_size_diff, num_of_elems);
-				} else {
-					tlv_size_diff = 0;
-					num_of_elems = 0;
+
+					/* Set the padding bytes to zeroes */
+					wmi_tlv_OS_MEMZERO(src_addr,
+							   num_padding_bytes);
+
+					tlv_buf_ptr +=
+						tlv_attr->
+						tag_struct_size;
 				}
-			} else
-			if ((WMITLV_TAG_ARRAY_UINT32 ==
-			     attr_struct_ptr.tag_id)
-			    || (WMITLV_TAG_ARRAY_BYTE ==
-				attr_struct_ptr.tag_id)
-			    || (WMITLV_TAG_ARRAY_FIXED_STRUC ==
-				attr_struct_ptr.tag_id)) {
-				tlv_size_diff = 0;
-				num_of_elems =
-					curr_tlv_len /
-					attr_struct_ptr.tag_struct_size;
+				src_addr = tlv_buf_ptr + in_tlv_len;
+				wmi_tlv_OS_MEMZERO(src_addr,
+						   num_padding_bytes);
+
+				/* Update the number of padding bytes to total number
+				 * of bytes padded for all elements in the array */
+				num_padding_bytes =
+					num_padding_bytes * num_of_elems;
+
+				new_tlv_buf = buf_ptr;
 			} else {
-				wmi_tlv_print_error
-					("%s ERROR Need to handle this tag ID for variable length %d\n",
-					__func__, attr_struct_ptr.tag_id);
-				goto Error_wmitlv_check_and_pad_tlvs;
-			}
-		}
+				/* Incoming structure size is greater than expected size
+				 * then this needs shrinking for each element in the array */
+
+				/* Find amount of bytes to be shrunk for one element */
+				num_padding_bytes = tlv_size_diff * -1;
+
+				/* Move subsequent elements of array up by number of bytes
+				 * to be shrunk for one element */
+				tlv_buf_ptr = buf_ptr;
+				for (i = 0; i < (num_of_elems - 1); i++) {
+					src_addr =
+						tlv_buf_ptr + in_tlv_len;
+					dst_addr =
+						tlv_buf_ptr + in_tlv_len +
+						num_padding_bytes;
+					buf_mov_len =
+						curr_tlv_len -
+						((i + 1) * in_tlv_len);
+
+					wmi_tlv_OS_MEMMOVE(dst_addr,
+							   src_addr,
+							   buf_mov_len);
+
+					tlv_buf_ptr +=
+						tlv_attr->
+						tag_struct_size;
+				}
 
-		if ((WMITLV_TAG_ARRAY_STRUC == attr_struct_ptr.tag_id) &&
-		    (tlv_size_diff != 0)) {
-			void *new_tlv_buf = NULL;
-			uint8_t *tlv_buf_ptr = NULL;
-			uint32_t in_tlv_len;
-			uint32_t i;
+				/* Move subsequent TLVs by number of bytes to be shrunk
+				 * for all elements */
+				if (param_buf_len >
+				    (buf_idx + curr_tlv_len)) {
+					src_addr =
+						buf_ptr + curr_tlv_len;
+					dst_addr =
+						buf_ptr + curr_tlv_len +
+						(num_padding_bytes *
+						 num_of_elems);
+					buf_mov_len =
+						param_buf_len - (buf_idx +
+								 curr_tlv_len);
+
+					wmi_tlv_OS_MEMMOVE(dst_addr,
+							   src_addr,
+							   buf_mov_len);
+				}
 
-			if (attr_struct_ptr.tag_varied_size == WMITLV_SIZE_FIX) {
-				/* This is not allowed. The tag WMITLV_TAG_ARRAY_STRUC can
-				 * only be used with variable-length structure array
-				 * should not have a fixed number of elements (contradicting).
-				 * Use WMITLV_TAG_ARRAY_FIXED_STRUC tag for fixed size
-				 * structure array(where structure never change without
-				 * breaking compatibility) */
-				wmi_tlv_print_error
-					("%s: ERROR: TLV (tag=%d) should be variable-length and not fixed length\n",
-					__func__, curr_tlv_tag);
-				goto Error_wmitlv_check_and_pad_tlvs;
-			}
+				/* Update the number of padding bytes to total number of
+				 * bytes shrunk for all elements in the array */
+				num_padding_bytes =
+					num_padding_bytes * num_of_elems;
 
-			/* Warning: Needs to allocate a larger structure and pad with zeros */
+				new_tlv_buf = buf_ptr;
+			}
+		}
+#endif
+		cmd_param_tlvs_ptr[tlv_index].tlv_ptr = new_tlv_buf;
+		cmd_param_tlvs_ptr[tlv_index].num_elements =
+			num_of_elems;
+		cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 1;     /* Indicates that buffer is allocated */
+
+	} else if (tlv_size_diff >= 0) {
+		/* Warning: some parameter truncation */
+		if (tlv_size_diff > 0) {
 			wmi_tlv_print_verbose
-				("%s: WARN: TLV array of structures needs padding. tlv_size_diff=%d\n",
-				__func__, tlv_size_diff);
+				("%s: WARN: TLV truncated. tlv_size_diff=%d, curr_tlv_len=%d\n",
+				__func__, tlv_size_diff, curr_tlv_len);
+		}
+		/* TODO: this next line needs more comments and explanation */
+		cmd_param_tlvs_ptr[tlv_index].tlv_ptr =
+			(tlv_attr->tag_varied_size
+			 && !curr_tlv_len) ? NULL : (void *)buf_ptr;
+		cmd_param_tlvs_ptr[tlv_index].num_elements =
+			num_of_elems;
+		cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 0;     /* Indicates that buffer is not allocated */
+	} else {
+		void *new_tlv_buf = NULL;
 
-			/* incoming structure length */
-			in_tlv_len =
-				WMITLV_GET_TLVLEN(WMITLV_GET_HDR(buf_ptr)) +
-				WMI_TLV_HDR_SIZE;
+		/* Warning: Needs to allocate a larger structure and pad with zeros */
+		wmi_tlv_print_verbose
+			("%s: WARN: TLV needs padding. tlv_size_diff=%d\n",
+			__func__, tlv_size_diff);
 #ifndef NO_DYNAMIC_MEM_ALLOC
-			wmi_tlv_os_mem_alloc(os_handle, new_tlv_buf,
-					     (num_of_elems *
-					      attr_struct_ptr.tag_struct_size));
-			if (!new_tlv_buf) {
-				/* Error: unable to alloc memory */
-				wmi_tlv_print_error
-					("%s: Error: unable to alloc memory (size=%d) for padding the TLV array %d\n",
-					__func__,
-					(num_of_elems *
-					 attr_struct_ptr.tag_struct_size),
-					curr_tlv_tag);
-				goto Error_wmitlv_check_and_pad_tlvs;
-			}
+		/* Dynamic memory allocation is supported */
+		wmi_tlv_os_mem_alloc(ctx->os_handle, new_tlv_buf,
+				     (curr_tlv_len - tlv_size_diff));
+		if (!new_tlv_buf) {
+			/* Error: unable to alloc memory */
+			wmi_tlv_print_error
+				("%s: Error: unable to alloc memory (size=%d) for padding the TLV %d\n",
+				__func__, (curr_tlv_len - tlv_size_diff),
+				curr_tlv_tag);
+			return -1;
+		}
 
-			wmi_tlv_OS_MEMZERO(new_tlv_buf,
-					   (num_of_elems *
-					    attr_struct_ptr.tag_struct_size));
-			tlv_buf_ptr = (uint8_t *) new_tlv_buf;
-			for (i = 0; i < num_of_elems; i++) {
-				if (tlv_size_diff > 0) {
-					/* Incoming structure size is greater than expected
-					 * structure size. so copy the number of bytes equal
-					 * to expected structure size */
-					wmi_tlv_OS_MEMCPY(tlv_buf_ptr,
-							  (void *)(buf_ptr +
-								   i *
-								   in_tlv_len),
-							  attr_struct_ptr.
-							  tag_struct_size);
-				} else {
-					/* Incoming structure size is smaller than expected
-					 * structure size. so copy the number of bytes equal
-					 * to incoming structure size */
-					wmi_tlv_OS_MEMCPY(tlv_buf_ptr,
-							  (void *)(buf_ptr +
-								   i *
-								   in_tlv_len),
-							  in_tlv_len);
-				}
-				tlv_buf_ptr += attr_struct_ptr.tag_struct_size;
-			}
+		wmi_tlv_OS_MEMZERO(new_tlv_buf,
+				   (curr_tlv_len - tlv_size_diff));
+		wmi_tlv_OS_MEMCPY(new_tlv_buf, (void *)buf_ptr,
+				  curr_tlv_len);
 #else
-			{
-				uint8_t *src_addr;
-				uint8_t *dst_addr;
-				uint32_t buf_mov_len;
-
-				if (tlv_size_diff < 0) {
-					/* Incoming structure size is smaller than expected size
-					 * then this needs padding for each element in the array */
-
-					/* Find amount of bytes to be padded for one element */
-					num_padding_bytes = tlv_size_diff * -1;
-
-					/* Move subsequent TLVs by number of bytes to be padded
-					 * for all elements */
-					if ((free_buf_len <
-					    attr_struct_ptr.tag_struct_size *
-					    num_of_elems) ||
-					    (param_buf_len <
-					    buf_idx + curr_tlv_len +
-					    num_padding_bytes * num_of_elems)) {
-						wmi_tlv_print_error("%s: Insufficent buffer\n",
-								    __func__);
-						goto
-						Error_wmitlv_check_and_pad_tlvs;
-					} else {
-						src_addr =
-							buf_ptr + curr_tlv_len;
-						dst_addr =
-							buf_ptr + curr_tlv_len +
-							(num_padding_bytes *
-							 num_of_elems);
-						buf_mov_len =
-							param_buf_len - (buf_idx +
-									 curr_tlv_len);
+		/* Dynamic memory allocation is not supported. Padding has
+		 * to be done with in the existing buffer assuming we have
+		 * enough space to grow */
+		{
+			/* Note: tlv_size_diff is a value less than zero */
+			/* Move the Subsequent TLVs by amount of bytes needs to be padded */
+			uint8_t *src_addr;
+			uint8_t *dst_addr;
+			uint32_t src_len;
+
+			num_padding_bytes = (tlv_size_diff * -1);
+
+			src_addr = buf_ptr + curr_tlv_len;
+			dst_addr =
+				buf_ptr + curr_tlv_len + num_padding_bytes;
+			src_len =
+				param_buf_len - (buf_idx + curr_tlv_len);
+
+			wmi_tlv_OS_MEMMOVE(dst_addr, src_addr, src_len);
+
+			/* Set the padding bytes to zeroes */
+			wmi_tlv_OS_MEMZERO(src_addr, num_padding_bytes);
+
+			new_tlv_buf = buf_ptr;
+		}
+#endif
+		cmd_param_tlvs_ptr[tlv_index].tlv_ptr = new_tlv_buf;
+		cmd_param_tlvs_ptr[tlv_index].num_elements =
+			num_of_elems;
+		cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 1;     /* Indicates that buffer is allocated */
+	}
 
-						wmi_tlv_OS_MEMMOVE(dst_addr,
-								   src_addr,
-								   buf_mov_len);
-					}
+	ctx->tlv_index++;
+	ctx->buf_ptr = buf_ptr + curr_tlv_len + num_padding_bytes;
+	ctx->buf_idx = buf_idx + curr_tlv_len + num_padding_bytes;
 
-					/* Move subsequent elements of array down by number of
-					 * bytes to be padded for one element and alse set
-					 * padding bytes to zero */
-					tlv_buf_ptr = buf_ptr;
-					for (i = 0; i < num_of_elems - 1; i++) {
-						src_addr =
-							tlv_buf_ptr + in_tlv_len;
-						if (i != (num_of_elems - 1)) {
-							dst_addr =
-								tlv_buf_ptr +
-								in_tlv_len +
-								num_padding_bytes;
-							buf_mov_len =
-								curr_tlv_len -
-								((i +
-								  1) * in_tlv_len);
-
-							wmi_tlv_OS_MEMMOVE
-								(dst_addr, src_addr,
-								buf_mov_len);
-						}
+	return 0;
+}
 
-						/* Set the padding bytes to zeroes */
-						wmi_tlv_OS_MEMZERO(src_addr,
-								   num_padding_bytes);
+/**
+ * wmitlv_pad_tlvs_by_attr() - validate and pad the TLVs using the attribute
+ * table
+ * @ctx: TLV walk state
+ * @is_cmd_id: boolean for command attribute
+ * @attr_list: attribute block of the command/event
+ *
+ * Return: 0 if success. Return < 0 if failure.
+ */
+static int wmitlv_pad_tlvs_by_attr(struct wmitlv_pad_ctx *ctx,
+				   uint32_t is_cmd_id,
+				   const uint32_t *attr_list)
+{
+	wmitlv_attributes_struc attr_struct_ptr;
 
-						tlv_buf_ptr +=
-							attr_struct_ptr.
-							tag_struct_size;
-					}
-					src_addr = tlv_buf_ptr + in_tlv_len;
-					wmi_tlv_OS_MEMZERO(src_addr,
-							   num_padding_bytes);
+	while ((ctx->buf_idx + WMI_TLV_HDR_SIZE) <= ctx->param_buf_len &&
+	       ctx->tlv_index < ctx->num_tlvs) {
+		/* Get the attributes of the TLV with the given order in "tlv_index" */
+		wmi_tlv_OS_MEMZERO(&attr_struct_ptr,
+				   sizeof(wmitlv_attributes_struc));
+		if (wmitlv_decode_attributes
+			    (attr_list, is_cmd_id, ctx->wmi_cmd_event_id,
+			    ctx->tlv_index, &attr_struct_ptr) != 0) {
+			wmi_tlv_print_error
+				("%s: ERROR: No TLV attributes found for Cmd=%d Tag_order=%d\n",
+				__func__, ctx->wmi_cmd_event_id,
+				ctx->tlv_index);
+			return -1;
+		}
 
-					/* Update the number of padding bytes to total number
-					 * of bytes padded for all elements in the array */
-					num_padding_bytes =
-						num_padding_bytes * num_of_elems;
+		if (wmitlv_pad_tlv(ctx, &attr_struct_ptr))
+			return -1;
+	}
 
-					new_tlv_buf = buf_ptr;
-				} else {
-					/* Incoming structure size is greater than expected size
-					 * then this needs shrinking for each element in the array */
-
-					/* Find amount of bytes to be shrunk for one element */
-					num_padding_bytes = tlv_size_diff * -1;
-
-					/* Move subsequent elements of array up by number of bytes
-					 * to be shrunk for one element */
-					tlv_buf_ptr = buf_ptr;
-					for (i = 0; i < (num_of_elems - 1); i++) {
-						src_addr =
-							tlv_buf_ptr + in_tlv_len;
-						dst_addr =
-							tlv_buf_ptr + in_tlv_len +
-							num_padding_bytes;
-						buf_mov_len =
-							curr_tlv_len -
-							((i + 1) * in_tlv_len);
+	return 0;
+}
 
-						wmi_tlv_OS_MEMMOVE(dst_addr,
-								   src_addr,
-								   buf_mov_len);
+#ifdef WMI_TLV_COMPILED_SCHEMA
+/**
+ * wmitlv_pad_next_tlv() - validate and pad the next TLV of an event
+ * @ctx: TLV walk state
+ * @attr: ATTRB1 word of the TLV, a constant in the generated callers
+ *
+ * TLVs laid out exactly like the host definition are referenced in place
+ * without going through the attribute table, anything else is handled by
+ * wmitlv_pad_tlv().
+ *
+ * Return: 0 if success. Return < 0 if failure.
+ */
+static inline int wmitlv_pad_next_tlv(struct wmitlv_pad_ctx *ctx,
+				      uint32_t attr)
+{
+	uint32_t tag_id = WMITLV_GET_TAGID(attr);
+	uint32_t struct_size = WMITLV_GET_TAG_STRUCT_SIZE(attr);
+	wmitlv_attributes_struc tlv_attr;
+	wmitlv_cmd_param_info *param;
+	uint32_t tlv_hdr, tlv_len;
+
+	/* the target may send less TLVs than defined */
+	if (ctx->buf_idx + WMI_TLV_HDR_SIZE > ctx->param_buf_len)
+		return 0;
 
-						tlv_buf_ptr +=
-							attr_struct_ptr.
-							tag_struct_size;
-					}
+	tlv_hdr = WMITLV_GET_HDR(ctx->buf_ptr);
+	tlv_len = WMITLV_GET_TLVLEN(tlv_hdr);
+	param = &ctx->param_tlvs[ctx->tlv_index];
+
+	if (WMITLV_GET_TLVTAG(tlv_hdr) != tag_id ||
+	    tlv_len > ctx->param_buf_len - (ctx->buf_idx + WMI_TLV_HDR_SIZE))
+		goto pad_tlv;
+
+	if (WMITLV_GET_TAG_VARIED(attr) == WMITLV_SIZE_FIX &&
+	    WMITLV_GET_TAG_ARRAY_SIZE(attr) == WMITLV_ARR_SIZE_INVALID &&
+	    (tag_id < WMITLV_TAG_FIRST_ARRAY_ENUM ||
+	     tag_id > WMITLV_TAG_LAST_ARRAY_ENUM) &&
+	    tlv_len + WMI_TLV_HDR_SIZE == struct_size) {
+		param->tlv_ptr = ctx->buf_ptr;
+		param->num_elements = struct_size > WMI_TLV_HDR_SIZE;
+	} else if (WMITLV_GET_TAG_VARIED(attr) == WMITLV_SIZE_VAR &&
+		   (tag_id == WMITLV_TAG_ARRAY_UINT32 ||
+		    tag_id == WMITLV_TAG_ARRAY_BYTE ||
+		    tag_id == WMITLV_TAG_ARRAY_FIXED_STRUC)) {
+		param->tlv_ptr = tlv_len ? ctx->buf_ptr + WMI_TLV_HDR_SIZE :
+					   NULL;
+		param->num_elements = tlv_len / struct_size;
+	} else {
+		goto pad_tlv;
+	}
 
-					/* Move subsequent TLVs by number of bytes to be shrunk
-					 * for all elements */
-					if (param_buf_len >
-					    (buf_idx + curr_tlv_len)) {
-						src_addr =
-							buf_ptr + curr_tlv_len;
-						dst_addr =
-							buf_ptr + curr_tlv_len +
-							(num_padding_bytes *
-							 num_of_elems);
-						buf_mov_len =
-							param_buf_len - (buf_idx +
-									 curr_tlv_len);
+	ctx->tlv_index++;
+	ctx->buf_ptr += tlv_len + WMI_TLV_HDR_SIZE;
+	ctx->buf_idx += tlv_len + WMI_TLV_HDR_SIZE;
 
-						wmi_tlv_OS_MEMMOVE(dst_addr,
-								   src_addr,
-								   buf_mov_len);
-					}
+	return 0;
 
-					/* Update the number of padding bytes to total number of
-					 * bytes shrunk for all elements in the array */
-					num_padding_bytes =
-						num_padding_bytes * num_of_elems;
+pad_tlv:
+	tlv_attr.tag_order = ctx->tlv_index;
+	tlv_attr.tag_id = tag_id;
+	tlv_attr.tag_struct_size = struct_size;
+	tlv_attr.tag_varied_size = WMITLV_GET_TAG_VARIED(attr);
+	tlv_attr.tag_array_size = WMITLV_GET_TAG_ARRAY_SIZE(attr);
+	tlv_attr.cmd_num_tlv = ctx->num_tlvs;
 
-					new_tlv_buf = buf_ptr;
-				}
-			}
-#endif
-			cmd_param_tlvs_ptr[tlv_index].tlv_ptr = new_tlv_buf;
-			cmd_param_tlvs_ptr[tlv_index].num_elements =
-				num_of_elems;
-			cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 1;     /* Indicates that buffer is allocated */
+	return wmitlv_pad_tlv(ctx, &tlv_attr);
+}
 
-		} else if (tlv_size_diff >= 0) {
-			/* Warning: some parameter truncation */
-			if (tlv_size_diff > 0) {
-				wmi_tlv_print_verbose
-					("%s: WARN: TLV truncated. tlv_size_diff=%d, curr_tlv_len=%d\n",
-					__func__, tlv_size_diff, curr_tlv_len);
-			}
-			/* TODO: this next line needs more comments and explanation */
-			cmd_param_tlvs_ptr[tlv_index].tlv_ptr =
-				(attr_struct_ptr.tag_varied_size
-				 && !curr_tlv_len) ? NULL : (void *)buf_ptr;
-			cmd_param_tlvs_ptr[tlv_index].num_elements =
-				num_of_elems;
-			cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 0;     /* Indicates that buffer is not allocated */
-		} else {
-			void *new_tlv_buf = NULL;
+/*
+ * One check function per event, expanded from its WMITLV table. Every TLV
+ * is checked against its constant host definition in table order.
+ */
+#define WMITLV_OP_PAD_TLV_macro(param_ptr, param_len, wmi_cmd_event_id, \
+				elem_tlv_tag, elem_struc_type, elem_name, \
+				var_len, arr_size) \
+	if (wmitlv_pad_next_tlv(ctx, \
+				WMITLV_SET_ATTRB1(elem_tlv_tag, \
+						  sizeof(elem_struc_type), \
+						  arr_size, var_len))) \
+		return -1;
+
+#define WMITLV_PAD_EVT_TLVS_FUNC(id) \
+static int wmitlv_pad_evt_tlvs_##id(struct wmitlv_pad_ctx *ctx) \
+{ \
+	WMITLV_TABLE(id, PAD_TLV, NULL, 0) \
+	return 0; \
+}
 
-			/* Warning: Needs to allocate a larger structure and pad with zeros */
-			wmi_tlv_print_verbose
-				("%s: WARN: TLV needs padding. tlv_size_diff=%d\n",
-				__func__, tlv_size_diff);
-#ifndef NO_DYNAMIC_MEM_ALLOC
-			/* Dynamic memory allocation is supported */
-			wmi_tlv_os_mem_alloc(os_handle, new_tlv_buf,
-					     (curr_tlv_len - tlv_size_diff));
-			if (!new_tlv_buf) {
-				/* Error: unable to alloc memory */
-				wmi_tlv_print_error
-					("%s: Error: unable to alloc memory (size=%d) for padding the TLV %d\n",
-					__func__, (curr_tlv_len - tlv_size_diff),
-					curr_tlv_tag);
-				goto Error_wmitlv_check_and_pad_tlvs;
-			}
+WMITLV_ALL_EVT_LIST(WMITLV_PAD_EVT_TLVS_FUNC)
+
+#define WMITLV_PAD_EVT_TLVS_CASE(id) \
+	case id: \
+		return wmitlv_pad_evt_tlvs_##id(ctx);
 
-			wmi_tlv_OS_MEMZERO(new_tlv_buf,
-					   (curr_tlv_len - tlv_size_diff));
-			wmi_tlv_OS_MEMCPY(new_tlv_buf, (void *)buf_ptr,
-					  curr_tlv_len);
+/**
+ * wmitlv_pad_tlvs() - validate and pad all the TLVs of a command/event
+ * @ctx: TLV walk state
+ * @is_cmd_id: boolean for command attribute
+ * @attr_list: attribute block of the command/event
+ *
+ * Events go through their generated check function, commands through the
+ * attribute table.
+ *
+ * Return: 0 if success. Return < 0 if failure.
+ */
+static int wmitlv_pad_tlvs(struct wmitlv_pad_ctx *ctx, uint32_t is_cmd_id,
+			   const uint32_t *attr_list)
+{
+	if (is_cmd_id)
+		return wmitlv_pad_tlvs_by_attr(ctx, is_cmd_id, attr_list);
+
+	switch (WMITLV_GET_CMDID(ctx->wmi_cmd_event_id)) {
+		WMITLV_ALL_EVT_LIST(WMITLV_PAD_EVT_TLVS_CASE);
+	default:
+		break;
+	}
+
+	return -1;
+}
 #else
-			/* Dynamic memory allocation is not supported. Padding has
-			 * to be done with in the existing buffer assuming we have
-			 * enough space to grow */
-			{
-				/* Note: tlv_size_diff is a value less than zero */
-				/* Move the Subsequent TLVs by amount of bytes needs to be padded */
-				uint8_t *src_addr;
-				uint8_t *dst_addr;
-				uint32_t src_len;
+static inline int wmitlv_pad_tlvs(struct wmitlv_pad_ctx *ctx,
+				  uint32_t is_cmd_id,
+				  const uint32_t *attr_list)
+{
+	return wmitlv_pad_tlvs_by_attr(ctx, is_cmd_id, attr_list);
+}
+#endif
 
-				num_padding_bytes = (tlv_size_diff * -1);
+static void wmitlv_free_allocated_tlvs(uint32_t is_cmd_id,
+				       uint32_t cmd_event_id,
+				       void **wmi_cmd_struct_ptr,
+				       void *param_tlvs_buf);
 
-				src_addr = buf_ptr + curr_tlv_len;
-				dst_addr =
-					buf_ptr + curr_tlv_len + num_padding_bytes;
-				src_len =
-					param_buf_len - (buf_idx + curr_tlv_len);
+/**
+ * wmitlv_check_and_pad_tlvs() - tlv helper function
+ * @os_handle: os context handle
+ * @param_buf_len: length of tlv parameter
+ * @param_struc_ptr: pointer to tlv structure
+ * @is_cmd_id: boolean for command attribute
+ * @wmi_cmd_event_id: command event id
+ * @wmi_cmd_struct_ptr: wmi command structure
+ * @param_tlvs_buf: caller provided param_tlvs container, may be NULL
+ * @param_tlvs_buf_len: size of @param_tlvs_buf
+ *
+ *
+ * vaidate the TLV's coming for an event/command and
+ * also pads data to TLV's if necessary. The param_tlvs container is only
+ * allocated if @param_tlvs_buf is too small to hold it.
+ *
+ * Return: 0 if success. Return < 0 if failure.
+ */
+static int
+wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
+			  uint32_t param_buf_len, uint32_t is_cmd_id,
+			  uint32_t wmi_cmd_event_id, void **wmi_cmd_struct_ptr,
+			  void *param_tlvs_buf, uint32_t param_tlvs_buf_len)
+{
+	wmitlv_attributes_struc attr_struct_ptr;
+	struct wmitlv_pad_ctx ctx;
+	uint32_t len_wmi_cmd_struct_buf;
+	const uint32_t *attr_list;
+	int32_t error = -1;
 
-				wmi_tlv_OS_MEMMOVE(dst_addr, src_addr, src_len);
+	/* Resolve the attribute block once for all the TLVs */
+	attr_list = wmitlv_get_attr_list(is_cmd_id, wmi_cmd_event_id);
+	if (!attr_list)
+		return error;
 
-				/* Set the padding bytes to zeroes */
-				wmi_tlv_OS_MEMZERO(src_addr, num_padding_bytes);
+	/* Get the number of TLVs for this command/event */
+	if (wmitlv_decode_attributes
+		    (attr_list, is_cmd_id, wmi_cmd_event_id,
+		    WMITLV_GET_ATTRIB_NUM_TLVS, &attr_struct_ptr) != 0) {
+		wmi_tlv_print_error
+			("%s: ERROR: Couldn't get expected number of TLVs for Cmd=%d\n",
+			__func__, wmi_cmd_event_id);
+		return error;
+	}
+	/* NOTE: the returned number of TLVs is in "attr_struct_ptr.cmd_num_tlv" */
 
-				new_tlv_buf = buf_ptr;
-			}
-#endif
-			cmd_param_tlvs_ptr[tlv_index].tlv_ptr = new_tlv_buf;
-			cmd_param_tlvs_ptr[tlv_index].num_elements =
-				num_of_elems;
-			cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 1;     /* Indicates that buffer is allocated */
-		}
+	if (param_buf_len < WMI_TLV_HDR_SIZE) {
+		wmi_tlv_print_error
+			("%s: ERROR: Incorrect param buf length passed\n",
+			__func__);
+		return error;
+	}
 
-		tlv_index++;
-		remaining_expected_tlvs--;
-		buf_ptr += curr_tlv_len + num_padding_bytes;
-		buf_idx += curr_tlv_len + num_padding_bytes;
+	/* Create base structure of format wmi_cmd_event_id##_param_tlvs */
+	len_wmi_cmd_struct_buf =
+		attr_struct_ptr.cmd_num_tlv * sizeof(wmitlv_cmd_param_info);
+	if (param_tlvs_buf && len_wmi_cmd_struct_buf <= param_tlvs_buf_len) {
+		*wmi_cmd_struct_ptr = param_tlvs_buf;
+	} else {
+#ifndef NO_DYNAMIC_MEM_ALLOC
+		/* Dynamic memory allocation supported */
+		wmi_tlv_os_mem_alloc(os_handle, *wmi_cmd_struct_ptr,
+				     len_wmi_cmd_struct_buf);
+#else
+		/* Dynamic memory allocation is not supported. Use the buffer
+		 * g_wmi_static_cmd_param_info_buf, which should be set using
+		 * wmi_tlv_set_static_param_tlv_buf(),
+		 * for base structure of format wmi_cmd_event_id##_param_tlvs */
+		*wmi_cmd_struct_ptr = g_wmi_static_cmd_param_info_buf;
+		if (attr_struct_ptr.cmd_num_tlv >
+		    g_wmi_static_max_cmd_param_tlvs) {
+			/* Error: Expecting more TLVs that accommodated for static structure  */
+			wmi_tlv_print_error
+				("%s: Error: Expecting more TLVs that accommodated for static structure. Expected:%d Accomodated:%d\n",
+				__func__, attr_struct_ptr.cmd_num_tlv,
+				g_wmi_static_max_cmd_param_tlvs);
+			return error;
+		}
+#endif
 	}
+	if (!*wmi_cmd_struct_ptr) {
+		/* Error: unable to alloc memory */
+		wmi_tlv_print_error
+			("%s: Error: unable to alloc memory (size=%d) for TLV\n",
+			__func__, len_wmi_cmd_struct_buf);
+		return error;
+	}
+
+	wmi_tlv_OS_MEMZERO(*wmi_cmd_struct_ptr, len_wmi_cmd_struct_buf);
+
+	ctx.os_handle = os_handle;
+	ctx.buf_ptr = param_struc_ptr;
+	ctx.buf_idx = 0;
+	ctx.param_buf_len = param_buf_len;
+	ctx.wmi_cmd_event_id = wmi_cmd_event_id;
+	ctx.param_tlvs = *wmi_cmd_struct_ptr;
+	ctx.tlv_index = 0;
+	ctx.num_tlvs = attr_struct_ptr.cmd_num_tlv;
+
+	if (wmitlv_pad_tlvs(&ctx, is_cmd_id, attr_list))
+		goto Error_wmitlv_check_and_pad_tlvs;
 
 	return 0;
 Error_wmitlv_check_and_pad_tlvs:
-	if (is_cmd_id) {
-		wmitlv_free_allocated_command_tlvs(wmi_cmd_event_id,
-						   wmi_cmd_struct_ptr);
-	} else {
-		wmitlv_free_allocated_event_tlvs(wmi_cmd_event_id,
-						 wmi_cmd_struct_ptr);
-	}
+	wmitlv_free_allocated_tlvs(is_cmd_id, wmi_cmd_event_id,
+				   wmi_cmd_struct_ptr, param_tlvs_buf);
 	*wmi_cmd_struct_ptr = NULL;
 	return error;
 }
@@ -1000,10 +1298,25 @@ wmitlv_check_and_pad_event_tlvs(void *os_handle, void *param_struc_ptr,
 	uint32_t is_cmd_id = 0;
 	return wmitlv_check_and_pad_tlvs
 			(os_handle, param_struc_ptr, param_buf_len, is_cmd_id,
-			wmi_cmd_event_id, wmi_cmd_struct_ptr);
+			wmi_cmd_event_id, wmi_cmd_struct_ptr, NULL, 0);
 }
 qdf_export_symbol(wmitlv_check_and_pad_event_tlvs);
 
+int
+wmitlv_check_and_pad_event_tlvs_buf(void *os_handle, void *param_struc_ptr,
+				    uint32_t param_buf_len,
+				    uint32_t wmi_cmd_event_id,
+				    void **wmi_cmd_struct_ptr,
+				    void *param_tlvs_buf,
+				    uint32_t param_tlvs_buf_len)
+{
+	return wmitlv_check_and_pad_tlvs(os_handle, param_struc_ptr,
+					 param_buf_len, 0, wmi_cmd_event_id,
+					 wmi_cmd_struct_ptr, param_tlvs_buf,
+					 param_tlvs_buf_len);
+}
+qdf_export_symbol(wmitlv_check_and_pad_event_tlvs_buf);
+
 /**
  * wmitlv_check_and_pad_command_tlvs() - tlv helper function
  * @os_handle: os context handle
@@ -1026,7 +1339,7 @@ wmitlv_check_and_pad_command_tlvs(void *os_handle, void *param_struc_ptr,
 	uint32_t is_cmd_id = 1;
 	return wmitlv_check_and_pad_tlvs
 			(os_handle, param_struc_ptr, param_buf_len, is_cmd_id,
-			wmi_cmd_event_id, wmi_cmd_struct_ptr);
+			wmi_cmd_event_id, wmi_cmd_struct_ptr, NULL, 0);
 }
 
 /**
@@ -1034,6 +1347,7 @@ wmitlv_check_and_pad_command_tlvs(void *os_handle, void *param_struc_ptr,
  * @is_cmd_id: bollean to check if cmd or event tlv
  * @cmd_event_id: command or event id
  * @wmi_cmd_struct_ptr: wmi command structure
+ * @param_tlvs_buf: caller provided param_tlvs container, may be NULL
  *
  *
  * free any allocated buffers for WMI Event/Command TLV processing
@@ -1042,7 +1356,8 @@ wmitlv_check_and_pad_command_tlvs(void *os_handle, void *param_struc_ptr,
  */
 static void wmitlv_free_allocated_tlvs(uint32_t is_cmd_id,
 				       uint32_t cmd_event_id,
-				       void **wmi_cmd_struct_ptr)
+				       void **wmi_cmd_struct_ptr,
+				       void *param_tlvs_buf)
 {
 	void *ptr = *wmi_cmd_struct_ptr;
 
@@ -1086,7 +1401,8 @@ break;
 		}
 	}
 
-	wmi_tlv_os_mem_free(*wmi_cmd_struct_ptr);
+	if (*wmi_cmd_struct_ptr != param_tlvs_buf)
+		wmi_tlv_os_mem_free(*wmi_cmd_struct_ptr);
 	*wmi_cmd_struct_ptr = NULL;
 #endif
 
@@ -1106,7 +1422,7 @@ break;
 void wmitlv_free_allocated_command_tlvs(uint32_t cmd_event_id,
 					void **wmi_cmd_struct_ptr)
 {
-	wmitlv_free_allocated_tlvs(1, cmd_event_id, wmi_cmd_struct_ptr);
+	wmitlv_free_allocated_tlvs(1, cmd_event_id, wmi_cmd_struct_ptr, NULL);
 }
 
 /**
@@ -1122,10 +1438,19 @@ void wmitlv_free_allocated_command_tlvs(uint32_t cmd_event_id,
 void wmitlv_free_allocated_event_tlvs(uint32_t cmd_event_id,
 				      void **wmi_cmd_struct_ptr)
 {
-	wmitlv_free_allocated_tlvs(0, cmd_event_id, wmi_cmd_struct_ptr);
+	wmitlv_free_allocated_tlvs(0, cmd_event_id, wmi_cmd_struct_ptr, NULL);
 }
 qdf_export_symbol(wmitlv_free_allocated_event_tlvs);
 
+void wmitlv_free_allocated_event_tlvs_buf(uint32_t cmd_event_id,
+					  void **wmi_cmd_struct_ptr,
+					  void *param_tlvs_buf)
+{
+	wmitlv_free_allocated_tlvs(0, cmd_event_id, wmi_cmd_struct_ptr,
+				   param_tlvs_buf);
+}
+qdf_export_symbol(wmitlv_free_allocated_event_tlvs_buf);
+
 /**
  * wmi_versions_are_compatible() - tlv helper function
  * @vers1: host wmi version
@@ -33,6 +33,7 @@
 
 #ifndef WMI_NON_TLV_SUPPORT
 #include "wmi_tlv_helper.h"
+#include "wmi_tlv_defs.h"
 #endif
 
 #include <linux/debugfs.h>
@@ -2764,6 +2765,7 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 	void *wmi_cmd_struct_ptr = NULL;
 #ifndef WMI_NON_TLV_SUPPORT
 	int tlv_ok_status = 0;
+	wmitlv_cmd_param_info param_tlvs[WMI_EVT_PARAM_TLVS_ON_STACK];
 #endif
 	uint32_t idx = 0;
 	struct wmi_raw_event_buffer ev_buf;
@@ -2786,7 +2788,9 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 		tlv_ok_status =
 			wmi_handle->ops->wmi_check_and_pad_event(wmi_handle->scn_handle,
 							data, len, id,
-							&wmi_cmd_struct_ptr);
+							&wmi_cmd_struct_ptr,
+							param_tlvs,
+							sizeof(param_tlvs));
 		if (tlv_ok_status != 0) {
 			QDF_TRACE(QDF_MODULE_ID_WMI, QDF_TRACE_LEVEL_ERROR,
 				  "%s: Error: id=0x%x, wmitlv check status=%d",
@@ -2848,7 +2852,9 @@ end:
 	/* Free event buffer and allocated event tlv */
 #ifndef WMI_NON_TLV_SUPPORT
 	if (wmi_handle->target_type == WMI_TLV_TARGET)
-		wmi_handle->ops->wmi_free_allocated_event(id, &wmi_cmd_struct_ptr);
+		wmi_handle->ops->wmi_free_allocated_event(id,
+							  &wmi_cmd_struct_ptr,
+							  param_tlvs);
 #endif
 
 	qdf_nbuf_free(evt_buf);
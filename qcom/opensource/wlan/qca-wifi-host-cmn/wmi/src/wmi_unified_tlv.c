@@ -17464,8 +17464,8 @@ struct wmi_ops tlv_ops =  {
 	.send_obss_detection_cfg_cmd = send_obss_detection_cfg_cmd_tlv,
 	.extract_obss_detection_info = extract_obss_detection_info_tlv,
 	.wmi_pdev_id_conversion_enable = wmi_tlv_pdev_id_conversion_enable,
-	.wmi_free_allocated_event = wmitlv_free_allocated_event_tlvs,
-	.wmi_check_and_pad_event = wmitlv_check_and_pad_event_tlvs,
+	.wmi_free_allocated_event = wmitlv_free_allocated_event_tlvs_buf,
+	.wmi_check_and_pad_event = wmitlv_check_and_pad_event_tlvs_buf,
 	.wmi_check_command_params = wmitlv_check_command_tlv_params,
 	.extract_comb_phyerr = extract_comb_phyerr_tlv,
 	.extract_single_phyerr = extract_single_phyerr_tlv,
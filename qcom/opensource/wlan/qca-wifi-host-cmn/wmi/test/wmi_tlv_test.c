@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "qdf_util.h"
+#include "wmi_unified_priv.h"
+#include "wmi_tlv_helper.h"
+#include "wmi_tlv_defs.h"
+#include "wmi_tlv_test.h"
+
+#define wmi_tlv_ut_frame_len 64
+#define wmi_tlv_ut_bench_iter 10000
+
+/**
+ * struct wmi_tlv_ut_mgmt_rx - synthetic WMI_MGMT_RX_EVENTID payload
+ * @hdr: fixed wmi_mgmt_rx_hdr TLV
+ * @frame_tlv_hdr: header of the bufp byte array TLV
+ * @frame: management frame carried in bufp
+ */
+struct wmi_tlv_ut_mgmt_rx {
+	wmi_mgmt_rx_hdr hdr;
+	uint32_t frame_tlv_hdr;
+	uint8_t frame[wmi_tlv_ut_frame_len];
+};
+
+/**
+ * wmi_tlv_ut_build_mgmt_rx() - build a management rx event
+ * @evt: event buffer to fill
+ * @hdr_trim: number of bytes the target drops from the end of the header,
+ *	as an older target with a shorter wmi_mgmt_rx_hdr would
+ *
+ * Return: length of the event
+ */
+static uint32_t wmi_tlv_ut_build_mgmt_rx(struct wmi_tlv_ut_mgmt_rx *evt,
+					 uint32_t hdr_trim)
+{
+	uint32_t hdr_len = sizeof(evt->hdr) - hdr_trim;
+	uint8_t *buf = (uint8_t *)evt;
+	uint32_t i;
+
+	qdf_mem_zero(evt, sizeof(*evt));
+	WMITLV_SET_HDR(buf, WMITLV_TAG_STRUC_wmi_mgmt_rx_hdr,
+		       hdr_len - WMI_TLV_HDR_SIZE);
+	evt->hdr.chan_freq = 5180;
+	evt->hdr.buf_len = wmi_tlv_ut_frame_len;
+
+	buf += hdr_len;
+	WMITLV_SET_HDR(buf, WMITLV_TAG_ARRAY_BYTE, wmi_tlv_ut_frame_len);
+	buf += WMI_TLV_HDR_SIZE;
+	for (i = 0; i < wmi_tlv_ut_frame_len; i++)
+		buf[i] = i;
+
+	return hdr_len + WMI_TLV_HDR_SIZE + wmi_tlv_ut_frame_len;
+}
+
+static uint32_t wmi_tlv_ut_in_place(void)
+{
+	wmitlv_cmd_param_info param_tlvs[WMI_EVT_PARAM_TLVS_ON_STACK];
+	WMI_MGMT_RX_EVENTID_param_tlvs *tlvs;
+	struct wmi_tlv_ut_mgmt_rx evt;
+	uint32_t errors = 0;
+	void *tlvs_ptr;
+	uint32_t len;
+
+	len = wmi_tlv_ut_build_mgmt_rx(&evt, 0);
+	if (wmitlv_check_and_pad_event_tlvs_buf(NULL, &evt, len,
+						WMI_MGMT_RX_EVENTID,
+						&tlvs_ptr, param_tlvs,
+						sizeof(param_tlvs)))
+		return 1;
+
+	/* the event fits the stack container and nothing is padded */
+	tlvs = tlvs_ptr;
+	if (tlvs_ptr != (void *)param_tlvs)
+		errors++;
+	if (tlvs->hdr != &evt.hdr || tlvs->num_hdr != 1 ||
+	    tlvs->is_allocated_hdr)
+		errors++;
+	if (tlvs->bufp != evt.frame ||
+	    tlvs->num_bufp != wmi_tlv_ut_frame_len ||
+	    tlvs->is_allocated_bufp)
+		errors++;
+	if (tlvs->rssi_ctl_ext || tlvs->num_rssi_ctl_ext || tlvs->reo_params)
+		errors++;
+
+	wmitlv_free_allocated_event_tlvs_buf(WMI_MGMT_RX_EVENTID, &tlvs_ptr,
+					     param_tlvs);
+	QDF_BUG(!errors);
+
+	return errors;
+}
+
+static uint32_t wmi_tlv_ut_padded(void)
+{
+	wmitlv_cmd_param_info param_tlvs[WMI_EVT_PARAM_TLVS_ON_STACK];
+	WMI_MGMT_RX_EVENTID_param_tlvs *tlvs;
+	struct wmi_tlv_ut_mgmt_rx evt;
+	uint32_t errors = 0;
+	void *tlvs_ptr;
+	uint32_t len;
+	uint8_t *frame;
+
+	/* a header without chan_freq is padded out to the host definition */
+	len = wmi_tlv_ut_build_mgmt_rx(&evt, sizeof(evt.hdr.chan_freq));
+	if (wmitlv_check_and_pad_event_tlvs_buf(NULL, &evt, len,
+						WMI_MGMT_RX_EVENTID,
+						&tlvs_ptr, param_tlvs,
+						sizeof(param_tlvs)))
+		return 1;
+
+	tlvs = tlvs_ptr;
+	frame = (uint8_t *)&evt + sizeof(evt.hdr) -
+		sizeof(evt.hdr.chan_freq) + WMI_TLV_HDR_SIZE;
+	if (tlvs_ptr != (void *)param_tlvs)
+		errors++;
+	if (tlvs->hdr == &evt.hdr || !tlvs->is_allocated_hdr ||
+	    tlvs->hdr->buf_len != wmi_tlv_ut_frame_len ||
+	    tlvs->hdr->chan_freq)
+		errors++;
+	if (tlvs->bufp != frame || tlvs->num_bufp != wmi_tlv_ut_frame_len ||
+	    frame[wmi_tlv_ut_frame_len - 1] != wmi_tlv_ut_frame_len - 1)
+		errors++;
+
+	/* frees the padded header but not the stack container */
+	wmitlv_free_allocated_event_tlvs_buf(WMI_MGMT_RX_EVENTID, &tlvs_ptr,
+					     param_tlvs);
+	QDF_BUG(!errors);
+
+	return errors;
+}
+
+static uint32_t wmi_tlv_ut_bad_tag(void)
+{
+	wmitlv_cmd_param_info param_tlvs[WMI_EVT_PARAM_TLVS_ON_STACK];
+	struct wmi_tlv_ut_mgmt_rx evt;
+	void *tlvs_ptr = NULL;
+	uint32_t len;
+
+	len = wmi_tlv_ut_build_mgmt_rx(&evt, 0);
+	WMITLV_SET_HDR(&evt.frame_tlv_hdr, WMITLV_TAG_ARRAY_UINT32,
+		       wmi_tlv_ut_frame_len);
+	if (!wmitlv_check_and_pad_event_tlvs_buf(NULL, &evt, len,
+						 WMI_MGMT_RX_EVENTID,
+						 &tlvs_ptr, param_tlvs,
+						 sizeof(param_tlvs)) ||
+	    tlvs_ptr) {
+		QDF_BUG(0);
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * wmi_tlv_ut_bench() - compare the allocating and the on-stack event parse
+ *
+ * Parses the same management rx event with a heap allocated param_tlvs
+ * container, as __wmi_control_rx() used to, and with the on-stack one it
+ * uses now. The numbers are only printed, they depend on the platform.
+ *
+ * Return: number of failed test cases
+ */
+static uint32_t wmi_tlv_ut_bench(void)
+{
+	wmitlv_cmd_param_info param_tlvs[WMI_EVT_PARAM_TLVS_ON_STACK];
+	struct wmi_tlv_ut_mgmt_rx evt;
+	uint64_t heap_ns, stack_ns;
+	uint32_t errors = 0;
+	int64_t start;
+	void *tlvs_ptr;
+	uint32_t len;
+	uint32_t i;
+
+	len = wmi_tlv_ut_build_mgmt_rx(&evt, 0);
+
+	start = qdf_ktime_to_ns(qdf_ktime_get());
+	for (i = 0; i < wmi_tlv_ut_bench_iter; i++) {
+		if (wmitlv_check_and_pad_event_tlvs(NULL, &evt, len,
+						    WMI_MGMT_RX_EVENTID,
+						    &tlvs_ptr)) {
+			errors++;
+			continue;
+		}
+		wmitlv_free_allocated_event_tlvs(WMI_MGMT_RX_EVENTID,
+						 &tlvs_ptr);
+	}
+	heap_ns = qdf_ktime_to_ns(qdf_ktime_get()) - start;
+
+	start = qdf_ktime_to_ns(qdf_ktime_get());
+	for (i = 0; i < wmi_tlv_ut_bench_iter; i++) {
+		if (wmitlv_check_and_pad_event_tlvs_buf(NULL, &evt, len,
+							WMI_MGMT_RX_EVENTID,
+							&tlvs_ptr, param_tlvs,
+							sizeof(param_tlvs))) {
+			errors++;
+			continue;
+		}
+		wmitlv_free_allocated_event_tlvs_buf(WMI_MGMT_RX_EVENTID,
+						     &tlvs_ptr, param_tlvs);
+	}
+	stack_ns = qdf_ktime_to_ns(qdf_ktime_get()) - start;
+
+	qdf_nofl_info("wmi_tlv: mgmt rx event parse %llu ns allocated, %llu ns on stack",
+		      qdf_do_div(heap_ns, wmi_tlv_ut_bench_iter),
+		      qdf_do_div(stack_ns, wmi_tlv_ut_bench_iter));
+	QDF_BUG(!errors);
+
+	return errors;
+}
+
+uint32_t wmi_tlv_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += wmi_tlv_ut_in_place();
+	errors += wmi_tlv_ut_padded();
+	errors += wmi_tlv_ut_bad_tag();
+	errors += wmi_tlv_ut_bench();
+
+	return errors;
+}
@@ -248,8 +248,9 @@ QDF_STATUS cm_get_rssi_snr_by_bssid(struct wlan_objmgr_pdev *pdev,
 				    int8_t *rssi, int8_t *snr)
 {
 	struct scan_filter *scan_filter;
-	qdf_list_t *list = NULL;
-	struct scan_cache_node *first_node = NULL;
+	struct scan_cache_snapshot *snapshot;
+	qdf_list_node_t *cur_lst = NULL;
+	struct scan_cache_ref_node *first_node;
 	QDF_STATUS status = QDF_STATUS_SUCCESS;
 
 	if (snr)
@@ -264,26 +265,27 @@ QDF_STATUS cm_get_rssi_snr_by_bssid(struct wlan_objmgr_pdev *pdev,
 	qdf_mem_copy(scan_filter->bssid_list[0].bytes,
 		     bssid, sizeof(struct qdf_mac_addr));
 	scan_filter->ignore_auth_enc_type = true;
-	list = wlan_scan_get_result(pdev, scan_filter);
+	snapshot = wlan_scan_get_result_snapshot(pdev, scan_filter);
 	qdf_mem_free(scan_filter);
+	if (!snapshot)
+		return QDF_STATUS_E_NULL_VALUE;
 
-	if (!list || (list && !qdf_list_size(list))) {
+	qdf_list_peek_front(&snapshot->list, &cur_lst);
+	if (!cur_lst) {
 		mlme_debug("scan list empty");
 		status = QDF_STATUS_E_NULL_VALUE;
 		goto error;
 	}
 
-	qdf_list_peek_front(list, (qdf_list_node_t **) &first_node);
-	if (first_node && first_node->entry) {
-		if (rssi)
-			*rssi = first_node->entry->rssi_raw;
-		if (snr)
-			*snr = first_node->entry->snr;
-	}
+	first_node = qdf_container_of(cur_lst, struct scan_cache_ref_node,
+				      node);
+	if (rssi)
+		*rssi = first_node->entry->rssi_raw;
+	if (snr)
+		*snr = first_node->entry->snr;
 
 error:
-	if (list)
-		wlan_scan_purge_results(list);
+	wlan_scan_snapshot_put_ref(snapshot);
 
 	return status;
 }
@@ -89,6 +89,10 @@
 #define WLAN_HASHTABLE_TEST (1)
 #endif
 
+#ifdef CONFIG_QDF_TEST
+#define WLAN_NBUF_CLASSIFY_TEST (1)
+#endif
+
 #ifdef CONFIG_QDF_TEST
 #define WLAN_PERIODIC_WORK_TEST (1)
 #endif
@@ -294,6 +298,14 @@
 #define WMI_CMD_STRINGS (1)
 #endif
 
+#ifdef CONFIG_WMI_TLV_COMPILED_SCHEMA
+#define WMI_TLV_COMPILED_SCHEMA (1)
+#endif
+
+#ifdef CONFIG_WMI_TLV_TEST
+#define WLAN_WMI_TLV_TEST (1)
+#endif
+
 #ifdef CONFIG_WLAN_FEATURE_TWT
 #define WLAN_SUPPORT_TWT (1)
 #endif
@@ -436,6 +448,12 @@
 #define FEATURE_BUS_BANDWIDTH_MGR (1)
 #endif
 
+#if defined(CONFIG_HDD_BBM_TEST) && \
+	defined(CONFIG_FEATURE_BUS_BANDWIDTH_MGR) && \
+	defined(CONFIG_WLAN_FEATURE_DP_BUS_BANDWIDTH)
+#define WLAN_HDD_BBM_TEST (1)
+#endif
+
 #ifdef CONFIG_DP_BE_WAR
 #define DP_BE_WAR (1)
 #endif
@@ -2281,6 +2299,49 @@
 #define WLAN_SCHED_HISTORY_SIZE (CONFIG_SCHED_HISTORY_SIZE)
 #endif
 
+#ifdef CONFIG_WLAN_SCHED_MPSC_QUEUE
+#define WLAN_SCHED_MPSC_QUEUE (1)
+#endif
+
+#ifdef CONFIG_SCHEDULER_TEST
+#define WLAN_SCHEDULER_MQ_TEST (1)
+#endif
+
+#ifdef CONFIG_WLAN_FEATURE_DOT11F_IE_INDEX
+#define WLAN_FEATURE_DOT11F_IE_INDEX (1)
+#endif
+
+#ifdef CONFIG_DOT11F_TEST
+#define WLAN_DOT11F_TEST (1)
+#endif
+
+#ifdef CONFIG_QDF_TRACE_PERCPU_RING
+#define QDF_TRACE_PERCPU_RING (1)
+#endif
+
+#if defined(CONFIG_QDF_TEST) && \
+	defined(CONFIG_QDF_TRACE_PERCPU_RING) && \
+	defined(CONFIG_TRACE_RECORD_FEATURE)
+#define WLAN_TRACE_RING_TEST (1)
+#endif
+
+#ifdef CONFIG_WLAN_LOGGING_PERCPU_BUFFERS
+#define WLAN_LOGGING_PERCPU_BUFFERS (1)
+#endif
+
+#ifdef CONFIG_WLAN_LOGGING_MMAP_RING
+#define WLAN_LOGGING_MMAP_RING (1)
+#endif
+
+#ifdef CONFIG_HIF_EXEC_ADAPTIVE_BUDGET
+#define HIF_EXEC_ADAPTIVE_BUDGET (1)
+#endif
+
+#if defined(CONFIG_HIF_EXEC_BUDGET_TEST) && \
+	defined(CONFIG_HIF_EXEC_ADAPTIVE_BUDGET)
+#define WLAN_HIF_EXEC_BUDGET_TEST (1)
+#endif
+
 #ifdef CONFIG_DP_LEGACY_MODE_CSM_DEFAULT_DISABLE
 #define DP_LEGACY_MODE_CSM_DEFAULT_DISABLE (CONFIG_DP_LEGACY_MODE_CSM_DEFAULT_DISABLE)
 #endif
@@ -2735,6 +2796,14 @@
 #define DP_TX_TRACKING (1)
 #endif
 
+#ifdef CONFIG_DP_TX_DESC_PERCPU_CACHE
+#define DP_TX_DESC_PERCPU_CACHE (1)
+#endif
+
+#ifdef CONFIG_DP_RX_THREAD_WORK_STEALING
+#define DP_RX_THREAD_WORK_STEALING (1)
+#endif
+
 #ifdef CONFIG_CHIP_VERSION
 #define CHIP_VERSION (CONFIG_CHIP_VERSION)
 #endif
@@ -24,7 +24,8 @@
 #include <linux/skbuff.h>
 #include "hif.h"
 
-static void dp_rx_fisa_flush_flow_wrap(struct dp_fisa_rx_sw_ft *sw_ft);
+static void dp_rx_fisa_flush_flow_wrap(struct dp_fisa_rx_sw_ft *sw_ft,
+				       enum dp_fisa_flush_reason reason);
 
 /*
  * Used by FW to route RX packets to host REO2SW1 ring if IPA hit
@@ -486,6 +487,61 @@ static bool is_same_flow(struct cdp_rx_flow_tuple_info *tuple1,
 		return true;
 }
 
+/**
+ * dp_rx_fisa_sw_ft_match() - Lockless check of a SW FT entry against a tuple
+ * @sw_ft_entry: SW FT entry
+ * @flow_tuple: tuple of the received packet
+ *
+ * The entry identity is published by the FST writer under its seqcount, so
+ * a reader never matches against a half written tuple.
+ *
+ * Return: true if the entry is populated with the same flow
+ */
+static bool dp_rx_fisa_sw_ft_match(struct dp_fisa_rx_sw_ft *sw_ft_entry,
+				   struct cdp_rx_flow_tuple_info *flow_tuple)
+{
+	unsigned int seq;
+	bool match;
+
+	do {
+		seq = qdf_read_seqcount_begin(&sw_ft_entry->seq);
+		match = sw_ft_entry->is_populated &&
+			is_same_flow(&sw_ft_entry->rx_flow_tuple_info,
+				     flow_tuple);
+	} while (qdf_read_seqcount_retry(&sw_ft_entry->seq, seq));
+
+	return match;
+}
+
+/**
+ * dp_rx_fisa_lookup_sw_ft() - Lockless lookup of a flow along its skid chain
+ * @fisa_hdl: Handle to fisa context
+ * @flow_hash: flow hash from the RX TLV
+ * @flow_tuple: tuple of the received packet
+ *
+ * Return: SW FT entry of the flow, NULL if it is not in the table yet
+ */
+static struct dp_fisa_rx_sw_ft *
+dp_rx_fisa_lookup_sw_ft(struct dp_rx_fst *fisa_hdl, uint32_t flow_hash,
+			struct cdp_rx_flow_tuple_info *flow_tuple)
+{
+	struct dp_fisa_rx_sw_ft *sw_ft_base;
+	uint32_t hashed_flow_idx = flow_hash & fisa_hdl->hash_mask;
+	uint32_t skid_count;
+
+	sw_ft_base = (struct dp_fisa_rx_sw_ft *)fisa_hdl->base;
+	for (skid_count = 0; skid_count <= fisa_hdl->max_skid_length;
+	     skid_count++) {
+		if (dp_rx_fisa_sw_ft_match(&sw_ft_base[hashed_flow_idx],
+					   flow_tuple))
+			return &sw_ft_base[hashed_flow_idx];
+
+		hashed_flow_idx = (hashed_flow_idx + 1) & fisa_hdl->hash_mask;
+	}
+
+	return NULL;
+}
+
 /**
  * dp_rx_fisa_add_ft_entry() - Add new flow to HW and SW FT if it is not added
  * @vdev: Handle DP vdev to save in SW flow table
@@ -524,7 +580,6 @@ dp_rx_fisa_add_ft_entry(struct dp_vdev *vdev,
 		return NULL;
 	}
 
-	rx_flow_tuple_info.tuple_populated = false;
 	flow_hash = flow_idx_hash;
 	hashed_flow_idx = flow_hash & fisa_hdl->hash_mask;
 	max_skid_length = fisa_hdl->max_skid_length;
@@ -532,20 +587,32 @@ dp_rx_fisa_add_ft_entry(struct dp_vdev *vdev,
 	dp_fisa_debug("flow_hash 0x%x hashed_flow_idx 0x%x", flow_hash,
 		      hashed_flow_idx);
 	dp_fisa_debug("max_skid_length 0x%x", max_skid_length);
+
+	/*
+	 * Until the FSE cache is flushed every packet of a new flow comes
+	 * with an invalid flow index; look the flow up without the FST lock
+	 * so those packets do not serialize all REO rings on it.
+	 */
+	get_flow_tuple_from_nbuf(fisa_hdl->soc_hdl, &rx_flow_tuple_info,
+				 nbuf, rx_tlv_hdr);
+	sw_ft_entry = dp_rx_fisa_lookup_sw_ft(fisa_hdl, flow_hash,
+					      &rx_flow_tuple_info);
+	if (sw_ft_entry) {
+		sw_ft_entry->vdev = vdev;
+		return sw_ft_entry;
+	}
+
 	qdf_spin_lock_bh(&fisa_hdl->dp_rx_fst_lock);
 	do {
 		sw_ft_entry = &(((struct dp_fisa_rx_sw_ft *)
 					fisa_hdl->base)[hashed_flow_idx]);
 		if (!sw_ft_entry->is_populated) {
+			qdf_write_seqcount_begin(&sw_ft_entry->seq);
 			/* Add SW FT entry */
 			dp_rx_fisa_update_sw_ft_entry(sw_ft_entry,
 						      flow_hash, vdev,
 						      fisa_hdl->soc_hdl,
 						      hashed_flow_idx);
-			if (!rx_flow_tuple_info.tuple_populated)
-				get_flow_tuple_from_nbuf(fisa_hdl->soc_hdl,
-							 &rx_flow_tuple_info,
-							 nbuf, rx_tlv_hdr);
 
 			/* Add HW FT entry */
 			sw_ft_entry->hw_fse =
@@ -566,17 +633,13 @@ dp_rx_fisa_add_ft_entry(struct dp_vdev *vdev,
 
 			sw_ft_entry->is_flow_tcp = proto_params.tcp_proto;
 			sw_ft_entry->is_flow_udp = proto_params.udp_proto;
+			qdf_write_seqcount_end(&sw_ft_entry->seq);
 
 			is_fst_updated = true;
 			fisa_hdl->add_flow_count++;
 			break;
 		}
 		/* else */
-		if (!rx_flow_tuple_info.tuple_populated)
-			get_flow_tuple_from_nbuf(fisa_hdl->soc_hdl,
-						 &rx_flow_tuple_info,
-						 nbuf, rx_tlv_hdr);
-
 		if (is_same_flow(&sw_ft_entry->rx_flow_tuple_info,
 				 &rx_flow_tuple_info)) {
 			sw_ft_entry->vdev = vdev;
@@ -719,11 +782,13 @@ dp_fisa_rx_delete_flow(struct dp_rx_fst *fisa_hdl,
 	dp_rx_fisa_acquire_ft_lock(fisa_hdl, reo_id);
 
 	/* Flush the flow before deletion */
-	dp_rx_fisa_flush_flow_wrap(sw_ft_entry);
+	dp_rx_fisa_flush_flow_wrap(sw_ft_entry, DP_FISA_FLUSH_FORCED);
 
+	qdf_write_seqcount_begin(&sw_ft_entry->seq);
 	dp_rx_fisa_save_pkt_hist(sw_ft_entry, &pkt_hist);
-	/* Clear the sw_ft_entry */
-	memset(sw_ft_entry, 0, sizeof(*sw_ft_entry));
+	/* Clear the sw_ft_entry, the seqcount in front is kept */
+	qdf_mem_zero((uint8_t *)sw_ft_entry + sizeof(sw_ft_entry->seq),
+		     sizeof(*sw_ft_entry) - sizeof(sw_ft_entry->seq));
 	dp_rx_fisa_restore_pkt_hist(sw_ft_entry, &pkt_hist);
 
 	dp_rx_fisa_update_sw_ft_entry(sw_ft_entry, elem->flow_idx, elem->vdev,
@@ -743,6 +808,7 @@ dp_fisa_rx_delete_flow(struct dp_rx_fst *fisa_hdl,
 
 	sw_ft_entry->is_flow_tcp = elem->is_tcp_flow;
 	sw_ft_entry->is_flow_udp = elem->is_udp_flow;
+	qdf_write_seqcount_end(&sw_ft_entry->seq);
 
 	fisa_hdl->add_flow_count++;
 	fisa_hdl->del_flow_count++;
@@ -781,6 +847,11 @@ dp_fisa_rx_get_hw_ft_timestamp(struct dp_rx_fst *fisa_hdl,
  * @fisa_hdl: handle to FISA context
  * @elem: details of the flow which is being added
  *
+ * Runs from the FST update worker, the only writer of the SW FT when the FST
+ * is in CMEM. Each entry is published under its seqcount with the FST lock
+ * held just for that entry, so lookups from the REO rings never wait for
+ * the whole update batch.
+ *
  * Return: None
  */
 static void dp_fisa_rx_fst_update(struct dp_rx_fst *fisa_hdl,
@@ -816,6 +887,8 @@ static void dp_fisa_rx_fst_update(struct dp_rx_fst *fisa_hdl,
 		sw_ft_entry = &(((struct dp_fisa_rx_sw_ft *)
 					fisa_hdl->base)[hashed_flow_idx]);
 		if (!sw_ft_entry->is_populated) {
+			qdf_spin_lock_bh(&fisa_hdl->dp_rx_fst_lock);
+			qdf_write_seqcount_begin(&sw_ft_entry->seq);
 			/* Add SW FT entry */
 			dp_rx_fisa_update_sw_ft_entry(sw_ft_entry,
 						      flow_hash, elem->vdev,
@@ -838,12 +911,19 @@ static void dp_fisa_rx_fst_update(struct dp_rx_fst *fisa_hdl,
 			sw_ft_entry->flow_init_ts = qdf_get_log_timestamp();
 			sw_ft_entry->is_flow_tcp = elem->is_tcp_flow;
 			sw_ft_entry->is_flow_udp = elem->is_udp_flow;
+			qdf_write_seqcount_end(&sw_ft_entry->seq);
+			qdf_spin_unlock_bh(&fisa_hdl->dp_rx_fst_lock);
 
 			is_fst_updated = true;
 			fisa_hdl->add_flow_count++;
 			break;
 		}
 		/* else */
+		/* flow was added by an earlier request of the same batch */
+		if (is_same_flow(&sw_ft_entry->rx_flow_tuple_info,
+				 rx_flow_tuple_info))
+			return;
+
 		/* hash collision move to the next FT entry */
 		dp_fisa_debug("Hash collision %d",
 			      fisa_hdl->hash_collision_cnt);
@@ -906,12 +986,13 @@ void dp_fisa_rx_fst_update_work(void *arg)
 	}
 
 	qdf_spin_lock_bh(&fisa_hdl->dp_rx_fst_lock);
-	while (qdf_list_peek_front(&fisa_hdl->fst_update_list, &node) ==
+	while (qdf_list_remove_front(&fisa_hdl->fst_update_list, &node) ==
 	       QDF_STATUS_SUCCESS) {
+		qdf_spin_unlock_bh(&fisa_hdl->dp_rx_fst_lock);
 		elem = (struct dp_fisa_rx_fst_update_elem *)node;
 		dp_fisa_rx_fst_update(fisa_hdl, elem);
-		qdf_list_remove_front(&fisa_hdl->fst_update_list, &node);
 		qdf_mem_free(elem);
+		qdf_spin_lock_bh(&fisa_hdl->dp_rx_fst_lock);
 	}
 	qdf_spin_unlock_bh(&fisa_hdl->dp_rx_fst_lock);
 
@@ -972,7 +1053,6 @@ dp_fisa_rx_queue_fst_update_work(struct dp_rx_fst *fisa_hdl, uint32_t flow_idx,
 	uint8_t *rx_tlv_hdr = qdf_nbuf_data(nbuf);
 	struct dp_fisa_rx_fst_update_elem *elem;
 	struct dp_fisa_rx_sw_ft *sw_ft_entry;
-	uint32_t hashed_flow_idx;
 	uint32_t reo_dest_indication;
 	bool found;
 	struct hal_proto_params proto_params;
@@ -989,23 +1069,25 @@ dp_fisa_rx_queue_fst_update_work(struct dp_rx_fst *fisa_hdl, uint32_t flow_idx,
 
 	hal_rx_msdu_get_reo_destination_indication(hal_soc_hdl, rx_tlv_hdr,
 						   &reo_dest_indication);
+
+	/*
+	 * The worker may already have published the flow while the FSE cache
+	 * still misses it; aggregate against the SW FT entry right away
+	 * instead of taking the FST lock to scan the pending requests.
+	 */
+	get_flow_tuple_from_nbuf(fisa_hdl->soc_hdl, &flow_tuple_info,
+				 nbuf, rx_tlv_hdr);
+	sw_ft_entry = dp_rx_fisa_lookup_sw_ft(fisa_hdl, flow_idx,
+					      &flow_tuple_info);
+	if (sw_ft_entry)
+		return sw_ft_entry;
+
 	qdf_spin_lock_bh(&fisa_hdl->dp_rx_fst_lock);
 	found = dp_fisa_rx_is_fst_work_queued(fisa_hdl, flow_idx);
 	qdf_spin_unlock_bh(&fisa_hdl->dp_rx_fst_lock);
 	if (found)
 		return NULL;
 
-	hashed_flow_idx = flow_idx & fisa_hdl->hash_mask;
-	sw_ft_entry = &(((struct dp_fisa_rx_sw_ft *)
-				fisa_hdl->base)[hashed_flow_idx]);
-
-	get_flow_tuple_from_nbuf(fisa_hdl->soc_hdl, &flow_tuple_info,
-				 nbuf, rx_tlv_hdr);
-
-	if (sw_ft_entry->is_populated && is_same_flow(
-			&sw_ft_entry->rx_flow_tuple_info, &flow_tuple_info))
-		return sw_ft_entry;
-
 	elem = qdf_mem_malloc(sizeof(*elem));
 	if (!elem) {
 		dp_fisa_debug("failed to allocate memory for FST update");
@@ -1049,6 +1131,8 @@ dp_fisa_rx_get_sw_ft_entry(struct dp_rx_fst *fisa_hdl, qdf_nbuf_t nbuf,
 	struct dp_fisa_rx_sw_ft *sw_ft_base;
 	uint32_t fse_metadata;
 	uint8_t *rx_tlv_hdr;
+	unsigned int seq;
+	bool stale;
 
 	sw_ft_base = (struct dp_fisa_rx_sw_ft *)fisa_hdl->base;
 	rx_tlv_hdr = qdf_nbuf_data(nbuf);
@@ -1074,7 +1158,13 @@ dp_fisa_rx_get_sw_ft_entry(struct dp_rx_fst *fisa_hdl, qdf_nbuf_t nbuf,
 	 * entry to avoid packets getting aggregated with the wrong flow.
 	 */
 	fse_metadata = hal_rx_msdu_fse_metadata_get(hal_soc_hdl, rx_tlv_hdr);
-	if (fisa_hdl->del_flow_count && fse_metadata != sw_ft_entry->metadata)
+	do {
+		seq = qdf_read_seqcount_begin(&sw_ft_entry->seq);
+		stale = fisa_hdl->del_flow_count &&
+			fse_metadata != sw_ft_entry->metadata;
+	} while (qdf_read_seqcount_retry(&sw_ft_entry->seq, seq));
+
+	if (stale)
 		return NULL;
 
 	sw_ft_entry->vdev = vdev;
@@ -1309,7 +1399,7 @@ dp_rx_fisa_aggr_udp(struct dp_rx_fst *fisa_hdl,
 		fisa_flow->adjusted_cumulative_ip_length -=
 			(udp_len - sizeof(struct udphdr));
 		fisa_flow->cur_aggr--;
-		dp_rx_fisa_flush_flow_wrap(fisa_flow);
+		dp_rx_fisa_flush_flow_wrap(fisa_flow, DP_FISA_FLUSH_LEN_CHANGE);
 		/* napi_flush_cumulative_ip_length  not include current msdu */
 		fisa_flow->napi_flush_cumulative_ip_length -= udp_len;
 		head_skb = NULL;
@@ -1324,6 +1414,7 @@ dp_rx_fisa_aggr_udp(struct dp_rx_fst *fisa_hdl,
 		fisa_flow->adjusted_cumulative_ip_length = udp_len;
 		fisa_flow->head_skb_ip_hdr_offset = l3_hdr_offset;
 		fisa_flow->head_skb_l4_hdr_offset = l4_hdr_offset;
+		fisa_flow->head_skb_ts = fisa_flow->last_pkt_ts;
 
 		fisa_flow->frags_cumulative_len = 0;
 
@@ -1372,7 +1463,7 @@ dp_rx_fisa_aggr_udp(struct dp_rx_fst *fisa_hdl,
 	 * then flush the aggregate
 	 */
 	if (udp_len < qdf_ntohs(fisa_flow->head_skb_udp_hdr->len))
-		dp_rx_fisa_flush_flow_wrap(fisa_flow);
+		dp_rx_fisa_flush_flow_wrap(fisa_flow, DP_FISA_FLUSH_LEN_CHANGE);
 
 	return FISA_AGGR_DONE;
 }
@@ -1610,18 +1701,56 @@ dp_rx_fisa_flush_tcp_flow(struct dp_vdev *vdev,
 	fisa_flow->flush_count++;
 }
 
+/**
+ * dp_rx_fisa_record_flush() - Account a flush in the per-flow statistics
+ * @flow: Flow whose aggregate is about to be delivered
+ * @reason: Reason for the flush
+ *
+ * Return: None
+ */
+static void dp_rx_fisa_record_flush(struct dp_fisa_rx_sw_ft *flow,
+				    enum dp_fisa_flush_reason reason)
+{
+	uint64_t lat_us;
+	uint8_t bucket;
+
+	flow->flush_reason_cnt[reason]++;
+
+	lat_us = qdf_log_timestamp_to_usecs(qdf_get_log_timestamp() -
+					    flow->head_skb_ts);
+	if (lat_us < 100)
+		bucket = 0;
+	else if (lat_us < 250)
+		bucket = 1;
+	else if (lat_us < 500)
+		bucket = 2;
+	else if (lat_us < 1000)
+		bucket = 3;
+	else if (lat_us < 2000)
+		bucket = 4;
+	else
+		bucket = 5;
+
+	flow->flush_lat_hist[bucket]++;
+}
+
 /**
  * dp_rx_fisa_flush_flow() - Flush all aggregated nbuf of the flow
  * @vdev: handle to dp_vdev
  * @fisa_flow: Flow for which aggregates to be flushed
+ * @reason: Reason for the flush, recorded in the flow stats
  *
  * Return: None
  */
 static void dp_rx_fisa_flush_flow(struct dp_vdev *vdev,
-				  struct dp_fisa_rx_sw_ft *flow)
+				  struct dp_fisa_rx_sw_ft *flow,
+				  enum dp_fisa_flush_reason reason)
 {
 	dp_fisa_debug("dp_rx_fisa_flush_flow");
 
+	if (flow->head_skb)
+		dp_rx_fisa_record_flush(flow, reason);
+
 	if (flow->is_flow_udp)
 		dp_rx_fisa_flush_udp_flow(vdev, flow);
 	else
@@ -1674,6 +1803,41 @@ static bool dp_fisa_aggregation_should_stop(
 	return false;
 }
 
+/**
+ * dp_fisa_update_aggr_limit() - Update the adaptive aggregation limit
+ * @fisa_flow: Handle SW flow entry
+ * @now: log timestamp of the current MSDU
+ *
+ * The limit follows an EWMA (1/8 weight) of the flow's inter-packet gap: the
+ * flow may hold as many MSDUs as it receives within
+ * FISA_ADAPTIVE_AGGR_WINDOW_US, bounded by the HW aggregation limit.
+ *
+ * Return: None
+ */
+static void dp_fisa_update_aggr_limit(struct dp_fisa_rx_sw_ft *fisa_flow,
+				      uint64_t now)
+{
+	uint64_t ipg_us = FISA_ADAPTIVE_IPG_MAX_US;
+	uint32_t limit;
+
+	if (fisa_flow->last_pkt_ts)
+		ipg_us = qdf_log_timestamp_to_usecs(now -
+						    fisa_flow->last_pkt_ts);
+	if (ipg_us > FISA_ADAPTIVE_IPG_MAX_US)
+		ipg_us = FISA_ADAPTIVE_IPG_MAX_US;
+
+	fisa_flow->last_pkt_ts = now;
+	fisa_flow->avg_ipg_us = (fisa_flow->avg_ipg_us * 7 + ipg_us) >> 3;
+
+	limit = FISA_ADAPTIVE_AGGR_WINDOW_US / (fisa_flow->avg_ipg_us + 1);
+	if (limit > FISA_FLOW_MAX_AGGR_COUNT)
+		limit = FISA_FLOW_MAX_AGGR_COUNT;
+	else if (!limit)
+		limit = 1;
+
+	fisa_flow->aggr_limit = limit;
+}
+
 /**
  * dp_add_nbuf_to_fisa_flow() - Aggregate incoming nbuf
  * @fisa_hdl: handle to fisa context
@@ -1695,6 +1859,7 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 	uint8_t napi_id = QDF_NBUF_CB_RX_CTX_ID(nbuf);
 	uint32_t fse_metadata;
 	bool cce_match;
+	uint64_t now;
 
 	dump_tlvs(hal_soc_hdl, rx_tlv_hdr, QDF_TRACE_LEVEL_INFO_HIGH);
 	dp_fisa_debug("nbuf: %pK nbuf->next:%pK nbuf->data:%pK len %d data_len %d",
@@ -1737,7 +1902,7 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 		 */
 		dp_fisa_debug("no fgc nbuf %pK, flush %pK napi %d", nbuf,
 			      fisa_flow, QDF_NBUF_CB_RX_CTX_ID(nbuf));
-		dp_rx_fisa_flush_flow(vdev, fisa_flow);
+		dp_rx_fisa_flush_flow(vdev, fisa_flow, DP_FISA_FLUSH_NEW_AGGR);
 		/* Clear of previoud context values */
 		fisa_flow->napi_flush_cumulative_l4_checksum = 0;
 		fisa_flow->napi_flush_cumulative_ip_length = 0;
@@ -1769,7 +1934,7 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 		 * Flush the flow and do not aggregate until next start new
 		 * aggreagtion
 		 */
-		dp_rx_fisa_flush_flow(vdev, fisa_flow);
+		dp_rx_fisa_flush_flow(vdev, fisa_flow, DP_FISA_FLUSH_INVALID);
 		fisa_flow->do_not_aggregate = true;
 		fisa_flow->cur_aggr = 0;
 		fisa_flow->napi_flush_cumulative_ip_length = 0;
@@ -1829,6 +1994,9 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 	dp_fisa_record_pkt(fisa_flow, nbuf, rx_tlv_hdr,
 			   fisa_hdl->soc_hdl->rx_pkt_tlv_size);
 
+	now = qdf_get_log_timestamp();
+	dp_fisa_update_aggr_limit(fisa_flow, now);
+
 	if (fisa_flow->is_flow_udp) {
 		dp_rx_fisa_aggr_udp(fisa_hdl, fisa_flow, nbuf);
 	} else if (fisa_flow->is_flow_tcp) {
@@ -1836,8 +2004,13 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 		dp_rx_fisa_aggr_tcp(fisa_hdl, fisa_flow, nbuf);
 	}
 
+	/* cur_aggr does not include the head_skb */
+	if (fisa_flow->head_skb &&
+	    fisa_flow->cur_aggr + 1 >= fisa_flow->aggr_limit)
+		dp_rx_fisa_flush_flow_wrap(fisa_flow, DP_FISA_FLUSH_ADAPTIVE);
+
 	dp_rx_fisa_release_ft_lock(fisa_hdl, napi_id);
-	fisa_flow->last_accessed_ts = qdf_get_log_timestamp();
+	fisa_flow->last_accessed_ts = now;
 
 	return FISA_AGGR_DONE;
 
@@ -1892,7 +2065,8 @@ QDF_STATUS dp_rx_fisa_flush_by_vdev_ctx_id(struct dp_soc *soc,
 		    sw_ft_entry[i].napi_id == rx_ctx_id) {
 			dp_fisa_debug("flushing %d %pk vdev %pK napi id:%d", i,
 				      &sw_ft_entry[i], vdev, rx_ctx_id);
-			dp_rx_fisa_flush_flow_wrap(&sw_ft_entry[i]);
+			dp_rx_fisa_flush_flow_wrap(&sw_ft_entry[i],
+						   DP_FISA_FLUSH_FORCED);
 		}
 	}
 	dp_rx_fisa_release_ft_lock(fisa_hdl, rx_ctx_id);
@@ -2000,7 +2174,8 @@ QDF_STATUS dp_fisa_rx(struct dp_soc *soc, struct dp_vdev *vdev,
 			if (fisa_flow) {
 				dp_rx_fisa_acquire_ft_lock(dp_fisa_rx_hdl,
 							   fisa_flow->napi_id);
-				dp_rx_fisa_flush_flow(vdev, fisa_flow);
+				dp_rx_fisa_flush_flow(vdev, fisa_flow,
+						      DP_FISA_FLUSH_FORCED);
 				dp_rx_fisa_release_ft_lock(dp_fisa_rx_hdl,
 							   fisa_flow->napi_id);
 			}
@@ -2075,10 +2250,12 @@ QDF_STATUS dp_rx_dump_fisa_stats(struct dp_soc *soc)
  * dp_rx_fisa_flush_flow_wrap() - flush fisa flow by invoking
  *				  dp_rx_fisa_flush_flow()
  * @sw_ft: fisa flow for which aggregates to be flushed
+ * @reason: Reason for the flush
  *
  * Return: None.
  */
-static void dp_rx_fisa_flush_flow_wrap(struct dp_fisa_rx_sw_ft *sw_ft)
+static void dp_rx_fisa_flush_flow_wrap(struct dp_fisa_rx_sw_ft *sw_ft,
+				       enum dp_fisa_flush_reason reason)
 {
 	/* Save the ip_len and checksum as hardware assist is
 	 * always based on his start of aggregation
@@ -2091,7 +2268,7 @@ static void dp_rx_fisa_flush_flow_wrap(struct dp_fisa_rx_sw_ft *sw_ft)
 		      sw_ft->napi_flush_cumulative_ip_length);
 
 	dp_rx_fisa_flush_flow(sw_ft->vdev,
-			      sw_ft);
+			      sw_ft, reason);
 	sw_ft->cur_aggr = 0;
 }
 
@@ -2109,7 +2286,8 @@ QDF_STATUS dp_rx_fisa_flush_by_ctx_id(struct dp_soc *soc, int napi_id)
 		    sw_ft_entry[i].is_populated) {
 			dp_fisa_debug("flushing %d %pK napi_id %d", i,
 				      &sw_ft_entry[i], napi_id);
-			dp_rx_fisa_flush_flow_wrap(&sw_ft_entry[i]);
+			dp_rx_fisa_flush_flow_wrap(&sw_ft_entry[i],
+						   DP_FISA_FLUSH_NAPI_END);
 		}
 	}
 	dp_rx_fisa_release_ft_lock(fisa_hdl, napi_id);
@@ -2142,7 +2320,8 @@ QDF_STATUS dp_rx_fisa_flush_by_vdev_id(struct dp_soc *soc, uint8_t vdev_id)
 			dp_fisa_debug("flushing %d %pk vdev %pK", i,
 				      &sw_ft_entry[i], vdev);
 
-			dp_rx_fisa_flush_flow_wrap(&sw_ft_entry[i]);
+			dp_rx_fisa_flush_flow_wrap(&sw_ft_entry[i],
+						   DP_FISA_FLUSH_FORCED);
 		}
 		dp_rx_fisa_release_ft_lock(fisa_hdl, reo_id);
 	}
@@ -36,6 +36,14 @@
 /* max flow cumulative ip length */
 #define FISA_FLOW_MAX_CUMULATIVE_IP_LEN \
 	(FISA_MAX_SINGLE_CUMULATIVE_IP_LEN * FISA_FLOW_MAX_AGGR_COUNT)
+/*
+ * Adaptive aggregation: a flow holds at most as many MSDUs as arrive within
+ * FISA_ADAPTIVE_AGGR_WINDOW_US at its average inter-packet gap, so sparse
+ * flows are flushed right away and high rate flows reach the HW limit.
+ */
+#define FISA_ADAPTIVE_AGGR_WINDOW_US	500
+/* inter-packet gaps are clamped to this before averaging */
+#define FISA_ADAPTIVE_IPG_MAX_US	10000
 
 #define IPSEC_PORT 500
 #define IPSEC_NAT_PORT 4500
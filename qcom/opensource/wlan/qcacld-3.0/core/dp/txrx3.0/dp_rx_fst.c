@@ -26,6 +26,7 @@
 #include "dp_internal.h"
 #include "hif.h"
 #include "dp_txrx.h"
+#include "qdf_debugfs.h"
 
 /* Timeout in milliseconds to wait for CMEM FST HTT response */
 #define DP_RX_FST_CMEM_RESP_TIMEOUT 2000
@@ -64,6 +65,120 @@ void dp_rx_dump_fisa_table(struct dp_soc *soc)
 	}
 }
 
+#ifdef WLAN_DEBUGFS
+static const char * const dp_fisa_flush_reason_str[DP_FISA_FLUSH_REASON_MAX] = {
+	[DP_FISA_FLUSH_NEW_AGGR] = "new",
+	[DP_FISA_FLUSH_LEN_CHANGE] = "len",
+	[DP_FISA_FLUSH_ADAPTIVE] = "adapt",
+	[DP_FISA_FLUSH_NAPI_END] = "napi",
+	[DP_FISA_FLUSH_FORCED] = "forced",
+	[DP_FISA_FLUSH_INVALID] = "inval",
+};
+
+/**
+ * dp_rx_fisa_flow_stats_show() - debugfs show handler for the FISA flow table
+ * @file: debugfs file handle
+ * @arg: FISA context
+ *
+ * Prints one row per populated flow with its adaptive aggregation state,
+ * flush reason counters and aggregate hold latency histogram.
+ *
+ * Return: QDF_STATUS_SUCCESS
+ */
+static QDF_STATUS dp_rx_fisa_flow_stats_show(qdf_debugfs_file_t file,
+					     void *arg)
+{
+	struct dp_rx_fst *fst = arg;
+	struct dp_fisa_rx_sw_ft *sw_ft_entry;
+	struct cdp_rx_flow_tuple_info *tuple;
+	int i, j;
+
+	qdf_debugfs_printf(file, "flows added %u evicted %u hash collision %u\n",
+			   fst->add_flow_count, fst->del_flow_count,
+			   fst->hash_collision_cnt);
+	qdf_debugfs_printf(file, "flow ring proto sport dport limit ipg_us aggr flushes avg_aggr");
+	for (i = 0; i < DP_FISA_FLUSH_REASON_MAX; i++)
+		qdf_debugfs_printf(file, " %s", dp_fisa_flush_reason_str[i]);
+	qdf_debugfs_printf(file, " lat<100/250/500/1000/2000/inf us\n");
+
+	sw_ft_entry = (struct dp_fisa_rx_sw_ft *)fst->base;
+	for (i = 0; i < fst->max_entries; i++, sw_ft_entry++) {
+		if (!sw_ft_entry->is_populated)
+			continue;
+
+		tuple = &sw_ft_entry->rx_flow_tuple_info;
+		qdf_debugfs_printf(file, "%u %u %s %u %u %u %u %u %u %llu",
+				   sw_ft_entry->flow_id,
+				   sw_ft_entry->napi_id,
+				   sw_ft_entry->is_flow_udp ? "udp" : "tcp",
+				   tuple->src_port, tuple->dest_port,
+				   sw_ft_entry->aggr_limit,
+				   sw_ft_entry->avg_ipg_us,
+				   sw_ft_entry->aggr_count,
+				   sw_ft_entry->flush_count,
+				   sw_ft_entry->flush_count ?
+				   qdf_do_div((uint64_t)sw_ft_entry->aggr_count,
+					      sw_ft_entry->flush_count) : 0);
+		for (j = 0; j < DP_FISA_FLUSH_REASON_MAX; j++)
+			qdf_debugfs_printf(file, " %u",
+					   sw_ft_entry->flush_reason_cnt[j]);
+		for (j = 0; j < DP_FISA_FLUSH_LAT_HIST_MAX; j++)
+			qdf_debugfs_printf(file, "%s%u", j ? "/" : " ",
+					   sw_ft_entry->flush_lat_hist[j]);
+		qdf_debugfs_printf(file, "\n");
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * dp_rx_fst_debugfs_init() - Create the FISA debugfs directory and table
+ * @fst: FISA context
+ *
+ * Return: None
+ */
+static void dp_rx_fst_debugfs_init(struct dp_rx_fst *fst)
+{
+	fst->flow_stats_fops.show = dp_rx_fisa_flow_stats_show;
+	fst->flow_stats_fops.priv = fst;
+
+	fst->debugfs_dir = qdf_debugfs_create_dir("fisa", NULL);
+	if (!fst->debugfs_dir) {
+		dp_err("failed to create fisa debugfs dir");
+		return;
+	}
+
+	if (!qdf_debugfs_create_file_simplified("flow_stats",
+						QDF_FILE_USR_READ,
+						fst->debugfs_dir,
+						&fst->flow_stats_fops))
+		dp_err("failed to create fisa flow_stats debugfs entry");
+}
+
+/**
+ * dp_rx_fst_debugfs_deinit() - Remove the FISA debugfs directory
+ * @fst: FISA context
+ *
+ * Return: None
+ */
+static void dp_rx_fst_debugfs_deinit(struct dp_rx_fst *fst)
+{
+	if (!fst->debugfs_dir)
+		return;
+
+	qdf_debugfs_remove_dir_recursive(fst->debugfs_dir);
+	fst->debugfs_dir = NULL;
+}
+#else
+static inline void dp_rx_fst_debugfs_init(struct dp_rx_fst *fst)
+{
+}
+
+static inline void dp_rx_fst_debugfs_deinit(struct dp_rx_fst *fst)
+{
+}
+#endif /* WLAN_DEBUGFS */
+
 /**
  * dp_rx_flow_send_htt_operation_cmd() - Invalidate FSE cache on FT change
  * @pdev: handle to DP pdev
@@ -307,8 +422,10 @@ QDF_STATUS dp_rx_fst_attach(struct dp_soc *soc, struct dp_pdev *pdev)
 
 	ft_entry = (struct dp_fisa_rx_sw_ft *)fst->base;
 
-	for (i = 0; i < fst->max_entries; i++)
+	for (i = 0; i < fst->max_entries; i++) {
+		qdf_seqcount_init(&ft_entry[i].seq);
 		ft_entry[i].napi_id = INVALID_NAPI;
+	}
 
 	status = dp_rx_sw_ft_hist_init(ft_entry, fst->max_entries,
 				       soc->rx_pkt_tlv_size);
@@ -345,6 +462,7 @@ QDF_STATUS dp_rx_fst_attach(struct dp_soc *soc, struct dp_pdev *pdev)
 	soc->rx_fst = fst;
 	soc->fisa_enable = true;
 	qdf_atomic_init(&soc->skip_fisa_param.skip_fisa);
+	dp_rx_fst_debugfs_init(fst);
 
 	QDF_TRACE(QDF_MODULE_ID_ANY, QDF_TRACE_LEVEL_ERROR,
 		  "Rx FST attach successful, #entries:%d\n",
@@ -447,6 +565,7 @@ void dp_rx_fst_detach(struct dp_soc *soc, struct dp_pdev *pdev)
 
 	dp_fst = soc->rx_fst;
 	if (qdf_likely(dp_fst)) {
+		dp_rx_fst_debugfs_deinit(dp_fst);
 		qdf_timer_sync_cancel(&dp_fst->fse_cache_flush_timer);
 		if (dp_fst->fst_in_cmem)
 			dp_rx_fst_cmem_deinit(dp_fst);
@@ -116,6 +116,31 @@ ol_txrx_soc_handle dp_rx_tm_get_soc_handle(struct dp_rx_tm_handle_cmn *rx_tm_han
 	return soc;
 }
 
+#ifdef DP_RX_THREAD_WORK_STEALING
+/**
+ * dp_rx_tm_thread_dump_ws_stats() - display work stealing stats of a rx_thread
+ * @rx_thread - rx_thread pointer for which the stats need to be displayed
+ *
+ * Returns: None
+ */
+static void dp_rx_tm_thread_dump_ws_stats(struct dp_rx_thread *rx_thread)
+{
+	dp_info("thread:%u - qlen:%u max_len:%u steal(attempts:%u lists:%u nbufs:%u) lists_lost:%u routed:%u",
+		rx_thread->id,
+		qdf_nbuf_queue_head_qlen(&rx_thread->nbuf_queue),
+		rx_thread->stats.nbufq_max_len,
+		rx_thread->stats.ws_steal_attempts,
+		rx_thread->stats.ws_lists_stolen,
+		rx_thread->stats.ws_nbuf_stolen,
+		rx_thread->stats.ws_lists_lost,
+		rx_thread->stats.ws_nbuf_routed);
+}
+#else
+static inline void dp_rx_tm_thread_dump_ws_stats(struct dp_rx_thread *rx_thread)
+{
+}
+#endif
+
 /**
  * dp_rx_tm_thread_dump_stats() - display stats for a rx_thread
  * @rx_thread - rx_thread pointer for which the stats need to be
@@ -146,6 +171,8 @@ static void dp_rx_tm_thread_dump_stats(struct dp_rx_thread *rx_thread)
 				     "reo[%u]:%u ", reo_ring_num, temp);
 	}
 
+	dp_rx_tm_thread_dump_ws_stats(rx_thread);
+
 	if (!total_queued)
 		return;
 
@@ -256,6 +283,227 @@ QDF_STATUS dp_check_and_update_pending(struct dp_rx_tm_handle_cmn
 }
 #endif
 
+#ifdef DP_RX_THREAD_WORK_STEALING
+/**
+ * dp_rx_tm_ws_flow_token() - get the flow ownership token index of a nbuf
+ * @nbuf: rx nbuf
+ *
+ * Return: index of the flow ownership token
+ */
+static inline uint16_t dp_rx_tm_ws_flow_token(qdf_nbuf_t nbuf)
+{
+	return QDF_NBUF_CB_RX_FLOW_ID(nbuf) & (DP_RX_TM_WS_FLOW_TOKENS - 1);
+}
+
+/**
+ * dp_rx_tm_ws_token_get() - take a packet reference on a flow token
+ * @token: flow token of the packet
+ * @thread_id: id of the rx_thread taking the flows if no one owns them
+ *
+ * A steal moving the token is waited out, so the packet is queued to the
+ * owner the steal settles on.
+ *
+ * Return: id of the rx_thread owning the flows
+ */
+static inline uint8_t dp_rx_tm_ws_token_get(struct dp_rx_tm_flow_token *token,
+					    uint8_t thread_id)
+{
+	int32_t state, new_state;
+
+	for (;;) {
+		state = qdf_atomic_read(&token->state);
+		if (qdf_unlikely(state & DP_RX_TM_WS_TOKEN_FROZEN))
+			continue;
+
+		if (state & DP_RX_TM_WS_TOKEN_REFS_MASK)
+			new_state = state + 1;
+		else
+			new_state = (thread_id <<
+				     DP_RX_TM_WS_TOKEN_OWNER_SHIFT) + 1;
+
+		if (qdf_atomic_cmpxchg(&token->state, state, new_state) ==
+		    state)
+			return new_state >> DP_RX_TM_WS_TOKEN_OWNER_SHIFT;
+	}
+}
+
+/**
+ * dp_rx_tm_ws_token_put() - drop packet references on a flow token
+ * @token: flow token of the packets
+ * @num: number of packets
+ *
+ * Return: None
+ */
+static inline void dp_rx_tm_ws_token_put(struct dp_rx_tm_flow_token *token,
+					 uint32_t num)
+{
+	qdf_atomic_sub(num, &token->state);
+}
+
+/**
+ * dp_rx_tm_ws_token_move() - move the flow tokens of a queued nbuf list
+ * @ws: work stealing state of the rx_threads
+ * @idx: distinct flow token indices of the nbuf list
+ * @num: number of packets of the nbuf list per flow token
+ * @num_flows: number of entries in @idx and @num
+ * @owner: id of the rx_thread taking the nbuf list
+ *
+ * Each token is frozen first, which only succeeds while the nbuf list
+ * holds all of its references; producers then wait instead of queueing
+ * packets of the flows to either thread. Ownership moves once all tokens
+ * are frozen, otherwise the frozen ones are thawed unchanged.
+ *
+ * Return: true if the tokens now belong to @owner
+ */
+static bool dp_rx_tm_ws_token_move(struct dp_rx_tm_ws *ws, uint16_t *idx,
+				   uint32_t *num, uint8_t num_flows,
+				   uint8_t owner)
+{
+	struct dp_rx_tm_flow_token *token;
+	int32_t state, delta;
+	uint8_t i, j;
+
+	for (i = 0; i < num_flows; i++) {
+		token = &ws->token[idx[i]];
+		state = qdf_atomic_read(&token->state);
+		if ((state & (DP_RX_TM_WS_TOKEN_REFS_MASK |
+			      DP_RX_TM_WS_TOKEN_FROZEN)) != num[i] ||
+		    qdf_atomic_cmpxchg(&token->state, state,
+				       state | DP_RX_TM_WS_TOKEN_FROZEN) !=
+		    state)
+			break;
+	}
+
+	/* packet references may still be dropped, only add deltas */
+	for (j = 0; j < i; j++) {
+		token = &ws->token[idx[j]];
+		delta = -DP_RX_TM_WS_TOKEN_FROZEN;
+		if (i == num_flows) {
+			state = qdf_atomic_read(&token->state);
+			delta += (owner - (state >>
+					   DP_RX_TM_WS_TOKEN_OWNER_SHIFT)) *
+				 (1 << DP_RX_TM_WS_TOKEN_OWNER_SHIFT);
+		}
+		qdf_atomic_add(delta, &token->state);
+	}
+
+	return i == num_flows;
+}
+
+/**
+ * dp_rx_tm_ws_init() - initialize work stealing state of the rx_threads
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ *
+ * Return: None
+ */
+static void dp_rx_tm_ws_init(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+	struct dp_rx_tm_ws *ws = &rx_tm_hdl->ws;
+	ol_txrx_soc_handle soc;
+
+	soc = dp_rx_tm_get_soc_handle((struct dp_rx_tm_handle_cmn *)rx_tm_hdl);
+
+	qdf_mem_zero(ws->token, sizeof(ws->token));
+	ws->gro_enabled = !!cdp_cfg_get(soc, cfg_dp_gro_enable);
+}
+
+/**
+ * dp_rx_tm_ws_release_list() - release the flow tokens held by a nbuf list
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @nbuf_list: nbuf list linked through ->next which is being dropped
+ *
+ * Return: None
+ */
+static void dp_rx_tm_ws_release_list(struct dp_rx_tm_handle *rx_tm_hdl,
+				     qdf_nbuf_t nbuf_list)
+{
+	qdf_nbuf_t nbuf;
+
+	for (nbuf = nbuf_list; nbuf; nbuf = qdf_nbuf_next(nbuf))
+		dp_rx_tm_ws_token_put(&rx_tm_hdl->ws.token[
+					dp_rx_tm_ws_flow_token(nbuf)], 1);
+}
+
+/**
+ * dp_rx_thread_ws_account() - account packets delivered by a rx_thread
+ * @rx_thread: rx_thread delivering the nbuf list
+ * @nbuf_list: nbuf list linked through ->next
+ *
+ * The flow tokens of delivered packets stay held until the thread has
+ * flushed GRO and calls dp_rx_thread_ws_release().
+ *
+ * Return: None
+ */
+static void dp_rx_thread_ws_account(struct dp_rx_thread *rx_thread,
+				    qdf_nbuf_t nbuf_list)
+{
+	qdf_nbuf_t nbuf;
+	uint16_t idx;
+
+	for (nbuf = nbuf_list; nbuf; nbuf = qdf_nbuf_next(nbuf)) {
+		idx = dp_rx_tm_ws_flow_token(nbuf);
+		if (!rx_thread->ws_pend[idx]++)
+			rx_thread->ws_pend_list[rx_thread->ws_pend_num++] = idx;
+	}
+}
+
+/**
+ * dp_rx_thread_ws_release() - release the flow tokens of delivered packets
+ * @rx_thread: rx_thread which has delivered and GRO flushed the packets
+ *
+ * Return: None
+ */
+static void dp_rx_thread_ws_release(struct dp_rx_thread *rx_thread)
+{
+	struct dp_rx_tm_handle *rx_tm_hdl =
+			(struct dp_rx_tm_handle *)rx_thread->rtm_handle_cmn;
+	uint16_t i, idx;
+
+	if (!rx_thread->ws_pend_num)
+		return;
+
+	for (i = 0; i < rx_thread->ws_pend_num; i++) {
+		idx = rx_thread->ws_pend_list[i];
+		dp_rx_tm_ws_token_put(&rx_tm_hdl->ws.token[idx],
+				      rx_thread->ws_pend[idx]);
+		rx_thread->ws_pend[idx] = 0;
+	}
+
+	rx_thread->ws_pend_num = 0;
+}
+
+/**
+ * dp_rx_thread_ws_release_req() - check if a sibling waits for the flows
+ *				   held by a rx_thread
+ * @rx_thread: rx_thread processing its nbuf queue
+ *
+ * Return: true if the thread should release its flow tokens
+ */
+static inline bool dp_rx_thread_ws_release_req(struct dp_rx_thread *rx_thread)
+{
+	return qdf_atomic_read(&rx_thread->ws_release_req);
+}
+#else
+static inline void dp_rx_tm_ws_init(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+}
+
+static inline void dp_rx_tm_ws_release_list(struct dp_rx_tm_handle *rx_tm_hdl,
+					    qdf_nbuf_t nbuf_list)
+{
+}
+
+static inline void dp_rx_thread_ws_account(struct dp_rx_thread *rx_thread,
+					   qdf_nbuf_t nbuf_list)
+{
+}
+
+static inline bool dp_rx_thread_ws_release_req(struct dp_rx_thread *rx_thread)
+{
+	return false;
+}
+#endif /* DP_RX_THREAD_WORK_STEALING */
+
 /**
  * dp_rx_tm_thread_enqueue() - enqueue nbuf list into rx_thread
  * @rx_thread - rx_thread in which the nbuf needs to be queued
@@ -304,6 +552,8 @@ static QDF_STATUS dp_rx_tm_thread_enqueue(struct dp_rx_thread *rx_thread,
 	allow_dropping = qdf_atomic_read(
 		&((struct dp_rx_tm_handle *)tm_handle_cmn)->allow_dropping);
 	if (unlikely(allow_dropping)) {
+		dp_rx_tm_ws_release_list((struct dp_rx_tm_handle *)tm_handle_cmn,
+					 nbuf_list);
 		qdf_nbuf_list_free(nbuf_list);
 		rx_thread->stats.dropped_enq_fail += num_elements_in_nbuf;
 		nbuf_queued = 0;
@@ -453,6 +703,46 @@ static inline bool dp_rx_thread_should_yield(struct dp_rx_thread *rx_thread,
 }
 #endif
 
+/**
+ * dp_rx_thread_deliver_nbuf_list() - send a dequeued nbuf list to the stack
+ * @rx_thread - rx_thread delivering the nbuf list
+ * @soc - ol_txrx_soc_handle object
+ * @nbuf_list - nbuf list linked through ->next
+ *
+ * Returns: number of packets in the nbuf list
+ */
+static uint32_t dp_rx_thread_deliver_nbuf_list(struct dp_rx_thread *rx_thread,
+					       ol_txrx_soc_handle soc,
+					       qdf_nbuf_t nbuf_list)
+{
+	uint8_t vdev_id;
+	ol_txrx_rx_fp stack_fn;
+	ol_osif_vdev_handle osif_vdev;
+	uint32_t num_list_elements;
+
+	num_list_elements = QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(nbuf_list);
+	/* count aggregated RX frame into stats */
+	num_list_elements += qdf_nbuf_get_gso_segs(nbuf_list);
+	rx_thread->stats.nbuf_dequeued += num_list_elements;
+
+	dp_rx_thread_ws_account(rx_thread, nbuf_list);
+
+	vdev_id = QDF_NBUF_CB_RX_VDEV_ID(nbuf_list);
+	cdp_get_os_rx_handles_from_vdev(soc, vdev_id, &stack_fn, &osif_vdev);
+	dp_debug("rx_thread %pK sending packet %pK to stack",
+		 rx_thread, nbuf_list);
+	if (!stack_fn || !osif_vdev ||
+	    QDF_STATUS_SUCCESS != stack_fn(osif_vdev, nbuf_list)) {
+		rx_thread->stats.dropped_invalid_os_rx_handles +=
+						num_list_elements;
+		qdf_nbuf_list_free(nbuf_list);
+	} else {
+		rx_thread->stats.nbuf_sent_to_stack += num_list_elements;
+	}
+
+	return num_list_elements;
+}
+
 /**
  * dp_rx_thread_process_nbufq() - process nbuf queue of a thread
  * @rx_thread - rx_thread whose nbuf queue needs to be processed
@@ -462,11 +752,7 @@ static inline bool dp_rx_thread_should_yield(struct dp_rx_thread *rx_thread,
 static int dp_rx_thread_process_nbufq(struct dp_rx_thread *rx_thread)
 {
 	qdf_nbuf_t nbuf_list;
-	uint8_t vdev_id;
-	ol_txrx_rx_fp stack_fn;
-	ol_osif_vdev_handle osif_vdev;
 	ol_txrx_soc_handle soc;
-	uint32_t num_list_elements = 0;
 	uint32_t iterates = 0;
 
 	struct dp_txrx_handle_cmn *txrx_handle_cmn;
@@ -486,32 +772,16 @@ static int dp_rx_thread_process_nbufq(struct dp_rx_thread *rx_thread)
 
 	nbuf_list = dp_rx_tm_thread_dequeue(rx_thread);
 	while (nbuf_list) {
-		num_list_elements =
-			QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(nbuf_list);
-		/* count aggregated RX frame into stats */
-		num_list_elements += qdf_nbuf_get_gso_segs(nbuf_list);
-		rx_thread->stats.nbuf_dequeued += num_list_elements;
-		iterates += num_list_elements;
-
-		vdev_id = QDF_NBUF_CB_RX_VDEV_ID(nbuf_list);
-		cdp_get_os_rx_handles_from_vdev(soc, vdev_id, &stack_fn,
-						&osif_vdev);
-		dp_debug("rx_thread %pK sending packet %pK to stack",
-			 rx_thread, nbuf_list);
-		if (!stack_fn || !osif_vdev ||
-		    QDF_STATUS_SUCCESS != stack_fn(osif_vdev, nbuf_list)) {
-			rx_thread->stats.dropped_invalid_os_rx_handles +=
-							num_list_elements;
-			qdf_nbuf_list_free(nbuf_list);
-		} else {
-			rx_thread->stats.nbuf_sent_to_stack +=
-							num_list_elements;
-		}
+		iterates += dp_rx_thread_deliver_nbuf_list(rx_thread, soc,
+							   nbuf_list);
 		if (qdf_unlikely(dp_rx_thread_should_yield(rx_thread,
 							   iterates))) {
 			rx_thread->stats.rx_nbufq_loop_yield++;
 			break;
 		}
+		/* a sibling waits for the flows this thread holds */
+		if (qdf_unlikely(dp_rx_thread_ws_release_req(rx_thread)))
+			break;
 		nbuf_list = dp_rx_tm_thread_dequeue(rx_thread);
 	}
 
@@ -558,6 +828,229 @@ dp_rx_should_flush(struct dp_rx_thread *rx_thread)
 	return gro_flush_code;
 }
 
+#ifdef DP_RX_THREAD_WORK_STEALING
+/**
+ * dp_rx_tm_ws_kick() - wake an idle sibling of a backlogged rx_thread
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @thread_id: id of the rx_thread which may be backlogged
+ *
+ * Return: None
+ */
+static void dp_rx_tm_ws_kick(struct dp_rx_tm_handle *rx_tm_hdl,
+			     uint8_t thread_id)
+{
+	struct dp_rx_thread *rx_thread;
+	uint8_t i;
+
+	rx_thread = rx_tm_hdl->rx_thread[thread_id];
+	if (qdf_nbuf_queue_head_qlen(&rx_thread->nbuf_queue) <
+	    DP_RX_TM_WS_MIN_QLEN)
+		return;
+
+	for (i = 1; i < rx_tm_hdl->num_dp_rx_threads; i++) {
+		rx_thread = rx_tm_hdl->rx_thread[(thread_id + i) %
+						 rx_tm_hdl->num_dp_rx_threads];
+		if (!rx_thread ||
+		    qdf_nbuf_queue_head_qlen(&rx_thread->nbuf_queue))
+			continue;
+		/* already posted, it will look for work before sleeping */
+		if (qdf_atomic_test_and_set_bit(RX_POST_EVENT,
+						&rx_thread->event_flag))
+			continue;
+		qdf_wake_up_interruptible(&rx_thread->wait_q);
+		break;
+	}
+}
+
+/**
+ * dp_rx_tm_ws_list_flows() - get the flow tokens used by a queued nbuf list
+ * @head: nbuf list as stored in the rx_thread nbuf queue
+ * @idx: filled with the distinct flow token indices
+ * @num: filled with the number of packets per flow token
+ *
+ * Return: number of distinct flow tokens, 0 if the list has more than
+ *	   DP_RX_TM_WS_LIST_FLOWS of them
+ */
+static uint8_t dp_rx_tm_ws_list_flows(qdf_nbuf_t head, uint16_t *idx,
+				      uint32_t *num)
+{
+	qdf_nbuf_t nbuf = head;
+	uint8_t num_flows = 0;
+	uint16_t token;
+	uint8_t i;
+
+	while (nbuf) {
+		token = dp_rx_tm_ws_flow_token(nbuf);
+		i = 0;
+		while (i < num_flows && idx[i] != token)
+			i++;
+		if (i == num_flows) {
+			if (num_flows == DP_RX_TM_WS_LIST_FLOWS)
+				return 0;
+			idx[num_flows] = token;
+			num[num_flows++] = 0;
+		}
+		num[i]++;
+
+		/* rest of the list is kept in the ext list of the head */
+		if (nbuf != head)
+			nbuf = qdf_nbuf_next(nbuf);
+		else if (QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(head) > 1)
+			nbuf = qdf_nbuf_get_ext_list(head);
+		else
+			nbuf = NULL;
+	}
+
+	return num_flows;
+}
+
+/**
+ * dp_rx_thread_ws_steal() - steal queued nbuf lists from the busiest sibling
+ * @rx_thread: idle rx_thread looking for work
+ *
+ * A queued nbuf list is taken only if it holds every reference of each of
+ * its flow tokens, i.e. no earlier packet of those flows is queued, being
+ * delivered or held in GRO by the owner. Ownership of the tokens moves to
+ * @rx_thread, so later packets of the flows are queued behind the stolen
+ * ones. If nothing can be taken the sibling is asked to release its flows.
+ *
+ * Return: stolen nbuf lists linked through ->next, NULL if none
+ */
+static qdf_nbuf_t dp_rx_thread_ws_steal(struct dp_rx_thread *rx_thread)
+{
+	struct dp_rx_tm_handle *rx_tm_hdl =
+			(struct dp_rx_tm_handle *)rx_thread->rtm_handle_cmn;
+	struct dp_rx_tm_ws *ws = &rx_tm_hdl->ws;
+	struct dp_rx_thread *victim = NULL, *sibling;
+	qdf_nbuf_t nbuf_list, tmp_nbuf_list;
+	qdf_nbuf_t stolen_head = NULL, stolen_tail = NULL;
+	uint16_t idx[DP_RX_TM_WS_LIST_FLOWS];
+	uint32_t num[DP_RX_TM_WS_LIST_FLOWS];
+	uint32_t qlen, max_qlen = DP_RX_TM_WS_MIN_QLEN - 1;
+	uint8_t num_flows, scanned = 0, stolen = 0;
+	uint8_t i;
+
+	for (i = 0; i < rx_tm_hdl->num_dp_rx_threads; i++) {
+		sibling = rx_tm_hdl->rx_thread[i];
+		if (!sibling || sibling == rx_thread)
+			continue;
+		qlen = qdf_nbuf_queue_head_qlen(&sibling->nbuf_queue);
+		if (qlen > max_qlen) {
+			max_qlen = qlen;
+			victim = sibling;
+		}
+	}
+
+	if (!victim ||
+	    qdf_atomic_test_bit(RX_VDEV_DEL_EVENT, &victim->event_flag))
+		return NULL;
+
+	rx_thread->stats.ws_steal_attempts++;
+
+	/* the queue lock also keeps other thieves off the victim */
+	qdf_nbuf_queue_head_lock(&victim->nbuf_queue);
+	QDF_NBUF_QUEUE_WALK_SAFE(&victim->nbuf_queue, nbuf_list,
+				 tmp_nbuf_list) {
+		if (scanned++ == DP_RX_TM_WS_SCAN_MAX)
+			break;
+
+		num_flows = dp_rx_tm_ws_list_flows(nbuf_list, idx, num);
+		if (!num_flows ||
+		    !dp_rx_tm_ws_token_move(ws, idx, num, num_flows,
+					    rx_thread->id))
+			continue;
+
+		qdf_nbuf_unlink_no_lock(nbuf_list, &victim->nbuf_queue);
+		if (!stolen_head)
+			stolen_head = nbuf_list;
+		else
+			qdf_nbuf_set_next(stolen_tail, nbuf_list);
+		stolen_tail = nbuf_list;
+
+		if (++stolen == DP_RX_TM_WS_STEAL_MAX)
+			break;
+	}
+	qdf_nbuf_queue_head_unlock(&victim->nbuf_queue);
+
+	if (!stolen) {
+		qdf_atomic_set(&victim->ws_release_req, 1);
+		return NULL;
+	}
+
+	victim->stats.ws_lists_lost += stolen;
+	rx_thread->stats.ws_lists_stolen += stolen;
+
+	return stolen_head;
+}
+
+/**
+ * dp_rx_thread_ws_process() - release flows and steal work for a rx_thread
+ * @rx_thread: rx_thread which has processed its nbuf queue
+ *
+ * Flow tokens of delivered packets are released, after a GRO flush, once
+ * the thread has drained its queue or a sibling has asked for them. A
+ * drained thread then steals queued nbuf lists from the busiest sibling
+ * and delivers them through its own GRO context.
+ *
+ * Return: None
+ */
+static void dp_rx_thread_ws_process(struct dp_rx_thread *rx_thread)
+{
+	struct dp_rx_tm_handle *rx_tm_hdl =
+			(struct dp_rx_tm_handle *)rx_thread->rtm_handle_cmn;
+	qdf_nbuf_t stolen = NULL, nbuf_list, nbuf;
+	ol_txrx_soc_handle soc;
+	bool drained;
+
+	drained = !qdf_nbuf_queue_head_qlen(&rx_thread->nbuf_queue);
+	if (!drained && !dp_rx_thread_ws_release_req(rx_thread))
+		return;
+
+	if (drained &&
+	    !qdf_atomic_test_bit(RX_SHUTDOWN_EVENT, &rx_thread->event_flag) &&
+	    !qdf_atomic_test_bit(RX_SUSPEND_EVENT, &rx_thread->event_flag) &&
+	    !qdf_atomic_test_bit(RX_VDEV_DEL_EVENT, &rx_thread->event_flag))
+		stolen = dp_rx_thread_ws_steal(rx_thread);
+
+	/* keep looking for work while siblings are backlogged */
+	if (stolen)
+		qdf_set_bit(RX_POST_EVENT, &rx_thread->event_flag);
+
+	soc = dp_rx_tm_get_soc_handle(rx_thread->rtm_handle_cmn);
+	while (stolen) {
+		nbuf_list = stolen;
+		stolen = qdf_nbuf_queue_next(stolen);
+		qdf_nbuf_set_next(nbuf_list, NULL);
+		dp_rx_thread_adjust_nbuf_list(nbuf_list);
+
+		/* deliver through the GRO context of this thread */
+		for (nbuf = nbuf_list; nbuf; nbuf = qdf_nbuf_next(nbuf))
+			QDF_NBUF_CB_RX_CTX_ID(nbuf) = rx_thread->id;
+
+		rx_thread->stats.ws_nbuf_stolen +=
+			dp_rx_thread_deliver_nbuf_list(rx_thread, soc,
+						       nbuf_list);
+	}
+
+	qdf_atomic_set(&rx_thread->ws_release_req, 0);
+	if (!rx_thread->ws_pend_num)
+		return;
+
+	if (rx_tm_hdl->ws.gro_enabled)
+		dp_rx_thread_gro_flush(rx_thread, DP_RX_GRO_NORMAL_FLUSH);
+	dp_rx_thread_ws_release(rx_thread);
+
+	if (!drained) {
+		qdf_set_bit(RX_POST_EVENT, &rx_thread->event_flag);
+		dp_rx_tm_ws_kick(rx_tm_hdl, rx_thread->id);
+	}
+}
+#else
+static inline void dp_rx_thread_ws_process(struct dp_rx_thread *rx_thread)
+{
+}
+#endif /* DP_RX_THREAD_WORK_STEALING */
+
 /**
  * dp_rx_thread_sub_loop() - rx thread subloop
  * @rx_thread - rx_thread to be processed
@@ -589,6 +1082,7 @@ static int dp_rx_thread_sub_loop(struct dp_rx_thread *rx_thread, bool *shutdown)
 		}
 
 		dp_rx_thread_process_nbufq(rx_thread);
+		dp_rx_thread_ws_process(rx_thread);
 
 		gro_flush_code = dp_rx_should_flush(rx_thread);
 		/* Only flush when gro_flush_code is either
@@ -830,6 +1324,9 @@ static QDF_STATUS dp_rx_tm_thread_init(struct dp_rx_thread *rx_thread,
 	qdf_event_create(&rx_thread->shutdown_event);
 	qdf_event_create(&rx_thread->vdev_del_event);
 	qdf_atomic_init(&rx_thread->gro_flush_ind);
+#ifdef DP_RX_THREAD_WORK_STEALING
+	qdf_atomic_init(&rx_thread->ws_release_req);
+#endif
 	qdf_init_waitqueue_head(&rx_thread->wait_q);
 	qdf_scnprintf(thread_name, sizeof(thread_name), "dp_rx_thread_%u", id);
 	dp_info("%s %u", thread_name, id);
@@ -947,6 +1444,7 @@ QDF_STATUS dp_rx_tm_init(struct dp_rx_tm_handle *rx_tm_hdl,
 
 	rx_tm_hdl->num_dp_rx_threads = num_dp_rx_threads;
 	rx_tm_hdl->state = DP_RX_THREADS_INVALID;
+	dp_rx_tm_ws_init(rx_tm_hdl);
 
 	dp_info("initializing %u threads", num_dp_rx_threads);
 
@@ -1131,6 +1629,9 @@ QDF_STATUS dp_rx_thread_flush_by_vdev_id(struct dp_rx_thread *rx_thread,
 		num_list_elements =
 			QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(nbuf_list_head);
 		rx_thread->stats.rx_flushed += num_list_elements;
+		dp_rx_tm_ws_release_list((struct dp_rx_tm_handle *)
+					 rx_thread->rtm_handle_cmn,
+					 nbuf_list_head);
 		qdf_nbuf_list_free(nbuf_list_head);
 		nbuf_list_head = nbuf_list_next;
 	}
@@ -1371,6 +1872,61 @@ static uint8_t dp_rx_tm_select_thread(struct dp_rx_tm_handle *rx_tm_hdl,
 	return selected_rx_thread;
 }
 
+#ifdef DP_RX_THREAD_WORK_STEALING
+/**
+ * dp_rx_tm_ws_enqueue() - enqueue nbuf list to the rx_threads owning its flows
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @thread_id: id of the rx_thread serving the REO ring of the nbuf list
+ * @nbuf_list: list of packets to be queued
+ *
+ * Packets of a flow whose token is held by a rx_thread are queued to that
+ * thread, so a flow taken over by a sibling stays in order. Packets of
+ * other flows go to @thread_id which then owns them. The RX context id of
+ * re-routed packets is rewritten so that they are delivered through the
+ * GRO context of the thread processing them. An idle sibling is woken if
+ * @thread_id is backlogged.
+ *
+ * Return: None
+ */
+static void dp_rx_tm_ws_enqueue(struct dp_rx_tm_handle *rx_tm_hdl,
+				uint8_t thread_id, qdf_nbuf_t nbuf_list)
+{
+	qdf_nbuf_t head[DP_MAX_RX_THREADS] = { NULL };
+	qdf_nbuf_t tail[DP_MAX_RX_THREADS] = { NULL };
+	struct dp_rx_tm_flow_token *token;
+	qdf_nbuf_t nbuf, next;
+	uint8_t owner;
+	uint8_t i;
+
+	for (nbuf = nbuf_list; nbuf; nbuf = next) {
+		next = qdf_nbuf_next(nbuf);
+		token = &rx_tm_hdl->ws.token[dp_rx_tm_ws_flow_token(nbuf)];
+		owner = dp_rx_tm_ws_token_get(token, thread_id);
+		DP_RX_LIST_APPEND(head[owner], tail[owner], nbuf);
+	}
+
+	for (i = 0; i < rx_tm_hdl->num_dp_rx_threads; i++) {
+		if (!head[i])
+			continue;
+		if (i != thread_id) {
+			for (nbuf = head[i]; nbuf; nbuf = qdf_nbuf_next(nbuf))
+				QDF_NBUF_CB_RX_CTX_ID(nbuf) = i;
+			rx_tm_hdl->rx_thread[i]->stats.ws_nbuf_routed +=
+				QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(head[i]);
+		}
+		dp_rx_tm_thread_enqueue(rx_tm_hdl->rx_thread[i], head[i]);
+	}
+
+	dp_rx_tm_ws_kick(rx_tm_hdl, thread_id);
+}
+#else
+static inline void dp_rx_tm_ws_enqueue(struct dp_rx_tm_handle *rx_tm_hdl,
+				       uint8_t thread_id, qdf_nbuf_t nbuf_list)
+{
+	dp_rx_tm_thread_enqueue(rx_tm_hdl->rx_thread[thread_id], nbuf_list);
+}
+#endif /* DP_RX_THREAD_WORK_STEALING */
+
 QDF_STATUS dp_rx_tm_enqueue_pkt(struct dp_rx_tm_handle *rx_tm_hdl,
 				qdf_nbuf_t nbuf_list)
 {
@@ -1379,8 +1935,7 @@ QDF_STATUS dp_rx_tm_enqueue_pkt(struct dp_rx_tm_handle *rx_tm_hdl,
 	selected_thread_id =
 		dp_rx_tm_select_thread(rx_tm_hdl,
 				       QDF_NBUF_CB_RX_CTX_ID(nbuf_list));
-	dp_rx_tm_thread_enqueue(rx_tm_hdl->rx_thread[selected_thread_id],
-				nbuf_list);
+	dp_rx_tm_ws_enqueue(rx_tm_hdl, selected_thread_id, nbuf_list);
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -31,6 +31,23 @@
 /* Number of DP RX threads supported */
 #define DP_MAX_RX_THREADS WLAN_CFG_NUM_REO_DEST_RING
 
+#ifdef DP_RX_THREAD_WORK_STEALING
+/* Number of flow ownership tokens, must be a power of 2 */
+#define DP_RX_TM_WS_FLOW_TOKENS 256
+/* Min nbuf_lists queued on a thread before its siblings may steal */
+#define DP_RX_TM_WS_MIN_QLEN 4
+/* Max queued nbuf_lists inspected per steal attempt */
+#define DP_RX_TM_WS_SCAN_MAX 8
+/* Max nbuf_lists taken per steal attempt */
+#define DP_RX_TM_WS_STEAL_MAX 4
+/* Max distinct flow tokens in a nbuf_list for it to be stolen */
+#define DP_RX_TM_WS_LIST_FLOWS 8
+/* Flow token state: packet count, steal in progress flag and owner id */
+#define DP_RX_TM_WS_TOKEN_REFS_MASK 0x7fffff
+#define DP_RX_TM_WS_TOKEN_FROZEN 0x800000
+#define DP_RX_TM_WS_TOKEN_OWNER_SHIFT 24
+#endif
+
 /*
  * struct dp_rx_tm_handle_cmn - Opaque handle for rx_threads to store
  * rx_tm_handle. This handle will be common for all the threads.
@@ -55,6 +72,12 @@ struct dp_rx_tm_handle_cmn;
  * @dropped_others: packets dropped due to other reasons
  * @dropped_enq_fail: packets dropped due to pending queue full
  * @rx_nbufq_loop_yield: rx loop yield counter
+ * @ws_steal_attempts: number of times the thread looked for work to steal
+ * @ws_lists_stolen: nbuf_lists stolen by the thread from its siblings
+ * @ws_nbuf_stolen: packets stolen by the thread from its siblings
+ * @ws_lists_lost: nbuf_lists stolen from the thread by its siblings
+ * @ws_nbuf_routed: packets queued to the thread, instead of the thread
+ *		    owning their REO ring, as it owns their flow
  */
 struct dp_rx_thread_stats {
 	unsigned int nbuf_queued[DP_RX_TM_MAX_REO_RINGS];
@@ -71,6 +94,13 @@ struct dp_rx_thread_stats {
 	unsigned int dropped_others;
 	unsigned int dropped_enq_fail;
 	unsigned int rx_nbufq_loop_yield;
+#ifdef DP_RX_THREAD_WORK_STEALING
+	unsigned int ws_steal_attempts;
+	unsigned int ws_lists_stolen;
+	unsigned int ws_nbuf_stolen;
+	unsigned int ws_lists_lost;
+	unsigned int ws_nbuf_routed;
+#endif
 };
 
 /**
@@ -107,6 +137,11 @@ enum dp_rx_refill_thread_state {
  *		    structures via APIs.
  * @napi: napi to deliver packet to stack via GRO
  * @netdev: dummy netdev to initialize the napi structure with
+ * @ws_pend: per flow token count of packets delivered by the thread whose
+ *	     ownership is yet to be released
+ * @ws_pend_list: flow tokens with a non zero ws_pend count
+ * @ws_pend_num: number of valid entries in ws_pend_list
+ * @ws_release_req: a sibling waits for the thread to release its flows
  */
 struct dp_rx_thread {
 	uint8_t id;
@@ -125,6 +160,12 @@ struct dp_rx_thread {
 	struct napi_struct napi;
 	qdf_wait_queue_head_t wait_q;
 	struct net_device netdev;
+#ifdef DP_RX_THREAD_WORK_STEALING
+	uint32_t ws_pend[DP_RX_TM_WS_FLOW_TOKENS];
+	uint16_t ws_pend_list[DP_RX_TM_WS_FLOW_TOKENS];
+	uint16_t ws_pend_num;
+	qdf_atomic_t ws_release_req;
+#endif
 };
 
 /**
@@ -153,6 +194,33 @@ struct dp_rx_refill_thread {
 	enum dp_rx_refill_thread_state state;
 };
 
+#ifdef DP_RX_THREAD_WORK_STEALING
+/**
+ * struct dp_rx_tm_flow_token - ownership token of a group of rx flows
+ * @state: number of packets of the flows queued, being delivered or held
+ *	   in GRO (DP_RX_TM_WS_TOKEN_REFS_MASK), DP_RX_TM_WS_TOKEN_FROZEN
+ *	   while a steal moves the token, and the id of the rx_thread owning
+ *	   the flows while the packet count is non zero, from bit
+ *	   DP_RX_TM_WS_TOKEN_OWNER_SHIFT
+ *
+ * The state is a single atomic, so producers take packet references
+ * without a lock.
+ */
+struct dp_rx_tm_flow_token {
+	qdf_atomic_t state;
+};
+
+/**
+ * struct dp_rx_tm_ws - work stealing state shared by all rx_threads
+ * @gro_enabled: rx_threads deliver packets through GRO
+ * @token: flow ownership tokens indexed by rx flow id
+ */
+struct dp_rx_tm_ws {
+	bool gro_enabled;
+	struct dp_rx_tm_flow_token token[DP_RX_TM_WS_FLOW_TOKENS];
+};
+#endif
+
 /**
  * enum dp_rx_thread_state - enum to keep track of the state of the rx threads
  * @DP_RX_THREADS_INVALID: initial invalid state
@@ -175,6 +243,7 @@ enum dp_rx_thread_state {
  * @state: state of the rx_threads. All of them should be in the same state.
  * @rx_thread: array of pointers of type struct dp_rx_thread
  * @allow_dropping: flag to indicate frame dropping is enabled
+ * @ws: flow ownership state for work stealing between the rx_threads
  */
 struct dp_rx_tm_handle {
 	uint8_t num_dp_rx_threads;
@@ -182,6 +251,9 @@ struct dp_rx_tm_handle {
 	enum dp_rx_thread_state state;
 	struct dp_rx_thread **rx_thread;
 	qdf_atomic_t allow_dropping;
+#ifdef DP_RX_THREAD_WORK_STEALING
+	struct dp_rx_tm_ws ws;
+#endif
 };
 
 /**
@@ -90,6 +90,9 @@ dp_swlm_can_tcl_wr_coalesce(struct dp_soc *soc,
 	uint8_t rid = tcl_data->ring_id;
 	struct dp_swlm_params *params = &soc->swlm.params;
 
+	if (!params->tcl[rid].policy.enabled)
+		goto coalescing_fail;
+
 	if (curr_time >= params->tcl[rid].expire_time) {
 		params->tcl[rid].expire_time = qdf_get_log_timestamp_usecs() +
 			      params->sampling_time;
@@ -128,6 +131,150 @@ coalescing_fail:
 	return 1;
 }
 
+/**
+ * dp_swlm_can_reo_wr_coalesce() - To check if current REO destination ring
+ *				   TP register write can be coalesced or not.
+ * @soc: Datapath global soc handle
+ * @reo_data: priv data for REO coalescing
+ *
+ * The TP write is held back while the reaped entries stay below the batch
+ * threshold of the ring and the coalescing session has not expired. The
+ * REO processing loop flushes any held back write before it exits, hence
+ * HW never sees a stale TP once the ring is no longer being serviced.
+ *
+ * Returns: 1 if the current REO TP write is to be coalesced
+ *	    0, if the current REO TP write is to be processed.
+ */
+static int
+dp_swlm_can_reo_wr_coalesce(struct dp_soc *soc,
+			    struct dp_swlm_reo_data *reo_data)
+{
+	struct dp_swlm *swlm = &soc->swlm;
+	uint8_t rid = reo_data->ring_id;
+	struct dp_swlm_reo_params *reo = &swlm->params.reo[rid];
+	u64 curr_time;
+
+	if (!reo->policy.enabled)
+		goto flush;
+
+	/* TP did not move, nothing to be written */
+	if (!reo_data->num_reaped && !reo->coalesce_start_time) {
+		swlm->stats.reo[rid].wr.idle_skipped++;
+		return 1;
+	}
+
+	reo->pending += reo_data->num_reaped;
+	if (reo->pending >= reo->policy.batch_thresh) {
+		DP_STATS_INC(swlm, reo[rid].batch_thresh_reached, 1);
+		goto flush;
+	}
+
+	curr_time = qdf_get_log_timestamp_usecs();
+	if (reo->coalesce_start_time &&
+	    curr_time - reo->coalesce_start_time >=
+	    reo->policy.time_flush_thresh) {
+		DP_STATS_INC(swlm, reo[rid].time_thresh_reached, 1);
+		goto flush;
+	}
+
+	dp_swlm_wr_coalesced(&swlm->stats.reo[rid].wr,
+			     &reo->coalesce_start_time);
+
+	return 1;
+
+flush:
+	dp_swlm_reo_session_end(soc, rid);
+
+	return 0;
+}
+
+/**
+ * dp_swlm_can_refill_wr_coalesce() - To check if current RX refill ring HP
+ *				      register write can be coalesced or not.
+ * @soc: Datapath global soc handle
+ * @refill_data: priv data for refill coalescing
+ *
+ * The HP write is held back only while HW still holds enough buffers to
+ * absorb a burst, the buffers posted since the last write stay below the
+ * batch threshold and the coalescing session has not expired. A flush
+ * timer writes the HP if no further replenish happens.
+ *
+ * Returns: 1 if the current refill HP write is to be coalesced
+ *	    0, if the current refill HP write is to be processed.
+ */
+static int
+dp_swlm_can_refill_wr_coalesce(struct dp_soc *soc,
+			       struct dp_swlm_refill_data *refill_data)
+{
+	struct dp_swlm *swlm = &soc->swlm;
+	uint8_t rid = refill_data->ring_id;
+	struct dp_swlm_refill_params *refill = &swlm->params.refill[rid];
+	uint32_t hw_bufs;
+	u64 curr_time;
+
+	if (!refill->policy.enabled)
+		goto flush;
+
+	/* HP did not move, nothing to be written */
+	if (!refill_data->num_posted && !refill->coalesce_start_time) {
+		swlm->stats.refill[rid].wr.idle_skipped++;
+		return 1;
+	}
+
+	/* buffers posted but not yet written to HP are not visible to HW */
+	hw_bufs = refill_data->num_used > refill->pending ?
+		  refill_data->num_used - refill->pending : 0;
+	if (hw_bufs < refill->policy.low_water_thresh) {
+		DP_STATS_INC(swlm, refill[rid].low_water_hit, 1);
+		goto flush;
+	}
+
+	refill->pending += refill_data->num_posted;
+	if (refill->pending >= refill->policy.batch_thresh) {
+		DP_STATS_INC(swlm, refill[rid].batch_thresh_reached, 1);
+		goto flush;
+	}
+
+	curr_time = qdf_get_log_timestamp_usecs();
+	if (refill->coalesce_start_time &&
+	    curr_time - refill->coalesce_start_time >=
+	    refill->policy.time_flush_thresh) {
+		DP_STATS_INC(swlm, refill[rid].time_thresh_reached, 1);
+		goto flush;
+	}
+
+	dp_swlm_wr_coalesced(&swlm->stats.refill[rid].wr,
+			     &refill->coalesce_start_time);
+	qdf_timer_mod(&refill->flush_timer, 1);
+
+	return 1;
+
+flush:
+	if (refill->coalesce_start_time)
+		qdf_timer_stop(&refill->flush_timer);
+	dp_swlm_wr_issued(&swlm->stats.refill[rid].wr,
+			  &refill->coalesce_start_time);
+	refill->pending = 0;
+
+	return 0;
+}
+
+/**
+ * dp_print_swlm_wr_stats() - Print the register write stats of a ring
+ * @wr: register write stats of the ring
+ *
+ * Returns: none
+ */
+static void dp_print_swlm_wr_stats(struct dp_swlm_wr_stats *wr)
+{
+	dp_info("Reg writes issued: %u coalesced: %u idle skipped: %u",
+		wr->issued, wr->coalesced, wr->idle_skipped);
+	dp_info("Coalesced sessions: %u added latency avg: %llu us max: %u us",
+		wr->sessions,
+		wr->sessions ? qdf_do_div(wr->delay_us_total, wr->sessions) : 0,
+		wr->delay_us_max);
+}
+
 QDF_STATUS dp_print_swlm_stats(struct dp_soc *soc)
 {
 	struct dp_swlm *swlm = &soc->swlm;
@@ -155,6 +302,32 @@ QDF_STATUS dp_print_swlm_stats(struct dp_soc *soc)
 			swlm->stats.tcl[i].time_thresh_reached);
 		dp_info("Coalesce fail (TPUT sampling fail): %d",
 			swlm->stats.tcl[i].tput_criteria_fail);
+		dp_print_swlm_wr_stats(&swlm->stats.tcl[i].wr);
+	}
+
+	for (i = 0; i < soc->num_reo_dest_rings; i++) {
+		dp_info("REO: %u Coalescing stats:", i);
+		dp_info("Coalesce fail (batch thresh crossed): %u",
+			swlm->stats.reo[i].batch_thresh_reached);
+		dp_info("Coalesce fail (time thresh crossed): %u",
+			swlm->stats.reo[i].time_thresh_reached);
+		dp_print_swlm_wr_stats(&swlm->stats.reo[i].wr);
+	}
+
+	for (i = 0; i < MAX_PDEV_CNT; i++) {
+		if (!swlm->stats.refill[i].wr.issued)
+			continue;
+		dp_info("Refill: %u Coalescing stats:", i);
+		dp_info("Timer flush success: %u fail: %u",
+			swlm->stats.refill[i].timer_flush_success,
+			swlm->stats.refill[i].timer_flush_fail);
+		dp_info("Coalesce fail (low water): %u",
+			swlm->stats.refill[i].low_water_hit);
+		dp_info("Coalesce fail (batch thresh crossed): %u",
+			swlm->stats.refill[i].batch_thresh_reached);
+		dp_info("Coalesce fail (time thresh crossed): %u",
+			swlm->stats.refill[i].time_thresh_reached);
+		dp_print_swlm_wr_stats(&swlm->stats.refill[i].wr);
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -162,6 +335,8 @@ QDF_STATUS dp_print_swlm_stats(struct dp_soc *soc)
 
 static struct dp_swlm_ops dp_latency_mgr_ops = {
 	.tcl_wr_coalesce_check = dp_swlm_can_tcl_wr_coalesce,
+	.reo_wr_coalesce_check = dp_swlm_can_reo_wr_coalesce,
+	.refill_wr_coalesce_check = dp_swlm_can_refill_wr_coalesce,
 };
 
 /**
@@ -190,6 +365,8 @@ static void dp_swlm_tcl_flush_timer(void *arg)
 	}
 
 	DP_STATS_INC(swlm, tcl[tcl->ring_id].timer_flush_success, 1);
+	dp_swlm_wr_issued(&swlm->stats.tcl[tcl->ring_id].wr,
+			  &tcl->coalesce_start_time);
 	hal_srng_access_end(soc->hal_soc, hal_ring_hdl);
 	hif_pm_runtime_put(soc->hif_handle, RTPM_ID_DW_TX_HW_ENQUEUE);
 
@@ -224,6 +401,9 @@ static inline QDF_STATUS dp_soc_swlm_tcl_attach(struct dp_soc *soc)
 		swlm->params.tcl[i].soc = soc;
 		swlm->params.tcl[i].ring_id = i;
 		swlm->params.tcl[i].bytes_flush_thresh = 0;
+		swlm->params.tcl[i].policy.enabled = 1;
+		swlm->params.tcl[i].policy.time_flush_thresh =
+					swlm->params.time_flush_thresh;
 		qdf_timer_init(soc->osdev,
 			       &swlm->params.tcl[i].flush_timer,
 			       dp_swlm_tcl_flush_timer,
@@ -251,6 +431,107 @@ static inline QDF_STATUS dp_soc_swlm_tcl_detach(struct dp_swlm *swlm,
 	return QDF_STATUS_SUCCESS;
 }
 
+/**
+ * dp_swlm_refill_flush_timer() - Timer handler for refill register write
+ *				  coalescing
+ * @arg: private data of the timer
+ *
+ * Returns: none
+ */
+static void dp_swlm_refill_flush_timer(void *arg)
+{
+	struct dp_swlm_refill_params *refill = arg;
+	struct dp_soc *soc = refill->soc;
+	struct dp_swlm *swlm = &soc->swlm;
+	hal_ring_handle_t hal_ring_hdl =
+			soc->rx_refill_buf_ring[refill->ring_id].hal_srng;
+
+	/* Replenish in progress will take care of the coalesced write */
+	if (!hal_ring_hdl ||
+	    hal_srng_try_access_start(soc->hal_soc, hal_ring_hdl) < 0) {
+		DP_STATS_INC(swlm, refill[refill->ring_id].timer_flush_fail, 1);
+		return;
+	}
+
+	if (!refill->coalesce_start_time) {
+		hal_srng_access_end_reap(soc->hal_soc, hal_ring_hdl);
+		return;
+	}
+
+	DP_STATS_INC(swlm, refill[refill->ring_id].timer_flush_success, 1);
+	dp_swlm_wr_issued(&swlm->stats.refill[refill->ring_id].wr,
+			  &refill->coalesce_start_time);
+	refill->pending = 0;
+	hal_srng_access_end(soc->hal_soc, hal_ring_hdl);
+}
+
+/**
+ * dp_soc_swlm_rx_attach() - attach the REO destination and RX refill ring
+ *			     resources for the software latency manager.
+ * @soc: Datapath global soc handle
+ *
+ * Returns: QDF_STATUS
+ */
+static inline QDF_STATUS dp_soc_swlm_rx_attach(struct dp_soc *soc)
+{
+	struct wlan_cfg_dp_soc_ctxt *cfg = soc->wlan_cfg_ctx;
+	struct dp_swlm *swlm = &soc->swlm;
+	uint32_t ring_size;
+	int i;
+
+	ring_size = wlan_cfg_get_reo_dst_ring_size(cfg);
+	for (i = 0; i < MAX_REO_DEST_RINGS; i++) {
+		swlm->params.reo[i].policy.enabled = 1;
+		swlm->params.reo[i].policy.batch_thresh =
+				ring_size >> DP_SWLM_REO_BATCH_SHIFT;
+		swlm->params.reo[i].policy.time_flush_thresh =
+				DP_SWLM_REO_TIME_FLUSH_THRESH;
+		swlm->params.reo[i].pending = 0;
+		swlm->params.reo[i].coalesce_start_time = 0;
+	}
+
+	ring_size = wlan_cfg_get_dp_soc_rxdma_refill_ring_size(cfg);
+	for (i = 0; i < MAX_PDEV_CNT; i++) {
+		swlm->params.refill[i].soc = soc;
+		swlm->params.refill[i].ring_id = i;
+		swlm->params.refill[i].policy.enabled = 1;
+		swlm->params.refill[i].policy.batch_thresh =
+				ring_size >> DP_SWLM_REFILL_BATCH_SHIFT;
+		swlm->params.refill[i].policy.low_water_thresh =
+				ring_size >> DP_SWLM_REFILL_LOW_WATER_SHIFT;
+		swlm->params.refill[i].policy.time_flush_thresh =
+				DP_SWLM_REFILL_TIME_FLUSH_THRESH;
+		swlm->params.refill[i].pending = 0;
+		swlm->params.refill[i].coalesce_start_time = 0;
+		qdf_timer_init(soc->osdev,
+			       &swlm->params.refill[i].flush_timer,
+			       dp_swlm_refill_flush_timer,
+			       (void *)&swlm->params.refill[i],
+			       QDF_TIMER_TYPE_WAKE_APPS);
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * dp_soc_swlm_rx_detach() - detach the RX refill ring resources for the
+ *			     software latency manager.
+ * @swlm: SWLM data pointer
+ *
+ * Returns: QDF_STATUS
+ */
+static inline QDF_STATUS dp_soc_swlm_rx_detach(struct dp_swlm *swlm)
+{
+	int i;
+
+	for (i = 0; i < MAX_PDEV_CNT; i++) {
+		qdf_timer_stop(&swlm->params.refill[i].flush_timer);
+		qdf_timer_free(&swlm->params.refill[i].flush_timer);
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
 QDF_STATUS dp_soc_swlm_attach(struct dp_soc *soc)
 {
 	struct wlan_cfg_dp_soc_ctxt *cfg = soc->wlan_cfg_ctx;
@@ -271,6 +552,10 @@ QDF_STATUS dp_soc_swlm_attach(struct dp_soc *soc)
 	if (QDF_IS_STATUS_ERROR(ret))
 		goto swlm_tcl_setup_fail;
 
+	ret = dp_soc_swlm_rx_attach(soc);
+	if (QDF_IS_STATUS_ERROR(ret))
+		goto swlm_tcl_setup_fail;
+
 	swlm->is_init = true;
 	swlm->is_enabled = true;
 
@@ -298,6 +583,10 @@ QDF_STATUS dp_soc_swlm_detach(struct dp_soc *soc)
 			return ret;
 	}
 
+	ret = dp_soc_swlm_rx_detach(swlm);
+	if (QDF_IS_STATUS_ERROR(ret))
+		return ret;
+
 	swlm->ops = NULL;
 
 	return QDF_STATUS_SUCCESS;
@@ -31,8 +31,92 @@
 #define DP_SWLM_TCL_TIME_FLUSH_THRESH 1000
 #define DP_SWLM_TCL_TX_THRESH_MULTIPLIER 2
 
+/* REO TP write is flushed once 1/4th of the ring is reaped */
+#define DP_SWLM_REO_BATCH_SHIFT 2
+/* Time in us */
+#define DP_SWLM_REO_TIME_FLUSH_THRESH 500
+
+/* Refill HP write is flushed once 1/8th of the ring is posted */
+#define DP_SWLM_REFILL_BATCH_SHIFT 3
+/* Refill HP write is flushed when HW holds less than half of the ring */
+#define DP_SWLM_REFILL_LOW_WATER_SHIFT 1
+/* Time in us */
+#define DP_SWLM_REFILL_TIME_FLUSH_THRESH 1000
+
 /* Inline Functions */
 
+/**
+ * dp_swlm_wr_coalesced() - Account a coalesced ring register write
+ * @wr: register write stats of the ring
+ * @start_time: start timestamp of the ring coalescing session
+ *
+ * Returns: none
+ */
+static inline void
+dp_swlm_wr_coalesced(struct dp_swlm_wr_stats *wr, uint64_t *start_time)
+{
+	wr->coalesced++;
+	if (!*start_time)
+		*start_time = qdf_get_log_timestamp_usecs();
+}
+
+/**
+ * dp_swlm_wr_issued() - Account an issued ring register write
+ * @wr: register write stats of the ring
+ * @start_time: start timestamp of the ring coalescing session
+ *
+ * If register writes were held back, the write ends the coalescing session
+ * and the time they were held back is accounted as added latency.
+ *
+ * Returns: none
+ */
+static inline void
+dp_swlm_wr_issued(struct dp_swlm_wr_stats *wr, uint64_t *start_time)
+{
+	uint32_t delay;
+
+	wr->issued++;
+	if (!*start_time)
+		return;
+
+	delay = qdf_get_log_timestamp_usecs() - *start_time;
+	wr->sessions++;
+	wr->delay_us_total += delay;
+	if (delay > wr->delay_us_max)
+		wr->delay_us_max = delay;
+	*start_time = 0;
+}
+
+/**
+ * dp_swlm_reo_session_end() - End the REO TP write coalescing session
+ * @soc: DP soc handle
+ * @ring_id: REO destination ring id
+ *
+ * To be called once the REO destination ring TP register is written.
+ *
+ * Returns: none
+ */
+static inline void dp_swlm_reo_session_end(struct dp_soc *soc, uint8_t ring_id)
+{
+	struct dp_swlm_reo_params *reo = &soc->swlm.params.reo[ring_id];
+
+	dp_swlm_wr_issued(&soc->swlm.stats.reo[ring_id].wr,
+			  &reo->coalesce_start_time);
+	reo->pending = 0;
+}
+
+/**
+ * dp_swlm_reo_is_pending() - Check if a REO TP write is held back
+ * @soc: DP soc handle
+ * @ring_id: REO destination ring id
+ *
+ * Returns: true, if the REO destination ring TP register is to be written
+ */
+static inline bool dp_swlm_reo_is_pending(struct dp_soc *soc, uint8_t ring_id)
+{
+	return !!soc->swlm.params.reo[ring_id].coalesce_start_time;
+}
+
 /**
  * dp_tx_is_special_frame() - check if this TX frame is a special frame.
  * @nbuf: TX skb pointer
@@ -72,7 +156,7 @@ dp_swlm_tcl_reset_session_data(struct dp_soc *soc, uint8_t ring_id)
 	struct dp_swlm_params *params = &soc->swlm.params;
 
 	params->tcl[ring_id].coalesce_end_time = qdf_get_log_timestamp_usecs() +
-		params->time_flush_thresh;
+		params->tcl[ring_id].policy.time_flush_thresh;
 	params->tcl[ring_id].bytes_coalesced = 0;
 	params->tcl[ring_id].bytes_flush_thresh =
 				params->tcl[ring_id].sampling_session_tx_bytes *
@@ -137,6 +221,12 @@ static inline int dp_swlm_query_policy(struct dp_soc *soc, int ring_type,
 	case TCL_DATA:
 		return swlm->ops->tcl_wr_coalesce_check(soc,
 							query_data.tcl_data);
+	case REO_DST:
+		return swlm->ops->reo_wr_coalesce_check(soc,
+							query_data.reo_data);
+	case RXDMA_BUF:
+		return swlm->ops->refill_wr_coalesce_check(soc,
+						query_data.refill_data);
 	default:
 		dp_err("Ring type %d not supported by SW latency manager",
 		       ring_type);
@@ -821,6 +821,59 @@
 		false, \
 		"Control to enable latency critical clients")
 
+/*
+ * <ini>
+ * gBusBwPredictiveVote - Enable predictive bus bandwidth voting
+ * @Default: false
+ *
+ * This ini enables the throughput model of the bus bandwidth manager. The
+ * model keeps an EWMA and a trend of the packets seen in each bus bandwidth
+ * compute interval and of the RX thread backlog, votes ahead of a ramp up
+ * and holds the vote for gBusBwDowngradeHysteresis intervals before moving
+ * to a lower level.
+ *
+ * Related: gBusBwDowngradeHysteresis
+ *
+ * Supported Feature: Bus bandwidth manager
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_BUS_BW_PREDICTIVE_VOTE \
+		CFG_INI_BOOL( \
+		"gBusBwPredictiveVote", \
+		false, \
+		"Enable predictive bus bandwidth voting")
+
+/*
+ * <ini>
+ * gBusBwDowngradeHysteresis - Intervals to hold a bus bandwidth vote
+ * @Min: 0
+ * @Max: 50
+ * @Default: 3
+ *
+ * This ini is the number of consecutive bus bandwidth compute intervals a
+ * lower throughput level has to be predicted before the predictive bus
+ * bandwidth vote is downgraded. Upgrades are applied immediately.
+ *
+ * Related: gBusBwPredictiveVote
+ *
+ * Supported Feature: Bus bandwidth manager
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_BUS_BW_DOWNGRADE_HYSTERESIS \
+		CFG_INI_UINT( \
+		"gBusBwDowngradeHysteresis", \
+		0, \
+		50, \
+		3, \
+		CFG_VALUE_OR_DEFAULT, \
+		"Intervals to hold bus bw vote before downgrade")
+
 #endif /*WLAN_FEATURE_DP_BUS_BANDWIDTH*/
 
 #ifdef QCA_SUPPORT_TXRX_DRIVER_TCP_DEL_ACK
@@ -1564,7 +1617,9 @@
 	CFG(CFG_DP_TCP_DELACK_TIMER_COUNT) \
 	CFG(CFG_DP_TCP_TX_HIGH_TPUT_THRESHOLD) \
 	CFG(CFG_DP_BUS_LOW_BW_CNT_THRESHOLD) \
-	CFG(CFG_DP_BUS_HANDLE_LATENCY_CRITICAL_CLIENTS)
+	CFG(CFG_DP_BUS_HANDLE_LATENCY_CRITICAL_CLIENTS) \
+	CFG(CFG_DP_BUS_BW_PREDICTIVE_VOTE) \
+	CFG(CFG_DP_BUS_BW_DOWNGRADE_HYSTERESIS)
 
 #else
 #define CFG_HDD_DP_BUS_BANDWIDTH
@@ -180,6 +180,8 @@ struct hdd_config {
 	bool     enable_tcp_param_update;
 	uint32_t bus_low_cnt_threshold;
 	bool enable_latency_crit_clients;
+	bool bus_bw_predictive_vote;
+	uint32_t bus_bw_down_hysteresis;
 #endif /*WLAN_FEATURE_DP_BUS_BANDWIDTH*/
 
 #ifdef WLAN_FEATURE_MSCS
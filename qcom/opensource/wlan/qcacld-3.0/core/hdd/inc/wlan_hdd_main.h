@@ -3237,6 +3237,16 @@ int hdd_bus_bandwidth_init(struct hdd_context *hdd_ctx);
  */
 void hdd_bus_bandwidth_deinit(struct hdd_context *hdd_ctx);
 
+/**
+ * hdd_bus_bw_pkts_to_tput_level() - Map packets per interval to a tput level
+ * @config: HDD config holding the bus bw thresholds
+ * @pkts: tx + rx packets per bus bw compute interval
+ *
+ * Returns: tput level
+ */
+enum tput_level
+hdd_bus_bw_pkts_to_tput_level(struct hdd_config *config, uint64_t pkts);
+
 static inline enum pld_bus_width_type
 hdd_get_current_throughput_level(struct hdd_context *hdd_ctx)
 {
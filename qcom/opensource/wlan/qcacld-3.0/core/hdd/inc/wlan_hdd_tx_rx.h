@@ -425,7 +425,8 @@ void hdd_adapter_set_rps(uint8_t vdev_id, bool enable)
 }
 #endif
 
-void wlan_hdd_classify_pkt(struct sk_buff *skb);
+void wlan_hdd_classify_pkt(struct sk_buff *skb,
+			   struct qdf_nbuf_pkt_meta *meta);
 
 #ifdef WLAN_FEATURE_DP_BUS_BANDWIDTH
 void hdd_reset_tcp_delack(struct hdd_context *hdd_ctx);
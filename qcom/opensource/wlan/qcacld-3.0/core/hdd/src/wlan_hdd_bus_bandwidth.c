@@ -28,6 +28,13 @@
 #include "wlan_hdd_bus_bandwidth.h"
 #include "wlan_hdd_main.h"
 
+/* weight of a new sample in the tput model EWMA, 1/(2^shift) */
+#define BBM_EWMA_SHIFT 2
+/* weight of a new EWMA delta in the tput model trend, 1/(2^shift) */
+#define BBM_TREND_SHIFT 1
+/* RX thread backlog above which the predicted tput level is raised */
+#define BBM_RX_PENDING_BOOST_THRESH 1024
+
 /**
  * bus_bw_table_default - default table which provides bus bandwidth level
  *  corresonding to a given connection mode and throughput level.
@@ -207,16 +214,86 @@ bbm_get_bus_bw_level_vote(struct hdd_adapter *adapter,
 	return vote_lvl;
 }
 
+#ifdef WLAN_FEATURE_DP_BUS_BANDWIDTH
+enum tput_level
+hdd_bbm_predict_tput_level(struct hdd_config *config,
+			   struct bbm_tput_model *model,
+			   struct bbm_tput_sample *sample,
+			   enum tput_level tput_level)
+{
+	int64_t pkts = sample->tx_packets + sample->rx_packets;
+	int64_t prev_ewma = model->ewma_pkts;
+	int64_t forecast = pkts;
+	enum tput_level next_level;
+
+	model->ewma_pkts += (pkts - model->ewma_pkts) >> BBM_EWMA_SHIFT;
+	model->trend += ((model->ewma_pkts - prev_ewma) - model->trend) >>
+			BBM_TREND_SHIFT;
+
+	if (model->trend > 0)
+		forecast += model->trend;
+
+	next_level = hdd_bus_bw_pkts_to_tput_level(config, forecast);
+	if (next_level < tput_level)
+		next_level = tput_level;
+
+	if (sample->rx_pending > BBM_RX_PENDING_BOOST_THRESH &&
+	    next_level < TPUT_LEVEL_SUPER_HIGH)
+		next_level++;
+
+	if (next_level >= model->level) {
+		model->down_cnt = 0;
+		model->level = next_level;
+		return next_level;
+	}
+
+	if (++model->down_cnt < config->bus_bw_down_hysteresis)
+		return model->level;
+
+	model->down_cnt = 0;
+	model->level = next_level;
+
+	return next_level;
+}
+
+/**
+ * bbm_is_predictive_vote_enabled() - Check if the tput model is enabled
+ * @hdd_ctx: HDD context
+ *
+ * Returns: true if the predictive tput model is enabled
+ */
+static inline bool bbm_is_predictive_vote_enabled(struct hdd_context *hdd_ctx)
+{
+	return hdd_ctx->config->bus_bw_predictive_vote;
+}
+#else
+static inline enum tput_level
+hdd_bbm_predict_tput_level(struct hdd_config *config,
+			   struct bbm_tput_model *model,
+			   struct bbm_tput_sample *sample,
+			   enum tput_level tput_level)
+{
+	return tput_level;
+}
+
+static inline bool bbm_is_predictive_vote_enabled(struct hdd_context *hdd_ctx)
+{
+	return false;
+}
+#endif
+
 /**
  * bbm_apply_tput_policy() - Apply tput BBM policy by considering
  *  throughput level and connection modes across adapters
  * @hdd_ctx: HDD context
  * @tput_level: throughput level
+ * @sample: tput sample @tput_level was derived from
  *
  * Returns: None
  */
 static void
-bbm_apply_tput_policy(struct hdd_context *hdd_ctx, enum tput_level tput_level)
+bbm_apply_tput_policy(struct hdd_context *hdd_ctx, enum tput_level tput_level,
+		      struct bbm_tput_sample *sample)
 {
 	struct hdd_adapter *adapter;
 	struct hdd_adapter *next_adapter;
@@ -229,11 +306,18 @@ bbm_apply_tput_policy(struct hdd_context *hdd_ctx, enum tput_level tput_level)
 		 * This is to handle the scenario where bus bw periodic work
 		 * is force cancelled
 		 */
+		qdf_mem_zero(&bbm_ctx->tput_model,
+			     sizeof(bbm_ctx->tput_model));
 		if (!hdd_is_any_adapter_connected(hdd_ctx))
 			bbm_ctx->per_policy_vote[BBM_TPUT_POLICY] = next_vote;
 		return;
 	}
 
+	if (bbm_is_predictive_vote_enabled(hdd_ctx))
+		tput_level = hdd_bbm_predict_tput_level(hdd_ctx->config,
+							&bbm_ctx->tput_model,
+							sample, tput_level);
+
 	hdd_for_each_adapter_dev_held_safe(hdd_ctx, adapter, next_adapter,
 					   NET_DEV_HOLD_BUS_BW_MGR) {
 		tmp_vote = bbm_get_bus_bw_level_vote(adapter, tput_level);
@@ -398,7 +482,8 @@ void hdd_bbm_apply_independent_policy(struct hdd_context *hdd_ctx,
 
 	switch (params->policy) {
 	case BBM_TPUT_POLICY:
-		bbm_apply_tput_policy(hdd_ctx, params->policy_info.tput_level);
+		bbm_apply_tput_policy(hdd_ctx, params->policy_info.tput_level,
+				      &params->tput_sample);
 		break;
 	case BBM_NON_PERSISTENT_POLICY:
 		bbm_apply_non_persistent_policy(hdd_ctx,
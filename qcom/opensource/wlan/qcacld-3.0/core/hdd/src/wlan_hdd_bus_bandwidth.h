@@ -146,32 +146,65 @@ union bbm_policy_info {
 	} usr;
 };
 
+/**
+ * struct bbm_tput_sample - throughput sample of a bus bw compute interval
+ *
+ * @tx_packets: tx packets in the interval
+ * @rx_packets: rx packets in the interval
+ * @rx_pending: frames pending in the RX thread queues
+ */
+struct bbm_tput_sample {
+	uint64_t tx_packets;
+	uint64_t rx_packets;
+	uint32_t rx_pending;
+};
+
 /**
  * struct bbm_params - BBM params
  *
  * @policy: BBM policy
  * @policy_info: policy related info
+ * @tput_sample: sample the tput level was derived from. valid for
+ *  BBM_TPUT_POLICY and only used by the predictive tput model.
  */
 struct bbm_params {
 	enum bbm_policy policy;
 	union bbm_policy_info policy_info;
+	struct bbm_tput_sample tput_sample;
 };
 
 typedef const enum bus_bw_level
 	bus_bw_table_type[QCA_WLAN_802_11_MODE_INVALID][TPUT_LEVEL_MAX];
 
+/**
+ * struct bbm_tput_model - predictive throughput model of the tput policy
+ *
+ * @ewma_pkts: EWMA of the packets seen per bus bw compute interval
+ * @trend: smoothed per interval change of @ewma_pkts
+ * @level: tput level last selected by the model
+ * @down_cnt: consecutive intervals a level below @level was predicted
+ */
+struct bbm_tput_model {
+	int64_t ewma_pkts;
+	int64_t trend;
+	enum tput_level level;
+	uint32_t down_cnt;
+};
+
 /**
  * struct bbm_context: Bus Bandwidth Manager context
  *
  * @curr_bus_bw_lookup_table: current bus bw lookup table
  * @curr_vote_level: current vote level
  * @per_policy_vote: per BBM policy related vote
+ * @tput_model: predictive throughput model
  * @bbm_lock: BBM API lock
  */
 struct bbm_context {
 	bus_bw_table_type *curr_bus_bw_lookup_table;
 	enum bus_bw_level curr_vote_level;
 	enum bus_bw_level per_policy_vote[BBM_MAX_POLICY];
+	struct bbm_tput_model tput_model;
 	qdf_mutex_t bbm_lock;
 };
 
@@ -205,6 +238,32 @@ void hdd_bbm_context_deinit(struct hdd_context *hdd_ctx);
  */
 void hdd_bbm_apply_independent_policy(struct hdd_context *hdd_ctx,
 				      struct bbm_params *params);
+
+#ifdef WLAN_FEATURE_DP_BUS_BANDWIDTH
+struct hdd_config;
+
+/**
+ * hdd_bbm_predict_tput_level() - Run the tput model over a new sample
+ * @config: HDD config holding the bus bw thresholds
+ * @model: tput model
+ * @sample: tput sample of the last bus bw compute interval
+ * @tput_level: tput level selected from @sample against the thresholds
+ *
+ * The model tracks an EWMA of the packets per interval and the trend of
+ * that EWMA. A rising trend is added to the sample so that the vote moves
+ * up one interval earlier at the start of a burst, and a RX thread backlog
+ * raises the level by one step. The result never drops below @tput_level.
+ * Lower levels are only taken once they were predicted for
+ * bus_bw_down_hysteresis consecutive intervals.
+ *
+ * Returns: tput level to vote for
+ */
+enum tput_level
+hdd_bbm_predict_tput_level(struct hdd_config *config,
+			   struct bbm_tput_model *model,
+			   struct bbm_tput_sample *sample,
+			   enum tput_level tput_level);
+#endif
 #else
 static inline int hdd_bbm_context_init(struct hdd_context *hdd_ctx)
 {
@@ -453,9 +453,9 @@ bool wlan_hdd_cm_handle_sap_sta_dfs_conc(struct hdd_context *hdd_ctx,
 	QDF_STATUS status;
 	qdf_freq_t ch_freq = 0;
 	struct scan_filter *scan_filter;
-	qdf_list_t *list = NULL;
+	struct scan_cache_snapshot *snapshot;
 	qdf_list_node_t *cur_lst = NULL;
-	struct scan_cache_node *cur_node = NULL;
+	struct scan_cache_ref_node *cur_node;
 
 	ap_adapter = hdd_get_sap_adapter_of_dfs(hdd_ctx);
 	/* probably no dfs sap running, no handling required */
@@ -501,22 +501,21 @@ bool wlan_hdd_cm_handle_sap_sta_dfs_conc(struct hdd_context *hdd_ctx,
 	qdf_mem_copy(scan_filter->ssid_list[0].ssid, req->ssid,
 		     scan_filter->ssid_list[0].length);
 	scan_filter->ignore_auth_enc_type = true;
-	list = ucfg_scan_get_result(hdd_ctx->pdev, scan_filter);
+	snapshot = ucfg_scan_get_result_snapshot(hdd_ctx->pdev, scan_filter);
 	qdf_mem_free(scan_filter);
+	if (!snapshot)
+		goto def_chan;
 
-	if (!list || (list && !qdf_list_size(list))) {
+	qdf_list_peek_front(&snapshot->list, &cur_lst);
+	if (!cur_lst) {
 		hdd_debug("scan list empty");
-		goto purge_list;
+		goto put_snapshot;
 	}
-	qdf_list_peek_front(list, &cur_lst);
-	if (!cur_lst)
-		goto purge_list;
 
-	cur_node = qdf_container_of(cur_lst, struct scan_cache_node, node);
+	cur_node = qdf_container_of(cur_lst, struct scan_cache_ref_node, node);
 	ch_freq = cur_node->entry->channel.chan_freq;
-purge_list:
-	if (list)
-		ucfg_scan_purge_results(list);
+put_snapshot:
+	ucfg_scan_snapshot_put_ref(snapshot);
 def_chan:
 	/*
 	 * If the STA's channel is 2.4 GHz, then set pcl with only 2.4 GHz
@@ -10841,6 +10841,52 @@ bool hdd_bus_bandwidth_work_tune_tx(struct hdd_context *hdd_ctx,
 	return tx_level_change;
 }
 
+enum tput_level
+hdd_bus_bw_pkts_to_tput_level(struct hdd_config *config, uint64_t pkts)
+{
+	if (pkts > config->bus_bw_super_high_threshold)
+		return TPUT_LEVEL_SUPER_HIGH;
+	if (pkts > config->bus_bw_ultra_high_threshold)
+		return TPUT_LEVEL_ULTRA_HIGH;
+	if (pkts > config->bus_bw_very_high_threshold)
+		return TPUT_LEVEL_VERY_HIGH;
+	if (pkts > config->bus_bw_high_threshold)
+		return TPUT_LEVEL_HIGH;
+	if (pkts > config->bus_bw_medium_threshold)
+		return TPUT_LEVEL_MEDIUM;
+	if (pkts > config->bus_bw_low_threshold)
+		return TPUT_LEVEL_LOW;
+
+	return TPUT_LEVEL_IDLE;
+}
+
+/**
+ * hdd_tput_level_to_bus_width() - Bus width to vote for a tput level
+ * @tput_level: tput level
+ *
+ * Returns: pld bus width
+ */
+static enum pld_bus_width_type
+hdd_tput_level_to_bus_width(enum tput_level tput_level)
+{
+	switch (tput_level) {
+	case TPUT_LEVEL_SUPER_HIGH:
+		return PLD_BUS_WIDTH_MAX;
+	case TPUT_LEVEL_ULTRA_HIGH:
+		return PLD_BUS_WIDTH_ULTRA_HIGH;
+	case TPUT_LEVEL_VERY_HIGH:
+		return PLD_BUS_WIDTH_VERY_HIGH;
+	case TPUT_LEVEL_HIGH:
+		return PLD_BUS_WIDTH_HIGH;
+	case TPUT_LEVEL_MEDIUM:
+		return PLD_BUS_WIDTH_MEDIUM;
+	case TPUT_LEVEL_LOW:
+		return PLD_BUS_WIDTH_LOW;
+	default:
+		return PLD_BUS_WIDTH_IDLE;
+	}
+}
+
 /**
  * hdd_pld_request_bus_bandwidth() - Function to control bus bandwidth
  * @hdd_ctx: handle to hdd context
@@ -10881,31 +10927,12 @@ static void hdd_pld_request_bus_bandwidth(struct hdd_context *hdd_ctx,
 	if (!soc)
 		return;
 
-	if (hdd_ctx->high_bus_bw_request) {
-		next_vote_level = PLD_BUS_WIDTH_VERY_HIGH;
-		tput_level = TPUT_LEVEL_VERY_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_super_high_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_MAX;
-		tput_level = TPUT_LEVEL_SUPER_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_ultra_high_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_ULTRA_HIGH;
-		tput_level = TPUT_LEVEL_ULTRA_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_very_high_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_VERY_HIGH;
+	if (hdd_ctx->high_bus_bw_request)
 		tput_level = TPUT_LEVEL_VERY_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_high_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_HIGH;
-		tput_level = TPUT_LEVEL_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_medium_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_MEDIUM;
-		tput_level = TPUT_LEVEL_MEDIUM;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_low_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_LOW;
-		tput_level = TPUT_LEVEL_LOW;
-	} else {
-		next_vote_level = PLD_BUS_WIDTH_IDLE;
-		tput_level = TPUT_LEVEL_IDLE;
-	}
+	else
+		tput_level = hdd_bus_bw_pkts_to_tput_level(hdd_ctx->config,
+							   total_pkts);
+	next_vote_level = hdd_tput_level_to_bus_width(tput_level);
 
 	/*
 	 * DBS mode requires more DDR/SNOC resources, vote to ultra high
@@ -10922,6 +10949,10 @@ static void hdd_pld_request_bus_bandwidth(struct hdd_context *hdd_ctx,
 
 	param.policy = BBM_TPUT_POLICY;
 	param.policy_info.tput_level = tput_level;
+	param.tput_sample.tx_packets = tx_packets;
+	param.tput_sample.rx_packets = rx_packets;
+	if (hdd_ctx->config->bus_bw_predictive_vote)
+		param.tput_sample.rx_pending = dp_rx_tm_get_pending(soc);
 	hdd_bbm_apply_independent_policy(hdd_ctx, &param);
 
 	hdd_rtpm_tput_policy_apply(hdd_ctx, tput_level);
@@ -684,6 +684,7 @@ static void __hdd_softap_hard_start_xmit(struct sk_buff *skb,
 	uint32_t num_seg;
 	struct hdd_tx_rx_stats *stats = &adapter->hdd_stats.tx_rx_stats;
 	int cpu = qdf_get_smp_processor_id();
+	struct qdf_nbuf_pkt_meta meta;
 
 	dest_mac_addr = (struct qdf_mac_addr *)skb->data;
 	++stats->per_cpu[cpu].tx_called;
@@ -692,7 +693,7 @@ static void __hdd_softap_hard_start_xmit(struct sk_buff *skb,
 	if (QDF_IS_STATUS_ERROR(hdd_softap_validate_driver_state(adapter)))
 		goto drop_pkt;
 
-	wlan_hdd_classify_pkt(skb);
+	wlan_hdd_classify_pkt(skb, &meta);
 
 	hdd_pkt_add_timestamp(adapter, QDF_PKT_TX_DRIVER_ENTRY,
 			      qdf_get_log_timestamp(), skb);
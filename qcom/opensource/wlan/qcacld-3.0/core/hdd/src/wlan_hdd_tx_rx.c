@@ -516,39 +516,24 @@ int hdd_set_udp_qos_upgrade_config(struct hdd_adapter *adapter,
 /**
  * wlan_hdd_classify_pkt() - classify packet
  * @skb - sk buff
+ * @meta - header summary filled for the later consumers of @skb
  *
  * Return: none
  */
-void wlan_hdd_classify_pkt(struct sk_buff *skb)
+void wlan_hdd_classify_pkt(struct sk_buff *skb,
+			   struct qdf_nbuf_pkt_meta *meta)
 {
-	struct ethhdr *eh = (struct ethhdr *)skb->data;
-
 	qdf_mem_zero(skb->cb, sizeof(skb->cb));
 
+	qdf_nbuf_parse_pkt_meta(skb, meta);
+
 	/* check destination mac address is broadcast/multicast */
-	if (is_broadcast_ether_addr((uint8_t *)eh))
+	if (meta->is_bcast)
 		QDF_NBUF_CB_GET_IS_BCAST(skb) = true;
-	else if (is_multicast_ether_addr((uint8_t *)eh))
+	else if (meta->is_mcast)
 		QDF_NBUF_CB_GET_IS_MCAST(skb) = true;
 
-	if (qdf_nbuf_is_ipv4_arp_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_ARP;
-	else if (qdf_nbuf_is_ipv4_dhcp_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_DHCP;
-	else if (qdf_nbuf_is_ipv4_eapol_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_EAPOL;
-	else if (qdf_nbuf_is_ipv4_wapi_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_WAPI;
-	else if (qdf_nbuf_is_icmp_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_ICMP;
-	else if (qdf_nbuf_is_icmpv6_pkt(skb))
-		QDF_NBUF_CB_GET_PACKET_TYPE(skb) =
-			QDF_NBUF_CB_PACKET_TYPE_ICMPv6;
+	QDF_NBUF_CB_GET_PACKET_TYPE(skb) = meta->pkt_type;
 }
 
 /**
@@ -670,13 +655,26 @@ static bool hdd_tx_rx_is_dns_domain_name_match(struct sk_buff *skb,
 		return false;
 }
 
-void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
-			void *context,
-			enum connectivity_stats_pkt_status action,
-			uint8_t *pkt_type)
+/**
+ * hdd_tx_rx_collect_connectivity_stats() - collect connectivity stats
+ * @skb: pointer to skb data
+ * @context: pointer to vdev apdapter
+ * @action: action done on pkt.
+ * @pkt_type: data pkt type
+ * @meta: header summary of @skb, NULL if @skb was not parsed yet
+ *
+ * Return: None
+ */
+static void
+hdd_tx_rx_collect_connectivity_stats(struct sk_buff *skb, void *context,
+				     enum connectivity_stats_pkt_status action,
+				     uint8_t *pkt_type,
+				     struct qdf_nbuf_pkt_meta *meta)
 {
 	uint32_t pkt_type_bitmap;
 	struct hdd_adapter *adapter = NULL;
+	struct qdf_nbuf_pkt_meta skb_meta;
+	bool is_ipv4;
 
 	adapter = (struct hdd_adapter *)context;
 	if (unlikely(adapter->magic != WLAN_HDD_ADAPTER_MAGIC)) {
@@ -693,10 +691,23 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 	if (!pkt_type_bitmap)
 		return;
 
+	if (!meta) {
+		qdf_nbuf_parse_pkt_meta(skb, &skb_meta);
+		meta = &skb_meta;
+	}
+
+	/*
+	 * The ICMP/TCP/DNS accessors below read the headers at the untagged
+	 * offsets, so VLAN tagged frames are not tracked.
+	 */
+	is_ipv4 = meta->is_ipv4 &&
+		  meta->ip_offset == QDF_NBUF_TRAC_IP_OFFSET;
+
 	switch (action) {
 	case PKT_TYPE_REQ:
 	case PKT_TYPE_TX_HOST_FW_SENT:
-		if (qdf_nbuf_is_icmp_pkt(skb)) {
+		if (is_ipv4 &&
+		    meta->l4_proto == QDF_NBUF_TRAC_ICMP_TYPE) {
 			if (qdf_nbuf_data_is_icmpv4_req(skb) &&
 			    (adapter->track_dest_ipv4 ==
 					qdf_nbuf_get_icmpv4_tgt_ip(skb))) {
@@ -713,7 +724,8 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 					++adapter->hdd_stats.hdd_icmpv4_stats.
 								tx_host_fw_sent;
 			}
-		} else if (qdf_nbuf_is_ipv4_tcp_pkt(skb)) {
+		} else if (is_ipv4 &&
+			   meta->l4_proto == QDF_NBUF_TRAC_TCP_TYPE) {
 			if (qdf_nbuf_data_is_tcp_syn(skb) &&
 			    (adapter->track_dest_port ==
 					qdf_nbuf_data_get_tcp_dst_port(skb))) {
@@ -759,7 +771,8 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 							is_tcp_ack_sent = false;
 				}
 			}
-		} else if (qdf_nbuf_is_ipv4_udp_pkt(skb)) {
+		} else if (is_ipv4 &&
+			   meta->l4_proto == QDF_NBUF_TRAC_UDP_TYPE) {
 			if (qdf_nbuf_data_is_dns_query(skb) &&
 			    hdd_tx_rx_is_dns_domain_name_match(skb, adapter)) {
 				*pkt_type = CONNECTIVITY_CHECK_SET_DNS;
@@ -779,7 +792,8 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 		break;
 
 	case PKT_TYPE_RSP:
-		if (qdf_nbuf_is_icmp_pkt(skb)) {
+		if (is_ipv4 &&
+		    meta->l4_proto == QDF_NBUF_TRAC_ICMP_TYPE) {
 			if (qdf_nbuf_data_is_icmpv4_rsp(skb) &&
 			    (adapter->track_dest_ipv4 ==
 					qdf_nbuf_get_icmpv4_src_ip(skb))) {
@@ -791,7 +805,8 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 					  QDF_TRACE_LEVEL_INFO_HIGH,
 					  "%s : ICMPv4 Res packet", __func__);
 			}
-		} else if (qdf_nbuf_is_ipv4_tcp_pkt(skb)) {
+		} else if (is_ipv4 &&
+			   meta->l4_proto == QDF_NBUF_TRAC_TCP_TYPE) {
 			if (qdf_nbuf_data_is_tcp_syn_ack(skb) &&
 			    (adapter->track_dest_port ==
 					qdf_nbuf_data_get_tcp_src_port(skb))) {
@@ -805,7 +820,8 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 					  QDF_TRACE_LEVEL_INFO_HIGH,
 					  "%s : TCP Syn ack packet", __func__);
 			}
-		} else if (qdf_nbuf_is_ipv4_udp_pkt(skb)) {
+		} else if (is_ipv4 &&
+			   meta->l4_proto == QDF_NBUF_TRAC_UDP_TYPE) {
 			if (qdf_nbuf_data_is_dns_response(skb) &&
 			    hdd_tx_rx_is_dns_domain_name_match(skb, adapter)) {
 				++adapter->hdd_stats.hdd_dns_stats.
@@ -901,6 +917,15 @@ void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
 	}
 }
 
+void hdd_tx_rx_collect_connectivity_stats_info(struct sk_buff *skb,
+			void *context,
+			enum connectivity_stats_pkt_status action,
+			uint8_t *pkt_type)
+{
+	hdd_tx_rx_collect_connectivity_stats(skb, context, action, pkt_type,
+					     NULL);
+}
+
 /**
  * hdd_is_xmit_allowed_on_ndi() - Verify if xmit is allowed on NDI
  * @adapter: The adapter structure
@@ -1080,6 +1105,7 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 	uint8_t pkt_type = 0;
 	bool is_arp = false;
 	struct hdd_context *hdd_ctx;
+	struct qdf_nbuf_pkt_meta meta;
 	void *soc = cds_get_context(QDF_MODULE_ID_SOC);
 	enum qdf_proto_subtype subtype = QDF_PROTO_INVALID;
 	bool is_eapol = false;
@@ -1111,7 +1137,7 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 		goto drop_pkt;
 	}
 
-	wlan_hdd_classify_pkt(skb);
+	wlan_hdd_classify_pkt(skb, &meta);
 
 	QDF_NBUF_CB_TX_EXTRA_FRAG_FLAGS_NOTIFY_COMP(skb) = 1;
 
@@ -1156,8 +1182,9 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 
 	/* track connectivity stats */
 	if (adapter->pkt_type_bitmap)
-		hdd_tx_rx_collect_connectivity_stats_info(skb, adapter,
-						PKT_TYPE_REQ, &pkt_type);
+		hdd_tx_rx_collect_connectivity_stats(skb, adapter,
+						     PKT_TYPE_REQ, &pkt_type,
+						     &meta);
 
 	hdd_get_transmit_mac_addr(adapter, skb, &mac_addr_tx_allowed);
 	if (qdf_is_macaddr_zero(&mac_addr_tx_allowed)) {
@@ -3604,6 +3631,10 @@ static void hdd_ini_bus_bandwidth(struct hdd_config *config,
 		cfg_get(psoc, CFG_DP_BUS_LOW_BW_CNT_THRESHOLD);
 	config->enable_latency_crit_clients =
 		cfg_get(psoc, CFG_DP_BUS_HANDLE_LATENCY_CRITICAL_CLIENTS);
+	config->bus_bw_predictive_vote =
+		cfg_get(psoc, CFG_DP_BUS_BW_PREDICTIVE_VOTE);
+	config->bus_bw_down_hysteresis =
+		cfg_get(psoc, CFG_DP_BUS_BW_DOWNGRADE_HYSTERESIS);
 }
 
 /**
@@ -23,18 +23,25 @@
  * debugfs unit_test_host
  */
 #include "wlan_hdd_main.h"
+#include "dot11f_test.h"
+#include "hif_exec_budget_test.h"
 #include "qdf_delayed_work_test.h"
 #include "qdf_hashtable_test.h"
+#include "qdf_nbuf_classify_test.h"
 #include "qdf_periodic_work_test.h"
 #include "qdf_ptr_hash_test.h"
 #include "qdf_slist_test.h"
 #include "qdf_talloc_test.h"
 #include "qdf_str.h"
 #include "qdf_trace.h"
+#include "qdf_trace_ring_test.h"
 #include "qdf_tracker_test.h"
 #include "qdf_types_test.h"
+#include "scheduler_mq_test.h"
 #include "wlan_dsc_test.h"
+#include "wlan_hdd_bbm_test.h"
 #include "wlan_hdd_unit_test.h"
+#include "wmi_tlv_test.h"
 
 typedef uint32_t (*hdd_ut_callback)(void);
 
@@ -44,16 +51,25 @@ struct hdd_ut_entry {
 };
 
 struct hdd_ut_entry hdd_ut_entries[] = {
+	{ .name = "bbm", .callback = hdd_bbm_unit_test },
+	{ .name = "dot11f", .callback = dot11f_unit_test },
 	{ .name = "dsc", .callback = dsc_unit_test },
+	{ .name = "hif_exec_budget",
+	  .callback = hif_exec_budget_unit_test },
 	{ .name = "qdf_delayed_work", .callback = qdf_delayed_work_unit_test },
 	{ .name = "qdf_ht", .callback = qdf_ht_unit_test },
+	{ .name = "qdf_nbuf_classify",
+	  .callback = qdf_nbuf_classify_unit_test },
 	{ .name = "qdf_periodic_work",
 	  .callback = qdf_periodic_work_unit_test },
 	{ .name = "qdf_ptr_hash", .callback = qdf_ptr_hash_unit_test },
 	{ .name = "qdf_slist", .callback = qdf_slist_unit_test },
 	{ .name = "qdf_talloc", .callback = qdf_talloc_unit_test },
+	{ .name = "qdf_trace_ring", .callback = qdf_trace_ring_unit_test },
 	{ .name = "qdf_tracker", .callback = qdf_tracker_unit_test },
 	{ .name = "qdf_types", .callback = qdf_types_unit_test },
+	{ .name = "scheduler_mq", .callback = scheduler_mq_unit_test },
+	{ .name = "wmi_tlv", .callback = wmi_tlv_unit_test },
 };
 
 #define hdd_for_each_ut_entry(cursor) \
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_trace.h"
+#include "wlan_hdd_main.h"
+#include "wlan_hdd_bus_bandwidth.h"
+#include "wlan_hdd_bbm_test.h"
+
+/**
+ * struct hdd_bbm_ut_sample - one recorded bus bw compute interval
+ * @tx: tx packets in the interval
+ * @rx: rx packets in the interval
+ * @rx_pending: RX thread backlog at the end of the interval
+ * @level: tput level the thresholds selected for the interval
+ */
+struct hdd_bbm_ut_sample {
+	uint32_t tx;
+	uint32_t rx;
+	uint32_t rx_pending;
+	enum tput_level level;
+};
+
+/*
+ * 100 ms intervals of a TCP download recorded with the default thresholds:
+ * a ramp up to the HIGH level, one quiet interval inside the burst, and the
+ * end of the burst.
+ */
+static const struct hdd_bbm_ut_sample hdd_bbm_ut_trace[] = {
+	{ 10, 20, 0, TPUT_LEVEL_IDLE },
+	{ 15, 25, 0, TPUT_LEVEL_IDLE },
+	{ 60, 180, 0, TPUT_LEVEL_LOW },
+	{ 150, 450, 0, TPUT_LEVEL_MEDIUM },
+	{ 300, 900, 0, TPUT_LEVEL_MEDIUM },
+	{ 500, 1500, 0, TPUT_LEVEL_MEDIUM },
+	{ 800, 2400, 0, TPUT_LEVEL_HIGH },
+	{ 1000, 3200, 0, TPUT_LEVEL_HIGH },
+	{ 1200, 4000, 0, TPUT_LEVEL_HIGH },
+	{ 1300, 4300, 0, TPUT_LEVEL_HIGH },
+	{ 1300, 4400, 0, TPUT_LEVEL_HIGH },
+	{ 1300, 4400, 0, TPUT_LEVEL_HIGH },
+	{ 40, 100, 0, TPUT_LEVEL_IDLE },
+	{ 1300, 4400, 0, TPUT_LEVEL_HIGH },
+	{ 1300, 4400, 0, TPUT_LEVEL_HIGH },
+	{ 1300, 4400, 0, TPUT_LEVEL_HIGH },
+	{ 1300, 4400, 0, TPUT_LEVEL_HIGH },
+	{ 20, 60, 0, TPUT_LEVEL_IDLE },
+	{ 20, 60, 0, TPUT_LEVEL_IDLE },
+	{ 10, 30, 0, TPUT_LEVEL_IDLE },
+	{ 10, 30, 0, TPUT_LEVEL_IDLE },
+	{ 10, 20, 0, TPUT_LEVEL_IDLE },
+	{ 10, 20, 0, TPUT_LEVEL_IDLE },
+};
+
+/* the quiet interval inside the burst */
+#define hdd_bbm_ut_dip 12
+/* the first interval after the burst */
+#define hdd_bbm_ut_tail 17
+#define hdd_bbm_ut_burst_level TPUT_LEVEL_HIGH
+
+static void hdd_bbm_ut_config_init(struct hdd_config *config,
+				   uint32_t hysteresis)
+{
+	config->bus_bw_super_high_threshold = 22000;
+	config->bus_bw_ultra_high_threshold = 12000;
+	config->bus_bw_very_high_threshold = 9000;
+	config->bus_bw_high_threshold = 2000;
+	config->bus_bw_medium_threshold = 500;
+	config->bus_bw_low_threshold = 150;
+	config->bus_bw_down_hysteresis = hysteresis;
+}
+
+static enum tput_level
+hdd_bbm_ut_predict(struct hdd_config *config, struct bbm_tput_model *model,
+		   const struct hdd_bbm_ut_sample *rec)
+{
+	struct bbm_tput_sample sample = {
+		.tx_packets = rec->tx,
+		.rx_packets = rec->rx,
+		.rx_pending = rec->rx_pending,
+	};
+
+	return hdd_bbm_predict_tput_level(config, model, &sample, rec->level);
+}
+
+static uint32_t hdd_bbm_ut_replay(struct hdd_config *config,
+				  uint32_t hysteresis)
+{
+	enum tput_level vote[QDF_ARRAY_SIZE(hdd_bbm_ut_trace)];
+	struct bbm_tput_model model = {0};
+	uint32_t first_vote = QDF_ARRAY_SIZE(hdd_bbm_ut_trace);
+	uint32_t first_level = QDF_ARRAY_SIZE(hdd_bbm_ut_trace);
+	uint32_t hold = hysteresis ? hysteresis - 1 : 0;
+	uint32_t errors = 0;
+	uint32_t i;
+
+	hdd_bbm_ut_config_init(config, hysteresis);
+
+	for (i = 0; i < QDF_ARRAY_SIZE(hdd_bbm_ut_trace); i++) {
+		vote[i] = hdd_bbm_ut_predict(config, &model,
+					     &hdd_bbm_ut_trace[i]);
+
+		/* the model never votes below the sampled level */
+		if (vote[i] < hdd_bbm_ut_trace[i].level)
+			errors++;
+
+		if (first_vote > i && vote[i] >= hdd_bbm_ut_burst_level)
+			first_vote = i;
+		if (first_level > i &&
+		    hdd_bbm_ut_trace[i].level >= hdd_bbm_ut_burst_level)
+			first_level = i;
+	}
+
+	/* upgrade lead: the rising trend reaches the burst level first */
+	if (first_vote >= first_level) {
+		qdf_nofl_alert("FAIL: bbm hysteresis %u: burst level voted at %u, sampled at %u",
+			       hysteresis, first_vote, first_level);
+		errors++;
+	}
+
+	/* a single quiet interval inside the burst keeps the vote */
+	if (hysteresis > 1 && vote[hdd_bbm_ut_dip] != hdd_bbm_ut_burst_level)
+		errors++;
+
+	/* after the burst the vote is held, then dropped at once */
+	for (i = hdd_bbm_ut_tail; i < hdd_bbm_ut_tail + hold; i++) {
+		if (vote[i] != hdd_bbm_ut_burst_level) {
+			qdf_nofl_alert("FAIL: bbm hysteresis %u: vote dropped %u intervals after the burst",
+				       hysteresis, i - hdd_bbm_ut_tail);
+			errors++;
+		}
+	}
+
+	i = hdd_bbm_ut_tail + hold;
+	if (vote[i] != hdd_bbm_ut_trace[i].level) {
+		qdf_nofl_alert("FAIL: bbm hysteresis %u: vote %d held past %u intervals",
+			       hysteresis, vote[i], hold + 1);
+		errors++;
+	}
+
+	return errors;
+}
+
+static uint32_t hdd_bbm_ut_rx_backlog(struct hdd_config *config)
+{
+	const struct hdd_bbm_ut_sample backlog = {
+		1300, 4400, 2048, TPUT_LEVEL_HIGH };
+	const struct hdd_bbm_ut_sample max_backlog = {
+		5000, 20000, 4096, TPUT_LEVEL_SUPER_HIGH };
+	struct bbm_tput_model model = {0};
+	uint32_t errors = 0;
+
+	hdd_bbm_ut_config_init(config, 3);
+
+	/* a RX thread backlog raises the vote by one level */
+	if (hdd_bbm_ut_predict(config, &model, &backlog) !=
+	    TPUT_LEVEL_VERY_HIGH)
+		errors++;
+
+	/* but not above the highest one */
+	if (hdd_bbm_ut_predict(config, &model, &max_backlog) !=
+	    TPUT_LEVEL_SUPER_HIGH)
+		errors++;
+
+	return errors;
+}
+
+uint32_t hdd_bbm_unit_test(void)
+{
+	struct hdd_config *config;
+	uint32_t errors = 0;
+
+	config = qdf_mem_malloc(sizeof(*config));
+	if (!config)
+		return 1;
+
+	errors += hdd_bbm_ut_replay(config, 0);
+	errors += hdd_bbm_ut_replay(config, 1);
+	errors += hdd_bbm_ut_replay(config, 3);
+	errors += hdd_bbm_ut_replay(config, 5);
+	errors += hdd_bbm_ut_rx_backlog(config);
+
+	qdf_mem_free(config);
+	QDF_BUG(!errors);
+
+	return errors;
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+#
+# Permission to use, copy, modify, and/or distribute this software for
+# any purpose with or without fee is hereby granted, provided that the
+# above copyright notice and this permission notice appear in all
+# copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+# WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+# AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+# DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+# PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+# TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+# PERFORMANCE OF THIS SOFTWARE.
+
+"""Emit the EID index of every tIEDefn table of dot11f.c.
+
+dot11f.c is generated by framesc. Run this script on the framesc output
+every time dot11f.c is regenerated:
+
+    dot11f_ie_index.py [dot11f.c] [dot11f.h]
+
+Every "static const tIEDefn IES_<frame>[]" table is followed by a
+"static const struct ie_index IES_<frame>_index", and every unpack_core()
+call gets the index of its table through DOT11F_IE_INDEX(). Running the
+script again replaces what it emitted before.
+"""
+
+import os
+import re
+import sys
+
+UTILS_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DOT11F_C = os.path.join(UTILS_DIR, 'src', 'dot11f.c')
+DOT11F_H = os.path.join(UTILS_DIR, '..', '..', '..', '..', 'include',
+                        'dot11f.h')
+
+EID_VENDOR_SPECIFIC = 0xdd
+EID_EXTENSION = 0xff
+# struct ie_index markers, see dot11f.c
+IE_INDEX_OUI = 0xfe
+IE_INDEX_END = 0xff
+
+FEATURE = 'WLAN_FEATURE_DOT11F_IE_INDEX'
+TABLE_RE = re.compile(r'static const tIEDefn (IES_\w+)\[\] = \{\n'
+                      r'(.*?)\n?\};\n', re.S)
+GENERATED = '/* EID index, generated by dot11f_ie_index.py */'
+BLOCK_RE = re.compile(r'\n#ifdef ' + FEATURE + r'\n' + re.escape(GENERATED) +
+                      r'.*?#endif /\* ' + FEATURE + r' \*/\n', re.S)
+CALL_ARG_RE = re.compile(r'^[ \t]*DOT11F_IE_INDEX\(IES_\w+\),\n', re.M)
+CALL_RE = re.compile(r'unpack_core\(pCtx,[^;]*?\n([ \t]*)[^\n]*\b(IES_\w+),\n')
+DEFN_RE = re.compile(r'"(\w+)",.*\{([^{}]*)\},\s*(\w+),\s*(\w+),\s*(\w+),'
+                     r'(?:\s*\w+,)?\s*$', re.S)
+
+
+def split_defns(body):
+    """Split the body of a tIEDefn table into its brace enclosed entries."""
+    defns, depth, cur = [], 0, ''
+    for ch in body:
+        if ch == '{':
+            depth += 1
+            if depth == 1:
+                cur = ''
+                continue
+        elif ch == '}':
+            depth -= 1
+            if depth == 0:
+                defns.append(cur)
+                continue
+        if depth:
+            cur += ch
+    return defns
+
+
+def parse_table(body, eids):
+    """Return (name, eid, extn_eid, noui) of each definition of a table."""
+    def value(token):
+        return eids[token] if token in eids else int(token, 0)
+
+    defns = []
+    for defn in split_defns(body):
+        match = DEFN_RE.search(defn.strip())
+        if not match:
+            # the terminating entry
+            continue
+        name, _, noui, eid, extn_eid = match.groups()
+        defns.append((name, value(eid), value(extn_eid), value(noui)))
+    return defns
+
+
+def emit_index(table, defns):
+    """Emit the ie_index of a table and its OUI and extension sub-tables."""
+    if len(defns) >= IE_INDEX_OUI - 1:
+        sys.exit('%s: too many IE definitions to index' % table)
+
+    by_eid = {}
+    for pos, (_, eid, _, _) in enumerate(defns):
+        by_eid.setdefault(eid, []).append(pos)
+
+    eid_map, oui, extn = {}, [], []
+    for eid, positions in sorted(by_eid.items()):
+        if eid == EID_EXTENSION:
+            eid_map[eid] = ('DOT11F_IE_INDEX_EXTN', 'extension IEs')
+            extn += positions
+        elif (len(positions) > 1 or eid == EID_VENDOR_SPECIFIC or
+              defns[positions[0]][3]):
+            eid_map[eid] = ('DOT11F_IE_INDEX_OUI', 'by OUI')
+            oui += positions
+        else:
+            eid_map[eid] = (str(positions[0] + 1), defns[positions[0]][0])
+
+    out = ['', '#ifdef ' + FEATURE, GENERATED]
+    for suffix, positions in (('oui', sorted(oui)), ('extn', extn)):
+        if not positions:
+            continue
+        out.append('static const uint8_t %s_%s[] = {' % (table, suffix))
+        for pos in positions:
+            out.append('\t%d, /* %s */' % (pos, defns[pos][0]))
+        out += ['\tDOT11F_IE_INDEX_END,', '};', '']
+
+    out += ['static const struct ie_index %s_index = {' % table, '\t.eid = {']
+    for eid, (entry, comment) in sorted(eid_map.items()):
+        out.append('\t\t[%d] = %s, /* %s */' % (eid, entry, comment))
+    if not eid_map:
+        out.append('\t\t0,')
+    out.append('\t},')
+    if oui:
+        out.append('\t.oui = %s_oui,' % table)
+    if extn:
+        out.append('\t.extn = %s_extn,' % table)
+    out += ['};', '#endif /* %s */' % FEATURE]
+    return '\n'.join(out) + '\n'
+
+
+def main(argv):
+    c_path = argv[1] if len(argv) > 1 else DOT11F_C
+    h_path = argv[2] if len(argv) > 2 else DOT11F_H
+
+    with open(h_path) as header:
+        eids = {m.group(1): int(m.group(2), 0) for m in
+                re.finditer(r'#define (DOT11F_EID_\w+) \((\w+)\)',
+                            header.read())}
+    with open(c_path) as source:
+        src = source.read()
+
+    src = BLOCK_RE.sub('', src)
+    src = CALL_ARG_RE.sub('', src)
+
+    def add_index(match):
+        table = match.group(1)
+        return match.group(0) + emit_index(table,
+                                           parse_table(match.group(2), eids))
+
+    src = TABLE_RE.sub(add_index, src)
+    src = CALL_RE.sub(lambda m: '%s%sDOT11F_IE_INDEX(%s),\n' %
+                      (m.group(0), m.group(1), m.group(2)), src)
+
+    with open(c_path, 'w') as source:
+        source.write(src)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
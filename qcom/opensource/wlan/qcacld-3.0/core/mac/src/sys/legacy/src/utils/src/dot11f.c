@@ -318,6 +318,109 @@ static const tIEDefn *find_ie_defn(tpAniSirGlobal pCtx,
 	return NULL;
 }
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* ie_index.eid[] holds the position + 1 of an IE definition or a marker */
+#define DOT11F_IE_INDEX_NONE (0)
+#define DOT11F_IE_INDEX_OUI (0xfe)
+#define DOT11F_IE_INDEX_EXTN (0xff)
+/* terminates the OUI and extension EID sub-tables */
+#define DOT11F_IE_INDEX_END (0xff)
+
+/*
+ * struct ie_index - EID index of a tIEDefn table
+ * @eid: position + 1 of the definition of each EID in the table,
+ *  DOT11F_IE_INDEX_OUI if definitions of the EID are told apart by their
+ *  OUI, DOT11F_IE_INDEX_EXTN for extension IEs
+ * @oui: positions of the definitions of the DOT11F_IE_INDEX_OUI EIDs
+ * @extn: positions of the extension IE definitions
+ *
+ * Every tIEDefn table is followed by its index, emitted from the table by
+ * dot11f_ie_index.py. The sub-tables keep table order, so a lookup returns
+ * the same definition as find_ie_defn().
+ */
+struct ie_index {
+	uint8_t eid[256];
+	const uint8_t *oui;
+	const uint8_t *extn;
+};
+
+#define DOT11F_IE_INDEX(ies) (&ies##_index)
+
+/**
+ * ie_defn_match() - Check if an IE matches a definition
+ * @pCtx: MAC context
+ * @pBuf: IE to match
+ * @nBuf: bytes left in the frame starting at @pBuf
+ * @pIe: IE definition with the same EID as @pBuf
+ *
+ * Return: true if @pIe describes the IE at @pBuf
+ */
+static inline bool ie_defn_match(tpAniSirGlobal pCtx, uint8_t *pBuf,
+				 uint32_t nBuf, const tIEDefn *pIe)
+{
+	if (pIe->eid == 0xff)
+		return (nBuf > 2) && (*(pBuf + 2)) == pIe->extn_eid;
+
+	if (0 == pIe->noui)
+		return true;
+
+	return (nBuf > (uint32_t)(pIe->noui + 2)) &&
+	       !DOT11F_MEMCMP(pCtx, pBuf + 2, pIe->oui, pIe->noui);
+}
+
+/**
+ * find_ie_defn_indexed() - find_ie_defn() through the EID index
+ * @pCtx: MAC context
+ * @pBuf: IE to look up
+ * @nBuf: bytes left in the frame starting at @pBuf
+ * @IEs: IE definition table of the frame
+ * @ie_idx: EID index of @IEs
+ *
+ * Return: IE definition, NULL if the IE is not part of the table
+ */
+static const tIEDefn *find_ie_defn_indexed(tpAniSirGlobal pCtx,
+					   uint8_t *pBuf,
+					   uint32_t nBuf,
+					   const tIEDefn IEs[],
+					   const struct ie_index *ie_idx)
+{
+	const uint8_t *pos;
+	const tIEDefn *pIe;
+
+	switch (ie_idx->eid[*pBuf]) {
+	case DOT11F_IE_INDEX_NONE:
+		return NULL;
+	case DOT11F_IE_INDEX_OUI:
+		pos = ie_idx->oui;
+		break;
+	case DOT11F_IE_INDEX_EXTN:
+		pos = ie_idx->extn;
+		break;
+	default:
+		return &IEs[ie_idx->eid[*pBuf] - 1];
+	}
+
+	for (; *pos != DOT11F_IE_INDEX_END; pos++) {
+		pIe = &IEs[*pos];
+		if (pIe->eid == *pBuf && ie_defn_match(pCtx, pBuf, nBuf, pIe))
+			return pIe;
+	}
+
+	return NULL;
+}
+#else
+struct ie_index;
+
+#define DOT11F_IE_INDEX(ies) NULL
+
+static inline const tIEDefn *
+find_ie_defn_indexed(tpAniSirGlobal pCtx, uint8_t *pBuf, uint32_t nBuf,
+		     const tIEDefn IEs[], const struct ie_index *ie_idx)
+{
+	return NULL;
+}
+#endif
+
 static uint32_t get_container_ies_len(tpAniSirGlobal pCtx,
 				      uint8_t *pBuf,
 				      uint32_t  nBuf,
@@ -359,6 +462,7 @@ static uint32_t unpack_core(tpAniSirGlobal pCtx,
 			    uint32_t nBuf,
 			    const tFFDefn  FFs[],
 			    const tIEDefn  IEs[],
+			    const struct ie_index *ie_idx,
 			    uint8_t *pFrm,
 			    size_t nFrm,
 			    bool append_ie);
@@ -3694,6 +3798,19 @@ static const tIEDefn IES_neighbor_rpt[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_neighbor_rpt_index = {
+	.eid = {
+		[1] = 1, /* TSFInfo */
+		[2] = 2, /* CondensedCountryStr */
+		[66] = 3, /* MeasurementPilot */
+		[70] = 4, /* RRMEnabledCap */
+		[71] = 5, /* MultiBssid */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_neighbor_rpt(tpAniSirGlobal pCtx,
 				       uint8_t *pBuf,
 				       uint8_t ielen,
@@ -3780,6 +3897,7 @@ uint32_t dot11f_unpack_ie_neighbor_rpt(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_neighbor_rpt,
 				IES_neighbor_rpt,
+				DOT11F_IE_INDEX(IES_neighbor_rpt),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -4093,6 +4211,16 @@ static const tIEDefn IES_ChannelSwitchWrapper[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_ChannelSwitchWrapper_index = {
+	.eid = {
+		[194] = 1, /* WiderBWChanSwitchAnn */
+		[195] = 2, /* transmit_power_env */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_channel_switch_wrapper(tpAniSirGlobal pCtx,
 					       uint8_t *pBuf,
 					       uint8_t ielen,
@@ -4110,6 +4238,7 @@ uint32_t dot11f_unpack_ie_channel_switch_wrapper(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_ChannelSwitchWrapper,
 				IES_ChannelSwitchWrapper,
+				DOT11F_IE_INDEX(IES_ChannelSwitchWrapper),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -4765,6 +4894,18 @@ static const tIEDefn IES_FTInfo[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_FTInfo_index = {
+	.eid = {
+		[1] = 1, /* R1KH_ID */
+		[2] = 2, /* GTK */
+		[3] = 3, /* R0KH_ID */
+		[4] = 4, /* IGTK */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_ft_info(tpAniSirGlobal pCtx,
 				 uint8_t *pBuf,
 				 uint8_t ielen,
@@ -4817,6 +4958,7 @@ uint32_t dot11f_unpack_ie_ft_info(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_FTInfo,
 				IES_FTInfo,
+				DOT11F_IE_INDEX(IES_FTInfo),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -5164,6 +5306,17 @@ static const tIEDefn IES_reportBeacon[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_reportBeacon_index = {
+	.eid = {
+		[1] = 1, /* BeaconReportFrmBody */
+		[2] = 2, /* beacon_report_frm_body_fragment_id */
+		[164] = 3, /* last_beacon_report_indication */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_measurement_report(tpAniSirGlobal pCtx,
 					    uint8_t *pBuf,
 					    uint8_t ielen,
@@ -5462,6 +5615,7 @@ uint32_t dot11f_unpack_ie_measurement_report(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_reportBeacon,
 				IES_reportBeacon,
+				DOT11F_IE_INDEX(IES_reportBeacon),
 				(uint8_t *)pDst,
 				sizeof(*pDst), append_ie);
 			break;
@@ -5510,6 +5664,20 @@ static const tIEDefn IES_measurement_requestBeacon[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_measurement_requestBeacon_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* BeaconReporting */
+		[2] = 3, /* BcnReportingDetail */
+		[10] = 4, /* RequestedInfo */
+		[51] = 5, /* APChannelReport */
+		[164] = 6, /* last_beacon_report_indication */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 static const tFFDefn FFS_measurement_requestlci[] = {
 	{ NULL, 0, 0, 0,},
 };
@@ -5534,6 +5702,18 @@ static const tIEDefn IES_measurement_requestlci[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_measurement_requestlci_index = {
+	.eid = {
+		[1] = 1, /* azimuth_req */
+		[2] = 2, /* req_mac_addr */
+		[3] = 3, /* tgt_mac_addr */
+		[4] = 4, /* max_age */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 static const tFFDefn FFS_measurement_requestftmrr[] = {
 	{ NULL, 0, 0, 0,},
 };
@@ -5550,6 +5730,16 @@ static const tIEDefn IES_measurement_requestftmrr[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_measurement_requestftmrr_index = {
+	.eid = {
+		[4] = 2, /* max_age */
+		[52] = 1, /* neighbor_rpt */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_measurement_request(tpAniSirGlobal pCtx,
 					     uint8_t *pBuf,
 					     uint8_t ielen,
@@ -5725,6 +5915,7 @@ uint32_t dot11f_unpack_ie_measurement_request(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_measurement_requestBeacon,
 				IES_measurement_requestBeacon,
+				DOT11F_IE_INDEX(IES_measurement_requestBeacon),
 				(uint8_t *)pDst,
 				sizeof(*pDst), append_ie);
 		break;
@@ -5742,6 +5933,7 @@ uint32_t dot11f_unpack_ie_measurement_request(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_measurement_requestlci,
 				IES_measurement_requestlci,
+				DOT11F_IE_INDEX(IES_measurement_requestlci),
 				(uint8_t *)pDst,
 				sizeof(*pDst), append_ie);
 		break;
@@ -5767,6 +5959,7 @@ uint32_t dot11f_unpack_ie_measurement_request(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_measurement_requestftmrr,
 				IES_measurement_requestftmrr,
+				DOT11F_IE_INDEX(IES_measurement_requestftmrr),
 				(uint8_t *)pDst,
 				sizeof(*pDst), append_ie);
 		break;
@@ -5841,6 +6034,19 @@ static const tIEDefn IES_NeighborReport[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_NeighborReport_index = {
+	.eid = {
+		[1] = 1, /* TSFInfo */
+		[2] = 2, /* CondensedCountryStr */
+		[66] = 3, /* MeasurementPilot */
+		[70] = 4, /* RRMEnabledCap */
+		[71] = 5, /* MultiBssid */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_neighbor_report(tpAniSirGlobal pCtx,
 					 uint8_t *pBuf,
 					 uint8_t ielen,
@@ -5927,6 +6133,7 @@ uint32_t dot11f_unpack_ie_neighbor_report(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_NeighborReport,
 				IES_NeighborReport,
+				DOT11F_IE_INDEX(IES_NeighborReport),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -6727,6 +6934,32 @@ static const tIEDefn IES_RICDataDesc[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_RICDataDesc_oui[] = {
+	7, /* WMMTSPEC */
+	8, /* WMMTCLAS */
+	9, /* WMMTCLASPROC */
+	10, /* WMMTSDelay */
+	11, /* WMMSchedule */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_RICDataDesc_index = {
+	.eid = {
+		[13] = 3, /* TSPEC */
+		[14] = 4, /* TCLAS */
+		[15] = 7, /* Schedule */
+		[43] = 6, /* TSDelay */
+		[44] = 5, /* TCLASSPROC */
+		[57] = 1, /* RICData */
+		[75] = 2, /* RICDescriptor */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_RICDataDesc_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_ric_data_desc(tpAniSirGlobal pCtx,
 				      uint8_t *pBuf,
 				      uint8_t ielen,
@@ -6744,6 +6977,7 @@ uint32_t dot11f_unpack_ie_ric_data_desc(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_RICDataDesc,
 				IES_RICDataDesc,
+				DOT11F_IE_INDEX(IES_RICDataDesc),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -8552,6 +8786,22 @@ static const tIEDefn IES_decriptor_element[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_decriptor_element_extn[] = {
+	0, /* tclas_mask */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_decriptor_element_index = {
+	.eid = {
+		[76] = 2, /* mscs_status */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.extn = IES_decriptor_element_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_decriptor_element(tpAniSirGlobal pCtx,
 					    uint8_t *pBuf,
 					    uint8_t ielen,
@@ -8593,6 +8843,7 @@ uint32_t dot11f_unpack_ie_decriptor_element(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_decriptor_element,
 				IES_decriptor_element,
+				DOT11F_IE_INDEX(IES_decriptor_element),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -9763,6 +10014,15 @@ static const tIEDefn IES_mlo_ie[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_mlo_ie_index = {
+	.eid = {
+		[0] = 1, /* sta_profile */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_mlo_ie(tpAniSirGlobal pCtx,
 				 uint8_t *pBuf,
 				 uint8_t ielen,
@@ -9901,6 +10161,7 @@ uint32_t dot11f_unpack_ie_mlo_ie(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_mlo_ie,
 				IES_mlo_ie,
+				DOT11F_IE_INDEX(IES_mlo_ie),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -10667,6 +10928,16 @@ static const tIEDefn IES_vendor_vht_ie[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_vendor_vht_ie_index = {
+	.eid = {
+		[191] = 1, /* VHTCaps */
+		[192] = 2, /* VHTOperation */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ie_vendor_vht_ie(tpAniSirGlobal pCtx,
 					 uint8_t *pBuf,
 					 uint8_t ielen,
@@ -10692,6 +10963,7 @@ uint32_t dot11f_unpack_ie_vendor_vht_ie(tpAniSirGlobal pCtx,
 				ielen,
 				FFS_vendor_vht_ie,
 				IES_vendor_vht_ie,
+				DOT11F_IE_INDEX(IES_vendor_vht_ie),
 				(uint8_t *)pDst,
 				sizeof(*pDst),
 				append_ie);
@@ -10739,6 +11011,27 @@ static const tIEDefn IES_AddTSRequest[] = {
 	4, DOT11F_EID_ESETRAFSTRMRATESET, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_AddTSRequest_oui[] = {
+	3, /* WMMTSPEC */
+	4, /* WMMTCLAS */
+	5, /* WMMTCLASPROC */
+	6, /* ESETrafStrmRateSet */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_AddTSRequest_index = {
+	.eid = {
+		[13] = 1, /* TSPEC */
+		[14] = 2, /* TCLAS */
+		[44] = 3, /* TCLASSPROC */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_AddTSRequest_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_add_ts_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fAddTSRequest *pFrm, bool append_ie)
@@ -10747,6 +11040,7 @@ uint32_t dot11f_unpack_add_ts_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_AddTSRequest, IES_AddTSRequest,
+		      DOT11F_IE_INDEX(IES_AddTSRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -10808,6 +11102,31 @@ static const tIEDefn IES_AddTSResponse[] = {
 	4, DOT11F_EID_ESETRAFSTRMMET, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_AddTSResponse_oui[] = {
+	5, /* WMMTSDelay */
+	6, /* WMMSchedule */
+	7, /* WMMTSPEC */
+	8, /* WMMTCLAS */
+	9, /* WMMTCLASPROC */
+	10, /* ESETrafStrmMet */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_AddTSResponse_index = {
+	.eid = {
+		[13] = 2, /* TSPEC */
+		[14] = 3, /* TCLAS */
+		[15] = 5, /* Schedule */
+		[43] = 1, /* TSDelay */
+		[44] = 4, /* TCLASSPROC */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_AddTSResponse_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_add_ts_response(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fAddTSResponse *pFrm, bool append_ie)
@@ -10816,6 +11135,7 @@ uint32_t dot11f_unpack_add_ts_response(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_AddTSResponse, IES_AddTSResponse,
+		      DOT11F_IE_INDEX(IES_AddTSResponse),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -10984,6 +11304,69 @@ static const tIEDefn IES_AssocRequest[] = {
 	{80, 111, 154, 29, 0}, 4, DOT11F_EID_ROAMING_CONSORTIUM_SEL, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_AssocRequest_oui[] = {
+	22, /* WAPIOpaque */
+	23, /* WAPI */
+	29, /* WPAOpaque */
+	30, /* WMMCaps */
+	31, /* WMMInfoStation */
+	32, /* WscIEOpaque */
+	33, /* ESERadMgmtCap */
+	34, /* ESEVersion */
+	35, /* P2PIEOpaque */
+	36, /* WFDIEOpaque */
+	37, /* vendor_vht_ie */
+	38, /* hs20vendor_ie */
+	39, /* qcn_ie */
+	40, /* osen_ie */
+	41, /* roaming_consortium_sel */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_AssocRequest_extn[] = {
+	14, /* fils_session */
+	15, /* fils_public_key */
+	16, /* fils_key_confirmation */
+	17, /* fils_hlp_container */
+	20, /* he_cap */
+	21, /* he_6ghz_band_cap */
+	26, /* dh_parameter_element */
+	27, /* eht_cap */
+	28, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_AssocRequest_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[33] = 4, /* PowerCaps */
+		[36] = 5, /* SuppChannels */
+		[45] = 11, /* HTCaps */
+		[46] = 7, /* QOSCapsStation */
+		[48] = 6, /* RSNOpaque */
+		[50] = 3, /* ExtSuppRates */
+		[54] = 9, /* MobilityDomain */
+		[55] = 20, /* FTInfo */
+		[59] = 10, /* SuppOperatingClasses */
+		[68] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[70] = 8, /* RRMEnabledCap */
+		[90] = 19, /* bss_max_idle_period */
+		[110] = 25, /* QosMapSet */
+		[127] = 12, /* ExtCap */
+		[191] = 13, /* VHTCaps */
+		[199] = 14, /* OperatingMode */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[242] = 26, /* fragment_ie */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_AssocRequest_oui,
+	.extn = IES_AssocRequest_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_assoc_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fAssocRequest *pFrm, bool append_ie)
@@ -10992,6 +11375,7 @@ uint32_t dot11f_unpack_assoc_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_AssocRequest, IES_AssocRequest,
+		      DOT11F_IE_INDEX(IES_AssocRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -11176,6 +11560,73 @@ static const tIEDefn IES_AssocResponse[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_REDUCED_NEIGHBOR_REPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_AssocResponse_oui[] = {
+	28, /* ESETxmitPower */
+	34, /* WPA */
+	35, /* WMMParams */
+	36, /* WMMCaps */
+	37, /* ESERadMgmtCap */
+	38, /* ESETrafStrmMet */
+	39, /* WMMTSPEC */
+	40, /* WscAssocRes */
+	41, /* P2PAssocRes */
+	42, /* vendor_vht_ie */
+	43, /* qcn_ie */
+	44, /* MBO_IE */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_AssocResponse_extn[] = {
+	18, /* fils_session */
+	19, /* fils_public_key */
+	20, /* fils_key_confirmation */
+	21, /* fils_hlp_container */
+	22, /* he_cap */
+	23, /* he_op */
+	24, /* bss_color_change */
+	25, /* mu_edca_param_set */
+	26, /* he_6ghz_band_cap */
+	30, /* fils_kde */
+	31, /* eht_cap */
+	32, /* eht_op */
+	33, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_AssocResponse_index = {
+	.eid = {
+		[1] = 1, /* SuppRates */
+		[12] = 3, /* EDCAParamSet */
+		[45] = 10, /* HTCaps */
+		[50] = 2, /* ExtSuppRates */
+		[53] = 4, /* RCPIIE */
+		[54] = 7, /* MobilityDomain */
+		[55] = 8, /* FTInfo */
+		[56] = 9, /* TimeoutInterval */
+		[57] = 28, /* RICDataDesc */
+		[61] = 11, /* HTInfo */
+		[65] = 5, /* RSNIIE */
+		[70] = 6, /* RRMEnabledCap */
+		[74] = 12, /* OBSSScanParameters */
+		[90] = 14, /* bss_max_idle_period */
+		[110] = 15, /* QosMapSet */
+		[127] = 13, /* ExtCap */
+		[150] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 16, /* VHTCaps */
+		[192] = 17, /* VHTOperation */
+		[199] = 18, /* OperatingMode */
+		[201] = 46, /* reduced_neighbor_report */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[242] = 30, /* fragment_ie */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_AssocResponse_oui,
+	.extn = IES_AssocResponse_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_assoc_response(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fAssocResponse *pFrm, bool append_ie)
@@ -11184,6 +11635,7 @@ uint32_t dot11f_unpack_assoc_response(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_AssocResponse, IES_AssocResponse,
+		      DOT11F_IE_INDEX(IES_AssocResponse),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -11247,6 +11699,31 @@ static const tIEDefn IES_Authentication[] = {
 	0, DOT11F_EID_MLO_IE, 107, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_Authentication_extn[] = {
+	6, /* fils_nonce */
+	7, /* fils_session */
+	8, /* fils_wrapped_data */
+	9, /* fils_assoc_delay_info */
+	10, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_Authentication_index = {
+	.eid = {
+		[16] = 1, /* ChallengeText */
+		[48] = 2, /* RSNOpaque */
+		[54] = 3, /* MobilityDomain */
+		[55] = 4, /* FTInfo */
+		[56] = 5, /* TimeoutInterval */
+		[57] = 6, /* RICDataDesc */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.extn = IES_Authentication_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_authentication(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fAuthentication *pFrm, bool append_ie)
@@ -11255,6 +11732,7 @@ uint32_t dot11f_unpack_authentication(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_Authentication, IES_Authentication,
+		      DOT11F_IE_INDEX(IES_Authentication),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -11496,6 +11974,93 @@ static const tIEDefn IES_Beacon[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_REDUCED_NEIGHBOR_REPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_Beacon_oui[] = {
+	44, /* ESETxmitPower */
+	49, /* WPA */
+	50, /* WMMInfoAp */
+	51, /* WMMParams */
+	52, /* WMMCaps */
+	53, /* ESEVersion */
+	54, /* ESERadMgmtCap */
+	55, /* ESETrafStrmMet */
+	56, /* WscBeacon */
+	57, /* P2PBeacon */
+	58, /* Vendor1IE */
+	59, /* vendor_vht_ie */
+	60, /* Vendor3IE */
+	61, /* hs20vendor_ie */
+	62, /* QComVendorIE */
+	63, /* MBO_IE */
+	64, /* qcn_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_Beacon_extn[] = {
+	35, /* max_chan_switch_time */
+	36, /* esp_information */
+	37, /* he_cap */
+	38, /* he_op */
+	39, /* bss_color_change */
+	40, /* mu_edca_param_set */
+	41, /* he_6ghz_band_cap */
+	46, /* eht_cap */
+	47, /* eht_op */
+	48, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_Beacon_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[2] = 3, /* FHParamSet */
+		[3] = 4, /* DSParams */
+		[4] = 5, /* CFParams */
+		[5] = 6, /* TIM */
+		[7] = 7, /* Country */
+		[8] = 8, /* FHParams */
+		[9] = 9, /* FHPattTable */
+		[11] = 17, /* QBSSLoad */
+		[12] = 18, /* EDCAParamSet */
+		[32] = 10, /* PowerConstraints */
+		[35] = 13, /* TPCReport */
+		[37] = 11, /* ChanSwitchAnn */
+		[40] = 12, /* Quiet */
+		[42] = 14, /* ERPInfo */
+		[45] = 25, /* HTCaps */
+		[46] = 19, /* QOSCapsAp */
+		[48] = 16, /* RSN */
+		[50] = 15, /* ExtSuppRates */
+		[51] = 20, /* APChannelReport */
+		[54] = 22, /* MobilityDomain */
+		[59] = 24, /* SuppOperatingClasses */
+		[60] = 23, /* ext_chan_switch_ann */
+		[61] = 26, /* HTInfo */
+		[62] = 43, /* sec_chan_offset_ele */
+		[68] = 44, /* WAPI */
+		[70] = 21, /* RRMEnabledCap */
+		[74] = 27, /* OBSSScanParameters */
+		[127] = 28, /* ExtCap */
+		[150] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 29, /* VHTCaps */
+		[192] = 30, /* VHTOperation */
+		[193] = 33, /* VHTExtBssLoad */
+		[194] = 46, /* WiderBWChanSwitchAnn */
+		[195] = 31, /* transmit_power_env */
+		[196] = 32, /* ChannelSwitchWrapper */
+		[199] = 34, /* OperatingMode */
+		[201] = 66, /* reduced_neighbor_report */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[240] = 35, /* fils_indication */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_Beacon_oui,
+	.extn = IES_Beacon_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_beacon(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fBeacon *pFrm, bool append_ie)
@@ -11504,6 +12069,7 @@ uint32_t dot11f_unpack_beacon(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_Beacon, IES_Beacon,
+		      DOT11F_IE_INDEX(IES_Beacon),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -11532,6 +12098,17 @@ static const tIEDefn IES_Beacon1[] = {
 	0, DOT11F_EID_DSPARAMS, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_Beacon1_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[3] = 3, /* DSParams */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_beacon1(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fBeacon1 *pFrm, bool append_ie)
@@ -11540,6 +12117,7 @@ uint32_t dot11f_unpack_beacon1(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_Beacon1, IES_Beacon1,
+		      DOT11F_IE_INDEX(IES_Beacon1),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -11745,6 +12323,82 @@ static const tIEDefn IES_Beacon2[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_REDUCED_NEIGHBOR_REPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_Beacon2_oui[] = {
+	34, /* ESETxmitPower */
+	39, /* WPA */
+	40, /* WMMInfoAp */
+	41, /* WMMParams */
+	42, /* WMMCaps */
+	43, /* ESERadMgmtCap */
+	44, /* ESETrafStrmMet */
+	45, /* WscBeacon */
+	46, /* P2PBeacon */
+	47, /* Vendor1IE */
+	48, /* vendor_vht_ie */
+	49, /* Vendor3IE */
+	50, /* hs20vendor_ie */
+	51, /* QComVendorIE */
+	52, /* ESEVersion */
+	53, /* qcn_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_Beacon2_extn[] = {
+	25, /* max_chan_switch_time */
+	26, /* esp_information */
+	27, /* he_cap */
+	28, /* he_op */
+	29, /* bss_color_change */
+	30, /* mu_edca_param_set */
+	31, /* he_6ghz_band_cap */
+	36, /* eht_cap */
+	37, /* eht_op */
+	38, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_Beacon2_index = {
+	.eid = {
+		[7] = 1, /* Country */
+		[12] = 9, /* EDCAParamSet */
+		[32] = 2, /* PowerConstraints */
+		[35] = 5, /* TPCReport */
+		[37] = 3, /* ChanSwitchAnn */
+		[40] = 4, /* Quiet */
+		[42] = 6, /* ERPInfo */
+		[45] = 15, /* HTCaps */
+		[48] = 8, /* RSNOpaque */
+		[50] = 7, /* ExtSuppRates */
+		[51] = 10, /* APChannelReport */
+		[54] = 12, /* MobilityDomain */
+		[59] = 14, /* SuppOperatingClasses */
+		[60] = 13, /* ext_chan_switch_ann */
+		[61] = 16, /* HTInfo */
+		[62] = 33, /* sec_chan_offset_ele */
+		[68] = 34, /* WAPI */
+		[70] = 11, /* RRMEnabledCap */
+		[74] = 17, /* OBSSScanParameters */
+		[127] = 18, /* ExtCap */
+		[150] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 19, /* VHTCaps */
+		[192] = 20, /* VHTOperation */
+		[193] = 23, /* VHTExtBssLoad */
+		[194] = 36, /* WiderBWChanSwitchAnn */
+		[195] = 21, /* transmit_power_env */
+		[196] = 22, /* ChannelSwitchWrapper */
+		[199] = 24, /* OperatingMode */
+		[201] = 55, /* reduced_neighbor_report */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[240] = 25, /* fils_indication */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_Beacon2_oui,
+	.extn = IES_Beacon2_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_beacon2(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fBeacon2 *pFrm, bool append_ie)
@@ -11753,6 +12407,7 @@ uint32_t dot11f_unpack_beacon2(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_Beacon2, IES_Beacon2,
+		      DOT11F_IE_INDEX(IES_Beacon2),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -11994,6 +12649,93 @@ static const tIEDefn IES_BeaconIEs[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_REDUCED_NEIGHBOR_REPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_BeaconIEs_oui[] = {
+	44, /* ESETxmitPower */
+	49, /* WPA */
+	50, /* WMMInfoAp */
+	51, /* WMMParams */
+	52, /* WMMCaps */
+	53, /* ESEVersion */
+	54, /* ESERadMgmtCap */
+	55, /* ESETrafStrmMet */
+	56, /* WscBeaconProbeRes */
+	57, /* P2PBeaconProbeRes */
+	58, /* Vendor1IE */
+	59, /* vendor_vht_ie */
+	60, /* Vendor3IE */
+	61, /* hs20vendor_ie */
+	62, /* QComVendorIE */
+	63, /* MBO_IE */
+	64, /* qcn_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_BeaconIEs_extn[] = {
+	35, /* max_chan_switch_time */
+	36, /* esp_information */
+	37, /* he_cap */
+	38, /* he_op */
+	39, /* bss_color_change */
+	40, /* mu_edca_param_set */
+	41, /* he_6ghz_band_cap */
+	46, /* eht_cap */
+	47, /* eht_op */
+	48, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_BeaconIEs_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[2] = 3, /* FHParamSet */
+		[3] = 4, /* DSParams */
+		[4] = 5, /* CFParams */
+		[5] = 6, /* TIM */
+		[7] = 7, /* Country */
+		[8] = 8, /* FHParams */
+		[9] = 9, /* FHPattTable */
+		[11] = 17, /* QBSSLoad */
+		[12] = 18, /* EDCAParamSet */
+		[32] = 10, /* PowerConstraints */
+		[35] = 13, /* TPCReport */
+		[37] = 11, /* ChanSwitchAnn */
+		[40] = 12, /* Quiet */
+		[42] = 14, /* ERPInfo */
+		[45] = 25, /* HTCaps */
+		[46] = 19, /* QOSCapsAp */
+		[48] = 16, /* RSN */
+		[50] = 15, /* ExtSuppRates */
+		[51] = 20, /* APChannelReport */
+		[54] = 22, /* MobilityDomain */
+		[59] = 24, /* SuppOperatingClasses */
+		[60] = 23, /* ext_chan_switch_ann */
+		[61] = 26, /* HTInfo */
+		[62] = 43, /* sec_chan_offset_ele */
+		[68] = 44, /* WAPI */
+		[70] = 21, /* RRMEnabledCap */
+		[74] = 27, /* OBSSScanParameters */
+		[127] = 28, /* ExtCap */
+		[150] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 29, /* VHTCaps */
+		[192] = 30, /* VHTOperation */
+		[193] = 33, /* VHTExtBssLoad */
+		[194] = 46, /* WiderBWChanSwitchAnn */
+		[195] = 31, /* transmit_power_env */
+		[196] = 32, /* ChannelSwitchWrapper */
+		[199] = 34, /* OperatingMode */
+		[201] = 66, /* reduced_neighbor_report */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[240] = 35, /* fils_indication */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_BeaconIEs_oui,
+	.extn = IES_BeaconIEs_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_beacon_i_es(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fBeaconIEs *pFrm, bool append_ie)
@@ -12002,6 +12744,7 @@ uint32_t dot11f_unpack_beacon_i_es(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_BeaconIEs, IES_BeaconIEs,
+		      DOT11F_IE_INDEX(IES_BeaconIEs),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12032,6 +12775,17 @@ static const tIEDefn IES_ChannelSwitch[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_WIDERBWCHANSWITCHANN, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_ChannelSwitch_index = {
+	.eid = {
+		[37] = 1, /* ChanSwitchAnn */
+		[62] = 2, /* sec_chan_offset_ele */
+		[194] = 3, /* WiderBWChanSwitchAnn */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_channel_switch(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fChannelSwitch *pFrm, bool append_ie)
@@ -12040,6 +12794,7 @@ uint32_t dot11f_unpack_channel_switch(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ChannelSwitch, IES_ChannelSwitch,
+		      DOT11F_IE_INDEX(IES_ChannelSwitch),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12059,6 +12814,21 @@ static const tIEDefn IES_DeAuth[] = {
 	4, DOT11F_EID_P2PDEAUTH, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_DeAuth_oui[] = {
+	0, /* P2PDeAuth */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_DeAuth_index = {
+	.eid = {
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_DeAuth_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_de_auth(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fDeAuth *pFrm, bool append_ie)
@@ -12067,6 +12837,7 @@ uint32_t dot11f_unpack_de_auth(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_DeAuth, IES_DeAuth,
+		      DOT11F_IE_INDEX(IES_DeAuth),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12089,6 +12860,15 @@ static const tFFDefn FFS_DelTS[] = {
 static const tIEDefn IES_DelTS[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_DelTS_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_del_ts(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fDelTS *pFrm, bool append_ie)
@@ -12097,6 +12877,7 @@ uint32_t dot11f_unpack_del_ts(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_DelTS, IES_DelTS,
+		      DOT11F_IE_INDEX(IES_DelTS),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12117,6 +12898,21 @@ static const tIEDefn IES_Disassociation[] = {
 	4, DOT11F_EID_P2PDISASSOC, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_Disassociation_oui[] = {
+	0, /* P2PDisAssoc */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_Disassociation_index = {
+	.eid = {
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_Disassociation_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_disassociation(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fDisassociation *pFrm, bool append_ie)
@@ -12125,6 +12921,7 @@ uint32_t dot11f_unpack_disassociation(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_Disassociation, IES_Disassociation,
+		      DOT11F_IE_INDEX(IES_Disassociation),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12161,6 +12958,15 @@ static const tFFDefn FFS_LinkMeasurementReport[] = {
 static const tIEDefn IES_LinkMeasurementReport[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_LinkMeasurementReport_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_link_measurement_report(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fLinkMeasurementReport *pFrm, bool append_ie)
@@ -12169,6 +12975,7 @@ uint32_t dot11f_unpack_link_measurement_report(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_LinkMeasurementReport, IES_LinkMeasurementReport,
+		      DOT11F_IE_INDEX(IES_LinkMeasurementReport),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12193,6 +13000,15 @@ static const tFFDefn FFS_LinkMeasurementRequest[] = {
 static const tIEDefn IES_LinkMeasurementRequest[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_LinkMeasurementRequest_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_link_measurement_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fLinkMeasurementRequest *pFrm, bool append_ie)
@@ -12201,6 +13017,7 @@ uint32_t dot11f_unpack_link_measurement_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_LinkMeasurementRequest, IES_LinkMeasurementRequest,
+		      DOT11F_IE_INDEX(IES_LinkMeasurementRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12225,6 +13042,15 @@ static const tIEDefn IES_MeasurementReport[] = {
 	0, DOT11F_EID_MEASUREMENTREPORT, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_MeasurementReport_index = {
+	.eid = {
+		[39] = 1, /* MeasurementReport */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_measurement_report(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fMeasurementReport *pFrm, bool append_ie)
@@ -12233,6 +13059,7 @@ uint32_t dot11f_unpack_measurement_report(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_MeasurementReport, IES_MeasurementReport,
+		      DOT11F_IE_INDEX(IES_MeasurementReport),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12258,6 +13085,15 @@ static const tIEDefn IES_MeasurementRequest[] = {
 	0, DOT11F_EID_MEASUREMENTREQUEST, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_MeasurementRequest_index = {
+	.eid = {
+		[38] = 1, /* MeasurementRequest */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_measurement_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fMeasurementRequest *pFrm, bool append_ie)
@@ -12266,6 +13102,7 @@ uint32_t dot11f_unpack_measurement_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_MeasurementRequest, IES_MeasurementRequest,
+		      DOT11F_IE_INDEX(IES_MeasurementRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12289,6 +13126,15 @@ static const tIEDefn IES_NeighborReportRequest[] = {
 	0, DOT11F_EID_SSID, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_NeighborReportRequest_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_neighbor_report_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fNeighborReportRequest *pFrm, bool append_ie)
@@ -12297,6 +13143,7 @@ uint32_t dot11f_unpack_neighbor_report_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_NeighborReportRequest, IES_NeighborReportRequest,
+		      DOT11F_IE_INDEX(IES_NeighborReportRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12322,6 +13169,15 @@ static const tIEDefn IES_NeighborReportResponse[] = {
 	0, DOT11F_EID_NEIGHBORREPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_NeighborReportResponse_index = {
+	.eid = {
+		[52] = 1, /* NeighborReport */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_neighbor_report_response(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fNeighborReportResponse *pFrm, bool append_ie)
@@ -12330,6 +13186,7 @@ uint32_t dot11f_unpack_neighbor_report_response(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_NeighborReportResponse, IES_NeighborReportResponse,
+		      DOT11F_IE_INDEX(IES_NeighborReportResponse),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12350,6 +13207,15 @@ static const tFFDefn FFS_OperatingMode[] = {
 static const tIEDefn IES_OperatingMode[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_OperatingMode_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_operating_mode(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fOperatingMode *pFrm, bool append_ie)
@@ -12358,6 +13224,7 @@ uint32_t dot11f_unpack_operating_mode(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_OperatingMode, IES_OperatingMode,
+		      DOT11F_IE_INDEX(IES_OperatingMode),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12424,6 +13291,42 @@ static const tIEDefn IES_ProbeRequest[] = {
 	4, DOT11F_EID_QCN_IE, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_ProbeRequest_oui[] = {
+	12, /* WscProbeReq */
+	13, /* WFATPC */
+	14, /* P2PProbeReq */
+	15, /* qcn_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_ProbeRequest_extn[] = {
+	8, /* he_cap */
+	9, /* he_6ghz_band_cap */
+	10, /* eht_cap */
+	11, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_ProbeRequest_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[3] = 5, /* DSParams */
+		[10] = 3, /* RequestedInfo */
+		[45] = 6, /* HTCaps */
+		[50] = 4, /* ExtSuppRates */
+		[127] = 7, /* ExtCap */
+		[191] = 8, /* VHTCaps */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_ProbeRequest_oui,
+	.extn = IES_ProbeRequest_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_probe_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fProbeRequest *pFrm, bool append_ie)
@@ -12432,6 +13335,7 @@ uint32_t dot11f_unpack_probe_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ProbeRequest, IES_ProbeRequest,
+		      DOT11F_IE_INDEX(IES_ProbeRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12671,6 +13575,89 @@ static const tIEDefn IES_ProbeResponse[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_REDUCED_NEIGHBOR_REPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_ProbeResponse_oui[] = {
+	41, /* ESETxmitPower */
+	45, /* WPA */
+	46, /* WMMInfoAp */
+	47, /* WMMParams */
+	48, /* WMMCaps */
+	49, /* ESEVersion */
+	50, /* ESERadMgmtCap */
+	51, /* ESETrafStrmMet */
+	52, /* WscProbeRes */
+	53, /* P2PProbeRes */
+	54, /* Vendor1IE */
+	55, /* vendor_vht_ie */
+	56, /* Vendor3IE */
+	57, /* hs20vendor_ie */
+	58, /* QComVendorIE */
+	59, /* MBO_IE */
+	60, /* qcn_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_ProbeResponse_extn[] = {
+	32, /* max_chan_switch_time */
+	33, /* esp_information */
+	34, /* he_cap */
+	35, /* he_op */
+	36, /* bss_color_change */
+	37, /* mu_edca_param_set */
+	38, /* he_6ghz_band_cap */
+	42, /* eht_cap */
+	43, /* eht_op */
+	44, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_ProbeResponse_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[2] = 3, /* FHParamSet */
+		[3] = 4, /* DSParams */
+		[4] = 5, /* CFParams */
+		[7] = 6, /* Country */
+		[8] = 7, /* FHParams */
+		[9] = 8, /* FHPattTable */
+		[11] = 16, /* QBSSLoad */
+		[12] = 17, /* EDCAParamSet */
+		[32] = 9, /* PowerConstraints */
+		[35] = 12, /* TPCReport */
+		[37] = 10, /* ChanSwitchAnn */
+		[40] = 11, /* Quiet */
+		[42] = 13, /* ERPInfo */
+		[45] = 23, /* HTCaps */
+		[48] = 15, /* RSNOpaque */
+		[50] = 14, /* ExtSuppRates */
+		[51] = 19, /* APChannelReport */
+		[54] = 20, /* MobilityDomain */
+		[59] = 22, /* SuppOperatingClasses */
+		[60] = 21, /* ext_chan_switch_ann */
+		[61] = 24, /* HTInfo */
+		[62] = 40, /* sec_chan_offset_ele */
+		[68] = 41, /* WAPI */
+		[70] = 18, /* RRMEnabledCap */
+		[74] = 25, /* OBSSScanParameters */
+		[127] = 26, /* ExtCap */
+		[150] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 27, /* VHTCaps */
+		[192] = 28, /* VHTOperation */
+		[193] = 31, /* VHTExtBssLoad */
+		[195] = 29, /* transmit_power_env */
+		[196] = 30, /* ChannelSwitchWrapper */
+		[201] = 62, /* reduced_neighbor_report */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[240] = 32, /* fils_indication */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_ProbeResponse_oui,
+	.extn = IES_ProbeResponse_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_probe_response(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fProbeResponse *pFrm, bool append_ie)
@@ -12679,6 +13666,7 @@ uint32_t dot11f_unpack_probe_response(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ProbeResponse, IES_ProbeResponse,
+		      DOT11F_IE_INDEX(IES_ProbeResponse),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12701,6 +13689,15 @@ static const tIEDefn IES_QosMapConfigure[] = {
 	0, DOT11F_EID_QOSMAPSET, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_QosMapConfigure_index = {
+	.eid = {
+		[110] = 1, /* QosMapSet */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_qos_map_configure(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fQosMapConfigure *pFrm, bool append_ie)
@@ -12709,6 +13706,7 @@ uint32_t dot11f_unpack_qos_map_configure(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_QosMapConfigure, IES_QosMapConfigure,
+		      DOT11F_IE_INDEX(IES_QosMapConfigure),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12734,6 +13732,15 @@ static const tIEDefn IES_RadioMeasurementReport[] = {
 	0, DOT11F_EID_MEASUREMENTREPORT, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_RadioMeasurementReport_index = {
+	.eid = {
+		[39] = 1, /* MeasurementReport */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_radio_measurement_report(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fRadioMeasurementReport *pFrm, bool append_ie)
@@ -12742,6 +13749,7 @@ uint32_t dot11f_unpack_radio_measurement_report(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_RadioMeasurementReport, IES_RadioMeasurementReport,
+		      DOT11F_IE_INDEX(IES_RadioMeasurementReport),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12770,6 +13778,15 @@ static const tIEDefn IES_RadioMeasurementRequest[] = {
 	0, DOT11F_EID_MEASUREMENTREQUEST, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_RadioMeasurementRequest_index = {
+	.eid = {
+		[38] = 1, /* MeasurementRequest */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_radio_measurement_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fRadioMeasurementRequest *pFrm, bool append_ie)
@@ -12778,6 +13795,7 @@ uint32_t dot11f_unpack_radio_measurement_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_RadioMeasurementRequest, IES_RadioMeasurementRequest,
+		      DOT11F_IE_INDEX(IES_RadioMeasurementRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -12937,6 +13955,65 @@ static const tIEDefn IES_ReAssocRequest[] = {
 	4, DOT11F_EID_HS20VENDOR_IE, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_ReAssocRequest_oui[] = {
+	19, /* WAPIOpaque */
+	20, /* WAPI */
+	22, /* ESECckmOpaque */
+	25, /* WPAOpaque */
+	26, /* WMMCaps */
+	27, /* WMMInfoStation */
+	28, /* WscIEOpaque */
+	29, /* ESERadMgmtCap */
+	30, /* ESEVersion */
+	31, /* WMMTSPEC */
+	32, /* ESETrafStrmRateSet */
+	33, /* P2PIEOpaque */
+	34, /* WFDIEOpaque */
+	35, /* vendor_vht_ie */
+	36, /* hs20vendor_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_ReAssocRequest_extn[] = {
+	17, /* he_cap */
+	18, /* he_6ghz_band_cap */
+	23, /* eht_cap */
+	24, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_ReAssocRequest_index = {
+	.eid = {
+		[0] = 1, /* SSID */
+		[1] = 2, /* SuppRates */
+		[33] = 4, /* PowerCaps */
+		[36] = 5, /* SuppChannels */
+		[45] = 13, /* HTCaps */
+		[46] = 7, /* QOSCapsStation */
+		[48] = 6, /* RSNOpaque */
+		[50] = 3, /* ExtSuppRates */
+		[54] = 9, /* MobilityDomain */
+		[55] = 10, /* FTInfo */
+		[57] = 11, /* RICDataDesc */
+		[59] = 12, /* SuppOperatingClasses */
+		[68] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[70] = 8, /* RRMEnabledCap */
+		[90] = 17, /* bss_max_idle_period */
+		[110] = 22, /* QosMapSet */
+		[127] = 14, /* ExtCap */
+		[156] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 15, /* VHTCaps */
+		[199] = 16, /* OperatingMode */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_ReAssocRequest_oui,
+	.extn = IES_ReAssocRequest_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_re_assoc_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fReAssocRequest *pFrm, bool append_ie)
@@ -12945,6 +14022,7 @@ uint32_t dot11f_unpack_re_assoc_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ReAssocRequest, IES_ReAssocRequest,
+		      DOT11F_IE_INDEX(IES_ReAssocRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13112,6 +14190,67 @@ static const tIEDefn IES_ReAssocResponse[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_REDUCED_NEIGHBOR_REPORT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_ReAssocResponse_oui[] = {
+	25, /* ESETxmitPower */
+	29, /* WPA */
+	30, /* WMMParams */
+	31, /* ESERadMgmtCap */
+	32, /* ESETrafStrmMet */
+	33, /* WMMTSPEC */
+	34, /* ESETrafStrmRateSet */
+	35, /* WscReassocRes */
+	36, /* P2PAssocRes */
+	37, /* vendor_vht_ie */
+	38, /* MBO_IE */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_ReAssocResponse_extn[] = {
+	19, /* he_cap */
+	20, /* he_op */
+	21, /* bss_color_change */
+	22, /* mu_edca_param_set */
+	23, /* he_6ghz_band_cap */
+	26, /* eht_cap */
+	27, /* eht_op */
+	28, /* mlo_ie */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_ReAssocResponse_index = {
+	.eid = {
+		[1] = 1, /* SuppRates */
+		[12] = 3, /* EDCAParamSet */
+		[45] = 12, /* HTCaps */
+		[48] = 7, /* RSNOpaque */
+		[50] = 2, /* ExtSuppRates */
+		[53] = 4, /* RCPIIE */
+		[54] = 8, /* MobilityDomain */
+		[55] = 9, /* FTInfo */
+		[56] = 11, /* TimeoutInterval */
+		[57] = 10, /* RICDataDesc */
+		[61] = 13, /* HTInfo */
+		[65] = 5, /* RSNIIE */
+		[70] = 6, /* RRMEnabledCap */
+		[74] = 14, /* OBSSScanParameters */
+		[90] = 16, /* bss_max_idle_period */
+		[110] = 25, /* QosMapSet */
+		[127] = 15, /* ExtCap */
+		[150] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[191] = 17, /* VHTCaps */
+		[192] = 18, /* VHTOperation */
+		[199] = 19, /* OperatingMode */
+		[201] = 40, /* reduced_neighbor_report */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_ReAssocResponse_oui,
+	.extn = IES_ReAssocResponse_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_re_assoc_response(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fReAssocResponse *pFrm, bool append_ie)
@@ -13120,6 +14259,7 @@ uint32_t dot11f_unpack_re_assoc_response(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ReAssocResponse, IES_ReAssocResponse,
+		      DOT11F_IE_INDEX(IES_ReAssocResponse),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13140,6 +14280,15 @@ static const tFFDefn FFS_SMPowerSave[] = {
 static const tIEDefn IES_SMPowerSave[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_SMPowerSave_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_sm_power_save(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fSMPowerSave *pFrm, bool append_ie)
@@ -13148,6 +14297,7 @@ uint32_t dot11f_unpack_sm_power_save(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_SMPowerSave, IES_SMPowerSave,
+		      DOT11F_IE_INDEX(IES_SMPowerSave),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13170,6 +14320,21 @@ static const tIEDefn IES_SaQueryReq[] = {
 	"oci", 0, 5, 5, SigIeoci, {0, 0, 0, 0, 0}, 0, DOT11F_EID_OCI, 54, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_SaQueryReq_extn[] = {
+	0, /* oci */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_SaQueryReq_index = {
+	.eid = {
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.extn = IES_SaQueryReq_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_sa_query_req(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fSaQueryReq *pFrm, bool append_ie)
@@ -13178,6 +14343,7 @@ uint32_t dot11f_unpack_sa_query_req(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_SaQueryReq, IES_SaQueryReq,
+		      DOT11F_IE_INDEX(IES_SaQueryReq),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13200,6 +14366,21 @@ static const tIEDefn IES_SaQueryRsp[] = {
 	"oci", 0, 5, 5, SigIeoci, {0, 0, 0, 0, 0}, 0, DOT11F_EID_OCI, 54, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_SaQueryRsp_extn[] = {
+	0, /* oci */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_SaQueryRsp_index = {
+	.eid = {
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.extn = IES_SaQueryRsp_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_sa_query_rsp(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fSaQueryRsp *pFrm, bool append_ie)
@@ -13208,6 +14389,7 @@ uint32_t dot11f_unpack_sa_query_rsp(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_SaQueryRsp, IES_SaQueryRsp,
+		      DOT11F_IE_INDEX(IES_SaQueryRsp),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13232,6 +14414,15 @@ static const tIEDefn IES_TDLSDisReq[] = {
 	0, DOT11F_EID_LINKIDENTIFIER, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_TDLSDisReq_index = {
+	.eid = {
+		[101] = 1, /* LinkIdentifier */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_dis_req(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSDisReq *pFrm, bool append_ie)
@@ -13240,6 +14431,7 @@ uint32_t dot11f_unpack_tdls_dis_req(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSDisReq, IES_TDLSDisReq,
+		      DOT11F_IE_INDEX(IES_TDLSDisReq),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13309,6 +14501,34 @@ static const tIEDefn IES_TDLSDisRsp[] = {
 	0, DOT11F_EID_HE_CAP, 35, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_TDLSDisRsp_extn[] = {
+	13, /* he_cap */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_TDLSDisRsp_index = {
+	.eid = {
+		[1] = 1, /* SuppRates */
+		[36] = 3, /* SuppChannels */
+		[45] = 10, /* HTCaps */
+		[48] = 5, /* RSN */
+		[50] = 2, /* ExtSuppRates */
+		[55] = 7, /* FTInfo */
+		[56] = 8, /* TimeoutInterval */
+		[57] = 9, /* RICData */
+		[59] = 4, /* SuppOperatingClasses */
+		[72] = 11, /* ht2040_bss_coexistence */
+		[101] = 12, /* LinkIdentifier */
+		[127] = 6, /* ExtCap */
+		[191] = 13, /* VHTCaps */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.extn = IES_TDLSDisRsp_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_dis_rsp(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSDisRsp *pFrm, bool append_ie)
@@ -13317,6 +14537,7 @@ uint32_t dot11f_unpack_tdls_dis_rsp(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSDisRsp, IES_TDLSDisRsp,
+		      DOT11F_IE_INDEX(IES_TDLSDisRsp),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13349,6 +14570,17 @@ static const tIEDefn IES_TDLSPeerTrafficInd[] = {
 	0, DOT11F_EID_PUBUFFERSTATUS, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_TDLSPeerTrafficInd_index = {
+	.eid = {
+		[101] = 1, /* LinkIdentifier */
+		[105] = 2, /* PTIControl */
+		[106] = 3, /* PUBufferStatus */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_peer_traffic_ind(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSPeerTrafficInd *pFrm, bool append_ie)
@@ -13357,6 +14589,7 @@ uint32_t dot11f_unpack_tdls_peer_traffic_ind(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSPeerTrafficInd, IES_TDLSPeerTrafficInd,
+		      DOT11F_IE_INDEX(IES_TDLSPeerTrafficInd),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13381,6 +14614,15 @@ static const tIEDefn IES_TDLSPeerTrafficRsp[] = {
 	0, DOT11F_EID_LINKIDENTIFIER, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_TDLSPeerTrafficRsp_index = {
+	.eid = {
+		[101] = 1, /* LinkIdentifier */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_peer_traffic_rsp(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSPeerTrafficRsp *pFrm, bool append_ie)
@@ -13389,6 +14631,7 @@ uint32_t dot11f_unpack_tdls_peer_traffic_rsp(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSPeerTrafficRsp, IES_TDLSPeerTrafficRsp,
+		      DOT11F_IE_INDEX(IES_TDLSPeerTrafficRsp),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13445,6 +14688,36 @@ static const tIEDefn IES_TDLSSetupCnf[] = {
 	0, DOT11F_EID_HE_OP, 36, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_TDLSSetupCnf_oui[] = {
+	6, /* WMMParams */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_TDLSSetupCnf_extn[] = {
+	9, /* he_op */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_TDLSSetupCnf_index = {
+	.eid = {
+		[12] = 2, /* EDCAParamSet */
+		[48] = 1, /* RSN */
+		[55] = 3, /* FTInfo */
+		[56] = 4, /* TimeoutInterval */
+		[61] = 5, /* HTInfo */
+		[101] = 6, /* LinkIdentifier */
+		[192] = 8, /* VHTOperation */
+		[199] = 9, /* OperatingMode */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_TDLSSetupCnf_oui,
+	.extn = IES_TDLSSetupCnf_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_setup_cnf(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSSetupCnf *pFrm, bool append_ie)
@@ -13453,6 +14726,7 @@ uint32_t dot11f_unpack_tdls_setup_cnf(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSSetupCnf, IES_TDLSSetupCnf,
+		      DOT11F_IE_INDEX(IES_TDLSSetupCnf),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13539,6 +14813,45 @@ static const tIEDefn IES_TDLSSetupReq[] = {
 	0, DOT11F_EID_HE_6GHZ_BAND_CAP, 59, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_TDLSSetupReq_oui[] = {
+	14, /* WMMInfoStation */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_TDLSSetupReq_extn[] = {
+	17, /* he_cap */
+	18, /* he_6ghz_band_cap */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_TDLSSetupReq_index = {
+	.eid = {
+		[1] = 1, /* SuppRates */
+		[7] = 2, /* Country */
+		[36] = 4, /* SuppChannels */
+		[45] = 12, /* HTCaps */
+		[46] = 8, /* QOSCapsStation */
+		[48] = 5, /* RSN */
+		[50] = 3, /* ExtSuppRates */
+		[55] = 9, /* FTInfo */
+		[56] = 10, /* TimeoutInterval */
+		[57] = 11, /* RICData */
+		[59] = 7, /* SuppOperatingClasses */
+		[72] = 13, /* ht2040_bss_coexistence */
+		[101] = 14, /* LinkIdentifier */
+		[127] = 6, /* ExtCap */
+		[191] = 17, /* VHTCaps */
+		[197] = 16, /* AID */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_TDLSSetupReq_oui,
+	.extn = IES_TDLSSetupReq_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_setup_req(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSSetupReq *pFrm, bool append_ie)
@@ -13547,6 +14860,7 @@ uint32_t dot11f_unpack_tdls_setup_req(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSSetupReq, IES_TDLSSetupReq,
+		      DOT11F_IE_INDEX(IES_TDLSSetupReq),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13639,6 +14953,46 @@ static const tIEDefn IES_TDLSSetupRsp[] = {
 	0, DOT11F_EID_HE_6GHZ_BAND_CAP, 59, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_TDLSSetupRsp_oui[] = {
+	14, /* WMMInfoStation */
+	DOT11F_IE_INDEX_END,
+};
+
+static const uint8_t IES_TDLSSetupRsp_extn[] = {
+	18, /* he_cap */
+	19, /* he_6ghz_band_cap */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_TDLSSetupRsp_index = {
+	.eid = {
+		[1] = 1, /* SuppRates */
+		[7] = 2, /* Country */
+		[36] = 4, /* SuppChannels */
+		[45] = 12, /* HTCaps */
+		[46] = 8, /* QOSCapsStation */
+		[48] = 5, /* RSN */
+		[50] = 3, /* ExtSuppRates */
+		[55] = 9, /* FTInfo */
+		[56] = 10, /* TimeoutInterval */
+		[57] = 11, /* RICData */
+		[59] = 7, /* SuppOperatingClasses */
+		[72] = 13, /* ht2040_bss_coexistence */
+		[101] = 14, /* LinkIdentifier */
+		[127] = 6, /* ExtCap */
+		[191] = 17, /* VHTCaps */
+		[197] = 16, /* AID */
+		[199] = 18, /* OperatingMode */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.oui = IES_TDLSSetupRsp_oui,
+	.extn = IES_TDLSSetupRsp_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_setup_rsp(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSSetupRsp *pFrm, bool append_ie)
@@ -13647,6 +15001,7 @@ uint32_t dot11f_unpack_tdls_setup_rsp(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSSetupRsp, IES_TDLSSetupRsp,
+		      DOT11F_IE_INDEX(IES_TDLSSetupRsp),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13674,6 +15029,16 @@ static const tIEDefn IES_TDLSTeardown[] = {
 	0, DOT11F_EID_LINKIDENTIFIER, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_TDLSTeardown_index = {
+	.eid = {
+		[55] = 1, /* FTInfo */
+		[101] = 2, /* LinkIdentifier */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tdls_teardown(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTDLSTeardown *pFrm, bool append_ie)
@@ -13682,6 +15047,7 @@ uint32_t dot11f_unpack_tdls_teardown(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TDLSTeardown, IES_TDLSTeardown,
+		      DOT11F_IE_INDEX(IES_TDLSTeardown),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13705,6 +15071,15 @@ static const tIEDefn IES_TPCReport[] = {
 	0, DOT11F_EID_TPCREPORT, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_TPCReport_index = {
+	.eid = {
+		[35] = 1, /* TPCReport */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tpc_report(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTPCReport *pFrm, bool append_ie)
@@ -13713,6 +15088,7 @@ uint32_t dot11f_unpack_tpc_report(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TPCReport, IES_TPCReport,
+		      DOT11F_IE_INDEX(IES_TPCReport),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13736,6 +15112,15 @@ static const tIEDefn IES_TPCRequest[] = {
 	0, DOT11F_EID_TPCREQUEST, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_TPCRequest_index = {
+	.eid = {
+		[34] = 1, /* TPCRequest */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_tpc_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTPCRequest *pFrm, bool append_ie)
@@ -13744,6 +15129,7 @@ uint32_t dot11f_unpack_tpc_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TPCRequest, IES_TPCRequest,
+		      DOT11F_IE_INDEX(IES_TPCRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13784,6 +15170,26 @@ static const tIEDefn IES_TimingAdvertisementFrame[] = {
 	3, DOT11F_EID_VENDOR3IE, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_TimingAdvertisementFrame_oui[] = {
+	4, /* Vendor1IE */
+	5, /* Vendor3IE */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_TimingAdvertisementFrame_index = {
+	.eid = {
+		[7] = 1, /* Country */
+		[32] = 2, /* PowerConstraints */
+		[69] = 3, /* TimeAdvertisement */
+		[127] = 4, /* ExtCap */
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_TimingAdvertisementFrame_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_timing_advertisement_frame(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fTimingAdvertisementFrame *pFrm, bool append_ie)
@@ -13792,6 +15198,7 @@ uint32_t dot11f_unpack_timing_advertisement_frame(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_TimingAdvertisementFrame, IES_TimingAdvertisementFrame,
+		      DOT11F_IE_INDEX(IES_TimingAdvertisementFrame),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13817,6 +15224,15 @@ static const tFFDefn FFS_VHTGidManagementActionFrame[] = {
 static const tIEDefn IES_VHTGidManagementActionFrame[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_VHTGidManagementActionFrame_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_vht_gid_management_action_frame(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fVHTGidManagementActionFrame *pFrm, bool append_ie)
@@ -13825,6 +15241,7 @@ uint32_t dot11f_unpack_vht_gid_management_action_frame(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_VHTGidManagementActionFrame, IES_VHTGidManagementActionFrame,
+		      DOT11F_IE_INDEX(IES_VHTGidManagementActionFrame),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13854,6 +15271,22 @@ static const tIEDefn IES_WMMAddTSRequest[] = {
 	4, DOT11F_EID_ESETRAFSTRMRATESET, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_WMMAddTSRequest_oui[] = {
+	0, /* WMMTSPEC */
+	1, /* ESETrafStrmRateSet */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_WMMAddTSRequest_index = {
+	.eid = {
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_WMMAddTSRequest_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_wmm_add_ts_request(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fWMMAddTSRequest *pFrm, bool append_ie)
@@ -13862,6 +15295,7 @@ uint32_t dot11f_unpack_wmm_add_ts_request(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_WMMAddTSRequest, IES_WMMAddTSRequest,
+		      DOT11F_IE_INDEX(IES_WMMAddTSRequest),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13892,6 +15326,22 @@ static const tIEDefn IES_WMMAddTSResponse[] = {
 	4, DOT11F_EID_ESETRAFSTRMMET, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_WMMAddTSResponse_oui[] = {
+	0, /* WMMTSPEC */
+	1, /* ESETrafStrmMet */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_WMMAddTSResponse_index = {
+	.eid = {
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_WMMAddTSResponse_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_wmm_add_ts_response(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fWMMAddTSResponse *pFrm, bool append_ie)
@@ -13900,6 +15350,7 @@ uint32_t dot11f_unpack_wmm_add_ts_response(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_WMMAddTSResponse, IES_WMMAddTSResponse,
+		      DOT11F_IE_INDEX(IES_WMMAddTSResponse),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13925,6 +15376,21 @@ static const tIEDefn IES_WMMDelTS[] = {
 	5, DOT11F_EID_WMMTSPEC, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_WMMDelTS_oui[] = {
+	0, /* WMMTSPEC */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_WMMDelTS_index = {
+	.eid = {
+		[221] = DOT11F_IE_INDEX_OUI, /* by OUI */
+	},
+	.oui = IES_WMMDelTS_oui,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_wmm_del_ts(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fWMMDelTS *pFrm, bool append_ie)
@@ -13933,6 +15399,7 @@ uint32_t dot11f_unpack_wmm_del_ts(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_WMMDelTS, IES_WMMDelTS,
+		      DOT11F_IE_INDEX(IES_WMMDelTS),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -13963,6 +15430,15 @@ static const tIEDefn IES_addba_req[] = {
 	0, DOT11F_EID_ADDBA_EXTN_ELEMENT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_addba_req_index = {
+	.eid = {
+		[159] = 1, /* addba_extn_element */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_addba_req(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11faddba_req *pFrm, bool append_ie)
@@ -13971,6 +15447,7 @@ uint32_t dot11f_unpack_addba_req(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_addba_req, IES_addba_req,
+		      DOT11F_IE_INDEX(IES_addba_req),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14001,6 +15478,15 @@ static const tIEDefn IES_addba_rsp[] = {
 	0, DOT11F_EID_ADDBA_EXTN_ELEMENT, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_addba_rsp_index = {
+	.eid = {
+		[159] = 1, /* addba_extn_element */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_addba_rsp(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11faddba_rsp *pFrm, bool append_ie)
@@ -14009,6 +15495,7 @@ uint32_t dot11f_unpack_addba_rsp(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_addba_rsp, IES_addba_rsp,
+		      DOT11F_IE_INDEX(IES_addba_rsp),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14031,6 +15518,15 @@ static const tFFDefn FFS_delba_req[] = {
 static const tIEDefn IES_delba_req[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_delba_req_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_delba_req(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fdelba_req *pFrm, bool append_ie)
@@ -14039,6 +15535,7 @@ uint32_t dot11f_unpack_delba_req(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_delba_req, IES_delba_req,
+		      DOT11F_IE_INDEX(IES_delba_req),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14065,6 +15562,15 @@ static const tIEDefn IES_ext_channel_switch_action_frame[] = {
 	{0, 0, 0, 0, 0}, 0, DOT11F_EID_WIDERBWCHANSWITCHANN, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_ext_channel_switch_action_frame_index = {
+	.eid = {
+		[194] = 1, /* WiderBWChanSwitchAnn */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ext_channel_switch_action_frame(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fext_channel_switch_action_frame *pFrm, bool append_ie)
@@ -14073,6 +15579,7 @@ uint32_t dot11f_unpack_ext_channel_switch_action_frame(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ext_channel_switch_action_frame, IES_ext_channel_switch_action_frame,
+		      DOT11F_IE_INDEX(IES_ext_channel_switch_action_frame),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14102,6 +15609,16 @@ static const tIEDefn IES_ht2040_bss_coexistence_mgmt_action_frame[] = {
 	0, DOT11F_EID_HT2040_BSS_INTOLERANT_REPORT, 0, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_ht2040_bss_coexistence_mgmt_action_frame_index = {
+	.eid = {
+		[72] = 1, /* ht2040_bss_coexistence */
+		[73] = 2, /* ht2040_bss_intolerant_report */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_ht2040_bss_coexistence_mgmt_action_frame(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fht2040_bss_coexistence_mgmt_action_frame *pFrm, bool append_ie)
@@ -14110,6 +15627,7 @@ uint32_t dot11f_unpack_ht2040_bss_coexistence_mgmt_action_frame(tpAniSirGlobal p
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_ht2040_bss_coexistence_mgmt_action_frame, IES_ht2040_bss_coexistence_mgmt_action_frame,
+		      DOT11F_IE_INDEX(IES_ht2040_bss_coexistence_mgmt_action_frame),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14134,6 +15652,21 @@ static const tIEDefn IES_mscs_request_action_frame[] = {
 	0, DOT11F_EID_DECRIPTOR_ELEMENT, 88, 1, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const uint8_t IES_mscs_request_action_frame_extn[] = {
+	0, /* decriptor_element */
+	DOT11F_IE_INDEX_END,
+};
+
+static const struct ie_index IES_mscs_request_action_frame_index = {
+	.eid = {
+		[255] = DOT11F_IE_INDEX_EXTN, /* extension IEs */
+	},
+	.extn = IES_mscs_request_action_frame_extn,
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_mscs_request_action_frame(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fmscs_request_action_frame *pFrm, bool append_ie)
@@ -14142,6 +15675,7 @@ uint32_t dot11f_unpack_mscs_request_action_frame(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_mscs_request_action_frame, IES_mscs_request_action_frame,
+		      DOT11F_IE_INDEX(IES_mscs_request_action_frame),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14175,6 +15709,17 @@ static const tIEDefn IES_p2p_oper_chan_change_confirm[] = {
 	0, DOT11F_EID_OPERATINGMODE, 0, 0, },
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_p2p_oper_chan_change_confirm_index = {
+	.eid = {
+		[45] = 1, /* HTCaps */
+		[191] = 2, /* VHTCaps */
+		[199] = 3, /* OperatingMode */
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_p2p_oper_chan_change_confirm(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fp2p_oper_chan_change_confirm *pFrm, bool append_ie)
@@ -14183,6 +15728,7 @@ uint32_t dot11f_unpack_p2p_oper_chan_change_confirm(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_p2p_oper_chan_change_confirm, IES_p2p_oper_chan_change_confirm,
+		      DOT11F_IE_INDEX(IES_p2p_oper_chan_change_confirm),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14204,6 +15750,15 @@ static const tFFDefn FFS_vendor_action_frame[] = {
 static const tIEDefn IES_vendor_action_frame[] = {
 	{0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },};
 
+#ifdef WLAN_FEATURE_DOT11F_IE_INDEX
+/* EID index, generated by dot11f_ie_index.py */
+static const struct ie_index IES_vendor_action_frame_index = {
+	.eid = {
+		0,
+	},
+};
+#endif /* WLAN_FEATURE_DOT11F_IE_INDEX */
+
 uint32_t dot11f_unpack_vendor_action_frame(tpAniSirGlobal pCtx,
 		uint8_t *pBuf, uint32_t nBuf,
 		tDot11fvendor_action_frame *pFrm, bool append_ie)
@@ -14212,6 +15767,7 @@ uint32_t dot11f_unpack_vendor_action_frame(tpAniSirGlobal pCtx,
 	uint32_t status = 0;
 	status = unpack_core(pCtx, pBuf, nBuf,
 		      FFS_vendor_action_frame, IES_vendor_action_frame,
+		      DOT11F_IE_INDEX(IES_vendor_action_frame),
 		      (uint8_t *)pFrm, sizeof(*pFrm), append_ie);
 
 	(void)i;
@@ -14229,6 +15785,7 @@ static uint32_t unpack_core(tpAniSirGlobal pCtx,
 			    uint32_t nBuf,
 			    const tFFDefn  FFs[],
 			    const tIEDefn  IEs[],
+			    const struct ie_index *ie_idx,
 			    uint8_t *pFrm,
 			    size_t nFrm,
 			    bool append_ie)
@@ -14488,7 +16045,12 @@ static uint32_t unpack_core(tpAniSirGlobal pCtx,
 			goto MandatoryCheck;
 		}
 
-		pIe = find_ie_defn(pCtx, pBufRemaining, nBufRemaining, IEs);
+		if (ie_idx)
+			pIe = find_ie_defn_indexed(pCtx, pBufRemaining,
+						   nBufRemaining, IEs, ie_idx);
+		else
+			pIe = find_ie_defn(pCtx, pBufRemaining,
+					   nBufRemaining, IEs);
 
 		eid = *pBufRemaining++; --nBufRemaining;
 		len = *pBufRemaining++; --nBufRemaining;
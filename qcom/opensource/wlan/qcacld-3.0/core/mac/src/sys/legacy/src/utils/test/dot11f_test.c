@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "cds_api.h"
+#include "qdf_mem.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "qdf_util.h"
+#include "sir_api.h"
+#include "dot11f.h"
+#include "dot11f_test.h"
+
+#define dot11f_ut_bench_iter 2000
+
+/* beacon fixed fields: timestamp, 100 TU beacon interval, ESS | short slot */
+#define dot11f_ut_fixed_fields \
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+	0x64, 0x00, 0x01, 0x04
+
+#define dot11f_ut_supp_rates \
+	0x01, 0x08, 0x82, 0x84, 0x8b, 0x96, 0x0c, 0x12, 0x18, 0x24
+
+static const uint8_t dot11f_ut_beacon_legacy[] = {
+	dot11f_ut_fixed_fields,
+	0x00, 0x04, 'o', 'p', 'e', 'n',
+	dot11f_ut_supp_rates,
+	0x03, 0x01, 0x06,
+	0x05, 0x04, 0x00, 0x01, 0x00, 0x00,
+};
+
+static const uint8_t dot11f_ut_beacon_vht[] = {
+	dot11f_ut_fixed_fields,
+	0x00, 0x05, 'w', 'p', 'a', '2', 'x',
+	dot11f_ut_supp_rates,
+	0x03, 0x01, 0x24,
+	0x05, 0x04, 0x00, 0x01, 0x00, 0x00,
+	/* Country */
+	0x07, 0x06, 'U', 'S', 0x20, 0x24, 0x04, 0x17,
+	/* RSN: CCMP, PSK */
+	0x30, 0x14, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00,
+	0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x02,
+	0x0c, 0x00,
+	/* HT capabilities */
+	0x2d, 0x1a, 0xef, 0x09, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* HT operation */
+	0x3d, 0x16, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00,
+	/* extended capabilities */
+	0x7f, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	/* VHT capabilities */
+	0xbf, 0x0c, 0xb2, 0x01, 0x80, 0x33, 0xfa, 0xff, 0x00, 0x00,
+	0xfa, 0xff, 0x00, 0x00,
+	/* VHT operation */
+	0xc0, 0x05, 0x01, 0x2a, 0x00, 0xfa, 0xff,
+	/* WMM parameters */
+	0xdd, 0x18, 0x00, 0x50, 0xf2, 0x02, 0x01, 0x01, 0x80, 0x00,
+	0x03, 0xa4, 0x00, 0x00, 0x27, 0xa4, 0x00, 0x00, 0x42, 0x43,
+	0x5e, 0x00, 0x62, 0x32, 0x2f, 0x00,
+	/* WPA: TKIP, PSK */
+	0xdd, 0x16, 0x00, 0x50, 0xf2, 0x01, 0x01, 0x00, 0x00, 0x50,
+	0xf2, 0x04, 0x01, 0x00, 0x00, 0x50, 0xf2, 0x04, 0x01, 0x00,
+	0x00, 0x50, 0xf2, 0x02,
+	/* vendor specific IE with an unknown OUI */
+	0xdd, 0x07, 0x00, 0x11, 0x22, 0x33, 0x01, 0x02, 0x03,
+	/* max channel switch time extension IE */
+	0xff, 0x04, 0x34, 0x10, 0x00, 0x00,
+	/* unknown extension IE */
+	0xff, 0x03, 0x7f, 0x00, 0x00,
+};
+
+struct dot11f_ut_frame {
+	const uint8_t *buf;
+	uint32_t len;
+};
+
+static const struct dot11f_ut_frame dot11f_ut_beacons[] = {
+	{ dot11f_ut_beacon_legacy, sizeof(dot11f_ut_beacon_legacy) },
+	{ dot11f_ut_beacon_vht, sizeof(dot11f_ut_beacon_vht) },
+};
+
+static uint32_t dot11f_ut_unpack(tpAniSirGlobal mac, tDot11fBeacon *bcn,
+				 const struct dot11f_ut_frame *frame)
+{
+	uint32_t status;
+
+	status = dot11f_unpack_beacon(mac, (uint8_t *)frame->buf, frame->len,
+				      bcn, false);
+	if (DOT11F_FAILED(status)) {
+		qdf_nofl_alert("FAIL: dot11f_unpack_beacon() -> status 0x%x",
+			       status);
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint32_t dot11f_ut_beacon_legacy_ies(tpAniSirGlobal mac,
+					    tDot11fBeacon *bcn)
+{
+	uint32_t errors;
+
+	errors = dot11f_ut_unpack(mac, bcn, &dot11f_ut_beacons[0]);
+	if (errors)
+		return errors;
+
+	if (!bcn->SSID.present || bcn->SSID.num_ssid != 4 ||
+	    !bcn->SuppRates.present || !bcn->DSParams.present ||
+	    !bcn->TIM.present)
+		errors++;
+
+	if (bcn->RSN.present || bcn->HTCaps.present || bcn->WPA.present ||
+	    bcn->WMMParams.present || bcn->max_chan_switch_time.present)
+		errors++;
+
+	return errors;
+}
+
+static uint32_t dot11f_ut_beacon_vht_ies(tpAniSirGlobal mac,
+					 tDot11fBeacon *bcn)
+{
+	uint32_t errors;
+
+	errors = dot11f_ut_unpack(mac, bcn, &dot11f_ut_beacons[1]);
+	if (errors)
+		return errors;
+
+	if (!bcn->SSID.present || bcn->SSID.num_ssid != 5 ||
+	    !bcn->Country.present || !bcn->RSN.present)
+		errors++;
+
+	if (!bcn->HTCaps.present || !bcn->HTInfo.present ||
+	    !bcn->ExtCap.present || !bcn->VHTCaps.present ||
+	    !bcn->VHTOperation.present)
+		errors++;
+
+	/* vendor specific IEs are told apart by their OUI */
+	if (!bcn->WMMParams.present || !bcn->WPA.present ||
+	    bcn->WMMInfoAp.present || bcn->WMMCaps.present ||
+	    bcn->P2PBeacon.present || bcn->WscBeacon.present)
+		errors++;
+
+	/* and extension IEs by their extension EID */
+	if (!bcn->max_chan_switch_time.present || bcn->he_cap.present ||
+	    bcn->he_op.present || bcn->esp_information.present)
+		errors++;
+
+	return errors;
+}
+
+/**
+ * dot11f_ut_beacon_bench() - time dot11f_unpack_beacon() over the corpus
+ * @mac: MAC context
+ * @bcn: beacon to unpack into
+ *
+ * Build with and without CONFIG_WLAN_FEATURE_DOT11F_IE_INDEX to compare the
+ * EID indexed lookup with the linear one. The numbers are only printed,
+ * they depend on the platform.
+ *
+ * Return: number of failed test cases
+ */
+static uint32_t dot11f_ut_beacon_bench(tpAniSirGlobal mac, tDot11fBeacon *bcn)
+{
+	uint32_t errors = 0;
+	uint64_t elapsed_ns;
+	int64_t start;
+	uint32_t i, j;
+
+	start = qdf_ktime_to_ns(qdf_ktime_get());
+	for (i = 0; i < dot11f_ut_bench_iter; i++)
+		for (j = 0; j < QDF_ARRAY_SIZE(dot11f_ut_beacons); j++)
+			errors += dot11f_ut_unpack(mac, bcn,
+						   &dot11f_ut_beacons[j]);
+	elapsed_ns = qdf_ktime_to_ns(qdf_ktime_get()) - start;
+
+	qdf_nofl_info("dot11f: %llu ns per dot11f_unpack_beacon()",
+		      qdf_do_div(elapsed_ns, dot11f_ut_bench_iter *
+				 QDF_ARRAY_SIZE(dot11f_ut_beacons)));
+
+	return errors;
+}
+
+uint32_t dot11f_unit_test(void)
+{
+	tpAniSirGlobal mac = cds_get_context(QDF_MODULE_ID_PE);
+	tDot11fBeacon *bcn;
+	uint32_t errors = 0;
+
+	bcn = qdf_mem_malloc(sizeof(*bcn));
+	if (!bcn)
+		return 1;
+
+	errors += dot11f_ut_beacon_legacy_ies(mac, bcn);
+	errors += dot11f_ut_beacon_vht_ies(mac, bcn);
+	errors += dot11f_ut_beacon_bench(mac, bcn);
+
+	qdf_mem_free(bcn);
+	QDF_BUG(!errors);
+
+	return errors;
+}